@@ -34,6 +34,7 @@ set(OMR_EXAMPLE ON CACHE BOOL "Enable the Example application")
 
 set(OMR_TOOLS ON CACHE BOOL "Enable the native build tools")
 set(OMR_DDR OFF CACHE BOOL "Enable DDR")
+set(OMR_DDR_PARALLEL_SCAN OFF CACHE BOOL "Let ddrgen --jobs scan DWARF input files in parallel (experimental)")
 set(OMR_RAS_TDF_TRACE ON CACHE BOOL "Enable trace engine")
 set(OMR_FVTEST ON CACHE BOOL "Enable the FV Testing.")
 
@@ -292,9 +292,11 @@ function(create_omr_compiler_library)
 		${COMPILER_OBJECTS}
 	)
 
+	# The code cache identifies thread region owners with omrthread_self().
 	target_link_libraries(${COMPILER_NAME}
 		PUBLIC
 			omr_base
+			${OMR_THREAD_LIB}
 	)
 
 	# Grab the list of core compiler objects from the global property.
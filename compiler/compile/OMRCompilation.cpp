@@ -906,7 +906,9 @@ int32_t OMR::Compilation::compile()
 #endif /* defined(AIXPPC) */
 
     if (self()->getOption(TR_TraceAll) || debug("traceStartCompile") || self()->getOption(TR_Timing)) {
-        self()->getDebug()->printHeader(self()->log());
+        // timing does not require a log, so there may be no debug object
+        if (self()->getDebug())
+            self()->getDebug()->printHeader(self()->log());
 
         static char *randomExercisePeriodStr = feGetEnv("TR_randomExercisePeriod");
         if (self()->getOption(TR_Randomize) || randomExercisePeriodStr != NULL)
@@ -931,6 +933,7 @@ int32_t OMR::Compilation::compile()
 
     {
         TR::RegionProfiler rpIlgen(self()->trMemory()->heapMemoryRegion(), *self(), "comp/ilgen");
+        LexicalTimer t("ilgen", self()->phaseTimer());
         if (printCodegenTime)
             genILTime.startTiming(self());
         _ilGenSuccess = _methodSymbol->genIL(self()->fe(), self(), self()->getSymRefTab(), _ilGenRequest);
@@ -0,0 +1,87 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#ifndef COMPILATION_STATISTICS_INCL
+#define COMPILATION_STATISTICS_INCL
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace TR {
+
+/**
+ * \brief Measurements of a single compilation.
+ *
+ * Attach an instance to the TR::IlGeneratorMethodDetails of a compilation
+ * with setCompilationStatistics() and compileMethodFromDetails() fills it in
+ * once the compilation has finished, whether it succeeded or not.
+ *
+ * Phase times come from the compilation's phase timer, which only runs when
+ * the `timing` option is set. Without it recordPhase() is never called.
+ */
+class CompilationStatistics {
+public:
+    CompilationStatistics()
+        : returnCode(-1)
+        , compileMicros(0)
+        , scratchBytesAllocated(0)
+        , nodesAllocated(0)
+        , nodeBytesAllocated(0)
+        , codeStart(NULL)
+        , codeEnd(NULL)
+    {}
+
+    virtual ~CompilationStatistics() {}
+
+    /**
+     * \brief Called once for every phase meter of the compilation, parents
+     * before their children.
+     *
+     * \param name the phase name; only valid for the duration of the call
+     * \param depth nesting depth of the phase, 1 for the outermost phases
+     * \param micros total time spent in the phase
+     * \param count number of times the phase ran
+     */
+    virtual void recordPhase(const char *name, uint32_t depth, uint64_t micros, uint32_t count) {}
+
+    /// return code of the compilation, or -1 if it never started
+    int32_t returnCode;
+
+    /// wall clock time of the whole compilation, including IL generation
+    uint64_t compileMicros;
+
+    /// peak scratch memory the compilation obtained from its segment provider
+    size_t scratchBytesAllocated;
+
+    /// IL nodes created over the whole compilation, including ones later removed
+    uint32_t nodesAllocated;
+
+    /// scratch memory the node pool used for those nodes, including block alignment
+    size_t nodeBytesAllocated;
+
+    /// start and end of the compiled body's code, NULL if the compilation failed
+    uint8_t *codeStart;
+    uint8_t *codeEnd;
+};
+
+} // namespace TR
+
+#endif
@@ -36,6 +36,7 @@
 #include "compile/Compilation.hpp"
 #include "compile/CompilationTypes.hpp"
 #include "compile/ResolvedMethod.hpp"
+#include "control/CompilationStatistics.hpp"
 #include "control/OptimizationPlan.hpp"
 #include "control/Options.hpp"
 #include "control/Options_inlines.hpp"
@@ -49,6 +50,7 @@
 #include "env/VerboseLog.hpp"
 #include "env/defines.h"
 #include "env/jittypes.h"
+#include "il/NodePool.hpp"
 #include "il/ResolvedMethodSymbol.hpp"
 #include "ilgen/IlGenRequest.hpp"
 #include "ilgen/IlGeneratorMethodDetails.hpp"
@@ -250,6 +252,30 @@ static void printCompFailureInfo(TR::JitConfig *jitConfig, TR::Compilation *comp
     }
 }
 
+static void recordCompilationStatistics(TR::CompilationStatistics &statistics, TR::Compilation &comp,
+    TR::SegmentAllocator &scratchSegmentProvider, int32_t rc, uint64_t compileMicros)
+{
+    statistics.returnCode = rc;
+    statistics.compileMicros = compileMicros;
+    statistics.scratchBytesAllocated = scratchSegmentProvider.bytesAllocated();
+    statistics.nodesAllocated = comp.getNodePool().getMaxIndex();
+    statistics.nodeBytesAllocated = comp.getNodePool().getBytesAllocated();
+    if (rc == COMPILATION_SUCCEEDED) {
+        statistics.codeStart = comp.cg()->getCodeStart();
+        statistics.codeEnd = comp.cg()->getCodeEnd();
+    }
+
+    // meter 0 is the root meter, which keeps running for the life of the compilation
+    PhaseTimingSummary &phases = comp.phaseTimer();
+    for (uint32_t i = 1; i < phases.NumberOfMeters(); i++) {
+        const PhaseTimingSummary::PhaseMeasuringNode &meter = phases.GetMeter(i);
+        uint32_t depth = 0;
+        for (uint32_t p = i; p != 0; p = phases.GetMeter(p).Parent())
+            depth++;
+        statistics.recordPhase(meter.Name(), depth, meter.Read(), meter.Count());
+    }
+}
+
 uint8_t *compileMethod(OMR_VMThread *omrVMThread, TR_ResolvedMethod &compilee, TR_Hotness hotness, int32_t &rc)
 {
     TR::IlGeneratorMethodDetails details(&compilee);
@@ -359,8 +385,10 @@ uint8_t *compileMethodFromDetails(OMR_VMThread *omrVMThread, TR::IlGeneratorMeth
                     compiler.cg()->getCodeEnd());
 
                 if (TR::Options::getVerboseOption(TR_VerbosePerformance)) {
-                    TR_VerboseLog::write(" time=%llu mem=%lluKB", translationTime,
-                        static_cast<unsigned long long>(scratchSegmentProvider.bytesAllocated()) / 1024);
+                    TR_VerboseLog::write(" time=%llu mem=%lluKB nodes=%u nodeMem=%lluKB", translationTime,
+                        static_cast<unsigned long long>(scratchSegmentProvider.bytesAllocated()) / 1024,
+                        compiler.getNodePool().getMaxIndex(),
+                        static_cast<unsigned long long>(compiler.getNodePool().getBytesAllocated()) / 1024);
                 }
 
                 TR_VerboseLog::write("\n");
@@ -417,6 +445,10 @@ uint8_t *compileMethodFromDetails(OMR_VMThread *omrVMThread, TR::IlGeneratorMeth
 #endif
     }
 
+    if (details.getCompilationStatistics() != NULL)
+        recordCompilationStatistics(*details.getCompilationStatistics(), compiler, scratchSegmentProvider, rc,
+            TR::Compiler->vm.getUSecClock() - translationStartTime);
+
     // A better place to do this would have been the destructor for
     // TR::Compilation. We'll need exceptions working instead of setjmp
     // before we can get working, and we need to make sure the other
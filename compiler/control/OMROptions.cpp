@@ -223,6 +223,9 @@ TR::OptionTable OMR::Options::_jitOptions[] = {
     { "classRedefinitionUPICRatSize=", "M<nnn>\tsize of runtime assumption table for classRedefinitionUPIC",
      TR::Options::setStaticNumeric, (intptr_t)&OMR::Options::_classRedefinitionUPICRatSize, 0, "F%d",
      NOT_IN_SUBSET },
+    { "codeCacheThreadRegionKB=",
+     "R<nnn>\tsize of the bump region a compilation thread carves from its reserved code cache, 0 to disable",
+     TR::Options::setStaticNumeric, (intptr_t)&OMR::Options::_codeCacheThreadRegionKB, 0, "F%d", NOT_IN_SUBSET },
     { "coldRunBCount=", "O<nnn>\tnumber of invocations before compiling methods with loops in AOT cold runs",
      TR::Options::setCount, offsetof(OMR::Options, _initialColdRunBCount), 0, "F%d", NOT_IN_SUBSET },
     { "coldRunCount=", "O<nnn>\tnumber of invocations before compiling methods with loops in AOT cold runs",
@@ -581,6 +584,8 @@ TR::OptionTable OMR::Options::_jitOptions[] = {
      SET_OPTION_BIT(TR_DisableImmutableFieldAliasing), "P" },
     { "disableIncrementalCCR", "O\tdisable incremental ccr", SET_OPTION_BIT(TR_DisableIncrementalCCR), "F",
      NOT_IN_SUBSET },
+    { "disableIncrementalValueNumbers", "O\tinvalidate value number info instead of updating it after an optimization",
+     SET_OPTION_BIT(TR_DisableIncrementalValueNumbers), "F" },
 
     { DisableInlineCheckCastString, "O\tdisable CheckCast    inline fast helper",
      SET_OPTION_BIT(TR_DisableInlineCheckCast), "F" },
@@ -1378,6 +1383,8 @@ TR::OptionTable OMR::Options::_jitOptions[] = {
      SET_OPTION_BIT(TR_EnableVirtualPersistentMemory), "F", NOT_IN_SUBSET },
     { "enableVpicForResolvedVirtualCalls", "O\tenable PIC for resolved virtual calls",
      SET_OPTION_BIT(TR_EnableVPICForResolvedVirtualCalls), "F" },
+    { "enableWorklistDataFlowSolver", "O\titerate bit vector analyses with a reverse post-order worklist",
+     SET_OPTION_BIT(TR_EnableWorklistDataFlowSolver), "F" },
     { "enableYieldVMAccess", "O\tenable yielding of VM access when GC is waiting",
      SET_OPTION_BIT(TR_EnableYieldVMAccess), "F" },
     { "enableZEpilogue", "O\tenable 64-bit 390 load-multiple breakdown.", SET_OPTION_BIT(TR_Enable39064Epilogue), "F" },
@@ -2194,6 +2201,8 @@ TR::OptionTable OMR::Options::_jitOptions[] = {
      SET_OPTION_BIT(TR_UseVmTotalCpuTimeAsAbstractTime), "F", NOT_IN_SUBSET },
     { "varyInlinerAggressivenessWithTime", "M\tVary inliner aggressiveness with abstract time",
      SET_OPTION_BIT(TR_VaryInlinerAggressivenessWithTime), "F", NOT_IN_SUBSET },
+    { "verifyIncrementalAnalyses", "O\tcheck incrementally updated value number info against a rebuild",
+     SET_OPTION_BIT(TR_VerifyIncrementalAnalyses), "F" },
     { "verifyReferenceCounts", "I\tverify the sanity of object reference counts before manipulation",
      SET_OPTION_BIT(TR_VerifyReferenceCounts), "F" },
     { "virtualMemoryCheckFrequencySec=",
@@ -2524,6 +2533,8 @@ int32_t OMR::Options::_numAllocatedCompilationThreads = -1; // -1 means not init
 
 int32_t OMR::Options::_trampolineSpacePercentage = 0; // 0 means no change from default
 
+int32_t OMR::Options::_codeCacheThreadRegionKB = 0; // 0 means thread regions are disabled
+
 int32_t OMR::Options::_traceFileLengthInMiB = 0; // 0 means unlimited
 
 bool OMR::Options::_countsAreProvidedByUser = false;
@@ -447,7 +447,7 @@ enum TR_CompilationOptions {
     TR_EnableSelectiveEnterExitHooks                         = 0x00000080 + 11,
     TR_EnableUseDefBasedVectorAPIExpansion                   = 0x00000100 + 11,
     TR_DisableDirectMemoryStore                              = 0x00000200 + 11,
-    // Available                                             = 0x00000400 + 11,
+    TR_EnableWorklistDataFlowSolver                          = 0x00000400 + 11,
     TR_DisableConstProvenance                                = 0x00000800 + 11,
     TR_DisableITableIterationsAfterLastITableCacheCheck      = 0x00001000 + 11,
     TR_VerboseOptTransformations                             = 0x00002000 + 11,
@@ -474,10 +474,10 @@ enum TR_CompilationOptions {
     TR_ForceTRIOForLoggers                                   = 0x00000040 + 12,
     TR_DisablePartialInlining                                = 0x00000080 + 12,
     TR_AssumeStartupPhaseUntilToldNotTo                      = 0x00000100 + 12,
-    // Available                                             = 0x00000200 + 12,
+    TR_DisableIncrementalValueNumbers                        = 0x00000200 + 12,
     TR_DisableAOTBytesCompression                            = 0x00000400 + 12,
     TR_X86UseMFENCE                                          = 0x00000800 + 12,
-    // Available                                             = 0x00001000 + 12,
+    TR_VerifyIncrementalAnalyses                             = 0x00001000 + 12,
     // Available                                             = 0x00002000 + 12,
     TR_DisableHPRSpill                                       = 0x00004000 + 12, // zGryphon
     TR_DisableHPRUpgrade                                     = 0x00008000 + 12, // zGryphon
@@ -2076,6 +2076,8 @@ public:
 
     static int32_t getTrampolineSpacePercentage() { return _trampolineSpacePercentage; }
 
+    static int32_t getCodeCacheThreadRegionKB() { return _codeCacheThreadRegionKB; }
+
     static size_t getScratchSpaceLimit() { return _scratchSpaceLimit; }
 
     static void setScratchSpaceLimit(size_t newScratchSpaceLimit) { _scratchSpaceLimit = newScratchSpaceLimit; }
@@ -2145,6 +2147,7 @@ public:
     static int32_t _numAllocatedCompilationThreads;
 
     static int32_t _trampolineSpacePercentage;
+    static int32_t _codeCacheThreadRegionKB;
 
     static int32_t _traceFileLengthInMiB;
 
@@ -96,6 +96,8 @@ static void initializeCodeCache(TR::CodeCacheManager &codeCacheManager)
     codeCacheConfig._codeCacheKB = 128;
     codeCacheConfig._codeCachePadKB = 0;
     codeCacheConfig._codeCacheAlignment = 32;
+    if (TR::Options::getCodeCacheThreadRegionKB() > 0)
+        codeCacheConfig._codeCacheThreadRegionKB = TR::Options::getCodeCacheThreadRegionKB();
     codeCacheConfig._codeCacheFreeBlockRecylingEnabled = true;
     codeCacheConfig._largeCodePageSize = 0;
     codeCacheConfig._largeCodePageFlags = 0;
@@ -444,6 +444,8 @@ public:
 
     bool IsRunning(void) const { return fRunning; }
 
+    uint32_t Count(void) const { return fCount; }
+
     Metric Read(void) const
     {
         CS2Assert(!fRunning, ("Cannot read running meter: %s", Name()));
@@ -592,6 +594,14 @@ public:
 
     bool Collect() { return fCollect; }
 
+    /**
+     * \brief Number of meters in the summary, including the root meter at
+     * index 0. Every other meter has a lower index than its children.
+     */
+    ListIndex NumberOfMeters() const { return fNodes.NumberOfElements(); }
+
+    const PhaseMeasuringNode &GetMeter(ListIndex index) const { return fNodes[index]; }
+
     static PhaseMeasuringSummary<Meter, Allocator> fGlobal;
 
     static PhaseMeasuringSummary<Meter, Allocator> &Global() { return fGlobal; }
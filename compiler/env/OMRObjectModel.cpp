@@ -28,12 +28,9 @@
 #include "compile/Compilation.hpp"
 #include "env/CompilerEnv.hpp"
 #include "env/jittypes.h"
+#include "il/Node.hpp"
 #include "infra/Assert.hpp"
 
-namespace TR {
-class Node;
-}
-
 OMR::ObjectModel::ObjectModel() {}
 
 int32_t OMR::ObjectModel::sizeofReferenceField() { return static_cast<int32_t>(sizeofReferenceAddress()); }
@@ -52,6 +49,11 @@ uint32_t OMR::ObjectModel::getSizeOfArrayElement(TR::Node *node)
     return 0;
 }
 
+bool OMR::ObjectModel::canScalarReplaceAllocation(TR::Node *allocation)
+{
+    return allocation->getOpCodeValue() == TR::New;
+}
+
 int64_t OMR::ObjectModel::maxArraySizeInElementsForAllocation(TR::Node *newArray, TR::Compilation *comp)
 {
     return LONG_MAX;
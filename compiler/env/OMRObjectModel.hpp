@@ -138,6 +138,21 @@ public:
 
     uintptr_t objectHeaderSizeInBytes() { return 0; }
 
+    /**
+     * @brief Answers whether an allocation that does not escape the method may
+     *        be replaced by locals holding its fields.  Fields inside the object
+     *        header are never replaced.
+     *
+     * @param[in] allocation : the allocation node
+     */
+    bool canScalarReplaceAllocation(TR::Node *allocation);
+
+    /**
+     * @brief Returns the largest number of distinct fields of one allocation
+     *        that may be replaced by locals
+     */
+    int32_t maxScalarReplacedFields() { return 32; }
+
     uintptr_t offsetOfIndexableSizeField() { return 0; }
 
     /**
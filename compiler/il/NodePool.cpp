@@ -34,14 +34,41 @@ TR::NodePool::NodePool(TR::Compilation *comp)
     : _comp(comp)
     , _disableGC(true)
     , _globalIndex(0)
+    , _blockAlloc(NULL)
+    , _blockTop(NULL)
+    , _numBlocks(0)
     , _nodeRegion(comp->trMemory()->heapMemoryRegion())
 {}
 
-void TR::NodePool::cleanUp() { TR::Region::reset(_nodeRegion, _comp->trMemory()->heapMemoryRegion()); }
+void TR::NodePool::cleanUp()
+{
+    TR::Region::reset(_nodeRegion, _comp->trMemory()->heapMemoryRegion());
+    _blockAlloc = _blockTop = NULL;
+    _numBlocks = 0;
+}
+
+// Node slots are rounded the same way the region rounds individual allocations
+//
+static inline size_t nodeStride() { return (sizeof(TR::Node) + 15) & ~static_cast<size_t>(15); }
+
+void TR::NodePool::allocateBlock()
+{
+    size_t blockSize = NODES_PER_BLOCK * nodeStride();
+    uint8_t *block = static_cast<uint8_t *>(_nodeRegion.allocate(blockSize + BLOCK_ALIGNMENT - 1));
+
+    _blockAlloc = reinterpret_cast<uint8_t *>(
+        (reinterpret_cast<uintptr_t>(block) + BLOCK_ALIGNMENT - 1) & ~static_cast<uintptr_t>(BLOCK_ALIGNMENT - 1));
+    _blockTop = _blockAlloc + blockSize;
+    _numBlocks++;
+}
 
 TR::Node *TR::NodePool::allocate()
 {
-    TR::Node *newNode = static_cast<TR::Node *>(_nodeRegion.allocate(sizeof(TR::Node)));
+    if (_blockAlloc == _blockTop)
+        allocateBlock();
+
+    TR::Node *newNode = reinterpret_cast<TR::Node *>(_blockAlloc);
+    _blockAlloc += nodeStride();
     memset(newNode, 0, sizeof(TR::Node));
     newNode->_globalIndex = ++_globalIndex;
     TR_ASSERT(_globalIndex < MAX_NODE_COUNT, "Reached TR::Node allocation limit");
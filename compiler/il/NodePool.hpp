@@ -34,6 +34,14 @@ template<class T> class TR_Array;
 
 namespace TR {
 
+/**
+ * Allocates the nodes of a compilation.
+ *
+ * Nodes are carved from cache-line aligned blocks that hold a fixed number of
+ * nodes, so nodes created one after the other (which tree walks tend to visit
+ * together) are laid out contiguously and a node never straddles more cache
+ * lines than its size requires.
+ */
 class NodePool {
 public:
     TR_ALLOC(TR_Memory::Compilation)
@@ -51,15 +59,29 @@ public:
 
     ncount_t getMaxIndex() { return _globalIndex; }
 
+    /// Total bytes of scratch memory used for nodes, including block alignment
+    size_t getBytesAllocated() { return _nodeRegion.bytesAllocated(); }
+
+    uint32_t getNumBlocks() { return _numBlocks; }
+
     TR::Compilation *comp() { return _comp; }
 
     void cleanUp();
 
 private:
+    static const size_t NODES_PER_BLOCK = 64;
+    static const size_t BLOCK_ALIGNMENT = 64;
+
+    void allocateBlock();
+
     TR::Compilation *_comp;
     bool _disableGC;
     ncount_t _globalIndex;
 
+    uint8_t *_blockAlloc;
+    uint8_t *_blockTop;
+    uint32_t _numBlocks;
+
     TR::Region _nodeRegion;
 };
 
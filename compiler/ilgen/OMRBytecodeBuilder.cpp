@@ -28,6 +28,7 @@
 #include "ilgen/IlBuilder.hpp"
 #include "ilgen/MethodBuilder.hpp"
 #include "ilgen/BytecodeBuilder.hpp"
+#include "ilgen/TraceRecorder.hpp"
 #include "ilgen/TypeDictionary.hpp"
 #include "ras/Logger.hpp"
 
@@ -129,12 +130,17 @@ void OMR::BytecodeBuilder::AddFallThroughBuilder(TR::BytecodeBuilder *ftb)
     TraceIL("IlBuilder[ %p ]:: fallThrough successor [ %p ]\n", this, ftb);
 
     TR::BytecodeBuilder *b = ftb;
-    transferVMState(&b); // may change what b points at!
+    if (leavesTrace(ftb)) {
+        b = traceExitBuilder(ftb->_bcIndex, _vmState, false);
+        TraceIL("IlBuilder[ %p ]:: fallThrough successor leaves the trace through [ %p ]\n", this, b);
+    } else {
+        transferVMState(&b); // may change what b points at!
 
-    if (b != ftb)
-        TraceIL("IlBuilder[ %p ]:: fallThrough successor changed to [ %p ]\n", this, b);
+        if (b != ftb)
+            TraceIL("IlBuilder[ %p ]:: fallThrough successor changed to [ %p ]\n", this, b);
+        _methodBuilder->addBytecodeBuilderToWorklist(ftb);
+    }
     _fallThroughBuilder = b;
-    _methodBuilder->addBytecodeBuilderToWorklist(ftb);
 
     // add explicit goto and register the actual fall-through block
     TR::IlBuilder *tgtb = b;
@@ -154,6 +160,12 @@ void OMR::BytecodeBuilder::AddSuccessorBuilders(uint32_t numExits, ...)
     va_start(exits, numExits);
     for (auto e = 0U; e < numExits; e++) {
         TR::BytecodeBuilder **builder = (TR::BytecodeBuilder **)va_arg(exits, TR::BytecodeBuilder **);
+        if (leavesTrace(*builder)) {
+            *builder = traceExitBuilder((*builder)->_bcIndex, _vmState, false);
+            _successorBuilders->add(*builder);
+            TraceIL("IlBuilder[ %p ]:: successor leaves the trace through [ %p ]\n", this, *builder);
+            continue;
+        }
         if ((*builder)->_bcIndex
             < _bcIndex) // If the successor has a bcIndex < than the current bcIndex this may be a loop
             _methodSymbol->setMayHaveLoops(true);
@@ -165,6 +177,42 @@ void OMR::BytecodeBuilder::AddSuccessorBuilders(uint32_t numExits, ...)
     va_end(exits);
 }
 
+// While compiling a trace, only the bytecodes recorded on the trace get BytecodeBuilders
+// processed from the worklist. Flow to any other bytecode goes to a side exit instead.
+bool OMR::BytecodeBuilder::leavesTrace(TR::BytecodeBuilder *target)
+{
+    OMR::BytecodeTrace *trace = _methodBuilder->trace();
+    return trace != NULL && !trace->isOnTrace(_bcIndex, target->_bcIndex);
+}
+
+// A side exit writes the simulated vm state back to the virtual machine, counts how often
+// it is taken, and returns from the compiled trace so the interpreter continues at target
+TR::BytecodeBuilder *OMR::BytecodeBuilder::traceExitBuilder(int32_t target, TR::VirtualMachineState *exitState,
+    bool guard)
+{
+    OMR::TraceExit *exit = _methodBuilder->trace()->exitTo(target, guard);
+    TR::BytecodeBuilder *exitBuilder = _methodBuilder->OrphanBytecodeBuilder(target, _name);
+    exitBuilder->propagateVMState(exitState);
+    exitBuilder->vmState()->commit(exitBuilder);
+
+    TR::IlType *pInt64 = _types->PointerTo(_types->Int64);
+    TR::IlValue *counter = exitBuilder->ConstAddress(&exit->_count);
+    exitBuilder->StoreAt(counter,
+        exitBuilder->Add(exitBuilder->LoadAt(pInt64, counter), exitBuilder->ConstInt64(1)));
+    exitBuilder->Return(exitBuilder->ConstInt32(exit->returnValue()));
+
+    TraceIL("IlBuilder[ %p ]:: trace exit [ %p ] to bci %d%s\n", this, exitBuilder, target, guard ? " (guard)" : "");
+    return exitBuilder;
+}
+
+void OMR::BytecodeBuilder::GuardEqual(TR::IlValue *v1, TR::IlValue *v2)
+{
+    TR_ASSERT_FATAL(_methodBuilder->IsCompilingTrace(), "GuardEqual used outside a trace compilation");
+    TR::BytecodeBuilder *exitBuilder = traceExitBuilder(_bcIndex, _initialVMState, true);
+    _successorBuilders->add(exitBuilder);
+    OMR::IlBuilder::IfCmpNotEqual(exitBuilder, v1, v2);
+}
+
 void OMR::BytecodeBuilder::setHandlerInfo(uint32_t catchType)
 {
     TR::Block *catchBlock = getEntry();
@@ -96,6 +96,16 @@ public:
     void IfCmpUnsignedGreaterOrEqual(TR::BytecodeBuilder **dest, TR::IlValue *v1, TR::IlValue *v2);
     void IfCmpUnsignedGreaterOrEqual(TR::BytecodeBuilder *dest, TR::IlValue *v1, TR::IlValue *v2);
 
+    /**
+     * @brief leave the trace being compiled unless two values are equal
+     * @param v1 a value computed by this bytecode, typically one the interpreter recorded for the trace
+     * @param v2 the value the rest of the trace was specialized for
+     * The side exit commits the VM state this builder started with and returns to the interpreter to
+     * execute this bytecode again, so any operations added to this builder before the guard must not
+     * change the virtual machine state. Can only be used while the MethodBuilder is compiling a trace.
+     */
+    void GuardEqual(TR::IlValue *v1, TR::IlValue *v2);
+
     /**
      * @brief returns the client object associated with this object, allocating it if necessary
      */
@@ -123,6 +133,8 @@ protected:
     bool connectTrees();
     virtual void setHandlerInfo(uint32_t catchType);
     void transferVMState(TR::BytecodeBuilder **b);
+    bool leavesTrace(TR::BytecodeBuilder *target);
+    TR::BytecodeBuilder *traceExitBuilder(int32_t target, TR::VirtualMachineState *exitState, bool guard);
 
 private:
     static ClientAllocator _clientAllocator;
@@ -44,6 +44,7 @@
 #include "ilgen/TypeDictionary.hpp"
 #include "ilgen/IlInjector.hpp"
 #include "ilgen/IlReference.hpp"
+#include "ilgen/JitBuilderRecorder.hpp"
 #include "ilgen/MethodBuilder.hpp"
 #include "ilgen/BytecodeBuilder.hpp"
 #include "infra/Cfg.hpp"
@@ -60,6 +61,124 @@
         }                                            \
     }
 
+namespace {
+
+/*
+ * Records a builder service in the MethodBuilder's JitBuilderRecorder, if it has one. Only services called
+ * by the client are written; services used to implement another service are regenerated when the outer one is
+ * replayed. Operand values are captured on entry because some services reassign their parameters.
+ *
+ * A statement is [builder][statement][result][operand values][type] followed by anything the service adds.
+ *
+ * Services are called far more often without a recorder than with one, so nothing else is done unless the
+ * MethodBuilder has a recorder.
+ */
+class RecordedService {
+public:
+    RecordedService(OMR::IlBuilder *builder, TR::MethodBuilder *methodBuilder, const char *statement,
+        TR::IlValue *v0 = NULL, TR::IlValue *v1 = NULL, TR::IlValue *v2 = NULL)
+        : _builder(static_cast<TR::IlBuilder *>(builder))
+        , _methodBuilder(NULL)
+        , _recorder(NULL)
+        , _statement(statement)
+        , _numValues(0)
+    {
+        if (methodBuilder == NULL || methodBuilder->recorder() == NULL)
+            return;
+
+        _methodBuilder = methodBuilder;
+        _recorder = methodBuilder->beginRecordedService();
+        if (_recorder == NULL)
+            return;
+
+        if (v0 != NULL)
+            _values[_numValues++] = v0;
+        if (v1 != NULL)
+            _values[_numValues++] = v1;
+        if (v2 != NULL)
+            _values[_numValues++] = v2;
+    }
+
+    ~RecordedService()
+    {
+        if (_methodBuilder != NULL)
+            _methodBuilder->endRecordedService();
+    }
+
+    /**
+     * @brief write the start of the statement
+     * @returns the recorder to write the rest of the statement to, or NULL if this service is not recorded
+     */
+    TR::JitBuilderRecorder *begin(const TR::IlType *type = NULL) { return beginStatement(false, NULL, type); }
+
+    TR::JitBuilderRecorder *beginWithResult(TR::IlValue *result, const TR::IlType *type = NULL)
+    {
+        return beginStatement(true, result, type);
+    }
+
+    void end() { _recorder->EndStatement(); }
+
+    void record(const TR::IlType *type = NULL)
+    {
+        if (begin(type) != NULL)
+            end();
+    }
+
+    void recordWithResult(TR::IlValue *result, const TR::IlType *type = NULL)
+    {
+        if (beginWithResult(result, type) != NULL)
+            end();
+    }
+
+    void value(TR::IlValue *v)
+    {
+        // a value the recording has not seen came from a service that was not recorded
+        if (!_recorder->EnsureAvailableID(v))
+            _recorder->setIncomplete();
+        _recorder->Value(v);
+    }
+
+    void builder(TR::IlBuilder *b)
+    {
+        _recorder->EnsureAvailableID(b);
+        _recorder->Builder(b);
+    }
+
+private:
+    TR::JitBuilderRecorder *beginStatement(bool hasResult, TR::IlValue *result, const TR::IlType *type)
+    {
+        if (_recorder == NULL)
+            return NULL;
+
+        if (!_recorder->EnsureAvailableID(_builder)) {
+            // builders only become known through recorded services
+            _recorder->setIncomplete();
+            return NULL;
+        }
+
+        _recorder->EnsureTypeDefined(type);
+        _recorder->BeginStatement(_builder, _statement);
+        if (hasResult) {
+            _recorder->EnsureAvailableID(result);
+            _recorder->Value(result);
+        }
+        for (int32_t v = 0; v < _numValues; v++)
+            value(_values[v]);
+        if (type != NULL)
+            _recorder->Type(type);
+        return _recorder;
+    }
+
+    TR::IlBuilder *_builder;
+    TR::MethodBuilder *_methodBuilder;
+    TR::JitBuilderRecorder *_recorder;
+    const char *_statement;
+    TR::IlValue *_values[3];
+    int32_t _numValues;
+};
+
+} // namespace
+
 // IlBuilder is a class designed to help build Testarossa IL quickly without
 // a lot of knowledge of the intricacies of commoned references, symbols,
 // symbol references, or blocks. You can add operations to an IlBuilder via
@@ -127,8 +246,25 @@ bool OMR::IlBuilder::injectIL()
 
     setupForBuildIL();
 
+    // only the IL generated by a MethodBuilder's own buildIL() is recorded
+    bool recording = isMethodBuilder() && _methodBuilder->recorder() != NULL;
+    if (recording)
+        _methodBuilder->beginRecording();
+
+    // field symbol references are only looked up while IL is generated; drop any
+    // cache an earlier failed compilation left behind for this compilation object
+    if (isMethodBuilder())
+        typeDictionary()->NotifyCompilationDone();
+
     bool rc = buildIL();
     TraceIL("buildIL() returned %d\n", rc);
+
+    if (isMethodBuilder())
+        typeDictionary()->NotifyCompilationDone();
+
+    if (recording)
+        _methodBuilder->endRecording(rc);
+
     if (!rc)
         return false;
 
@@ -236,11 +372,24 @@ TR::IlValue *OMR::IlBuilder::newValue(TR::DataType dt, TR::Node *n)
     TR::TreeTop *tt = TR::TreeTop::create(_comp, ttNode);
     _currentBlock->append(tt);
     TR::IlValue *value = new (_comp->trHeapMemory()) TR::IlValue(n, tt, _currentBlock, _methodBuilder);
+    noteGeneratedIL();
     return value;
 }
 
 TR::IlValue *OMR::IlBuilder::newValue(TR::IlType *dt, TR::Node *n) { return newValue(dt->getPrimitiveType(), n); }
 
+TR::TreeTop *OMR::IlBuilder::genTreeTop(TR::Node *n)
+{
+    noteGeneratedIL();
+    return TR::IlInjector::genTreeTop(n);
+}
+
+void OMR::IlBuilder::noteGeneratedIL()
+{
+    if (_methodBuilder != NULL)
+        _methodBuilder->noteGeneratedIL();
+}
+
 TR::IlValue *OMR::IlBuilder::NewValue(TR::IlType *dt)
 {
     TR_ASSERT_FATAL(0, "should not create a value without a TR::Node");
@@ -449,10 +598,16 @@ TR::IlValue *OMR::IlBuilder::zeroForValue(TR::IlValue *v)
 
 TR::IlBuilder *OMR::IlBuilder::OrphanBuilder()
 {
+    RecordedService rs(this, _methodBuilder, OMR::StatementName::STATEMENT_NEWILBUILDER);
     TR::IlBuilder *orphan = new (comp()->trHeapMemory()) TR::IlBuilder(_methodBuilder, _types);
     orphan->initialize(_details, _methodSymbol, _fe, _symRefTab);
     orphan->setupForBuildIL();
     TraceIL("IlBuilder[ %p ]::OrphanBuilder created %p\n", this, orphan);
+    TR::JitBuilderRecorder *rec = rs.begin();
+    if (rec != NULL) {
+        rs.builder(orphan);
+        rs.end();
+    }
     return orphan;
 }
 
@@ -469,6 +624,7 @@ TR::Block *OMR::IlBuilder::emptyBlock()
 {
     TR::Block *empty = TR::Block::createEmptyBlock(NULL, _comp);
     cfg()->addNode(empty);
+    noteGeneratedIL();
     return empty;
 }
 
@@ -491,6 +647,7 @@ OMR::IlBuilder::SequenceEntry *OMR::IlBuilder::builderEntry(TR::IlBuilder *build
 
 void OMR::IlBuilder::appendBlock(TR::Block *newBlock, bool addEdge)
 {
+    noteGeneratedIL();
     if (newBlock == NULL) {
         newBlock = emptyBlock();
     }
@@ -508,6 +665,7 @@ void OMR::IlBuilder::appendBlock(TR::Block *newBlock, bool addEdge)
 
 void OMR::IlBuilder::AppendBuilder(TR::IlBuilder *builder)
 {
+    RecordedService rs(this, _methodBuilder, OMR::StatementName::STATEMENT_APPENDBUILDER);
     TR_ASSERT_FATAL(builder->_partOfSequence == false, "builder cannot be in two places");
     TraceIL("IlBuilder[ %p ]::AppendBuilder %p\n", this, builder);
 
@@ -524,6 +682,12 @@ void OMR::IlBuilder::AppendBuilder(TR::IlBuilder *builder)
     // this block we're about to create need to add edge explicitly because of this exit block sleight of hand
     appendNoFallThroughBlock();
     cfg()->addEdge(builder->getExit(), _currentBlock);
+
+    TR::JitBuilderRecorder *rec = rs.begin();
+    if (rec != NULL) {
+        rs.builder(builder);
+        rs.end();
+    }
 }
 
 TR::Node *OMR::IlBuilder::loadValue(TR::IlValue *v) { return v->load(_currentBlock); }
@@ -573,6 +737,7 @@ TR::IlValue *OMR::IlBuilder::indirectLoadNode(TR::IlType *dt, TR::Node *addr, bo
  */
 void OMR::IlBuilder::Store(const char *varName, TR::IlValue *value)
 {
+    RecordedService rs(this, _methodBuilder, OMR::StatementName::STATEMENT_STORE, value);
     if (!_methodBuilder->symbolDefined(varName))
         _methodBuilder->defineValue(varName, _types->PrimitiveType(value->getDataType()));
     TR::SymbolReference *symRef = lookupSymbol(varName);
@@ -580,6 +745,12 @@ void OMR::IlBuilder::Store(const char *varName, TR::IlValue *value)
     TraceIL("IlBuilder[ %p ]::Store %s %d (%d) gets %d\n", this, varName, symRef->getCPIndex(),
         symRef->getReferenceNumber(), value->getID());
     storeNode(symRef, loadValue(value));
+
+    TR::JitBuilderRecorder *rec = rs.begin();
+    if (rec != NULL) {
+        rec->String(varName);
+        rs.end();
+    }
 }
 
 /**
@@ -589,8 +760,10 @@ void OMR::IlBuilder::Store(const char *varName, TR::IlValue *value)
  */
 void OMR::IlBuilder::StoreOver(TR::IlValue *dest, TR::IlValue *value)
 {
+    RecordedService rs(this, _methodBuilder, OMR::StatementName::STATEMENT_STOREOVER, dest, value);
     TraceIL("IlBuilder[ %p ]::%d is StoreOver %d\n", this, dest->getID(), value->getID());
     dest->storeOver(value, _currentBlock);
+    rs.record();
 }
 
 /**
@@ -625,10 +798,12 @@ void OMR::IlBuilder::VectorStore(const char *varName, TR::IlValue *value)
  */
 void OMR::IlBuilder::StoreAt(TR::IlValue *address, TR::IlValue *value)
 {
+    RecordedService rs(this, _methodBuilder, OMR::StatementName::STATEMENT_STOREAT, address, value);
     TR_ASSERT_FATAL(address->getDataType() == TR::Address, "StoreAt needs an address operand");
 
     TraceIL("IlBuilder[ %p ]::StoreAt address %d gets %d\n", this, address->getID(), value->getID());
     indirectStoreNode(loadValue(address), loadValue(value));
+    rs.record();
 }
 
 /**
@@ -697,6 +872,7 @@ TR::IlValue *OMR::IlBuilder::CreateLocalStruct(TR::IlType *structType)
 
 void OMR::IlBuilder::StoreIndirect(const char *type, const char *field, TR::IlValue *object, TR::IlValue *value)
 {
+    RecordedService rs(this, _methodBuilder, OMR::StatementName::STATEMENT_STOREINDIRECT, object, value);
     TR::IlReference *fieldRef = _types->FieldReference(type, field);
     TR::SymbolReference *symRef = fieldRef->symRef();
     TR::DataType fieldType = symRef->getSymbol()->getDataType();
@@ -705,15 +881,27 @@ void OMR::IlBuilder::StoreIndirect(const char *type, const char *field, TR::IlVa
     TR::ILOpCodes storeOp = comp()->il.opCodeForIndirectStore(fieldType);
     genTreeTop(TR::Node::createWithSymRef(storeOp, 2, loadValue(object), loadValue(value), 0, symRef));
     jitPersistentFree(fieldRef);
+    TR::JitBuilderRecorder *rec = rs.begin();
+    if (rec != NULL) {
+        rec->String(type);
+        rec->String(field);
+        rs.end();
+    }
 }
 
 TR::IlValue *OMR::IlBuilder::Load(const char *name)
 {
+    RecordedService rs(this, _methodBuilder, OMR::StatementName::STATEMENT_LOAD);
     TR::SymbolReference *symRef = lookupSymbol(name);
     TR::Node *valueNode = TR::Node::createLoad(symRef);
     TR::IlValue *returnValue = newValue(symRef->getSymbol()->getDataType(), valueNode);
     TraceIL("IlBuilder[ %p ]::%d is Load %s from symref %d\n", this, returnValue->getID(), name,
         symRef->getReferenceNumber());
+    TR::JitBuilderRecorder *rec = rs.beginWithResult(returnValue);
+    if (rec != NULL) {
+        rec->String(name);
+        rs.end();
+    }
     return returnValue;
 }
 
@@ -732,6 +920,7 @@ TR::IlValue *OMR::IlBuilder::VectorLoad(const char *name)
 
 TR::IlValue *OMR::IlBuilder::LoadIndirect(const char *type, const char *field, TR::IlValue *object)
 {
+    RecordedService rs(this, _methodBuilder, OMR::StatementName::STATEMENT_LOADINDIRECT, object);
     TR::IlReference *fieldRef = _types->FieldReference(type, field);
     TR::SymbolReference *symRef = fieldRef->symRef();
     TR::DataType fieldType = symRef->getSymbol()->getDataType();
@@ -740,15 +929,23 @@ TR::IlValue *OMR::IlBuilder::LoadIndirect(const char *type, const char *field, T
     TraceIL("IlBuilder[ %p ]::%d is LoadIndirect %s.%s from (%d)\n", this, returnValue->getID(), type, field,
         object->getID());
     jitPersistentFree(fieldRef);
+    TR::JitBuilderRecorder *rec = rs.beginWithResult(returnValue);
+    if (rec != NULL) {
+        rec->String(type);
+        rec->String(field);
+        rs.end();
+    }
     return returnValue;
 }
 
 TR::IlValue *OMR::IlBuilder::LoadAt(TR::IlType *dt, TR::IlValue *address)
 {
+    RecordedService rs(this, _methodBuilder, OMR::StatementName::STATEMENT_LOADAT, address);
     TR_ASSERT_FATAL(address->getDataType() == TR::Address, "LoadAt needs an address operand");
     TR::IlValue *returnValue = indirectLoadNode(dt, loadValue(address));
     TraceIL("IlBuilder[ %p ]::%d is LoadAt type %d address %d\n", this, returnValue->getID(),
         dt->getPrimitiveType().getDataType(), address->getID());
+    rs.recordWithResult(returnValue, dt);
     return returnValue;
 }
 
@@ -763,6 +960,7 @@ TR::IlValue *OMR::IlBuilder::VectorLoadAt(TR::IlType *dt, TR::IlValue *address)
 
 TR::IlValue *OMR::IlBuilder::IndexAt(TR::IlType *dt, TR::IlValue *base, TR::IlValue *index)
 {
+    RecordedService rs(this, _methodBuilder, OMR::StatementName::STATEMENT_INDEXAT, base, index);
     TR::IlType *elemType = dt->baseType();
     TR_ASSERT_FATAL(base->getDataType() == TR::Address, "IndexAt must be called with a pointer base");
     TR_ASSERT_FATAL(elemType != NULL, "IndexAt should be called with pointer type");
@@ -799,6 +997,7 @@ TR::IlValue *OMR::IlBuilder::IndexAt(TR::IlType *dt, TR::IlValue *base, TR::IlVa
     TraceIL("IlBuilder[ %p ]::%d is IndexAt(%s) base %d index %d\n", this, address->getID(), dt->getName(),
         base->getID(), index->getID());
 
+    rs.recordWithResult(address, dt);
     return address;
 }
 
@@ -843,54 +1042,92 @@ TR::IlValue *OMR::IlBuilder::UnionFieldInstanceAddress(const char *unionName, co
 
 TR::IlValue *OMR::IlBuilder::NullAddress()
 {
+    RecordedService rs(this, _methodBuilder, OMR::StatementName::STATEMENT_NULLADDRESS);
     TR::IlValue *returnValue = newValue(Address, TR::Node::aconst(0));
     TraceIL("IlBuilder[ %p ]::%d is NullAddress\n", this, returnValue->getID());
+    rs.recordWithResult(returnValue);
     return returnValue;
 }
 
 TR::IlValue *OMR::IlBuilder::ConstInt8(int8_t value)
 {
+    RecordedService rs(this, _methodBuilder, OMR::StatementName::STATEMENT_CONSTINT8);
     TR::IlValue *returnValue = newValue(Int8, TR::Node::bconst(value));
     TraceIL("IlBuilder[ %p ]::%d is ConstInt8 %d\n", this, returnValue->getID(), value);
+    TR::JitBuilderRecorder *rec = rs.beginWithResult(returnValue);
+    if (rec != NULL) {
+        rec->Number(value);
+        rs.end();
+    }
     return returnValue;
 }
 
 TR::IlValue *OMR::IlBuilder::ConstInt16(int16_t value)
 {
+    RecordedService rs(this, _methodBuilder, OMR::StatementName::STATEMENT_CONSTINT16);
     TR::IlValue *returnValue = newValue(Int16, TR::Node::sconst(value));
     TraceIL("IlBuilder[ %p ]::%d is ConstInt16 %d\n", this, returnValue->getID(), value);
+    TR::JitBuilderRecorder *rec = rs.beginWithResult(returnValue);
+    if (rec != NULL) {
+        rec->Number(value);
+        rs.end();
+    }
     return returnValue;
 }
 
 TR::IlValue *OMR::IlBuilder::ConstInt32(int32_t value)
 {
+    RecordedService rs(this, _methodBuilder, OMR::StatementName::STATEMENT_CONSTINT32);
     TR::IlValue *returnValue = newValue(Int32, TR::Node::iconst(value));
     TraceIL("IlBuilder[ %p ]::%d is ConstInt32 %d\n", this, returnValue->getID(), value);
+    TR::JitBuilderRecorder *rec = rs.beginWithResult(returnValue);
+    if (rec != NULL) {
+        rec->Number(value);
+        rs.end();
+    }
     return returnValue;
 }
 
 TR::IlValue *OMR::IlBuilder::ConstInt64(int64_t value)
 {
+    RecordedService rs(this, _methodBuilder, OMR::StatementName::STATEMENT_CONSTINT64);
     TR::IlValue *returnValue = newValue(Int64, TR::Node::lconst(value));
     TraceIL("IlBuilder[ %p ]::%d is ConstInt64 %lld\n", this, returnValue->getID(), value);
+    TR::JitBuilderRecorder *rec = rs.beginWithResult(returnValue);
+    if (rec != NULL) {
+        rec->Number(value);
+        rs.end();
+    }
     return returnValue;
 }
 
 TR::IlValue *OMR::IlBuilder::ConstFloat(float value)
 {
+    RecordedService rs(this, _methodBuilder, OMR::StatementName::STATEMENT_CONSTFLOAT);
     TR::Node *fconstNode = TR::Node::create(0, TR::fconst, 0);
     fconstNode->setFloat(value);
     TR::IlValue *returnValue = newValue(Float, fconstNode);
     TraceIL("IlBuilder[ %p ]::%d is ConstFloat %f\n", this, returnValue->getID(), value);
+    TR::JitBuilderRecorder *rec = rs.beginWithResult(returnValue);
+    if (rec != NULL) {
+        rec->Number(value);
+        rs.end();
+    }
     return returnValue;
 }
 
 TR::IlValue *OMR::IlBuilder::ConstDouble(double value)
 {
+    RecordedService rs(this, _methodBuilder, OMR::StatementName::STATEMENT_CONSTDOUBLE);
     TR::Node *dconstNode = TR::Node::create(0, TR::dconst, 0);
     dconstNode->setDouble(value);
     TR::IlValue *returnValue = newValue(Double, dconstNode);
     TraceIL("IlBuilder[ %p ]::%d is ConstDouble %lf\n", this, returnValue->getID(), value);
+    TR::JitBuilderRecorder *rec = rs.beginWithResult(returnValue);
+    if (rec != NULL) {
+        rec->Number(value);
+        rs.end();
+    }
     return returnValue;
 }
 
@@ -903,8 +1140,14 @@ TR::IlValue *OMR::IlBuilder::ConstString(const char * const value)
 
 TR::IlValue *OMR::IlBuilder::ConstAddress(const void * const value)
 {
+    RecordedService rs(this, _methodBuilder, OMR::StatementName::STATEMENT_CONSTADDRESS);
     TR::IlValue *returnValue = newValue(Address, TR::Node::aconst((uintptr_t)value));
     TraceIL("IlBuilder[ %p ]::%d is ConstAddress %p\n", this, returnValue->getID(), value);
+    TR::JitBuilderRecorder *rec = rs.beginWithResult(returnValue);
+    if (rec != NULL) {
+        rec->Location(value);
+        rs.end();
+    }
     return returnValue;
 }
 
@@ -925,35 +1168,42 @@ TR::IlValue *OMR::IlBuilder::ConstInteger(TR::IlType *intType, int64_t value)
 
 TR::IlValue *OMR::IlBuilder::ConvertTo(TR::IlType *t, TR::IlValue *v)
 {
+    RecordedService rs(this, _methodBuilder, OMR::StatementName::STATEMENT_CONVERTTO, v);
     TR::DataType typeFrom = v->getDataType();
     TR::DataType typeTo = t->getPrimitiveType();
     if (typeFrom == typeTo) {
         TraceIL("IlBuilder[ %p ]::%d is ConvertTo (already has type %s) %d\n", this, v->getID(), t->getName(),
             v->getID());
+        rs.recordWithResult(v, t);
         return v;
     }
     TR::IlValue *convertedValue = convertTo(typeTo, v, false);
     TraceIL("IlBuilder[ %p ]::%d is ConvertTo(%s) %d\n", this, convertedValue->getID(), t->getName(), v->getID());
+    rs.recordWithResult(convertedValue, t);
     return convertedValue;
 }
 
 TR::IlValue *OMR::IlBuilder::UnsignedConvertTo(TR::IlType *t, TR::IlValue *v)
 {
+    RecordedService rs(this, _methodBuilder, OMR::StatementName::STATEMENT_UNSIGNEDCONVERTTO, v);
     TR::DataType typeFrom = v->getDataType();
     TR::DataType typeTo = t->getPrimitiveType();
     if (typeFrom == typeTo) {
         TraceIL("IlBuilder[ %p ]::%d is UnsignedConvertTo (already has type %s) %d\n", this, v->getID(), t->getName(),
             v->getID());
+        rs.recordWithResult(v, t);
         return v;
     }
     TR::IlValue *convertedValue = convertTo(typeTo, v, true);
     TraceIL("IlBuilder[ %p ]::%d is UnsignedConvertTo(%s) %d\n", this, convertedValue->getID(), t->getName(),
         v->getID());
+    rs.recordWithResult(convertedValue, t);
     return convertedValue;
 }
 
 TR::IlValue *OMR::IlBuilder::Negate(TR::IlValue *v)
 {
+    RecordedService rs(this, _methodBuilder, OMR::StatementName::STATEMENT_NEGATE, v);
     TR::DataType dataType = v->getDataType();
 
     TR::ILOpCodes negateOp = ILOpCode::negateOpCode(dataType);
@@ -963,6 +1213,7 @@ TR::IlValue *OMR::IlBuilder::Negate(TR::IlValue *v)
     TR::Node *result = TR::Node::create(negateOp, 1, loadValue(v));
     TR::IlValue *negatedValue = newValue(dataType, result);
     TraceIL("IlBuilder[ %p ]::%d is Negate %d\n", this, negatedValue->getID(), v->getID());
+    rs.recordWithResult(negatedValue);
     return negatedValue;
 }
 
@@ -1101,8 +1352,10 @@ TR::IlValue *OMR::IlBuilder::compareOp(TR_ComparisonTypes ct, bool needUnsigned,
 
 TR::IlValue *OMR::IlBuilder::NotEqualTo(TR::IlValue *left, TR::IlValue *right)
 {
+    RecordedService rs(this, _methodBuilder, OMR::StatementName::STATEMENT_NOTEQUALTO, left, right);
     TR::IlValue *returnValue = compareOp(TR_cmpNE, false, left, right);
     TraceIL("IlBuilder[ %p ]::%d is NotEqualTo %d != %d?\n", this, returnValue->getID(), left->getID(), right->getID());
+    rs.recordWithResult(returnValue);
     return returnValue;
 }
 
@@ -1115,14 +1368,22 @@ void OMR::IlBuilder::Goto(TR::IlBuilder **dest)
 
 void OMR::IlBuilder::Goto(TR::IlBuilder *dest)
 {
+    RecordedService rs(this, _methodBuilder, OMR::StatementName::STATEMENT_GOTO);
     TR_ASSERT_FATAL(dest != NULL, "This goto implementation requires a non-NULL builder object");
     TraceIL("IlBuilder[ %p ]::Goto %p\n", this, dest);
     appendGoto(dest->getEntry());
     setDoesNotComeBack();
+
+    TR::JitBuilderRecorder *rec = rs.begin();
+    if (rec != NULL) {
+        rs.builder(dest);
+        rs.end();
+    }
 }
 
 void OMR::IlBuilder::Return()
 {
+    RecordedService rs(this, _methodBuilder, OMR::StatementName::STATEMENT_RETURN);
     TR::IlBuilder *returnBuilder = _methodBuilder->returnBuilder();
     if (returnBuilder != NULL) {
         TR_ASSERT_FATAL(_methodBuilder->returnSymbol() == NULL,
@@ -1138,10 +1399,13 @@ void OMR::IlBuilder::Return()
         cfg()->addEdge(_currentBlock, cfg()->getEnd());
         setDoesNotComeBack();
     }
+
+    rs.record();
 }
 
 void OMR::IlBuilder::Return(TR::IlValue *value)
 {
+    RecordedService rs(this, _methodBuilder, OMR::StatementName::STATEMENT_RETURNVALUE, value);
     TR::DataType retType = value->getDataType();
     if (value->getDataType() == TR::Int8 || value->getDataType() == TR::Int16
         || (Word == Int64 && value->getDataType() == TR::Int32)) {
@@ -1178,10 +1442,13 @@ void OMR::IlBuilder::Return(TR::IlValue *value)
         cfg()->addEdge(_currentBlock, cfg()->getEnd());
         setDoesNotComeBack();
     }
+
+    rs.record();
 }
 
 TR::IlValue *OMR::IlBuilder::Sub(TR::IlValue *left, TR::IlValue *right)
 {
+    RecordedService rs(this, _methodBuilder, OMR::StatementName::STATEMENT_SUB, left, right);
     TR::IlValue *returnValue = NULL;
     if (left->getDataType() == TR::Address) {
         TR::IlValue *zero;
@@ -1217,6 +1484,7 @@ TR::IlValue *OMR::IlBuilder::Sub(TR::IlValue *left, TR::IlValue *right)
         returnValue = binaryOpFromOpMap(TR::ILOpCode::subtractOpCode, left, right);
     }
     TraceIL("IlBuilder[ %p ]::%d is Sub %d - %d\n", this, returnValue->getID(), left->getID(), right->getID());
+    rs.recordWithResult(returnValue);
     return returnValue;
 }
 
@@ -1232,6 +1500,7 @@ static TR::ILOpCodes unsignedAddOpCode(TR::DataType type)
 
 TR::IlValue *OMR::IlBuilder::Add(TR::IlValue *left, TR::IlValue *right)
 {
+    RecordedService rs(this, _methodBuilder, OMR::StatementName::STATEMENT_ADD, left, right);
     TR::IlValue *returnValue = NULL;
     if (left->getDataType() == TR::Address) {
         if (TR::Compiler->target.is64Bit() && right->getDataType() == TR::Int32) {
@@ -1245,6 +1514,7 @@ TR::IlValue *OMR::IlBuilder::Add(TR::IlValue *left, TR::IlValue *right)
         returnValue = binaryOpFromOpMap(addOpCode, left, right);
     }
     TraceIL("IlBuilder[ %p ]::%d is Add %d + %d\n", this, returnValue->getID(), left->getID(), right->getID());
+    rs.recordWithResult(returnValue);
     return returnValue;
 }
 
@@ -1403,15 +1673,19 @@ TR::IlValue *OMR::IlBuilder::MulWithOverflow(TR::IlBuilder **handler, TR::IlValu
 
 TR::IlValue *OMR::IlBuilder::Mul(TR::IlValue *left, TR::IlValue *right)
 {
+    RecordedService rs(this, _methodBuilder, OMR::StatementName::STATEMENT_MUL, left, right);
     TR::IlValue *returnValue = binaryOpFromOpMap(TR::ILOpCode::multiplyOpCode, left, right);
     TraceIL("IlBuilder[ %p ]::%d is Mul %d * %d\n", this, returnValue->getID(), left->getID(), right->getID());
+    rs.recordWithResult(returnValue);
     return returnValue;
 }
 
 TR::IlValue *OMR::IlBuilder::Div(TR::IlValue *left, TR::IlValue *right)
 {
+    RecordedService rs(this, _methodBuilder, OMR::StatementName::STATEMENT_DIV, left, right);
     TR::IlValue *returnValue = binaryOpFromOpMap(TR::ILOpCode::divideOpCode, left, right);
     TraceIL("IlBuilder[ %p ]::%d is Div %d / %d\n", this, returnValue->getID(), left->getID(), right->getID());
+    rs.recordWithResult(returnValue);
     return returnValue;
 }
 
@@ -1436,6 +1710,7 @@ TR::IlValue *OMR::IlBuilder::UnsignedDiv(TR::IlValue *left, TR::IlValue *right)
 
 TR::IlValue *OMR::IlBuilder::Rem(TR::IlValue *left, TR::IlValue *right)
 {
+    RecordedService rs(this, _methodBuilder, OMR::StatementName::STATEMENT_REM, left, right);
     TR::DataType returnType = left->getDataType();
 
     // No code generators currently support the brem or srem opcodes. If we
@@ -1451,6 +1726,7 @@ TR::IlValue *OMR::IlBuilder::Rem(TR::IlValue *left, TR::IlValue *right)
     if (returnValue->getDataType() != returnType)
         returnValue = ConvertTo(_types->PrimitiveType(returnType), returnValue);
 
+    rs.recordWithResult(returnValue);
     return returnValue;
 }
 
@@ -1490,22 +1766,28 @@ TR::IlValue *OMR::IlBuilder::UnsignedRem(TR::IlValue *left, TR::IlValue *right)
 
 TR::IlValue *OMR::IlBuilder::And(TR::IlValue *left, TR::IlValue *right)
 {
+    RecordedService rs(this, _methodBuilder, OMR::StatementName::STATEMENT_AND, left, right);
     TR::IlValue *returnValue = binaryOpFromOpMap(TR::ILOpCode::andOpCode, left, right);
     TraceIL("IlBuilder[ %p ]::%d is And %d & %d\n", this, returnValue->getID(), left->getID(), right->getID());
+    rs.recordWithResult(returnValue);
     return returnValue;
 }
 
 TR::IlValue *OMR::IlBuilder::Or(TR::IlValue *left, TR::IlValue *right)
 {
+    RecordedService rs(this, _methodBuilder, OMR::StatementName::STATEMENT_OR, left, right);
     TR::IlValue *returnValue = binaryOpFromOpMap(TR::ILOpCode::orOpCode, left, right);
     TraceIL("IlBuilder[ %p ]::%d is Or %d | %d\n", this, returnValue->getID(), left->getID(), right->getID());
+    rs.recordWithResult(returnValue);
     return returnValue;
 }
 
 TR::IlValue *OMR::IlBuilder::Xor(TR::IlValue *left, TR::IlValue *right)
 {
+    RecordedService rs(this, _methodBuilder, OMR::StatementName::STATEMENT_XOR, left, right);
     TR::IlValue *returnValue = binaryOpFromOpMap(TR::ILOpCode::xorOpCode, left, right);
     TraceIL("IlBuilder[ %p ]::%d is Xor %d ^ %d\n", this, returnValue->getID(), left->getID(), right->getID());
+    rs.recordWithResult(returnValue);
     return returnValue;
 }
 
@@ -1543,23 +1825,29 @@ TR::IlValue *OMR::IlBuilder::shiftOpFromOpMap(OpCodeMapper mapOp, TR::IlValue *l
 
 TR::IlValue *OMR::IlBuilder::ShiftL(TR::IlValue *v, TR::IlValue *amount)
 {
+    RecordedService rs(this, _methodBuilder, OMR::StatementName::STATEMENT_SHIFTL, v, amount);
     TR::IlValue *returnValue = shiftOpFromOpMap(TR::ILOpCode::shiftLeftOpCode, v, amount);
     TraceIL("IlBuilder[ %p ]::%d is shl %d << %d\n", this, returnValue->getID(), v->getID(), amount->getID());
+    rs.recordWithResult(returnValue);
     return returnValue;
 }
 
 TR::IlValue *OMR::IlBuilder::ShiftR(TR::IlValue *v, TR::IlValue *amount)
 {
+    RecordedService rs(this, _methodBuilder, OMR::StatementName::STATEMENT_SHIFTR, v, amount);
     TR::IlValue *returnValue = shiftOpFromOpMap(TR::ILOpCode::shiftRightOpCode, v, amount);
     TraceIL("IlBuilder[ %p ]::%d is arithmetic shr %d >> %d\n", this, returnValue->getID(), v->getID(),
         amount->getID());
+    rs.recordWithResult(returnValue);
     return returnValue;
 }
 
 TR::IlValue *OMR::IlBuilder::UnsignedShiftR(TR::IlValue *v, TR::IlValue *amount)
 {
+    RecordedService rs(this, _methodBuilder, OMR::StatementName::STATEMENT_UNSIGNEDSHIFTR, v, amount);
     TR::IlValue *returnValue = shiftOpFromOpMap(TR::ILOpCode::unsignedShiftRightOpCode, v, amount);
     TraceIL("IlBuilder[ %p ]::%d is unsigned shr %d >> %d\n", this, returnValue->getID(), v->getID(), amount->getID());
+    rs.recordWithResult(returnValue);
     return returnValue;
 }
 
@@ -1761,8 +2049,10 @@ TR::IlBuilder::JBCondition *OMR::IlBuilder::MakeCondition(TR::IlBuilder *conditi
 
 TR::IlValue *OMR::IlBuilder::EqualTo(TR::IlValue *left, TR::IlValue *right)
 {
+    RecordedService rs(this, _methodBuilder, OMR::StatementName::STATEMENT_EQUALTO, left, right);
     TR::IlValue *returnValue = compareOp(TR_cmpEQ, false, left, right);
     TraceIL("IlBuilder[ %p ]::%d is EqualTo %d == %d?\n", this, returnValue->getID(), left->getID(), right->getID());
+    rs.recordWithResult(returnValue);
     return returnValue;
 }
 
@@ -1779,71 +2069,87 @@ void OMR::IlBuilder::integerizeAddresses(TR::IlValue **leftPtr, TR::IlValue **ri
 
 TR::IlValue *OMR::IlBuilder::LessThan(TR::IlValue *left, TR::IlValue *right)
 {
+    RecordedService rs(this, _methodBuilder, OMR::StatementName::STATEMENT_LESSTHAN, left, right);
     integerizeAddresses(&left, &right);
     TR::IlValue *returnValue = compareOp(TR_cmpLT, false, left, right);
     TraceIL("IlBuilder[ %p ]::%d is LessThan %d < %d?\n", this, returnValue->getID(), left->getID(), right->getID());
+    rs.recordWithResult(returnValue);
     return returnValue;
 }
 
 TR::IlValue *OMR::IlBuilder::UnsignedLessThan(TR::IlValue *left, TR::IlValue *right)
 {
+    RecordedService rs(this, _methodBuilder, OMR::StatementName::STATEMENT_UNSIGNEDLESSTHAN, left, right);
     integerizeAddresses(&left, &right);
     TR::IlValue *returnValue = compareOp(TR_cmpLT, true, left, right);
     TraceIL("IlBuilder[ %p ]::%d is UnsignedLessThan %d < %d?\n", this, returnValue->getID(), left->getID(),
         right->getID());
+    rs.recordWithResult(returnValue);
     return returnValue;
 }
 
 TR::IlValue *OMR::IlBuilder::LessOrEqualTo(TR::IlValue *left, TR::IlValue *right)
 {
+    RecordedService rs(this, _methodBuilder, OMR::StatementName::STATEMENT_LESSOREQUALTO, left, right);
     integerizeAddresses(&left, &right);
     TR::IlValue *returnValue = compareOp(TR_cmpLE, false, left, right);
     TraceIL("IlBuilder[ %p ]::%d is LessOrEqualTo %d <= %d?\n", this, returnValue->getID(), left->getID(),
         right->getID());
+    rs.recordWithResult(returnValue);
     return returnValue;
 }
 
 TR::IlValue *OMR::IlBuilder::UnsignedLessOrEqualTo(TR::IlValue *left, TR::IlValue *right)
 {
+    RecordedService rs(this, _methodBuilder, OMR::StatementName::STATEMENT_UNSIGNEDLESSOREQUALTO, left, right);
     integerizeAddresses(&left, &right);
     TR::IlValue *returnValue = compareOp(TR_cmpLE, true, left, right);
     TraceIL("IlBuilder[ %p ]::%d is UnsignedLessOrEqualTo %d <= %d?\n", this, returnValue->getID(), left->getID(),
         right->getID());
+    rs.recordWithResult(returnValue);
     return returnValue;
 }
 
 TR::IlValue *OMR::IlBuilder::GreaterThan(TR::IlValue *left, TR::IlValue *right)
 {
+    RecordedService rs(this, _methodBuilder, OMR::StatementName::STATEMENT_GREATERTHAN, left, right);
     integerizeAddresses(&left, &right);
     TR::IlValue *returnValue = compareOp(TR_cmpGT, false, left, right);
     TraceIL("IlBuilder[ %p ]::%d is GreaterThan %d > %d?\n", this, returnValue->getID(), left->getID(), right->getID());
+    rs.recordWithResult(returnValue);
     return returnValue;
 }
 
 TR::IlValue *OMR::IlBuilder::UnsignedGreaterThan(TR::IlValue *left, TR::IlValue *right)
 {
+    RecordedService rs(this, _methodBuilder, OMR::StatementName::STATEMENT_UNSIGNEDGREATERTHAN, left, right);
     integerizeAddresses(&left, &right);
     TR::IlValue *returnValue = compareOp(TR_cmpGT, true, left, right);
     TraceIL("IlBuilder[ %p ]::%d is UnsignedGreaterThan %d > %d?\n", this, returnValue->getID(), left->getID(),
         right->getID());
+    rs.recordWithResult(returnValue);
     return returnValue;
 }
 
 TR::IlValue *OMR::IlBuilder::GreaterOrEqualTo(TR::IlValue *left, TR::IlValue *right)
 {
+    RecordedService rs(this, _methodBuilder, OMR::StatementName::STATEMENT_GREATEROREQUALTO, left, right);
     integerizeAddresses(&left, &right);
     TR::IlValue *returnValue = compareOp(TR_cmpGE, false, left, right);
     TraceIL("IlBuilder[ %p ]::%d is GreaterOrEqualTo %d >= %d?\n", this, returnValue->getID(), left->getID(),
         right->getID());
+    rs.recordWithResult(returnValue);
     return returnValue;
 }
 
 TR::IlValue *OMR::IlBuilder::UnsignedGreaterOrEqualTo(TR::IlValue *left, TR::IlValue *right)
 {
+    RecordedService rs(this, _methodBuilder, OMR::StatementName::STATEMENT_UNSIGNEDGREATEROREQUALTO, left, right);
     integerizeAddresses(&left, &right);
     TR::IlValue *returnValue = compareOp(TR_cmpGE, true, left, right);
     TraceIL("IlBuilder[ %p ]::%d is UnsignedGreaterOrEqualTo %d >= %d?\n", this, returnValue->getID(), left->getID(),
         right->getID());
+    rs.recordWithResult(returnValue);
     return returnValue;
 }
 
@@ -1991,19 +2297,12 @@ TR::IlValue *OMR::IlBuilder::Call(const char *functionName, int32_t numArgs, ...
     va_start(args, numArgs);
     TR::IlValue **argValues = processCallArgs(_comp, numArgs, args);
     va_end(args);
-    TR::ResolvedMethod *resolvedMethod = _methodBuilder->lookupFunction(functionName);
-    if (resolvedMethod == NULL && _methodBuilder->RequestFunction(functionName))
-        resolvedMethod = _methodBuilder->lookupFunction(functionName);
-    TR_ASSERT_FATAL(resolvedMethod, "Could not identify function %s\n", functionName);
-
-    TR::SymbolReference *methodSymRef
-        = symRefTab()->findOrCreateStaticMethodSymbol(JITTED_METHOD_INDEX, -1, resolvedMethod);
-    methodSymRef->getSymbol()->getMethodSymbol()->setLinkage(TR_System);
-    return genCall("Call", methodSymRef, numArgs, argValues);
+    return Call(functionName, numArgs, argValues);
 }
 
 TR::IlValue *OMR::IlBuilder::Call(const char *functionName, int32_t numArgs, TR::IlValue **argValues)
 {
+    RecordedService rs(this, _methodBuilder, OMR::StatementName::STATEMENT_CALL);
     TR::ResolvedMethod *resolvedMethod = _methodBuilder->lookupFunction(functionName);
     if (resolvedMethod == NULL && _methodBuilder->RequestFunction(functionName))
         resolvedMethod = _methodBuilder->lookupFunction(functionName);
@@ -2012,7 +2311,17 @@ TR::IlValue *OMR::IlBuilder::Call(const char *functionName, int32_t numArgs, TR:
     TR::SymbolReference *methodSymRef
         = symRefTab()->findOrCreateStaticMethodSymbol(JITTED_METHOD_INDEX, -1, resolvedMethod);
     methodSymRef->getSymbol()->getMethodSymbol()->setLinkage(TR_System);
-    return genCall("Call", methodSymRef, numArgs, argValues);
+    TR::IlValue *returnValue = genCall("Call", methodSymRef, numArgs, argValues);
+
+    TR::JitBuilderRecorder *rec = rs.beginWithResult(returnValue);
+    if (rec != NULL) {
+        rec->String(functionName);
+        rec->Number(numArgs);
+        for (int32_t a = 0; a < numArgs; a++)
+            rs.value(argValues[a]);
+        rs.end();
+    }
+    return returnValue;
 }
 
 TR::IlValue *OMR::IlBuilder::genCall(const char *name, TR::SymbolReference *methodSymRef, int32_t numArgs,
@@ -2251,10 +2560,17 @@ void OMR::IlBuilder::IfCmpNotEqualZero(TR::IlBuilder **target, TR::IlValue *cond
 
 void OMR::IlBuilder::IfCmpNotEqualZero(TR::IlBuilder *target, TR::IlValue *condition)
 {
+    RecordedService rs(this, _methodBuilder, OMR::StatementName::STATEMENT_IFCMPNOTEQUALZERO, condition);
     TR_ASSERT_FATAL(target != NULL, "This IfCmpNotEqualZero requires a non-NULL builder object");
     TraceIL("IlBuilder[ %p ]::IfCmpNotEqualZero %d? -> [ %p ] B%d\n", this, condition->getID(), target,
         target->getEntry()->getNumber());
     ifCmpNotEqualZero(condition, target->getEntry());
+
+    TR::JitBuilderRecorder *rec = rs.begin();
+    if (rec != NULL) {
+        rs.builder(target);
+        rs.end();
+    }
 }
 
 void OMR::IlBuilder::IfCmpNotEqual(TR::IlBuilder **target, TR::IlValue *left, TR::IlValue *right)
@@ -2265,10 +2581,17 @@ void OMR::IlBuilder::IfCmpNotEqual(TR::IlBuilder **target, TR::IlValue *left, TR
 
 void OMR::IlBuilder::IfCmpNotEqual(TR::IlBuilder *target, TR::IlValue *left, TR::IlValue *right)
 {
+    RecordedService rs(this, _methodBuilder, OMR::StatementName::STATEMENT_IFCMPNOTEQUAL, left, right);
     TR_ASSERT_FATAL(target != NULL, "This IfCmpNotEqual requires a non-NULL builder object");
     TraceIL("IlBuilder[ %p ]::IfCmpNotEqual %d == %d? -> [ %p ] B%d\n", this, left->getID(), right->getID(), target,
         target->getEntry()->getNumber());
     ifCmpCondition(TR_cmpNE, false, left, right, target->getEntry());
+
+    TR::JitBuilderRecorder *rec = rs.begin();
+    if (rec != NULL) {
+        rs.builder(target);
+        rs.end();
+    }
 }
 
 void OMR::IlBuilder::IfCmpEqualZero(TR::IlBuilder **target, TR::IlValue *condition)
@@ -2279,10 +2602,17 @@ void OMR::IlBuilder::IfCmpEqualZero(TR::IlBuilder **target, TR::IlValue *conditi
 
 void OMR::IlBuilder::IfCmpEqualZero(TR::IlBuilder *target, TR::IlValue *condition)
 {
+    RecordedService rs(this, _methodBuilder, OMR::StatementName::STATEMENT_IFCMPEQUALZERO, condition);
     TR_ASSERT_FATAL(target != NULL, "This IfCmpEqualZero requires a non-NULL builder object");
     TraceIL("IlBuilder[ %p ]::IfCmpEqualZero %d == 0? -> [ %p ] B%d\n", this, condition->getID(), target,
         target->getEntry()->getNumber());
     ifCmpEqualZero(condition, target->getEntry());
+
+    TR::JitBuilderRecorder *rec = rs.begin();
+    if (rec != NULL) {
+        rs.builder(target);
+        rs.end();
+    }
 }
 
 void OMR::IlBuilder::IfCmpEqual(TR::IlBuilder **target, TR::IlValue *left, TR::IlValue *right)
@@ -2293,10 +2623,17 @@ void OMR::IlBuilder::IfCmpEqual(TR::IlBuilder **target, TR::IlValue *left, TR::I
 
 void OMR::IlBuilder::IfCmpEqual(TR::IlBuilder *target, TR::IlValue *left, TR::IlValue *right)
 {
+    RecordedService rs(this, _methodBuilder, OMR::StatementName::STATEMENT_IFCMPEQUAL, left, right);
     TR_ASSERT_FATAL(target != NULL, "This IfCmpEqual requires a non-NULL builder object");
     TraceIL("IlBuilder[ %p ]::IfCmpEqual %d == %d? -> [ %p ] B%d\n", this, left->getID(), right->getID(), target,
         target->getEntry()->getNumber());
     ifCmpCondition(TR_cmpEQ, false, left, right, target->getEntry());
+
+    TR::JitBuilderRecorder *rec = rs.begin();
+    if (rec != NULL) {
+        rs.builder(target);
+        rs.end();
+    }
 }
 
 void OMR::IlBuilder::IfCmpLessThan(TR::IlBuilder **target, TR::IlValue *left, TR::IlValue *right)
@@ -2307,10 +2644,17 @@ void OMR::IlBuilder::IfCmpLessThan(TR::IlBuilder **target, TR::IlValue *left, TR
 
 void OMR::IlBuilder::IfCmpLessThan(TR::IlBuilder *target, TR::IlValue *left, TR::IlValue *right)
 {
+    RecordedService rs(this, _methodBuilder, OMR::StatementName::STATEMENT_IFCMPLESSTHAN, left, right);
     TR_ASSERT_FATAL(target != NULL, "This IfCmpLessThan requires a non-NULL builder object");
     TraceIL("IlBuilder[ %p ]::IfCmpLessThan %d < %d? -> [ %p ] B%d\n", this, left->getID(), right->getID(), target,
         target->getEntry()->getNumber());
     ifCmpCondition(TR_cmpLT, false, left, right, target->getEntry());
+
+    TR::JitBuilderRecorder *rec = rs.begin();
+    if (rec != NULL) {
+        rs.builder(target);
+        rs.end();
+    }
 }
 
 void OMR::IlBuilder::IfCmpUnsignedLessThan(TR::IlBuilder **target, TR::IlValue *left, TR::IlValue *right)
@@ -2321,10 +2665,17 @@ void OMR::IlBuilder::IfCmpUnsignedLessThan(TR::IlBuilder **target, TR::IlValue *
 
 void OMR::IlBuilder::IfCmpUnsignedLessThan(TR::IlBuilder *target, TR::IlValue *left, TR::IlValue *right)
 {
+    RecordedService rs(this, _methodBuilder, OMR::StatementName::STATEMENT_IFCMPUNSIGNEDLESSTHAN, left, right);
     TR_ASSERT_FATAL(target != NULL, "This IfCmpUnsignedLessThan requires a non-NULL builder object");
     TraceIL("IlBuilder[ %p ]::IfCmpUnsignedLessThan %d < %d? -> [ %p ] B%d\n", this, left->getID(), right->getID(),
         target, target->getEntry()->getNumber());
     ifCmpCondition(TR_cmpLT, true, left, right, target->getEntry());
+
+    TR::JitBuilderRecorder *rec = rs.begin();
+    if (rec != NULL) {
+        rs.builder(target);
+        rs.end();
+    }
 }
 
 void OMR::IlBuilder::IfCmpLessOrEqual(TR::IlBuilder **target, TR::IlValue *left, TR::IlValue *right)
@@ -2335,10 +2686,17 @@ void OMR::IlBuilder::IfCmpLessOrEqual(TR::IlBuilder **target, TR::IlValue *left,
 
 void OMR::IlBuilder::IfCmpLessOrEqual(TR::IlBuilder *target, TR::IlValue *left, TR::IlValue *right)
 {
+    RecordedService rs(this, _methodBuilder, OMR::StatementName::STATEMENT_IFCMPLESSOREQUAL, left, right);
     TR_ASSERT_FATAL(target != NULL, "This IfCmpLessOrEqual requires a non-NULL builder object");
     TraceIL("IlBuilder[ %p ]::IfCmpLessOrEqual %d <= %d? -> [ %p ] B%d\n", this, left->getID(), right->getID(), target,
         target->getEntry()->getNumber());
     ifCmpCondition(TR_cmpLE, false, left, right, target->getEntry());
+
+    TR::JitBuilderRecorder *rec = rs.begin();
+    if (rec != NULL) {
+        rs.builder(target);
+        rs.end();
+    }
 }
 
 void OMR::IlBuilder::IfCmpUnsignedLessOrEqual(TR::IlBuilder **target, TR::IlValue *left, TR::IlValue *right)
@@ -2349,10 +2707,17 @@ void OMR::IlBuilder::IfCmpUnsignedLessOrEqual(TR::IlBuilder **target, TR::IlValu
 
 void OMR::IlBuilder::IfCmpUnsignedLessOrEqual(TR::IlBuilder *target, TR::IlValue *left, TR::IlValue *right)
 {
+    RecordedService rs(this, _methodBuilder, OMR::StatementName::STATEMENT_IFCMPUNSIGNEDLESSOREQUAL, left, right);
     TR_ASSERT_FATAL(target != NULL, "This IfCmpUnsignedLessOrEqual requires a non-NULL builder object");
     TraceIL("IlBuilder[ %p ]::IfCmpUnsignedLessOrEqual %d <= %d? -> [ %p ] B%d\n", this, left->getID(), right->getID(),
         target, target->getEntry()->getNumber());
     ifCmpCondition(TR_cmpLE, true, left, right, target->getEntry());
+
+    TR::JitBuilderRecorder *rec = rs.begin();
+    if (rec != NULL) {
+        rs.builder(target);
+        rs.end();
+    }
 }
 
 void OMR::IlBuilder::IfCmpGreaterThan(TR::IlBuilder **target, TR::IlValue *left, TR::IlValue *right)
@@ -2363,9 +2728,16 @@ void OMR::IlBuilder::IfCmpGreaterThan(TR::IlBuilder **target, TR::IlValue *left,
 
 void OMR::IlBuilder::IfCmpGreaterThan(TR::IlBuilder *target, TR::IlValue *left, TR::IlValue *right)
 {
+    RecordedService rs(this, _methodBuilder, OMR::StatementName::STATEMENT_IFCMPGREATERTHAN, left, right);
     TraceIL("IlBuilder[ %p ]::IfCmpGreaterThan %d > %d? -> [ %p ] B%d\n", this, left->getID(), right->getID(), target,
         target->getEntry()->getNumber());
     ifCmpCondition(TR_cmpGT, false, left, right, target->getEntry());
+
+    TR::JitBuilderRecorder *rec = rs.begin();
+    if (rec != NULL) {
+        rs.builder(target);
+        rs.end();
+    }
 }
 
 void OMR::IlBuilder::IfCmpUnsignedGreaterThan(TR::IlBuilder **target, TR::IlValue *left, TR::IlValue *right)
@@ -2376,9 +2748,16 @@ void OMR::IlBuilder::IfCmpUnsignedGreaterThan(TR::IlBuilder **target, TR::IlValu
 
 void OMR::IlBuilder::IfCmpUnsignedGreaterThan(TR::IlBuilder *target, TR::IlValue *left, TR::IlValue *right)
 {
+    RecordedService rs(this, _methodBuilder, OMR::StatementName::STATEMENT_IFCMPUNSIGNEDGREATERTHAN, left, right);
     TraceIL("IlBuilder[ %p ]::IfCmpUnsignedGreaterThan %d > %d? -> [ %p ] B%d\n", this, left->getID(), right->getID(),
         target, target->getEntry()->getNumber());
     ifCmpCondition(TR_cmpGT, true, left, right, target->getEntry());
+
+    TR::JitBuilderRecorder *rec = rs.begin();
+    if (rec != NULL) {
+        rs.builder(target);
+        rs.end();
+    }
 }
 
 void OMR::IlBuilder::IfCmpGreaterOrEqual(TR::IlBuilder **target, TR::IlValue *left, TR::IlValue *right)
@@ -2389,9 +2768,16 @@ void OMR::IlBuilder::IfCmpGreaterOrEqual(TR::IlBuilder **target, TR::IlValue *le
 
 void OMR::IlBuilder::IfCmpGreaterOrEqual(TR::IlBuilder *target, TR::IlValue *left, TR::IlValue *right)
 {
+    RecordedService rs(this, _methodBuilder, OMR::StatementName::STATEMENT_IFCMPGREATEROREQUAL, left, right);
     TraceIL("IlBuilder[ %p ]::IfCmpGreaterOrEqual %d >= %d? -> [ %p ] B%d\n", this, left->getID(), right->getID(),
         target, target->getEntry()->getNumber());
     ifCmpCondition(TR_cmpGE, false, left, right, target->getEntry());
+
+    TR::JitBuilderRecorder *rec = rs.begin();
+    if (rec != NULL) {
+        rs.builder(target);
+        rs.end();
+    }
 }
 
 void OMR::IlBuilder::IfCmpUnsignedGreaterOrEqual(TR::IlBuilder **target, TR::IlValue *left, TR::IlValue *right)
@@ -2402,9 +2788,16 @@ void OMR::IlBuilder::IfCmpUnsignedGreaterOrEqual(TR::IlBuilder **target, TR::IlV
 
 void OMR::IlBuilder::IfCmpUnsignedGreaterOrEqual(TR::IlBuilder *target, TR::IlValue *left, TR::IlValue *right)
 {
+    RecordedService rs(this, _methodBuilder, OMR::StatementName::STATEMENT_IFCMPUNSIGNEDGREATEROREQUAL, left, right);
     TraceIL("IlBuilder[ %p ]::IfCmpUnsignedGreaterOrEqual %d >= %d? -> [ %p ] B%d\n", this, left->getID(),
         right->getID(), target, target->getEntry()->getNumber());
     ifCmpCondition(TR_cmpGE, true, left, right, target->getEntry());
+
+    TR::JitBuilderRecorder *rec = rs.begin();
+    if (rec != NULL) {
+        rs.builder(target);
+        rs.end();
+    }
 }
 
 void OMR::IlBuilder::ifCmpCondition(TR_ComparisonTypes ct, bool isUnsignedCmp, TR::IlValue *left, TR::IlValue *right,
@@ -2456,6 +2849,7 @@ void OMR::IlBuilder::appendGoto(TR::Block *destBlock)
  */
 void OMR::IlBuilder::IfThenElse(TR::IlBuilder **thenPath, TR::IlBuilder **elsePath, TR::IlValue *condition)
 {
+    RecordedService rs(this, _methodBuilder, OMR::StatementName::STATEMENT_IFTHENELSE, condition);
     TraceIL("IlBuilder[ %p ]::IfThenElse starting\n", this);
     TR_ASSERT_FATAL(thenPath != NULL || elsePath != NULL, "IfThenElse needs at least one conditional path");
 
@@ -2514,6 +2908,13 @@ void OMR::IlBuilder::IfThenElse(TR::IlBuilder **thenPath, TR::IlBuilder **elsePa
     appendBlock(mergeBlock);
 
     TraceIL("IlBuilder[ %p ]::IfThenElse complete\n", this);
+
+    TR::JitBuilderRecorder *rec = rs.begin();
+    if (rec != NULL) {
+        rs.builder(thenPath != NULL ? *thenPath : NULL);
+        rs.builder(elsePath != NULL ? *elsePath : NULL);
+        rs.end();
+    }
 }
 
 void OMR::IlBuilder::traceSwitch(const char *name, TR::IlValue *selectorValue, TR::IlBuilder *defaultBuilder,
@@ -2593,6 +2994,7 @@ TR::IlBuilder::JBCase *OMR::IlBuilder::MakeCase(int32_t caseValue, TR::IlBuilder
 
 TR::IlValue *OMR::IlBuilder::Select(TR::IlValue *condition, TR::IlValue *trueValue, TR::IlValue *falseValue)
 {
+    RecordedService rs(this, _methodBuilder, OMR::StatementName::STATEMENT_SELECT, condition, trueValue, falseValue);
     TR_ASSERT_FATAL(condition != NULL && trueValue != NULL && falseValue != NULL,
         "Select requires condition, trueValue and falseValue");
     TR::DataType dt = trueValue->getDataType();
@@ -2617,6 +3019,7 @@ TR::IlValue *OMR::IlBuilder::Select(TR::IlValue *condition, TR::IlValue *trueVal
 
     TraceIL("IlBuilder[ %p ]::%d is Select %d T (%d) F (%d)\n", this, result->getID(), condition->getID(),
         trueValue->getID(), falseValue->getID());
+    rs.recordWithResult(result);
     return result;
 }
 
@@ -2678,6 +3081,7 @@ void OMR::IlBuilder::generateSwitchCases(TR::Node *switchNode, TR::Node *default
 void OMR::IlBuilder::ForLoop(bool countsUp, const char *indVar, TR::IlBuilder **loopCode, TR::IlBuilder **breakBuilder,
     TR::IlBuilder **continueBuilder, TR::IlValue *initial, TR::IlValue *end, TR::IlValue *increment)
 {
+    RecordedService rs(this, _methodBuilder, OMR::StatementName::STATEMENT_FORLOOP, initial, end, increment);
     methodSymbol()->setMayHaveLoops(true);
     TR_ASSERT_FATAL(loopCode != NULL, "ForLoop needs to have loopCode builder");
     *loopCode = createBuilderIfNeeded(*loopCode);
@@ -2718,11 +3122,22 @@ void OMR::IlBuilder::ForLoop(bool countsUp, const char *indVar, TR::IlBuilder **
     // make sure any subsequent operations go into their own block *after* the loop
     appendBlock();
     TraceIL("IlBuilder[ %p ]::ForLoop complete\n", this);
+
+    TR::JitBuilderRecorder *rec = rs.begin();
+    if (rec != NULL) {
+        rec->Number((int8_t)countsUp);
+        rec->String(indVar);
+        rs.builder(*loopCode);
+        rs.builder(breakBuilder != NULL ? *breakBuilder : NULL);
+        rs.builder(continueBuilder != NULL ? *continueBuilder : NULL);
+        rs.end();
+    }
 }
 
 void OMR::IlBuilder::DoWhileLoop(const char *whileCondition, TR::IlBuilder **body, TR::IlBuilder **breakBuilder,
     TR::IlBuilder **continueBuilder)
 {
+    RecordedService rs(this, _methodBuilder, OMR::StatementName::STATEMENT_DOWHILELOOP);
     methodSymbol()->setMayHaveLoops(true);
     TR_ASSERT_FATAL(body != NULL, "doWhileLoop needs to have a body");
 
@@ -2757,11 +3172,21 @@ void OMR::IlBuilder::DoWhileLoop(const char *whileCondition, TR::IlBuilder **bod
     appendBlock();
 
     TraceIL("IlBuilder[ %p ]::DoWhileLoop complete\n", this);
+
+    TR::JitBuilderRecorder *rec = rs.begin();
+    if (rec != NULL) {
+        rec->String(whileCondition);
+        rs.builder(*body);
+        rs.builder(breakBuilder != NULL ? *breakBuilder : NULL);
+        rs.builder(continueBuilder != NULL ? *continueBuilder : NULL);
+        rs.end();
+    }
 }
 
 void OMR::IlBuilder::WhileDoLoop(const char *whileCondition, TR::IlBuilder **body, TR::IlBuilder **breakBuilder,
     TR::IlBuilder **continueBuilder)
 {
+    RecordedService rs(this, _methodBuilder, OMR::StatementName::STATEMENT_WHILEDOLOOP);
     methodSymbol()->setMayHaveLoops(true);
     TR_ASSERT_FATAL(body != NULL, "WhileDo needs to have a body");
     TraceIL("IlBuilder[ %p ]::WhileDoLoop while %s do body %p\n", this, whileCondition, *body);
@@ -2792,6 +3217,15 @@ void OMR::IlBuilder::WhileDoLoop(const char *whileCondition, TR::IlBuilder **bod
     AppendBuilder(done);
 
     TraceIL("IlBuilder[ %p ]::WhileLoop complete\n", this);
+
+    TR::JitBuilderRecorder *rec = rs.begin();
+    if (rec != NULL) {
+        rec->String(whileCondition);
+        rs.builder(*body);
+        rs.builder(breakBuilder != NULL ? *breakBuilder : NULL);
+        rs.builder(continueBuilder != NULL ? *continueBuilder : NULL);
+        rs.end();
+    }
 }
 
 void *OMR::IlBuilder::client()
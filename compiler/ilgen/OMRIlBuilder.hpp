@@ -743,6 +743,10 @@ protected:
     TR::IlValue *newValue(TR::DataType dt, TR::Node *n = NULL);
     void defineValue(const char *name, TR::IlType *dt);
 
+    // hides IlInjector::genTreeTop so all IL generated by builder services is seen by noteGeneratedIL()
+    TR::TreeTop *genTreeTop(TR::Node *n);
+    void noteGeneratedIL();
+
     TR::Node *loadValue(TR::IlValue *v);
     void storeNode(TR::SymbolReference *symRef, TR::Node *v);
     void indirectStoreNode(TR::Node *addr, TR::Node *v);
@@ -33,6 +33,7 @@
 OMR::IlGeneratorMethodDetails::IlGeneratorMethodDetails(TR_ResolvedMethod *method)
     : _method(static_cast<TR::ResolvedMethod *>(method))
     , _ilVerifier(NULL)
+    , _statistics(NULL)
 {}
 
 bool OMR::IlGeneratorMethodDetails::sameAs(TR::IlGeneratorMethodDetails &other, TR_FrontEnd *) const
@@ -46,6 +46,7 @@ class TR_ResolvedMethod;
 
 namespace TR {
 class Compilation;
+class CompilationStatistics;
 class IlGeneratorMethodDetails;
 class IlVerifier;
 class ResolvedMethod;
@@ -84,6 +85,10 @@ public:
 
     TR::IlVerifier *getIlVerifier() { return _ilVerifier; }
 
+    void setCompilationStatistics(TR::CompilationStatistics *statistics) { _statistics = statistics; }
+
+    TR::CompilationStatistics *getCompilationStatistics() { return _statistics; }
+
     TR_IlGenerator *getIlGenerator(TR::ResolvedMethodSymbol *methodSymbol, TR_FrontEnd *fe, TR::Compilation *comp,
         TR::SymbolReferenceTable *symRefTab, bool forceClassLookahead, TR_InlineBlocks *blocksToInline);
 
@@ -91,6 +96,7 @@ protected:
     IlGeneratorMethodDetails()
         : _method(NULL)
         , _ilVerifier(NULL)
+        , _statistics(NULL)
     {}
 
     inline TR::IlGeneratorMethodDetails *self();
@@ -109,6 +115,7 @@ protected:
 
     TR::ResolvedMethod *_method;
     TR::IlVerifier *_ilVerifier;
+    TR::CompilationStatistics *_statistics;
 };
 
 } // namespace OMR
@@ -20,31 +20,32 @@
  *******************************************************************************/
 
 #include "infra/Assert.hpp"
+#include "ilgen/IlType.hpp"
 #include "ilgen/JitBuilderRecorder.hpp"
-
-namespace TR {
-class MethodBuilder;
-}
+#include "ilgen/MethodBuilder.hpp"
 
 OMR::JitBuilderRecorder::JitBuilderRecorder(const TR::MethodBuilder *mb, const char *fileName)
     : _mb(mb)
     , _nextID(0)
     , _idSize(8)
-    , _file(fileName, std::fstream::out | std::fstream::trunc)
+    , _complete(true)
+    , _file()
 {
-    start(); // initializes IDs 0 and 1 (reserved)
-}
+    // a buffer recorder has no file to write
+    if (fileName != NULL)
+        _file.open(fileName, std::fstream::out | std::fstream::trunc);
 
-OMR::JitBuilderRecorder::~JitBuilderRecorder() {}
-
-void OMR::JitBuilderRecorder::start()
-{
     // special reserved value, must do it first !
     StoreID(0);
 
     // another special reserved value, so do it first
     StoreID((const void *)1);
+}
 
+OMR::JitBuilderRecorder::~JitBuilderRecorder() {}
+
+void OMR::JitBuilderRecorder::start()
+{
     String(StatementName::RECORDER_SIGNATURE);
     Number(StatementName::VERSION_MAJOR);
     Number(StatementName::VERSION_MINOR);
@@ -58,25 +59,36 @@ void OMR::JitBuilderRecorder::Close()
     EndStatement();
 }
 
-OMR::JitBuilderRecorder::TypeID OMR::JitBuilderRecorder::getNewID()
+OMR::JitBuilderRecorder::TypeID OMR::JitBuilderRecorder::getNewID() { return _nextID++; }
+
+void OMR::JitBuilderRecorder::ensureIDSize()
 {
     // support for variable sized ID encoding
-    //  to avoid any synchronization issues in how decoders/encoders count IDs, use a statement to signal change
-    // check if we're close to 8-bit / 16-bit boundary
-    // need to leave space for one ID because these statements will not have been defined yet
-    //  and defining the statement needs an ID!
-    if (_nextID == (1 << 8) - 2) {
-        _idSize = 16;
-        Statement(StatementName::STATEMENT_ID16BIT);
-    } else if (_nextID == (1 << 16) - 2) {
-        _idSize = 32;
-        Statement(StatementName::STATEMENT_ID32BIT);
+    //  to avoid any synchronization issues in how decoders/encoders count IDs, use a marker to signal change
+    // the marker can only go between statements, so switch while there is still room for every new ID
+    //  the next statement could need (a statement creates only a handful of IDs)
+    const TypeID headroom = 16;
+    const char *marker = NULL;
+    uint8_t newSize = _idSize;
+    if (_idSize == 8 && _nextID + headroom > (1 << 8)) {
+        marker = StatementName::STATEMENT_ID16BIT;
+        newSize = 16;
+    } else if (_idSize == 16 && _nextID + headroom > (1 << 16)) {
+        marker = StatementName::STATEMENT_ID32BIT;
+        newSize = 32;
     }
 
-    return _nextID++;
+    if (marker == NULL)
+        return;
+
+    // reserved ID 1 followed by the marker, written with the old ID size
+    ID(1);
+    String(marker);
+    EndStatement();
+    _idSize = newSize;
 }
 
-OMR::JitBuilderRecorder::TypeID OMR::JitBuilderRecorder::myID() { return lookupID(_mb); }
+OMR::JitBuilderRecorder::TypeID OMR::JitBuilderRecorder::myID() { return lookupID(static_cast<const TR::IlBuilder *>(_mb)); }
 
 bool OMR::JitBuilderRecorder::knownID(const void *ptr)
 {
@@ -108,14 +120,19 @@ void OMR::JitBuilderRecorder::ensureStatementDefined(const char *s)
 
 void OMR::JitBuilderRecorder::end()
 {
+    // leave out the end marker so an incomplete recording cannot be mistaken for a replayable one
+    if (!_complete)
+        return;
+
     ID(1); // reserved ID to indicate end of file
     String(StatementName::JBIL_COMPLETE);
 }
 
-void OMR::JitBuilderRecorder::BeginStatement(const char *s) { BeginStatement(_mb, s); }
+void OMR::JitBuilderRecorder::BeginStatement(const char *s) { BeginStatement(static_cast<const TR::IlBuilder *>(_mb), s); }
 
-void OMR::JitBuilderRecorder::BeginStatement(const TR::MethodBuilder *b, const char *s)
+void OMR::JitBuilderRecorder::BeginStatement(const TR::IlBuilder *b, const char *s)
 {
+    ensureIDSize();
     ensureStatementDefined(s);
     Builder(b);
     Statement(s);
@@ -138,3 +155,69 @@ bool OMR::JitBuilderRecorder::EnsureAvailableID(const void *ptr)
     StoreID(ptr);
     return false; // ID was not available, but is now
 }
+
+void OMR::JitBuilderRecorder::DefineLocation(const char *name, const void *location)
+{
+    // the empty name stands for NULL
+    TR_ASSERT_FATAL(name != NULL && name[0] != '\0', "JBIL: a location needs a name");
+
+    NamedLocationMap::iterator it = _namedLocations.find(name);
+    if (it != _namedLocations.end()) {
+        // a replay could only resolve the name to one of the addresses
+        if (it->second != location)
+            setIncomplete();
+        return;
+    }
+
+    _namedLocations.insert(std::make_pair(std::string(name), location));
+
+    // an address given more than one name is written as the first one
+    _locationNames.insert(std::make_pair(location, std::string(name)));
+}
+
+void OMR::JitBuilderRecorder::Location(const void *location)
+{
+    if (location == NULL) {
+        String("");
+        return;
+    }
+
+    LocationNameMap::iterator it = _locationNames.find(location);
+    if (it == _locationNames.end()) {
+        // the raw address would mean nothing to a replay in another process
+        setIncomplete();
+        String("");
+        return;
+    }
+
+    String(it->second.c_str());
+}
+
+void OMR::JitBuilderRecorder::EnsureTypeDefined(const TR::IlType *constType)
+{
+    if (constType == NULL || knownID(constType))
+        return;
+
+    // types are defined outside of any builder
+    TR::IlType *type = const_cast<TR::IlType *>(constType);
+    if (type->isPointer()) {
+        TR::IlType *baseType = type->baseType();
+        EnsureTypeDefined(baseType);
+        BeginStatement((const TR::IlBuilder *)NULL, StatementName::STATEMENT_POINTERTYPE);
+        StoreID(type);
+        Type(type);
+        Type(baseType);
+    } else if (type->isStruct() || type->isUnion()) {
+        BeginStatement((const TR::IlBuilder *)NULL,
+            type->isStruct() ? StatementName::STATEMENT_DEFINESTRUCT : StatementName::STATEMENT_DEFINEUNION);
+        StoreID(type);
+        Type(type);
+        String(type->getName());
+    } else {
+        BeginStatement((const TR::IlBuilder *)NULL, StatementName::STATEMENT_PRIMITIVETYPE);
+        StoreID(type);
+        Type(type);
+        Number((int32_t)type->getPrimitiveType().getDataType());
+    }
+    EndStatement();
+}
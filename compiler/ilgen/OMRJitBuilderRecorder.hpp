@@ -25,6 +25,7 @@
 #include <iostream>
 #include <fstream>
 #include <map>
+#include <string>
 #include "ilgen/StatementNames.hpp"
 
 namespace TR {
@@ -40,12 +41,37 @@ class JitBuilderRecorder {
 public:
     typedef uint32_t TypeID;
     typedef std::map<const void *, TypeID> TypeMapID;
+    typedef std::map<const void *, std::string> LocationNameMap;
+    typedef std::map<std::string, const void *> NamedLocationMap;
 
     JitBuilderRecorder(const TR::MethodBuilder *mb, const char *fileName);
     virtual ~JitBuilderRecorder();
 
     void setMethodBuilderRecorder(TR::MethodBuilder *mb) { _mb = mb; }
 
+    /**
+     * @brief write the stream header
+     * Called by the MethodBuilder when recording begins rather than by the constructor, where the
+     * subclass overrides that write the output are not yet in place.
+     */
+    void start();
+
+    /**
+     * @brief mark the recording as not replayable, for example because a service that cannot be recorded was used
+     * An incomplete recording is closed without the end of stream marker.
+     */
+    void setIncomplete() { _complete = false; }
+
+    bool isComplete() { return _complete; }
+
+    /**
+     * @brief give an address the name the recording refers to it by
+     * Addresses are written as names and resolved again by the replay, so a recording can be replayed in a
+     * process where the addresses are different. DefineMemory, DefineGlobal and DefineFunction name their
+     * addresses after the definition; any other address passed to ConstAddress must be named by the client.
+     */
+    void DefineLocation(const char *name, const void *location);
+
     /**
      * @brief Subclasses override these functions to record to different output formats
      */
@@ -73,13 +99,16 @@ public:
 
     virtual void Value(const TR::IlValue *v) {}
 
-    virtual void Builder(const TR::MethodBuilder *b) {}
+    virtual void Builder(const TR::IlBuilder *b) {}
 
     virtual void Builder() {}
 
-    virtual void Location(const void *location) {}
+    /**
+     * @brief write the name of an address, or mark the recording incomplete if the address has no name
+     */
+    void Location(const void *location);
 
-    virtual void BeginStatement(const TR::MethodBuilder *b, const char *s);
+    virtual void BeginStatement(const TR::IlBuilder *b, const char *s);
     virtual void BeginStatement(const char *s);
 
     virtual void EndStatement() {}
@@ -87,11 +116,16 @@ public:
     void StoreID(const void *ptr);
     bool EnsureAvailableID(const void *ptr);
 
+    /**
+     * @brief write the statements that define a type, and any type it refers to, the first time it is used
+     */
+    void EnsureTypeDefined(const TR::IlType *type);
+
 protected:
-    void start();
     bool knownID(const void *ptr);
     TypeID lookupID(const void *ptr);
     void ensureStatementDefined(const char *s);
+    void ensureIDSize();
     void end();
 
     TypeID getNewID();
@@ -100,7 +134,10 @@ protected:
     const TR::MethodBuilder *_mb;
     TypeID _nextID;
     TypeMapID _idMap;
+    LocationNameMap _locationNames;
+    NamedLocationMap _namedLocations;
     uint8_t _idSize;
+    bool _complete;
 
     std::fstream _file;
 };
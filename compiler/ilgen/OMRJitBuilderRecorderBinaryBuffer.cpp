@@ -128,10 +128,4 @@ void OMR::JitBuilderRecorderBinaryBuffer::Value(const TR::IlValue *v) { ID(looku
 
 void OMR::JitBuilderRecorderBinaryBuffer::Builder(const TR::IlBuilder *b) { ID(lookupID(b)); }
 
-void OMR::JitBuilderRecorderBinaryBuffer::Location(const void *location)
-{
-    int64_t num = (int64_t)location;
-    Number(num);
-}
-
 void OMR::JitBuilderRecorderBinaryBuffer::EndStatement() {}
@@ -53,7 +53,6 @@ public:
     virtual void Type(const TR::IlType *type);
     virtual void Value(const TR::IlValue *v);
     virtual void Builder(const TR::IlBuilder *b);
-    virtual void Location(const void *location);
     virtual void EndStatement();
 
     std::vector<uint8_t> &buffer() { return _buf; }
@@ -68,6 +68,4 @@ void OMR::JitBuilderRecorderTextFile::Builder(const TR::IlBuilder *b)
         _file << "Def ";
 }
 
-void OMR::JitBuilderRecorderTextFile::Location(const void *location) { _file << "{" << location << "} "; }
-
 void OMR::JitBuilderRecorderTextFile::EndStatement() { _file << "\n"; }
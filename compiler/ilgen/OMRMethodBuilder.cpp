@@ -48,8 +48,10 @@
 #include "ilgen/IlGeneratorMethodDetails_inlines.hpp"
 #include "ilgen/IlInjector.hpp"
 #include "ilgen/IlBuilder.hpp"
+#include "ilgen/JitBuilderRecorder.hpp"
 #include "ilgen/MethodBuilder.hpp"
 #include "ilgen/BytecodeBuilder.hpp"
+#include "ilgen/TraceRecorder.hpp"
 #include "ilgen/TypeDictionary.hpp"
 #include "ilgen/VirtualMachineState.hpp"
 #include "ras/Logger.hpp"
@@ -127,10 +129,14 @@ OMR::MethodBuilder::MethodBuilder(TR::TypeDictionary *types, TR::VirtualMachineS
     , _vmState(vmState)
     , _bytecodeWorklist(NULL)
     , _bytecodeHasBeenInWorklist(NULL)
+    , _trace(NULL)
     , _inlineSiteIndex(-1)
     , _nextInlineSiteIndex(0)
     , _returnBuilder(NULL)
     , _returnSymbolName(NULL)
+    , _recorder(NULL)
+    , _recording(false)
+    , _recordingDepth(0)
 {
     _definingLine[0] = '\0';
 }
@@ -160,10 +166,14 @@ OMR::MethodBuilder::MethodBuilder(TR::MethodBuilder *callerMB, TR::VirtualMachin
     , _vmState(vmState)
     , _bytecodeWorklist(NULL)
     , _bytecodeHasBeenInWorklist(NULL)
+    , _trace(NULL)
     , _inlineSiteIndex(callerMB->getNextInlineSiteIndex())
     , _nextInlineSiteIndex(0)
     , _returnBuilder(NULL)
     , _returnSymbolName(NULL)
+    , _recorder(NULL)
+    , _recording(false)
+    , _recordingDepth(0)
 {
     _definingLine[0] = '\0';
     initialize(callerMB->_details, callerMB->_methodSymbol, callerMB->_fe, callerMB->_symRefTab);
@@ -475,6 +485,14 @@ void OMR::MethodBuilder::DefineLocal(const char *name, TR::IlType *dt)
 {
     TR_ASSERT_FATAL(_symbolTypes.find(name) == _symbolTypes.end(), "Symbol '%s' already defined", name);
     _symbolTypes.insert(std::make_pair(name, dt));
+
+    if (_recording && _recorder->isComplete()) {
+        _recorder->EnsureTypeDefined(dt);
+        _recorder->BeginStatement(static_cast<TR::IlBuilder *>(this), OMR::StatementName::STATEMENT_DEFINELOCAL);
+        _recorder->String(name);
+        _recorder->Type(dt);
+        _recorder->EndStatement();
+    }
 }
 
 void OMR::MethodBuilder::DefineMemory(const char *name, TR::IlType *dt, void *location)
@@ -547,6 +565,152 @@ void OMR::MethodBuilder::DefineFunction(const char * const name, const char * co
         numParms, parmNames, methodParmTypes, methodReturnType, entryPoint, 0);
 
     _functions.insert(std::make_pair(name, method));
+
+    // functions can be defined while buildIL() runs, from RequestFunction()
+    if (_recording && _recorder->isComplete())
+        recordFunction(name, method);
+}
+
+void OMR::MethodBuilder::beginRecording()
+{
+    if (_recorder == NULL)
+        return;
+
+    TR::JitBuilderRecorder *rec = _recorder;
+    TR::IlBuilder *self = static_cast<TR::IlBuilder *>(this);
+    rec->setMethodBuilderRecorder(static_cast<TR::MethodBuilder *>(this));
+    rec->start();
+
+    rec->BeginStatement((const TR::IlBuilder *)NULL, OMR::StatementName::STATEMENT_NEWMETHODBUILDER);
+    rec->StoreID(self);
+    rec->Builder(self);
+    rec->EndStatement();
+
+    // definitions made before IL generation, usually in the constructor, are written up front so a replay can
+    // set itself up before it is compiled
+    rec->BeginStatement(self, OMR::StatementName::STATEMENT_DEFINENAME);
+    rec->String(_methodName);
+    rec->EndStatement();
+
+    rec->BeginStatement(self, OMR::StatementName::STATEMENT_DEFINEFILE);
+    rec->String(_definingFile);
+    rec->EndStatement();
+
+    rec->BeginStatement(self, OMR::StatementName::STATEMENT_DEFINELINESTRING);
+    rec->String(_definingLine);
+    rec->EndStatement();
+
+    for (int32_t slot = 0; slot < _numParameters; slot++) {
+        const char *name = _symbolNameFromSlot.find(slot)->second;
+        TR::IlType *type = _symbolTypes.find(name)->second;
+        rec->EnsureTypeDefined(type);
+        rec->BeginStatement(self,
+            isSymbolAnArray(name) ? OMR::StatementName::STATEMENT_DEFINEARRAYPARAMETER
+                                  : OMR::StatementName::STATEMENT_DEFINEPARAMETER);
+        rec->String(name);
+        rec->Type(type);
+        rec->EndStatement();
+    }
+
+    rec->EnsureTypeDefined(_returnType);
+    rec->BeginStatement(self, OMR::StatementName::STATEMENT_DEFINERETURNTYPE);
+    rec->Type(_returnType);
+    rec->EndStatement();
+
+    for (SymbolTypeMap::iterator it = _symbolTypes.begin(); it != _symbolTypes.end(); ++it) {
+        const char *name = it->first;
+        if (_parameterSlot.find(name) != _parameterSlot.end() || _memoryLocations.find(name) != _memoryLocations.end()
+            || _globals.find(name) != _globals.end())
+            continue;
+
+        rec->EnsureTypeDefined(it->second);
+        rec->BeginStatement(self, OMR::StatementName::STATEMENT_DEFINELOCAL);
+        rec->String(name);
+        rec->Type(it->second);
+        rec->EndStatement();
+    }
+
+    for (MemoryLocationMap::iterator it = _memoryLocations.begin(); it != _memoryLocations.end(); ++it) {
+        TR::IlType *type = _symbolTypes.find(it->first)->second;
+        rec->EnsureTypeDefined(type);
+        rec->BeginStatement(self, OMR::StatementName::STATEMENT_DEFINEMEMORY);
+        rec->DefineLocation(it->first, it->second);
+        rec->String(it->first);
+        rec->Type(type);
+        rec->Location(it->second);
+        rec->EndStatement();
+    }
+
+    for (GlobalMap::iterator it = _globals.begin(); it != _globals.end(); ++it) {
+        TR::IlType *type = _symbolTypes.find(it->first)->second;
+        rec->EnsureTypeDefined(type);
+        rec->BeginStatement(self, OMR::StatementName::STATEMENT_DEFINEGLOBAL);
+        rec->DefineLocation(it->first, it->second);
+        rec->String(it->first);
+        rec->Type(type);
+        rec->Location(it->second);
+        rec->EndStatement();
+    }
+
+    for (FunctionMap::iterator it = _functions.begin(); it != _functions.end(); ++it)
+        recordFunction(it->first, it->second);
+
+    if (_newSymbolsAreTemps) {
+        rec->BeginStatement(self, OMR::StatementName::STATEMENT_ALLLOCALSHAVEBEENDEFINED);
+        rec->EndStatement();
+    }
+
+    _recording = true;
+    _recordingDepth = 0;
+}
+
+void OMR::MethodBuilder::endRecording(bool buildILSucceeded)
+{
+    if (!_recording)
+        return;
+
+    if (!buildILSucceeded)
+        markRecordingIncomplete();
+
+    _recording = false;
+    _recorder->Close();
+    _recorder = NULL;
+}
+
+TR::JitBuilderRecorder *OMR::MethodBuilder::beginRecordedService()
+{
+    if (!_recording)
+        return NULL;
+
+    if (_recordingDepth++ > 0 || !_recorder->isComplete())
+        return NULL;
+
+    return _recorder;
+}
+
+void OMR::MethodBuilder::markRecordingIncomplete() { _recorder->setIncomplete(); }
+
+void OMR::MethodBuilder::recordFunction(const char *name, TR::ResolvedMethod *method)
+{
+    // the function's types were converted to primitive types when it was defined
+    TR::JitBuilderRecorder *rec = _recorder;
+    TR::IlType *returnType = typeDictionary()->PrimitiveType(method->returnType());
+    int32_t numParms = method->getNumArgs();
+    rec->EnsureTypeDefined(returnType);
+    for (int32_t p = 0; p < numParms; p++)
+        rec->EnsureTypeDefined(typeDictionary()->PrimitiveType(method->parmType(p)));
+
+    rec->DefineLocation(name, method->getEntryPoint());
+    rec->BeginStatement(static_cast<TR::IlBuilder *>(this), OMR::StatementName::STATEMENT_DEFINEFUNCTION);
+    rec->String(name);
+    rec->String(method->classNameChars());
+    rec->String(method->getLineNumber());
+    rec->Location(method->getEntryPoint());
+    rec->Type(returnType);
+    rec->Number(numParms);
+    for (int32_t p = 0; p < numParms; p++)
+        rec->Type(typeDictionary()->PrimitiveType(method->parmType(p)));
+    rec->EndStatement();
 }
 
 const char *OMR::MethodBuilder::getSymbolName(int32_t slot)
@@ -649,7 +813,23 @@ int32_t OMR::MethodBuilder::GetNextBytecodeFromWorklist()
     return bci;
 }
 
-int32_t OMR::MethodBuilder::Compile(void **entry)
+int32_t OMR::MethodBuilder::GetTraceEntryBytecodeIndex()
+{
+    TR_ASSERT_FATAL(_trace != NULL, "MethodBuilder %p is not compiling a trace", this);
+    return _trace->anchor();
+}
+
+int64_t OMR::MethodBuilder::GetTraceProfiledValue(int32_t bcIndex)
+{
+    TR_ASSERT_FATAL(_trace != NULL, "MethodBuilder %p is not compiling a trace", this);
+    int32_t position = _trace->position(bcIndex);
+    TR_ASSERT_FATAL(position >= 0, "bytecode %d is not on the trace being compiled", bcIndex);
+    return _trace->profiledValue(position);
+}
+
+int32_t OMR::MethodBuilder::Compile(void **entry) { return Compile(entry, warm); }
+
+int32_t OMR::MethodBuilder::Compile(void **entry, TR_Hotness hotness, TR::CompilationStatistics *statistics)
 {
     TR::IlType **paramTypes = getParameterTypes();
     TR::DataType *methodParmTypes
@@ -665,13 +845,13 @@ int32_t OMR::MethodBuilder::Compile(void **entry)
     TR::ResolvedMethod resolvedMethod(getDefiningFile(), getDefiningLine(), GetMethodName(), getNumParameters(),
         methodParmNames, methodParmTypes, methodReturnType, 0, static_cast<TR::IlInjector *>(this));
     TR::IlGeneratorMethodDetails details(&resolvedMethod);
+    details.setCompilationStatistics(statistics);
 
     int32_t rc = 0;
-    *entry = (void *)compileMethodFromDetails(NULL, details, warm, rc);
+    *entry = (void *)compileMethodFromDetails(NULL, details, hotness, rc);
 
-    // let TypeDictionary know to clear out sym refs used in this compilation so
-    // no dangling pointers
-    typeDictionary()->NotifyCompilationDone();
+    // the TypeDictionary already dropped its field sym refs for this compilation
+    // once IL generation finished (see OMR::IlBuilder::injectIL)
 
     // in case this MethodBuilder object is used in another Call()
     // clear out symrefs allocated in this compilation (no dangling pointers)
@@ -679,6 +859,18 @@ int32_t OMR::MethodBuilder::Compile(void **entry)
     _symbols.clear();
     _connectedTrees = false;
 
+    // BytecodeBuilders and their worklists were allocated in this compilation too,
+    // so forget them in case this MethodBuilder is compiled again (e.g. for another trace)
+    if (_useBytecodeBuilders) {
+        _useBytecodeBuilders = false;
+        _allBytecodeBuilders = NULL;
+        _countBlocksWorklist = NULL;
+        _connectTreesWorklist = NULL;
+        _bytecodeWorklist = NULL;
+        _bytecodeHasBeenInWorklist = NULL;
+        _count = -1;
+    }
+
     return rc;
 }
 
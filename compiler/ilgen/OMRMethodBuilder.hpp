@@ -25,6 +25,7 @@
 #include <map>
 #include <set>
 #include <fstream>
+#include "compile/CompilationTypes.hpp"
 #include "env/TRMemory.hpp"
 #include "ilgen/IlBuilder.hpp"
 #include "env/TypedAllocator.hpp"
@@ -36,6 +37,8 @@ class TR_BitVector;
 
 namespace TR {
 class BytecodeBuilder;
+class CompilationStatistics;
+class JitBuilderRecorder;
 class ResolvedMethod;
 class SymbolReference;
 class VirtualMachineState;
@@ -52,6 +55,8 @@ typedef bool (*RequestFunctionCallback)(void *client, const char *name);
 
 namespace OMR {
 
+class BytecodeTrace;
+
 class MethodBuilder : public TR::IlBuilder {
 public:
     TR_ALLOC(TR_Memory::IlGenerator)
@@ -144,6 +149,15 @@ public:
 
     int32_t Compile(void **entry);
 
+    /**
+     * @brief compiles this method at the given hotness rather than the default warm
+     * @param entry receives the entry point of the compiled method
+     * @param hotness the optimization level to compile at, unless the optLevel option overrides it
+     * @param statistics if not NULL, filled in with measurements of the compilation
+     * @returns the compilation's return code, 0 on success
+     */
+    int32_t Compile(void **entry, TR_Hotness hotness, TR::CompilationStatistics *statistics = NULL);
+
     /**
      * @brief will be called if a Call is issued to a function that has not yet been defined, provides a
      *        mechanism for MethodBuilder subclasses to provide method lookup on demand rather than all up
@@ -182,6 +196,34 @@ public:
      */
     int32_t GetNextBytecodeFromWorklist();
 
+    /**
+     * @brief compile only the bytecodes of a recorded trace, or the whole method if trace is NULL
+     * Used by TR::TraceRecorder around each compilation of a trace.
+     */
+    void setTrace(OMR::BytecodeTrace *trace) { _trace = trace; }
+
+    OMR::BytecodeTrace *trace() { return _trace; }
+
+    /**
+     * @brief returns true if the current compilation is for a trace rather than for the whole method
+     * While compiling a trace, buildIL() must append the BytecodeBuilder for GetTraceEntryBytecodeIndex()
+     * rather than the one for the method's first bytecode. Flow edges to bytecodes that are not next on
+     * the trace become side exits back to the interpreter (see OMR::BytecodeBuilder::AddSuccessorBuilders).
+     */
+    bool IsCompilingTrace() { return _trace != NULL; }
+
+    /**
+     * @brief returns the bytecode index compiled code for the current trace starts at
+     */
+    int32_t GetTraceEntryBytecodeIndex();
+
+    /**
+     * @brief returns the value the interpreter recorded with a bytecode of the current trace
+     * @param bcIndex a bytecode on the trace being compiled
+     * Code specialized for this value should be protected by OMR::BytecodeBuilder::GuardEqual().
+     */
+    int64_t GetTraceProfiledValue(int32_t bcIndex);
+
     /**
      * @brief Override this MethodBuilder's inline site index
      * @param siteIndex the inline site index to use for this MethodBuilder
@@ -227,6 +269,47 @@ public:
      */
     const char *returnSymbol() { return _returnSymbolName; }
 
+    /**
+     * @brief record the builder services used by the next generation of this MethodBuilder's IL
+     * The recorder is closed and detached from this MethodBuilder once buildIL() returns, so each recorder holds
+     * one recording. Services the recorder does not support leave the recording marked incomplete.
+     * @param recorder the recorder to write to, or NULL to not record
+     */
+    void setRecorder(TR::JitBuilderRecorder *recorder) { _recorder = recorder; }
+
+    TR::JitBuilderRecorder *recorder() { return _recorder; }
+
+    /**
+     * @brief called by injectIL() around buildIL() to write this MethodBuilder's definitions and to close the
+     * recording
+     */
+    void beginRecording();
+    void endRecording(bool buildILSucceeded);
+
+    /**
+     * @brief called on entry to each builder service that can be recorded; endRecordedService() must be called on
+     * exit
+     * @returns the recorder if the service was called by the client and should be recorded, NULL if nothing is
+     * being recorded or if the service is being used to implement another service
+     */
+    TR::JitBuilderRecorder *beginRecordedService();
+
+    void endRecordedService()
+    {
+        if (_recording)
+            _recordingDepth--;
+    }
+
+    /**
+     * @brief called whenever IL is generated: IL generated outside of any recorded service comes from a service
+     * the recorder does not support, so the recording can no longer be replayed
+     */
+    void noteGeneratedIL()
+    {
+        if (_recording && _recordingDepth == 0)
+            markRecordingIncomplete();
+    }
+
     /*
      * @brief If this is an inlined MethodBuilder, return the MethodBuilder that directly inlined it
      * @returns the directly inlining MethodBuilder or NULL if no MethodBuilder inlined this one
@@ -272,6 +355,9 @@ protected:
      */
     const char *adjustNameForInlinedSite(const char *name);
 
+    void markRecordingIncomplete();
+    void recordFunction(const char *name, TR::ResolvedMethod *method);
+
 private:
     // We have MemoryManager as the first member of TypeDictionary, so that
     // it is the last one to get destroyed and all objects allocated using
@@ -357,12 +443,17 @@ private:
 
     TR_BitVector *_bytecodeWorklist;
     TR_BitVector *_bytecodeHasBeenInWorklist;
+    OMR::BytecodeTrace *_trace;
 
     int32_t _inlineSiteIndex;
     int32_t _nextInlineSiteIndex;
     TR::IlBuilder *_returnBuilder;
     const char *_returnSymbolName;
 
+    TR::JitBuilderRecorder *_recorder;
+    bool _recording;
+    int32_t _recordingDepth;
+
 private:
     static ClientAllocator _clientAllocator;
     static ImplGetter _getImpl;
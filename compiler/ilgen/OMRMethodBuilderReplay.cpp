@@ -0,0 +1,963 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+#include <stdint.h>
+#include <string.h>
+
+#include "env/TRMemory.hpp"
+#include "il/DataTypes.hpp"
+#include "ilgen/IlBuilder.hpp"
+#include "ilgen/IlType.hpp"
+#include "ilgen/IlValue.hpp"
+#include "ilgen/MethodBuilderReplay.hpp"
+#include "ilgen/StatementNames.hpp"
+#include "ilgen/TypeDictionary.hpp"
+
+namespace {
+
+using namespace OMR::StatementName;
+
+enum ReplayKind {
+    REPLAY_UNKNOWN = 0,
+
+    // definitions, written before the first builder service
+    REPLAY_NEWMETHODBUILDER,
+    REPLAY_PRIMITIVETYPE,
+    REPLAY_POINTERTYPE,
+    REPLAY_DEFINESTRUCT,
+    REPLAY_DEFINEUNION,
+    REPLAY_DEFINENAME,
+    REPLAY_DEFINEFILE,
+    REPLAY_DEFINELINESTRING,
+    REPLAY_DEFINEPARAMETER,
+    REPLAY_DEFINEARRAYPARAMETER,
+    REPLAY_DEFINERETURNTYPE,
+    REPLAY_DEFINELOCAL,
+    REPLAY_DEFINEMEMORY,
+    REPLAY_DEFINEGLOBAL,
+    REPLAY_DEFINEFUNCTION,
+    REPLAY_ALLLOCALSHAVEBEENDEFINED,
+
+    // builder services
+    REPLAY_NEWILBUILDER,
+    REPLAY_NULLADDRESS,
+    REPLAY_CONSTINT8,
+    REPLAY_CONSTINT16,
+    REPLAY_CONSTINT32,
+    REPLAY_CONSTINT64,
+    REPLAY_CONSTFLOAT,
+    REPLAY_CONSTDOUBLE,
+    REPLAY_CONSTADDRESS,
+    REPLAY_LOAD,
+    REPLAY_STORE,
+    REPLAY_STOREOVER,
+    REPLAY_LOADAT,
+    REPLAY_STOREAT,
+    REPLAY_INDEXAT,
+    REPLAY_LOADINDIRECT,
+    REPLAY_STOREINDIRECT,
+    REPLAY_CONVERT,
+    REPLAY_BINARY,
+    REPLAY_NEGATE,
+    REPLAY_SELECT,
+    REPLAY_APPENDBUILDER,
+    REPLAY_GOTO,
+    REPLAY_RETURN,
+    REPLAY_RETURNVALUE,
+    REPLAY_IFTHENELSE,
+    REPLAY_IFCMPZERO,
+    REPLAY_IFCMP,
+    REPLAY_FORLOOP,
+    REPLAY_CONDITIONLOOP,
+    REPLAY_CALL
+};
+
+typedef TR::IlValue *(OMR::IlBuilder::*ConvertService)(TR::IlType *, TR::IlValue *);
+typedef TR::IlValue *(OMR::IlBuilder::*BinaryService)(TR::IlValue *, TR::IlValue *);
+typedef void (OMR::IlBuilder::*IfCmpZeroService)(TR::IlBuilder **, TR::IlValue *);
+typedef void (OMR::IlBuilder::*IfCmpService)(TR::IlBuilder **, TR::IlValue *, TR::IlValue *);
+typedef void (OMR::IlBuilder::*ConditionLoopService)(const char *, TR::IlBuilder **, TR::IlBuilder **,
+    TR::IlBuilder **);
+
+struct ReplayStatement {
+    const char *name;
+    ReplayKind kind;
+    ConvertService convert;
+    BinaryService binary;
+    IfCmpZeroService ifCmpZero;
+    IfCmpService ifCmp;
+    ConditionLoopService conditionLoop;
+};
+
+#define REPLAY(name, kind) { name, kind, NULL, NULL, NULL, NULL, NULL }
+#define REPLAY_CONVERTTO(name, service) { name, REPLAY_CONVERT, &OMR::IlBuilder::service, NULL, NULL, NULL, NULL }
+#define REPLAY_BINARYOP(name, service) { name, REPLAY_BINARY, NULL, &OMR::IlBuilder::service, NULL, NULL, NULL }
+#define REPLAY_IFCMPZEROOP(name, service) \
+    { name, REPLAY_IFCMPZERO, NULL, NULL, &OMR::IlBuilder::service, NULL, NULL }
+#define REPLAY_IFCMPOP(name, service) { name, REPLAY_IFCMP, NULL, NULL, NULL, &OMR::IlBuilder::service, NULL }
+#define REPLAY_LOOP(name, service) \
+    { name, REPLAY_CONDITIONLOOP, NULL, NULL, NULL, NULL, &OMR::IlBuilder::service }
+
+/*
+ * Index 0 is the entry for statements this replay does not support; a stream that uses one cannot be replayed.
+ */
+const ReplayStatement replayStatements[] = {
+    REPLAY(NULL, REPLAY_UNKNOWN),
+
+    REPLAY(STATEMENT_NEWMETHODBUILDER, REPLAY_NEWMETHODBUILDER),
+    REPLAY(STATEMENT_PRIMITIVETYPE, REPLAY_PRIMITIVETYPE),
+    REPLAY(STATEMENT_POINTERTYPE, REPLAY_POINTERTYPE),
+    REPLAY(STATEMENT_DEFINESTRUCT, REPLAY_DEFINESTRUCT),
+    REPLAY(STATEMENT_DEFINEUNION, REPLAY_DEFINEUNION),
+    REPLAY(STATEMENT_DEFINENAME, REPLAY_DEFINENAME),
+    REPLAY(STATEMENT_DEFINEFILE, REPLAY_DEFINEFILE),
+    REPLAY(STATEMENT_DEFINELINESTRING, REPLAY_DEFINELINESTRING),
+    REPLAY(STATEMENT_DEFINEPARAMETER, REPLAY_DEFINEPARAMETER),
+    REPLAY(STATEMENT_DEFINEARRAYPARAMETER, REPLAY_DEFINEARRAYPARAMETER),
+    REPLAY(STATEMENT_DEFINERETURNTYPE, REPLAY_DEFINERETURNTYPE),
+    REPLAY(STATEMENT_DEFINELOCAL, REPLAY_DEFINELOCAL),
+    REPLAY(STATEMENT_DEFINEMEMORY, REPLAY_DEFINEMEMORY),
+    REPLAY(STATEMENT_DEFINEGLOBAL, REPLAY_DEFINEGLOBAL),
+    REPLAY(STATEMENT_DEFINEFUNCTION, REPLAY_DEFINEFUNCTION),
+    REPLAY(STATEMENT_ALLLOCALSHAVEBEENDEFINED, REPLAY_ALLLOCALSHAVEBEENDEFINED),
+
+    REPLAY(STATEMENT_NEWILBUILDER, REPLAY_NEWILBUILDER),
+    REPLAY(STATEMENT_NULLADDRESS, REPLAY_NULLADDRESS),
+    REPLAY(STATEMENT_CONSTINT8, REPLAY_CONSTINT8),
+    REPLAY(STATEMENT_CONSTINT16, REPLAY_CONSTINT16),
+    REPLAY(STATEMENT_CONSTINT32, REPLAY_CONSTINT32),
+    REPLAY(STATEMENT_CONSTINT64, REPLAY_CONSTINT64),
+    REPLAY(STATEMENT_CONSTFLOAT, REPLAY_CONSTFLOAT),
+    REPLAY(STATEMENT_CONSTDOUBLE, REPLAY_CONSTDOUBLE),
+    REPLAY(STATEMENT_CONSTADDRESS, REPLAY_CONSTADDRESS),
+    REPLAY(STATEMENT_LOAD, REPLAY_LOAD),
+    REPLAY(STATEMENT_STORE, REPLAY_STORE),
+    REPLAY(STATEMENT_STOREOVER, REPLAY_STOREOVER),
+    REPLAY(STATEMENT_LOADAT, REPLAY_LOADAT),
+    REPLAY(STATEMENT_STOREAT, REPLAY_STOREAT),
+    REPLAY(STATEMENT_INDEXAT, REPLAY_INDEXAT),
+    REPLAY(STATEMENT_LOADINDIRECT, REPLAY_LOADINDIRECT),
+    REPLAY(STATEMENT_STOREINDIRECT, REPLAY_STOREINDIRECT),
+    REPLAY_CONVERTTO(STATEMENT_CONVERTTO, ConvertTo),
+    REPLAY_CONVERTTO(STATEMENT_UNSIGNEDCONVERTTO, UnsignedConvertTo),
+    REPLAY_BINARYOP(STATEMENT_ADD, Add),
+    REPLAY_BINARYOP(STATEMENT_SUB, Sub),
+    REPLAY_BINARYOP(STATEMENT_MUL, Mul),
+    REPLAY_BINARYOP(STATEMENT_DIV, Div),
+    REPLAY_BINARYOP(STATEMENT_REM, Rem),
+    REPLAY_BINARYOP(STATEMENT_AND, And),
+    REPLAY_BINARYOP(STATEMENT_OR, Or),
+    REPLAY_BINARYOP(STATEMENT_XOR, Xor),
+    REPLAY_BINARYOP(STATEMENT_SHIFTL, ShiftL),
+    REPLAY_BINARYOP(STATEMENT_SHIFTR, ShiftR),
+    REPLAY_BINARYOP(STATEMENT_UNSIGNEDSHIFTR, UnsignedShiftR),
+    REPLAY_BINARYOP(STATEMENT_EQUALTO, EqualTo),
+    REPLAY_BINARYOP(STATEMENT_NOTEQUALTO, NotEqualTo),
+    REPLAY_BINARYOP(STATEMENT_LESSTHAN, LessThan),
+    REPLAY_BINARYOP(STATEMENT_UNSIGNEDLESSTHAN, UnsignedLessThan),
+    REPLAY_BINARYOP(STATEMENT_LESSOREQUALTO, LessOrEqualTo),
+    REPLAY_BINARYOP(STATEMENT_UNSIGNEDLESSOREQUALTO, UnsignedLessOrEqualTo),
+    REPLAY_BINARYOP(STATEMENT_GREATERTHAN, GreaterThan),
+    REPLAY_BINARYOP(STATEMENT_UNSIGNEDGREATERTHAN, UnsignedGreaterThan),
+    REPLAY_BINARYOP(STATEMENT_GREATEROREQUALTO, GreaterOrEqualTo),
+    REPLAY_BINARYOP(STATEMENT_UNSIGNEDGREATEROREQUALTO, UnsignedGreaterOrEqualTo),
+    REPLAY(STATEMENT_NEGATE, REPLAY_NEGATE),
+    REPLAY(STATEMENT_SELECT, REPLAY_SELECT),
+    REPLAY(STATEMENT_APPENDBUILDER, REPLAY_APPENDBUILDER),
+    REPLAY(STATEMENT_GOTO, REPLAY_GOTO),
+    REPLAY(STATEMENT_RETURN, REPLAY_RETURN),
+    REPLAY(STATEMENT_RETURNVALUE, REPLAY_RETURNVALUE),
+    REPLAY(STATEMENT_IFTHENELSE, REPLAY_IFTHENELSE),
+    REPLAY_IFCMPZEROOP(STATEMENT_IFCMPNOTEQUALZERO, IfCmpNotEqualZero),
+    REPLAY_IFCMPZEROOP(STATEMENT_IFCMPEQUALZERO, IfCmpEqualZero),
+    REPLAY_IFCMPOP(STATEMENT_IFCMPNOTEQUAL, IfCmpNotEqual),
+    REPLAY_IFCMPOP(STATEMENT_IFCMPEQUAL, IfCmpEqual),
+    REPLAY_IFCMPOP(STATEMENT_IFCMPLESSTHAN, IfCmpLessThan),
+    REPLAY_IFCMPOP(STATEMENT_IFCMPUNSIGNEDLESSTHAN, IfCmpUnsignedLessThan),
+    REPLAY_IFCMPOP(STATEMENT_IFCMPLESSOREQUAL, IfCmpLessOrEqual),
+    REPLAY_IFCMPOP(STATEMENT_IFCMPUNSIGNEDLESSOREQUAL, IfCmpUnsignedLessOrEqual),
+    REPLAY_IFCMPOP(STATEMENT_IFCMPGREATERTHAN, IfCmpGreaterThan),
+    REPLAY_IFCMPOP(STATEMENT_IFCMPUNSIGNEDGREATERTHAN, IfCmpUnsignedGreaterThan),
+    REPLAY_IFCMPOP(STATEMENT_IFCMPGREATEROREQUAL, IfCmpGreaterOrEqual),
+    REPLAY_IFCMPOP(STATEMENT_IFCMPUNSIGNEDGREATEROREQUAL, IfCmpUnsignedGreaterOrEqual),
+    REPLAY(STATEMENT_FORLOOP, REPLAY_FORLOOP),
+    REPLAY_LOOP(STATEMENT_WHILEDOLOOP, WhileDoLoop),
+    REPLAY_LOOP(STATEMENT_DOWHILELOOP, DoWhileLoop),
+    REPLAY(STATEMENT_CALL, REPLAY_CALL)
+};
+
+#undef REPLAY
+#undef REPLAY_CONVERTTO
+#undef REPLAY_BINARYOP
+#undef REPLAY_IFCMPZEROOP
+#undef REPLAY_IFCMPOP
+#undef REPLAY_LOOP
+
+const int32_t numReplayStatements = sizeof(replayStatements) / sizeof(replayStatements[0]);
+
+int32_t lookupReplayStatement(const char *name)
+{
+    for (int32_t i = 1; i < numReplayStatements; i++) {
+        if (strcmp(replayStatements[i].name, name) == 0)
+            return i;
+    }
+
+    return 0;
+}
+
+} // namespace
+
+OMR::MethodBuilderReplay::MethodBuilderReplay(TR::TypeDictionary *types, const uint8_t *buffer, size_t length,
+    Locations *locations)
+    : TR::MethodBuilder(types)
+    , _buffer(buffer)
+    , _length(length)
+    , _locations(locations)
+    , _position(0)
+    , _idSize(8)
+    , _failed(false)
+    , _valid(false)
+    , _servicesPosition(0)
+    , _servicesIdSize(8)
+    , _servicesFirstID(0)
+    , _definedPosition(0)
+    , _objects()
+    , _statements()
+{
+    // IDs 0 (NULL) and 1 (end of stream marker) are reserved by the recorder
+    bind(0, NULL);
+    bind(1, NULL);
+
+    if (!readHeader())
+        return;
+
+    // apply the method definitions now so this object can be compiled like the recorded MethodBuilder
+    ReplayStatus status;
+    do {
+        status = replayStatement(true);
+    } while (status == StatementReplayed);
+
+    if (status == StreamFailed)
+        return;
+
+    _servicesPosition = _position;
+    _servicesIdSize = _idSize;
+    _servicesFirstID = (TypeID)(_objects.size() > _statements.size() ? _objects.size() : _statements.size());
+    _valid = true;
+}
+
+bool OMR::MethodBuilderReplay::buildIL()
+{
+    if (!_valid)
+        return false;
+
+    _position = _servicesPosition;
+    _idSize = _servicesIdSize;
+    _failed = false;
+
+    // builders and values from an earlier compilation of this object are not valid any more
+    if (_objects.size() > _servicesFirstID)
+        _objects.resize(_servicesFirstID);
+    if (_statements.size() > _servicesFirstID)
+        _statements.resize(_servicesFirstID);
+
+    ReplayStatus status;
+    do {
+        status = replayStatement(false);
+    } while (status == StatementReplayed);
+
+    return status == StreamComplete;
+}
+
+bool OMR::MethodBuilderReplay::readHeader()
+{
+    const char *signature = readString();
+    int16_t major = readInt16();
+    int16_t minor = readInt16();
+    readInt16(); // patch level does not affect the format
+
+    if (_failed || strcmp(signature, StatementName::RECORDER_SIGNATURE) != 0)
+        return false;
+
+    // minor versions only add to the format, so older streams of the same major version can still be replayed
+    return major == StatementName::VERSION_MAJOR && minor <= StatementName::VERSION_MINOR;
+}
+
+OMR::MethodBuilderReplay::ReplayStatus OMR::MethodBuilderReplay::replayStatement(bool definitionsOnly)
+{
+    size_t statementPosition = _position;
+    TypeID builderID = readID();
+    if (_failed)
+        return StreamFailed;
+
+    if (builderID == 1) {
+        // the recorder writes reserved ID 1 followed by a marker string to switch ID sizes or end the stream
+        const char *marker = readString();
+        if (_failed)
+            return StreamFailed;
+
+        if (strcmp(marker, StatementName::STATEMENT_ID16BIT) == 0) {
+            _idSize = 16;
+            return StatementReplayed;
+        }
+
+        if (strcmp(marker, StatementName::STATEMENT_ID32BIT) == 0) {
+            _idSize = 32;
+            return StatementReplayed;
+        }
+
+        if (strcmp(marker, StatementName::JBIL_COMPLETE) == 0) {
+            // leave the end marker for buildIL() if the method has no services
+            if (definitionsOnly)
+                _position = statementPosition;
+            return StreamComplete;
+        }
+
+        return StreamFailed;
+    }
+
+    TypeID statementID = readID();
+    if (_failed)
+        return StreamFailed;
+
+    bool isStatement = statementID < _statements.size() && _statements[statementID] >= 0;
+    if (builderID == 0 && !isStatement) {
+        // first use of a statement: [0][new ID][name]
+        const char *name = readString();
+        if (_failed)
+            return StreamFailed;
+
+        if (statementID >= _statements.size())
+            _statements.resize(statementID + 1, -1);
+        _statements[statementID] = lookupReplayStatement(name);
+        return StatementReplayed;
+    }
+
+    if (!isStatement)
+        return StreamFailed;
+
+    int32_t statement = _statements[statementID];
+    ReplayKind kind = replayStatements[statement].kind;
+    if (kind == REPLAY_UNKNOWN)
+        return StreamFailed;
+
+    TR::IlBuilder *b = NULL;
+    if (builderID != 0) {
+        b = static_cast<TR::IlBuilder *>(const_cast<void *>(lookup(builderID)));
+        if (b == NULL)
+            return StreamFailed;
+    }
+
+    if (kind < REPLAY_NEWILBUILDER) {
+        // definitions made while the recorded buildIL() ran are only applied the first time they are replayed
+        bool apply = statementPosition >= _definedPosition;
+        if (!replayDefinition(statement, b, apply))
+            return StreamFailed;
+        if (_position > _definedPosition)
+            _definedPosition = _position;
+        return StatementReplayed;
+    }
+
+    if (definitionsOnly) {
+        _position = statementPosition;
+        return ServiceFound;
+    }
+
+    if (b == NULL || !replayService(statement, b))
+        return StreamFailed;
+
+    return StatementReplayed;
+}
+
+bool OMR::MethodBuilderReplay::replayDefinition(int32_t statement, TR::IlBuilder *b, bool apply)
+{
+    ReplayKind kind = replayStatements[statement].kind;
+
+    // types are defined by the recorder outside of any builder; everything else belongs to the method.
+    // Types are bound every time because their IDs may be rebound by buildIL(); the TypeDictionary
+    // returns the same type each time.
+    if (kind == REPLAY_PRIMITIVETYPE || kind == REPLAY_POINTERTYPE || kind == REPLAY_DEFINESTRUCT
+        || kind == REPLAY_DEFINEUNION) {
+        if (b != NULL)
+            return false;
+
+        TypeID typeID = readID();
+        TR::IlType *type = NULL;
+        switch (kind) {
+            case REPLAY_PRIMITIVETYPE: {
+                int32_t dt = readInt32();
+                if (!_failed && dt >= 0 && dt < TR::NumAllTypes)
+                    type = typeDictionary()->PrimitiveType((TR::DataTypes)dt);
+                break;
+            }
+            case REPLAY_POINTERTYPE: {
+                TR::IlType *baseType = readType();
+                if (!_failed)
+                    type = typeDictionary()->PointerTo(baseType);
+                break;
+            }
+            case REPLAY_DEFINESTRUCT: {
+                const char *name = readString();
+                if (!_failed)
+                    type = typeDictionary()->LookupStruct(name);
+                break;
+            }
+            default: {
+                const char *name = readString();
+                if (!_failed)
+                    type = typeDictionary()->LookupUnion(name);
+                break;
+            }
+        }
+
+        if (_failed || type == NULL)
+            return false;
+        bind(typeID, type);
+        return true;
+    }
+
+    if (kind == REPLAY_NEWMETHODBUILDER) {
+        // the recorded MethodBuilder is the first builder in the stream and is replayed by this object
+        if (b != NULL)
+            return false;
+
+        TypeID mbID = readID();
+        if (_failed)
+            return false;
+
+        if (apply)
+            bind(mbID, static_cast<TR::IlBuilder *>(this));
+        return true;
+    }
+
+    if (b != static_cast<TR::IlBuilder *>(this))
+        return false;
+
+    switch (kind) {
+        case REPLAY_DEFINENAME: {
+            const char *name = readString();
+            if (!_failed && apply)
+                DefineName(name);
+            break;
+        }
+        case REPLAY_DEFINEFILE: {
+            const char *file = readString();
+            if (!_failed && apply)
+                DefineFile(file);
+            break;
+        }
+        case REPLAY_DEFINELINESTRING: {
+            const char *line = readString();
+            if (!_failed && apply)
+                DefineLine(line);
+            break;
+        }
+        case REPLAY_DEFINEPARAMETER:
+        case REPLAY_DEFINEARRAYPARAMETER:
+        case REPLAY_DEFINELOCAL: {
+            const char *name = readString();
+            TR::IlType *type = readType();
+            if (_failed || !apply)
+                break;
+            if (kind == REPLAY_DEFINEPARAMETER)
+                DefineParameter(name, type);
+            else if (kind == REPLAY_DEFINEARRAYPARAMETER)
+                DefineArrayParameter(name, type);
+            else
+                DefineLocal(name, type);
+            break;
+        }
+        case REPLAY_DEFINERETURNTYPE: {
+            TR::IlType *type = readType();
+            if (!_failed && apply)
+                DefineReturnType(type);
+            break;
+        }
+        case REPLAY_DEFINEMEMORY:
+        case REPLAY_DEFINEGLOBAL: {
+            const char *name = readString();
+            TR::IlType *type = readType();
+            void *location = readLocation();
+            if (_failed || !apply)
+                break;
+            if (kind == REPLAY_DEFINEMEMORY)
+                DefineMemory(name, type, location);
+            else
+                DefineGlobal(name, type, location);
+            break;
+        }
+        case REPLAY_DEFINEFUNCTION: {
+            const char *name = readString();
+            const char *file = readString();
+            const char *line = readString();
+            void *entryPoint = readLocation();
+            TR::IlType *returnType = readType();
+            int32_t numParms = readInt32();
+            if (_failed || numParms < 0)
+                return false;
+
+            std::vector<TR::IlType *> parmTypes(numParms + 1);
+            for (int32_t p = 0; p < numParms; p++)
+                parmTypes[p] = readType();
+            if (!_failed && apply)
+                DefineFunction(name, file, line, entryPoint, returnType, numParms, &parmTypes[0]);
+            break;
+        }
+        case REPLAY_ALLLOCALSHAVEBEENDEFINED:
+            if (apply)
+                AllLocalsHaveBeenDefined();
+            break;
+        default:
+            return false;
+    }
+
+    return !_failed;
+}
+
+bool OMR::MethodBuilderReplay::replayService(int32_t statement, TR::IlBuilder *b)
+{
+    const ReplayStatement &s = replayStatements[statement];
+    switch (s.kind) {
+        case REPLAY_NEWILBUILDER: {
+            TypeID newID = readID();
+            if (_failed || lookup(newID) != NULL)
+                return false;
+            bind(newID, b->OrphanBuilder());
+            return true;
+        }
+        case REPLAY_NULLADDRESS:
+        case REPLAY_CONSTINT8:
+        case REPLAY_CONSTINT16:
+        case REPLAY_CONSTINT32:
+        case REPLAY_CONSTINT64:
+        case REPLAY_CONSTFLOAT:
+        case REPLAY_CONSTDOUBLE:
+        case REPLAY_CONSTADDRESS: {
+            TypeID resultID = readID();
+            TR::IlValue *result = NULL;
+            switch (s.kind) {
+                case REPLAY_NULLADDRESS:
+                    result = b->NullAddress();
+                    break;
+                case REPLAY_CONSTINT8: {
+                    int8_t value = (int8_t)readByte();
+                    if (!_failed)
+                        result = b->ConstInt8(value);
+                    break;
+                }
+                case REPLAY_CONSTINT16: {
+                    int16_t value = readInt16();
+                    if (!_failed)
+                        result = b->ConstInt16(value);
+                    break;
+                }
+                case REPLAY_CONSTINT32: {
+                    int32_t value = readInt32();
+                    if (!_failed)
+                        result = b->ConstInt32(value);
+                    break;
+                }
+                case REPLAY_CONSTINT64: {
+                    int64_t value = readInt64();
+                    if (!_failed)
+                        result = b->ConstInt64(value);
+                    break;
+                }
+                case REPLAY_CONSTFLOAT: {
+                    float value = readFloat();
+                    if (!_failed)
+                        result = b->ConstFloat(value);
+                    break;
+                }
+                case REPLAY_CONSTDOUBLE: {
+                    double value = readDouble();
+                    if (!_failed)
+                        result = b->ConstDouble(value);
+                    break;
+                }
+                default: {
+                    void *value = readLocation();
+                    if (!_failed)
+                        result = b->ConstAddress(value);
+                    break;
+                }
+            }
+            if (_failed)
+                return false;
+            bind(resultID, result);
+            return true;
+        }
+        case REPLAY_LOAD: {
+            TypeID resultID = readID();
+            const char *name = readString();
+            if (_failed)
+                return false;
+            bind(resultID, b->Load(name));
+            return true;
+        }
+        case REPLAY_STORE: {
+            TR::IlValue *value = readValue();
+            const char *name = readString();
+            if (_failed)
+                return false;
+            b->Store(name, value);
+            return true;
+        }
+        case REPLAY_STOREOVER: {
+            TR::IlValue *dest = readValue();
+            TR::IlValue *value = readValue();
+            if (_failed)
+                return false;
+            b->StoreOver(dest, value);
+            return true;
+        }
+        case REPLAY_LOADAT: {
+            TypeID resultID = readID();
+            TR::IlValue *address = readValue();
+            TR::IlType *type = readType();
+            if (_failed)
+                return false;
+            bind(resultID, b->LoadAt(type, address));
+            return true;
+        }
+        case REPLAY_STOREAT: {
+            TR::IlValue *address = readValue();
+            TR::IlValue *value = readValue();
+            if (_failed)
+                return false;
+            b->StoreAt(address, value);
+            return true;
+        }
+        case REPLAY_INDEXAT: {
+            TypeID resultID = readID();
+            TR::IlValue *base = readValue();
+            TR::IlValue *index = readValue();
+            TR::IlType *type = readType();
+            if (_failed)
+                return false;
+            bind(resultID, b->IndexAt(type, base, index));
+            return true;
+        }
+        case REPLAY_LOADINDIRECT: {
+            TypeID resultID = readID();
+            TR::IlValue *object = readValue();
+            const char *type = readString();
+            const char *field = readString();
+            if (_failed)
+                return false;
+            bind(resultID, b->LoadIndirect(type, field, object));
+            return true;
+        }
+        case REPLAY_STOREINDIRECT: {
+            TR::IlValue *object = readValue();
+            TR::IlValue *value = readValue();
+            const char *type = readString();
+            const char *field = readString();
+            if (_failed)
+                return false;
+            b->StoreIndirect(type, field, object, value);
+            return true;
+        }
+        case REPLAY_CONVERT: {
+            TypeID resultID = readID();
+            TR::IlValue *value = readValue();
+            TR::IlType *type = readType();
+            if (_failed)
+                return false;
+            bind(resultID, (b->*s.convert)(type, value));
+            return true;
+        }
+        case REPLAY_BINARY: {
+            TypeID resultID = readID();
+            TR::IlValue *left = readValue();
+            TR::IlValue *right = readValue();
+            if (_failed)
+                return false;
+            bind(resultID, (b->*s.binary)(left, right));
+            return true;
+        }
+        case REPLAY_NEGATE: {
+            TypeID resultID = readID();
+            TR::IlValue *value = readValue();
+            if (_failed)
+                return false;
+            bind(resultID, b->Negate(value));
+            return true;
+        }
+        case REPLAY_SELECT: {
+            TypeID resultID = readID();
+            TR::IlValue *condition = readValue();
+            TR::IlValue *trueValue = readValue();
+            TR::IlValue *falseValue = readValue();
+            if (_failed)
+                return false;
+            bind(resultID, b->Select(condition, trueValue, falseValue));
+            return true;
+        }
+        case REPLAY_APPENDBUILDER:
+        case REPLAY_GOTO: {
+            TR::IlBuilder *target = readBuilder();
+            if (_failed)
+                return false;
+            if (s.kind == REPLAY_APPENDBUILDER)
+                b->AppendBuilder(target);
+            else
+                b->Goto(target);
+            return true;
+        }
+        case REPLAY_RETURN:
+            b->Return();
+            return true;
+        case REPLAY_RETURNVALUE: {
+            TR::IlValue *value = readValue();
+            if (_failed)
+                return false;
+            b->Return(value);
+            return true;
+        }
+        default:
+            break;
+    }
+
+    // the remaining services take builders that may be created by the service itself: an ID that has not been
+    // bound yet is passed as a pointer to a NULL builder and bound to the builder the service creates
+    switch (s.kind) {
+        case REPLAY_IFTHENELSE: {
+            TR::IlValue *condition = readValue();
+            TypeID thenID = readID();
+            TypeID elseID = readID();
+            if (_failed)
+                return false;
+            TR::IlBuilder *thenPath = static_cast<TR::IlBuilder *>(const_cast<void *>(lookup(thenID)));
+            TR::IlBuilder *elsePath = static_cast<TR::IlBuilder *>(const_cast<void *>(lookup(elseID)));
+            b->IfThenElse(thenID != 0 ? &thenPath : NULL, elseID != 0 ? &elsePath : NULL, condition);
+            if (thenID != 0)
+                bind(thenID, thenPath);
+            if (elseID != 0)
+                bind(elseID, elsePath);
+            return true;
+        }
+        case REPLAY_IFCMPZERO: {
+            TR::IlValue *condition = readValue();
+            TypeID targetID = readID();
+            if (_failed || targetID == 0)
+                return false;
+            TR::IlBuilder *target = static_cast<TR::IlBuilder *>(const_cast<void *>(lookup(targetID)));
+            (b->*s.ifCmpZero)(&target, condition);
+            bind(targetID, target);
+            return true;
+        }
+        case REPLAY_IFCMP: {
+            TR::IlValue *left = readValue();
+            TR::IlValue *right = readValue();
+            TypeID targetID = readID();
+            if (_failed || targetID == 0)
+                return false;
+            TR::IlBuilder *target = static_cast<TR::IlBuilder *>(const_cast<void *>(lookup(targetID)));
+            (b->*s.ifCmp)(&target, left, right);
+            bind(targetID, target);
+            return true;
+        }
+        case REPLAY_FORLOOP: {
+            TR::IlValue *initial = readValue();
+            TR::IlValue *iterateWhile = readValue();
+            TR::IlValue *increment = readValue();
+            bool countsUp = readByte() != 0;
+            const char *indVar = readString();
+            TypeID bodyID = readID();
+            TypeID breakID = readID();
+            TypeID continueID = readID();
+            if (_failed || bodyID == 0)
+                return false;
+            TR::IlBuilder *body = static_cast<TR::IlBuilder *>(const_cast<void *>(lookup(bodyID)));
+            TR::IlBuilder *breakBuilder = NULL;
+            TR::IlBuilder *continueBuilder = NULL;
+            b->ForLoop(countsUp, indVar, &body, breakID != 0 ? &breakBuilder : NULL,
+                continueID != 0 ? &continueBuilder : NULL, initial, iterateWhile, increment);
+            bind(bodyID, body);
+            if (breakID != 0)
+                bind(breakID, breakBuilder);
+            if (continueID != 0)
+                bind(continueID, continueBuilder);
+            return true;
+        }
+        case REPLAY_CONDITIONLOOP: {
+            const char *exitCondition = readString();
+            TypeID bodyID = readID();
+            TypeID breakID = readID();
+            TypeID continueID = readID();
+            if (_failed || bodyID == 0)
+                return false;
+            TR::IlBuilder *body = static_cast<TR::IlBuilder *>(const_cast<void *>(lookup(bodyID)));
+            TR::IlBuilder *breakBuilder = NULL;
+            TR::IlBuilder *continueBuilder = NULL;
+            (b->*s.conditionLoop)(exitCondition, &body, breakID != 0 ? &breakBuilder : NULL,
+                continueID != 0 ? &continueBuilder : NULL);
+            bind(bodyID, body);
+            if (breakID != 0)
+                bind(breakID, breakBuilder);
+            if (continueID != 0)
+                bind(continueID, continueBuilder);
+            return true;
+        }
+        case REPLAY_CALL: {
+            TypeID resultID = readID();
+            const char *name = readString();
+            int32_t numArgs = readInt32();
+            if (_failed || numArgs < 0)
+                return false;
+            std::vector<TR::IlValue *> args(numArgs + 1);
+            for (int32_t a = 0; a < numArgs; a++)
+                args[a] = readValue();
+            if (_failed)
+                return false;
+            TR::IlValue *result = b->Call(name, numArgs, &args[0]);
+            if (resultID != 0)
+                bind(resultID, result);
+            return true;
+        }
+        default:
+            return false;
+    }
+}
+
+uint8_t OMR::MethodBuilderReplay::readByte()
+{
+    if (_failed || _position + 1 > _length) {
+        fail();
+        return 0;
+    }
+
+    return _buffer[_position++];
+}
+
+int16_t OMR::MethodBuilderReplay::readInt16()
+{
+    // the recorder writes numbers little endian
+    uint16_t b0 = readByte();
+    uint16_t b1 = readByte();
+    return (int16_t)(b0 | (b1 << 8));
+}
+
+int32_t OMR::MethodBuilderReplay::readInt32()
+{
+    uint32_t lo = (uint16_t)readInt16();
+    uint32_t hi = (uint16_t)readInt16();
+    return (int32_t)(lo | (hi << 16));
+}
+
+int64_t OMR::MethodBuilderReplay::readInt64()
+{
+    uint64_t lo = (uint32_t)readInt32();
+    uint64_t hi = (uint32_t)readInt32();
+    return (int64_t)(lo | (hi << 32));
+}
+
+float OMR::MethodBuilderReplay::readFloat()
+{
+    int32_t bits = readInt32();
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+double OMR::MethodBuilderReplay::readDouble()
+{
+    int64_t bits = readInt64();
+    double value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+void *OMR::MethodBuilderReplay::readLocation()
+{
+    // the recorder writes the empty name for NULL and for addresses it could not name
+    const char *name = readString();
+    if (_failed)
+        return NULL;
+
+    void *location = NULL;
+    if (name[0] == '\0')
+        return location;
+
+    if (_locations == NULL || !_locations->resolveLocation(name, &location))
+        fail();
+    return location;
+}
+
+OMR::MethodBuilderReplay::TypeID OMR::MethodBuilderReplay::readID()
+{
+    if (_idSize == 8)
+        return readByte();
+    if (_idSize == 16)
+        return (uint16_t)readInt16();
+    return (uint32_t)readInt32();
+}
+
+const char *OMR::MethodBuilderReplay::readString()
+{
+    int16_t length = readInt16();
+    if (_failed || length < 0 || _position + length > _length) {
+        fail();
+        return "";
+    }
+
+    char *string = (char *)trMemory()->allocateHeapMemory(length + 1);
+    memcpy(string, _buffer + _position, length);
+    string[length] = '\0';
+    _position += length;
+    return string;
+}
+
+TR::IlValue *OMR::MethodBuilderReplay::readValue()
+{
+    TypeID id = readID();
+    const void *value = lookup(id);
+    if (value == NULL)
+        fail();
+    return static_cast<TR::IlValue *>(const_cast<void *>(value));
+}
+
+TR::IlType *OMR::MethodBuilderReplay::readType()
+{
+    TypeID id = readID();
+    const void *type = lookup(id);
+    if (type == NULL)
+        fail();
+    return static_cast<TR::IlType *>(const_cast<void *>(type));
+}
+
+TR::IlBuilder *OMR::MethodBuilderReplay::readBuilder()
+{
+    TypeID id = readID();
+    const void *builder = lookup(id);
+    if (builder == NULL)
+        fail();
+    return static_cast<TR::IlBuilder *>(const_cast<void *>(builder));
+}
+
+void OMR::MethodBuilderReplay::bind(TypeID id, const void *object)
+{
+    if (id >= _objects.size())
+        _objects.resize(id + 1, NULL);
+    _objects[id] = object;
+}
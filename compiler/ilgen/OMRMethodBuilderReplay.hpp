@@ -0,0 +1,163 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#ifndef OMR_METHODBUILDERREPLAY_INCL
+#define OMR_METHODBUILDERREPLAY_INCL
+
+#include <stddef.h>
+#include <stdint.h>
+#include <map>
+#include <string>
+#include <vector>
+#include "ilgen/JitBuilderRecorder.hpp"
+#include "ilgen/MethodBuilder.hpp"
+
+namespace TR {
+class IlBuilder;
+class IlType;
+class IlValue;
+class TypeDictionary;
+} // namespace TR
+
+namespace OMR {
+
+/**
+ * @brief MethodBuilder that generates its IL from a stream written by a JitBuilderRecorderBinaryBuffer
+ *
+ * The constructor applies the method definitions at the start of the stream (name, parameters, return type,
+ * locals and functions), so the object can be compiled in place of the MethodBuilder that was recorded.
+ * buildIL() then replays the recorded builder services without running the recorded MethodBuilder's buildIL().
+ *
+ * Struct and union types are looked up by name in the TypeDictionary passed to the constructor, so it must
+ * define the same types as the dictionary used for the recording. Addresses (ConstAddress, DefineMemory,
+ * DefineGlobal and DefineFunction entry points) are recorded by name and resolved through the Locations passed
+ * to the constructor, so a stream can be replayed in a process where the addresses are different. The stream and
+ * the Locations must remain valid for the lifetime of this object.
+ *
+ * buildIL() fails, so that the compilation fails rather than producing wrong code, if the stream is truncated
+ * or malformed or if it was recorded while the MethodBuilder used a service the recorder does not support.
+ */
+class MethodBuilderReplay : public TR::MethodBuilder {
+public:
+    typedef TR::JitBuilderRecorder::TypeID TypeID;
+
+    /**
+     * @brief resolves the names a recording gave its addresses, see JitBuilderRecorder::DefineLocation()
+     * Subclasses can override resolveLocation() to look names up elsewhere, for example in a symbol table.
+     */
+    class Locations {
+    public:
+        virtual ~Locations() {}
+
+        void DefineLocation(const char *name, void *location) { _locations[name] = location; }
+
+        /**
+         * @returns true and sets \a location if \a name is known, false if it is not
+         */
+        virtual bool resolveLocation(const char *name, void **location)
+        {
+            std::map<std::string, void *>::iterator it = _locations.find(name);
+            if (it == _locations.end())
+                return false;
+            *location = it->second;
+            return true;
+        }
+
+    private:
+        std::map<std::string, void *> _locations;
+    };
+
+    /**
+     * @param locations resolves the addresses in the stream; may be NULL if the stream refers to none
+     */
+    MethodBuilderReplay(TR::TypeDictionary *types, const uint8_t *buffer, size_t length, Locations *locations = NULL);
+    virtual ~MethodBuilderReplay() {}
+
+    virtual bool buildIL();
+
+    /**
+     * @brief returns false if the stream header or the method definitions could not be read
+     */
+    bool isValid() { return _valid; }
+
+protected:
+    enum ReplayStatus {
+        StatementReplayed,
+        ServiceFound,
+        StreamComplete,
+        StreamFailed
+    };
+
+    /**
+     * @brief replay the next statement in the stream
+     * @param definitionsOnly if true, stop at the first builder service rather than replaying it
+     */
+    ReplayStatus replayStatement(bool definitionsOnly);
+    bool replayDefinition(int32_t statement, TR::IlBuilder *b, bool apply);
+    bool replayService(int32_t statement, TR::IlBuilder *b);
+
+    bool readHeader();
+    uint8_t readByte();
+    int16_t readInt16();
+    int32_t readInt32();
+    int64_t readInt64();
+    float readFloat();
+    double readDouble();
+    void *readLocation();
+    TypeID readID();
+    const char *readString();
+
+    TR::IlValue *readValue();
+    TR::IlType *readType();
+    TR::IlBuilder *readBuilder();
+
+    const void *lookup(TypeID id) { return id < _objects.size() ? _objects[id] : NULL; }
+
+    void bind(TypeID id, const void *object);
+    void fail() { _failed = true; }
+
+private:
+    const uint8_t *_buffer;
+    size_t _length;
+    Locations *_locations;
+    size_t _position;
+    uint8_t _idSize;
+    bool _failed;
+    bool _valid;
+
+    // where buildIL() starts replaying, just past the method definitions
+    size_t _servicesPosition;
+    uint8_t _servicesIdSize;
+
+    // IDs from here on are first written by the services, so they are rebound each time buildIL() runs
+    TypeID _servicesFirstID;
+
+    // end of the furthest definition applied so far, so compiling again does not repeat definitions
+    size_t _definedPosition;
+
+    // the type, value or builder recorded under each ID, and the statement each statement ID names (-1 if none)
+    std::vector<const void *> _objects;
+    std::vector<int32_t> _statements;
+};
+
+} // namespace OMR
+
+#endif // !defined(OMR_METHODBUILDERREPLAY_INCL)
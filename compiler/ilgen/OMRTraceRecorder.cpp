@@ -0,0 +1,263 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include <string.h>
+#include "env/TRMemory.hpp"
+#include "ilgen/MethodBuilder.hpp"
+#include "ilgen/TraceRecorder.hpp"
+#include "infra/Assert.hpp"
+
+namespace {
+const int32_t DEFAULT_HOT_LOOP_THRESHOLD = 100;
+const int32_t DEFAULT_HOT_EXIT_THRESHOLD = 50;
+const int32_t DEFAULT_MAX_TRACE_LENGTH = 256;
+} // namespace
+
+OMR::BytecodeTrace::BytecodeTrace(int32_t anchor, int32_t maxLength)
+    : _anchor(anchor)
+    , _length(0)
+    , _maxLength(maxLength)
+    , _linkTarget(-1)
+    , _state(Recording)
+    , _entryPoint(NULL)
+    , _exits(NULL)
+    , _executions(0)
+{
+    _bcIndices = (int32_t *)TR_Memory::jitPersistentAlloc(maxLength * sizeof(int32_t));
+    _profiledValues = (int64_t *)TR_Memory::jitPersistentAlloc(maxLength * sizeof(int64_t));
+}
+
+OMR::BytecodeTrace::~BytecodeTrace()
+{
+    TraceExit *e = _exits;
+    while (e) {
+        TraceExit *n = e->_next;
+        TR_Memory::jitPersistentFree(e);
+        e = n;
+    }
+    TR_Memory::jitPersistentFree(_profiledValues);
+    TR_Memory::jitPersistentFree(_bcIndices);
+}
+
+bool OMR::BytecodeTrace::append(int32_t bcIndex, int64_t profiledValue)
+{
+    if (_length == _maxLength)
+        return false;
+
+    _bcIndices[_length] = bcIndex;
+    _profiledValues[_length] = profiledValue;
+    _length++;
+    return true;
+}
+
+int32_t OMR::BytecodeTrace::position(int32_t bcIndex)
+{
+    for (int32_t p = 0; p < _length; p++) {
+        if (_bcIndices[p] == bcIndex)
+            return p;
+    }
+    return -1;
+}
+
+bool OMR::BytecodeTrace::isOnTrace(int32_t fromIndex, int32_t toIndex)
+{
+    if (fromIndex == toIndex)
+        return true;
+
+    int32_t p = position(fromIndex);
+    if (p < 0)
+        return false;
+    if (p + 1 < _length)
+        return _bcIndices[p + 1] == toIndex;
+    return closesLoop() && toIndex == _anchor;
+}
+
+OMR::TraceExit *OMR::BytecodeTrace::findExit(int32_t target, bool guard)
+{
+    for (TraceExit *e = _exits; e != NULL; e = e->_next) {
+        if (e->_target == target && e->_guard == guard)
+            return e;
+    }
+    return NULL;
+}
+
+OMR::TraceExit *OMR::BytecodeTrace::exitTo(int32_t target, bool guard)
+{
+    TraceExit *e = findExit(target, guard);
+    if (e == NULL) {
+        e = new (PERSISTENT_NEW) TraceExit(target, guard, _exits);
+        _exits = e;
+    }
+    return e;
+}
+
+OMR::TraceRecorder::TraceRecorder(TR::MethodBuilder *traceBuilder, int32_t numBytecodes)
+    : _traceBuilder(traceBuilder)
+    , _numBytecodes(numBytecodes)
+    , _hotLoopThreshold(DEFAULT_HOT_LOOP_THRESHOLD)
+    , _hotExitThreshold(DEFAULT_HOT_EXIT_THRESHOLD)
+    , _maxTraceLength(DEFAULT_MAX_TRACE_LENGTH)
+    , _recording(NULL)
+    , _numTracesCompiled(0)
+    , _numTracesFailed(0)
+    , _numRecordingsAborted(0)
+    , _numLinkedTransfers(0)
+    , _numSideExits(0)
+{
+    _traces = (BytecodeTrace **)TR_Memory::jitPersistentAlloc(numBytecodes * sizeof(BytecodeTrace *));
+    memset(_traces, 0, numBytecodes * sizeof(BytecodeTrace *));
+    _loopCounts = (int32_t *)TR_Memory::jitPersistentAlloc(numBytecodes * sizeof(int32_t));
+    memset(_loopCounts, 0, numBytecodes * sizeof(int32_t));
+}
+
+OMR::TraceRecorder::~TraceRecorder()
+{
+    for (int32_t i = 0; i < _numBytecodes; i++) {
+        BytecodeTrace *trace = _traces[i];
+        if (trace) {
+            trace->~BytecodeTrace();
+            TR_Memory::jitPersistentFree(trace);
+        }
+    }
+    TR_Memory::jitPersistentFree(_loopCounts);
+    TR_Memory::jitPersistentFree(_traces);
+}
+
+OMR::BytecodeTrace *OMR::TraceRecorder::GetTrace(int32_t bcIndex)
+{
+    TR_ASSERT_FATAL(bcIndex >= 0 && bcIndex < _numBytecodes, "bytecode index %d out of range", bcIndex);
+    return _traces[bcIndex];
+}
+
+void *OMR::TraceRecorder::GetTraceEntry(int32_t bcIndex)
+{
+    BytecodeTrace *trace = compiledTrace(bcIndex);
+    return trace ? (void *)trace->entryPoint() : NULL;
+}
+
+OMR::BytecodeTrace *OMR::TraceRecorder::compiledTrace(int32_t bcIndex)
+{
+    BytecodeTrace *trace = GetTrace(bcIndex);
+    if (trace && trace->state() == BytecodeTrace::Compiled)
+        return trace;
+    return NULL;
+}
+
+void OMR::TraceRecorder::CountLoopHeader(int32_t bcIndex)
+{
+    if (_recording != NULL || GetTrace(bcIndex) != NULL)
+        return;
+
+    if (++_loopCounts[bcIndex] >= _hotLoopThreshold)
+        startRecording(bcIndex);
+}
+
+void OMR::TraceRecorder::startRecording(int32_t bcIndex)
+{
+    _recording = new (PERSISTENT_NEW) BytecodeTrace(bcIndex, _maxTraceLength);
+    _traces[bcIndex] = _recording;
+}
+
+void OMR::TraceRecorder::RecordBytecode(int32_t bcIndex, int64_t profiledValue)
+{
+    if (_recording == NULL)
+        return;
+
+    if (_recording->length() == 0) {
+        // recording starts at the bytecode that made the anchor hot
+        if (bcIndex != _recording->anchor()) {
+            AbortRecording();
+            return;
+        }
+    } else if (bcIndex == _recording->anchor() || compiledTrace(bcIndex) != NULL
+        || _recording->position(bcIndex) >= 0) {
+        finishRecording(bcIndex);
+        return;
+    }
+
+    if (!_recording->append(bcIndex, profiledValue))
+        AbortRecording();
+}
+
+void OMR::TraceRecorder::AbortRecording()
+{
+    if (_recording == NULL)
+        return;
+
+    // leave the trace in place so its anchor is not recorded again
+    _recording->_state = BytecodeTrace::Failed;
+    _recording = NULL;
+    _numRecordingsAborted++;
+}
+
+void OMR::TraceRecorder::finishRecording(int32_t linkTarget)
+{
+    BytecodeTrace *trace = _recording;
+    _recording = NULL;
+    trace->_linkTarget = linkTarget;
+
+    void *entry = NULL;
+    _traceBuilder->setTrace(trace);
+    int32_t rc = _traceBuilder->Compile(&entry);
+    _traceBuilder->setTrace(NULL);
+
+    if (rc == 0 && entry != NULL) {
+        trace->_entryPoint = (BytecodeTrace::TraceFunction *)entry;
+        trace->_state = BytecodeTrace::Compiled;
+        _numTracesCompiled++;
+    } else {
+        trace->_state = BytecodeTrace::Failed;
+        _numTracesFailed++;
+    }
+}
+
+int32_t OMR::TraceRecorder::RunTraces(int32_t bcIndex, void *frame)
+{
+    // the interpreter must execute every bytecode of a recording itself
+    if (_recording != NULL)
+        return bcIndex;
+
+    BytecodeTrace *trace = compiledTrace(bcIndex);
+    while (trace != NULL) {
+        trace->_executions++;
+        int32_t rc = trace->entryPoint()(frame);
+        bool guard = rc < 0;
+        int32_t exitIndex = guard ? OMR::TraceExit::guardTarget(rc) : rc;
+        TR_ASSERT_FATAL(exitIndex >= 0 && exitIndex < _numBytecodes, "trace at %d exited to bytecode %d",
+            trace->anchor(), exitIndex);
+
+        // a guard exit re-executes its bytecode, which only the interpreter can do
+        TraceExit *exit = trace->findExit(exitIndex, guard);
+        BytecodeTrace *next = guard ? NULL : compiledTrace(exitIndex);
+
+        bcIndex = exitIndex;
+        if (next != NULL) {
+            _numLinkedTransfers++;
+        } else {
+            _numSideExits++;
+            if (exit != NULL && exit->_count >= _hotExitThreshold && GetTrace(exitIndex) == NULL)
+                startRecording(exitIndex);
+        }
+        trace = next;
+    }
+
+    return bcIndex;
+}
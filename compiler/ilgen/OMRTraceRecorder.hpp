@@ -0,0 +1,272 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#ifndef OMR_TRACERECORDER_INCL
+#define OMR_TRACERECORDER_INCL
+
+#include <stdint.h>
+#include "env/TRMemory.hpp"
+
+namespace TR {
+class MethodBuilder;
+} // namespace TR
+
+namespace OMR {
+
+/**
+ * @brief a way out of a compiled trace, back to the interpreter
+ *
+ * Compiled code increments _count every time it leaves the trace through this exit.
+ * A guard exit re-executes the guarding bytecode in the interpreter, any other exit
+ * continues at the bytecode the trace did not record as the next one. Compiled code
+ * returns returnValue() so that RunTraces can tell the two kinds of exit apart.
+ */
+struct TraceExit {
+    TR_ALLOC(TR_Memory::IlGenerator)
+
+    TraceExit(int32_t target, bool guard, TraceExit *next)
+        : _target(target)
+        , _guard(guard)
+        , _count(0)
+        , _next(next)
+    {}
+
+    int32_t returnValue() { return _guard ? -1 - _target : _target; }
+
+    static int32_t guardTarget(int32_t returnValue) { return -1 - returnValue; }
+
+    int32_t _target;
+    bool _guard;
+    int64_t _count;
+    TraceExit *_next;
+};
+
+/**
+ * @brief a linear path of bytecodes recorded by a TraceRecorder, and the code compiled for it
+ *
+ * A trace starts at its anchor bytecode and either closes a loop (the bytecode recorded last
+ * continues at the anchor) or links to another bytecode, usually the anchor of another trace.
+ * Each bytecode index appears at most once in a trace. Traces are allocated in persistent
+ * memory and are owned by the TraceRecorder that recorded them.
+ */
+class BytecodeTrace {
+public:
+    TR_ALLOC(TR_Memory::IlGenerator)
+
+    enum State {
+        Recording,
+        Compiled,
+        Failed
+    };
+
+    typedef int32_t(TraceFunction)(void *frame);
+
+    BytecodeTrace(int32_t anchor, int32_t maxLength);
+    ~BytecodeTrace();
+
+    int32_t anchor() { return _anchor; }
+
+    int32_t length() { return _length; }
+
+    int32_t bytecodeIndex(int32_t position) { return _bcIndices[position]; }
+
+    int64_t profiledValue(int32_t position) { return _profiledValues[position]; }
+
+    /**
+     * @brief returns the position of a bytecode in this trace, or -1 if the trace does not contain it
+     */
+    int32_t position(int32_t bcIndex);
+
+    /**
+     * @brief returns true if the bytecode recorded last continues at the anchor
+     */
+    bool closesLoop() { return _linkTarget == _anchor; }
+
+    /**
+     * @brief returns the bytecode the trace continues at after its last bytecode
+     */
+    int32_t linkTarget() { return _linkTarget; }
+
+    /**
+     * @brief returns true if control flow from one bytecode to another stays on this trace
+     * Flow between builders of the same bytecode is always on the trace. Flow between two
+     * bytecodes is on the trace only if the trace recorded the second one right after the first.
+     */
+    bool isOnTrace(int32_t fromIndex, int32_t toIndex);
+
+    /**
+     * @brief returns the exit to a bytecode, creating it if this trace has no such exit yet
+     */
+    TraceExit *exitTo(int32_t target, bool guard);
+
+    /**
+     * @brief returns the exit to a bytecode, or NULL if compiled code has no such exit
+     */
+    TraceExit *findExit(int32_t target, bool guard);
+
+    TraceExit *exits() { return _exits; }
+
+    State state() { return _state; }
+
+    TraceFunction *entryPoint() { return _entryPoint; }
+
+    /**
+     * @brief returns the number of times the compiled trace has been entered
+     */
+    int64_t executions() { return _executions; }
+
+protected:
+    friend class TraceRecorder;
+
+    bool append(int32_t bcIndex, int64_t profiledValue);
+
+    int32_t _anchor;
+    int32_t _length;
+    int32_t _maxLength;
+    int32_t *_bcIndices;
+    int64_t *_profiledValues;
+    int32_t _linkTarget;
+    State _state;
+    TraceFunction *_entryPoint;
+    TraceExit *_exits;
+    int64_t _executions;
+};
+
+/**
+ * @brief records hot paths through an interpreter's bytecodes and compiles them as traces
+ *
+ * The interpreter reports backward branches with CountLoopHeader(). Once a loop header has
+ * been reached often enough, the bytecodes the interpreter executes next are recorded with
+ * RecordBytecode() until the path comes back to the loop header, reaches the start of another
+ * compiled trace or a bytecode it has already recorded. The recorded path is then compiled
+ * by the trace MethodBuilder passed to the constructor: while compiling a trace,
+ * MethodBuilder::IsCompilingTrace() returns true, IL is generated only for the recorded
+ * bytecodes, and any BytecodeBuilder flow edge that leaves the recorded path is replaced by a
+ * side exit that commits the VirtualMachineState, counts the exit and returns the bytecode
+ * index the interpreter should continue at.
+ *
+ * The trace MethodBuilder must take a single parameter through which its VirtualMachineState
+ * reaches the interpreter's frame, must return Int32, and must start at
+ * GetTraceEntryBytecodeIndex() when compiling a trace. It is compiled once per trace.
+ *
+ * RunTraces() runs the compiled trace that starts at a bytecode, if there is one, and follows
+ * trace exits that lead to another compiled trace without returning to the interpreter. An
+ * exit taken more than the hot exit threshold starts recording a side trace at its target.
+ * Recordings that run longer than the maximum trace length are abandoned, and their anchor
+ * is not recorded again.
+ *
+ * A TraceRecorder must only be used by one interpreter thread at a time.
+ */
+class TraceRecorder {
+public:
+    TR_ALLOC(TR_Memory::IlGenerator)
+
+    /**
+     * @param traceBuilder MethodBuilder that generates IL for the bytecodes of a trace
+     * @param numBytecodes the number of bytecode indices the interpreter can report
+     */
+    TraceRecorder(TR::MethodBuilder *traceBuilder, int32_t numBytecodes);
+    ~TraceRecorder();
+
+    void setHotLoopThreshold(int32_t threshold) { _hotLoopThreshold = threshold; }
+
+    void setHotExitThreshold(int32_t threshold) { _hotExitThreshold = threshold; }
+
+    void setMaxTraceLength(int32_t length) { _maxTraceLength = length; }
+
+    /**
+     * @brief count a backward branch to a bytecode, and start recording there once it is hot
+     */
+    void CountLoopHeader(int32_t bcIndex);
+
+    /**
+     * @brief record that the interpreter is about to execute a bytecode
+     * @param profiledValue a value observed by the interpreter that the trace may specialize on,
+     *        available through MethodBuilder::GetTraceProfiledValue() while the trace is compiled
+     * Does nothing unless a recording is in progress. Completing a recording compiles the trace.
+     */
+    void RecordBytecode(int32_t bcIndex, int64_t profiledValue = 0);
+
+    /**
+     * @brief abandon the recording in progress, for example when the interpreter throws
+     */
+    void AbortRecording();
+
+    bool IsRecording() { return _recording != NULL; }
+
+    /**
+     * @brief run compiled traces starting at a bytecode
+     * @param bcIndex the bytecode the interpreter is about to execute
+     * @param frame passed to the compiled traces
+     * @returns the bytecode the interpreter should execute next, which is bcIndex if no trace ran
+     */
+    int32_t RunTraces(int32_t bcIndex, void *frame);
+
+    /**
+     * @brief returns the trace anchored at a bytecode, or NULL if there is none
+     */
+    BytecodeTrace *GetTrace(int32_t bcIndex);
+
+    /**
+     * @brief returns the entry point of the compiled trace anchored at a bytecode, or NULL
+     */
+    void *GetTraceEntry(int32_t bcIndex);
+
+    int32_t numTracesCompiled() { return _numTracesCompiled; }
+
+    int32_t numTracesFailed() { return _numTracesFailed; }
+
+    int32_t numRecordingsAborted() { return _numRecordingsAborted; }
+
+    /**
+     * @brief returns the number of times RunTraces went straight from one compiled trace to another
+     */
+    int64_t numLinkedTransfers() { return _numLinkedTransfers; }
+
+    /**
+     * @brief returns the number of times compiled traces returned to the interpreter
+     */
+    int64_t numSideExits() { return _numSideExits; }
+
+protected:
+    void startRecording(int32_t bcIndex);
+    void finishRecording(int32_t linkTarget);
+    BytecodeTrace *compiledTrace(int32_t bcIndex);
+
+    TR::MethodBuilder *_traceBuilder;
+    int32_t _numBytecodes;
+    int32_t _hotLoopThreshold;
+    int32_t _hotExitThreshold;
+    int32_t _maxTraceLength;
+    BytecodeTrace **_traces;
+    int32_t *_loopCounts;
+    BytecodeTrace *_recording;
+
+    int32_t _numTracesCompiled;
+    int32_t _numTracesFailed;
+    int32_t _numRecordingsAborted;
+    int64_t _numLinkedTransfers;
+    int64_t _numSideExits;
+};
+
+} // namespace OMR
+
+#endif // !defined(OMR_TRACERECORDER_INCL)
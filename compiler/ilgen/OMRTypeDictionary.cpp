@@ -33,6 +33,8 @@
 #include "env/TRMemory.hpp"
 #include "infra/Assert.hpp"
 #include "infra/BitVector.hpp"
+#include "infra/CriticalSection.hpp"
+#include "infra/Monitor.hpp"
 #include "infra/STLUtils.hpp"
 
 namespace OMR {
@@ -71,15 +73,8 @@ public:
         , _name(name)
         , _offset(offset)
         , _type(type)
-        , _symRef(0)
     {}
 
-    void cacheSymRef(TR::SymbolReference *symRef) { _symRef = symRef; }
-
-    TR::SymbolReference *getSymRef() { return _symRef; }
-
-    void clearSymRef() { _symRef = NULL; }
-
     TR::IlType *getType() { return _type; }
 
     TR::IlType *primitiveType(TR::TypeDictionary *d) { return _type->primitiveType(d); }
@@ -97,7 +92,6 @@ public:
     const char *_name;
     size_t _offset;
     TR::IlType *_type;
-    TR::SymbolReference *_symRef;
 };
 
 class StructType : public TR::IlType {
@@ -133,14 +127,12 @@ public:
     TR::IlType *getFieldType(const char *fieldName);
     size_t getFieldOffset(const char *fieldName);
 
-    TR::SymbolReference *getFieldSymRef(const char *name);
+    TR::SymbolReference *getFieldSymRef(const char *name, CompilationSymRefs *symRefs);
 
     bool isStruct() { return true; }
 
     virtual size_t getSize() { return _size; }
 
-    void clearSymRefs();
-
     void freeFields()
     {
         FieldInfo *f = _firstField;
@@ -164,14 +156,12 @@ class UnionType : public TR::IlType {
 public:
     TR_ALLOC(TR_Memory::IlGenerator)
 
-    UnionType(const char *name, TR_Memory *trMemory)
+    UnionType(const char *name)
         : TR::IlType(name)
         , _firstField(0)
         , _lastField(0)
         , _size(0)
         , _closed(false)
-        , _symRefBV(4, trMemory)
-        , _trMemory(trMemory)
     {}
 
     virtual ~UnionType() {}
@@ -185,14 +175,12 @@ public:
     void AddField(const char *name, TR::IlType *fieldType);
     TR::IlType *getFieldType(const char *fieldName);
 
-    TR::SymbolReference *getFieldSymRef(const char *name);
+    TR::SymbolReference *getFieldSymRef(const char *name, CompilationSymRefs *symRefs);
 
     virtual bool isUnion() { return true; }
 
     virtual size_t getSize() { return _size; }
 
-    void clearSymRefs();
-
     void freeFields()
     {
         FieldInfo *f = _firstField;
@@ -210,8 +198,6 @@ protected:
     FieldInfo *_lastField;
     size_t _size;
     bool _closed;
-    TR_BitVector _symRefBV;
-    TR_Memory *_trMemory;
 };
 
 class PointerType : public TR::IlType {
@@ -245,6 +231,64 @@ protected:
     char _nameArray[nameArraySize];
 };
 
+/**
+ * Field symbol references are specific to the compilation that created them, so
+ * each compilation using a TypeDictionary gets its own cache.  Only the thread
+ * running that compilation touches the cache once it has been found, and its
+ * contents live in the compilation's heap region.
+ */
+class CompilationSymRefs {
+public:
+    TR_ALLOC(TR_Memory::IlGenerator)
+
+    CompilationSymRefs(TR::Compilation *comp, CompilationSymRefs *next)
+        : _comp(comp)
+        , _next(next)
+        , _fieldSymRefs(std::less<FieldInfo *>(), comp->trMemory()->heapMemoryRegion())
+        , _unionSymRefs(std::less<UnionType *>(), comp->trMemory()->heapMemoryRegion())
+    {}
+
+    TR::Compilation *comp() { return _comp; }
+
+    CompilationSymRefs *getNext() { return _next; }
+
+    CompilationSymRefs **nextLink() { return &_next; }
+
+    TR::SymbolReference *getSymRef(FieldInfo *field)
+    {
+        FieldSymRefMap::iterator it = _fieldSymRefs.find(field);
+        return it != _fieldSymRefs.end() ? it->second : NULL;
+    }
+
+    void cacheSymRef(FieldInfo *field, TR::SymbolReference *symRef) { _fieldSymRefs[field] = symRef; }
+
+    // symbol references created for the fields of a union, which all alias each other
+    TR_BitVector *getUnionSymRefs(UnionType *unionType)
+    {
+        UnionSymRefMap::iterator it = _unionSymRefs.find(unionType);
+        if (it != _unionSymRefs.end())
+            return it->second;
+
+        TR_BitVector *symRefs = new (_comp->trHeapMemory()) TR_BitVector(4, _comp->trMemory());
+        _unionSymRefs.insert(std::make_pair(unionType, symRefs));
+        return symRefs;
+    }
+
+private:
+    typedef TR::typed_allocator<std::pair<FieldInfo * const, TR::SymbolReference *>, TR::Region &>
+        FieldSymRefMapAllocator;
+    typedef std::map<FieldInfo *, TR::SymbolReference *, std::less<FieldInfo *>, FieldSymRefMapAllocator>
+        FieldSymRefMap;
+
+    typedef TR::typed_allocator<std::pair<UnionType * const, TR_BitVector *>, TR::Region &> UnionSymRefMapAllocator;
+    typedef std::map<UnionType *, TR_BitVector *, std::less<UnionType *>, UnionSymRefMapAllocator> UnionSymRefMap;
+
+    TR::Compilation *_comp;
+    CompilationSymRefs *_next;
+    FieldSymRefMap _fieldSymRefs;
+    UnionSymRefMap _unionSymRefs;
+};
+
 } // namespace OMR
 
 void OMR::StructType::AddField(const char *name, TR::IlType *typeInfo, size_t offset)
@@ -311,15 +355,15 @@ size_t OMR::StructType::getFieldOffset(const char *fieldName)
     return info->getOffset();
 }
 
-TR::SymbolReference *OMR::StructType::getFieldSymRef(const char *fieldName)
+TR::SymbolReference *OMR::StructType::getFieldSymRef(const char *fieldName, OMR::CompilationSymRefs *symRefs)
 {
     OMR::FieldInfo *info = findField(fieldName);
     if (NULL == info)
         return NULL;
 
-    TR::SymbolReference *symRef = info->getSymRef();
+    TR::SymbolReference *symRef = symRefs->getSymRef(info);
     if (NULL == symRef) {
-        TR::Compilation *comp = TR::comp();
+        TR::Compilation *comp = symRefs->comp();
 
         TR::DataType type = info->getPrimitiveType();
 
@@ -343,21 +387,12 @@ TR::SymbolReference *OMR::StructType::getFieldSymRef(const char *fieldName)
         else
             comp->getSymRefTab()->aliasBuilder.nonIntPrimitiveShadowSymRefs().set(refNum);
 
-        info->cacheSymRef(symRef);
+        symRefs->cacheSymRef(info, symRef);
     }
 
     return symRef;
 }
 
-void OMR::StructType::clearSymRefs()
-{
-    OMR::FieldInfo *field = _firstField;
-    while (field) {
-        field->clearSymRef();
-        field = field->_next;
-    }
-}
-
 void OMR::UnionType::AddField(const char *name, TR::IlType *typeInfo)
 {
     if (_closed)
@@ -396,15 +431,15 @@ TR::IlType *OMR::UnionType::getFieldType(const char *fieldName)
     return info->_type;
 }
 
-TR::SymbolReference *OMR::UnionType::getFieldSymRef(const char *fieldName)
+TR::SymbolReference *OMR::UnionType::getFieldSymRef(const char *fieldName, OMR::CompilationSymRefs *symRefs)
 {
     OMR::FieldInfo *info = findField(fieldName);
     TR_ASSERT_FATAL(info, "Struct %s has no field with name %s\n", getName(), fieldName);
 
-    TR::SymbolReference *symRef = info->getSymRef();
+    TR::SymbolReference *symRef = symRefs->getSymRef(info);
     if (NULL == symRef) {
         // create a symref for the new field and set its bitvector
-        TR::Compilation *comp = TR::comp();
+        TR::Compilation *comp = symRefs->comp();
         auto symRefTab = comp->getSymRefTab();
         TR::DataType type = info->getPrimitiveType();
 
@@ -418,29 +453,20 @@ TR::SymbolReference *OMR::UnionType::getFieldSymRef(const char *fieldName)
         symRef->setOffset(0);
         symRef->setReallySharesSymbol();
 
-        TR_SymRefIterator sit(_symRefBV, symRefTab);
+        TR_BitVector *unionSymRefs = symRefs->getUnionSymRefs(this);
+        TR_SymRefIterator sit(*unionSymRefs, symRefTab);
         for (TR::SymbolReference *sr = sit.getNext(); sr; sr = sit.getNext()) {
             symRefTab->makeSharedAliases(symRef, sr);
         }
 
-        _symRefBV.set(symRef->getReferenceNumber());
+        unionSymRefs->set(symRef->getReferenceNumber());
 
-        info->cacheSymRef(symRef);
+        symRefs->cacheSymRef(info, symRef);
     }
 
     return symRef;
 }
 
-void OMR::UnionType::clearSymRefs()
-{
-    OMR::FieldInfo *field = _firstField;
-    while (field) {
-        field->clearSymRef();
-        field = field->_next;
-    }
-    _symRefBV.init(4, _trMemory);
-}
-
 // Note: _memoryRegion and the corresponding TR::SegmentProvider and TR::Memory instances are stored as pointers within
 // TypeDictionary in order to avoid increasing the number of header files needed to compile against the JitBuilder
 // library. Because we are storing them as pointers, we cannot rely on the default C++ destruction semantic to destruct
@@ -470,6 +496,8 @@ OMR::TypeDictionary::TypeDictionary()
     , _pointersByName(str_comparator, trMemory()->heapMemoryRegion())
     , _structsByName(str_comparator, trMemory()->heapMemoryRegion())
     , _unionsByName(str_comparator, trMemory()->heapMemoryRegion())
+    , _compilationSymRefs(NULL)
+    , _monitor(TR::Monitor::create("JitBuilderTypeDictionaryMonitor"))
 {
     TR::DataTypes Vector128Int8 = OMR::DataType::createVectorType(TR::Int8, TR::VectorLength128);
     TR::DataTypes Vector128Int16 = OMR::DataType::createVectorType(TR::Int16, TR::VectorLength128);
@@ -531,10 +559,21 @@ OMR::TypeDictionary::TypeDictionary(const TypeDictionary &src)
     , _pointersByName(str_comparator, trMemory()->heapMemoryRegion())
     , _structsByName(str_comparator, trMemory()->heapMemoryRegion())
     , _unionsByName(str_comparator, trMemory()->heapMemoryRegion())
+    , _compilationSymRefs(NULL)
+    , _monitor(TR::Monitor::create("JitBuilderTypeDictionaryMonitor"))
 {}
 
 OMR::TypeDictionary::~TypeDictionary() throw()
 {
+    // Caches left behind by compilations that never finished generating IL;
+    // their contents went away with the compilation's heap region
+    while (_compilationSymRefs) {
+        OMR::CompilationSymRefs *symRefs = _compilationSymRefs;
+        _compilationSymRefs = symRefs->getNext();
+        jitPersistentFree(symRefs);
+    }
+    TR::Monitor::destroy(_monitor);
+
     // Cleanup allocations in _memoryRegion *before* its destroyed in
     // the TypeDictionary::MemoryManager destructor
     for (auto it = _pointersByName.begin(); it != _pointersByName.end(); it++) {
@@ -630,7 +669,7 @@ TR::IlType *OMR::TypeDictionary::DefineUnion(const char *unionName)
 {
     TR_ASSERT_FATAL(_unionsByName.find(unionName) == _unionsByName.end(), "Union '%s' already exists", unionName);
 
-    OMR::UnionType *newType = new (PERSISTENT_NEW) OMR::UnionType(unionName, trMemory());
+    OMR::UnionType *newType = new (PERSISTENT_NEW) OMR::UnionType(unionName);
     _unionsByName.insert(std::make_pair(unionName, newType));
 
     return newType;
@@ -653,6 +692,7 @@ TR::IlType *OMR::TypeDictionary::PointerTo(const char *structName) { return Poin
 TR::IlType *OMR::TypeDictionary::PointerTo(TR::IlType *baseType)
 {
     OMR::PointerType *ptrType = new (PERSISTENT_NEW) OMR::PointerType(baseType);
+    OMR::CriticalSection addPointerType(_monitor);
     _pointersByName.insert(std::make_pair(ptrType->getName(), ptrType));
     return ptrType;
 }
@@ -662,31 +702,46 @@ TR::IlReference *OMR::TypeDictionary::FieldReference(const char *typeName, const
     StructMap::iterator structIterator = _structsByName.find(typeName);
     if (structIterator != _structsByName.end()) {
         OMR::StructType *theStruct = structIterator->second;
-        return new (PERSISTENT_NEW) TR::IlReference(theStruct->getFieldSymRef(fieldName));
+        return new (PERSISTENT_NEW) TR::IlReference(theStruct->getFieldSymRef(fieldName, symRefsFor(TR::comp())));
     }
 
     UnionMap::iterator unionIterator = _unionsByName.find(typeName);
     if (unionIterator != _unionsByName.end()) {
         OMR::UnionType *theUnion = unionIterator->second;
-        return new (PERSISTENT_NEW) TR::IlReference(theUnion->getFieldSymRef(fieldName));
+        return new (PERSISTENT_NEW) TR::IlReference(theUnion->getFieldSymRef(fieldName, symRefsFor(TR::comp())));
     }
 
     TR_ASSERT_FATAL(false, "No type with name '%s'", typeName);
     return NULL;
 }
 
-void OMR::TypeDictionary::NotifyCompilationDone()
+OMR::CompilationSymRefs *OMR::TypeDictionary::symRefsFor(TR::Compilation *comp)
 {
-    // clear all symbol references for fields
-    for (StructMap::iterator it = _structsByName.begin(); it != _structsByName.end(); it++) {
-        OMR::StructType *aStruct = it->second;
-        aStruct->clearSymRefs();
+    OMR::CriticalSection findSymRefs(_monitor);
+    for (OMR::CompilationSymRefs *symRefs = _compilationSymRefs; symRefs; symRefs = symRefs->getNext()) {
+        if (symRefs->comp() == comp)
+            return symRefs;
     }
 
-    // clear all symbol references for union fields
-    for (UnionMap::iterator it = _unionsByName.begin(); it != _unionsByName.end(); it++) {
-        OMR::UnionType *aUnion = it->second;
-        aUnion->clearSymRefs();
+    _compilationSymRefs = new (PERSISTENT_NEW) OMR::CompilationSymRefs(comp, _compilationSymRefs);
+    return _compilationSymRefs;
+}
+
+void OMR::TypeDictionary::NotifyCompilationDone()
+{
+    TR::Compilation *comp = TR::comp();
+    if (NULL == comp)
+        return;
+
+    // the cache contents live in the compilation's heap region, so only the list node needs freeing
+    OMR::CriticalSection releaseSymRefs(_monitor);
+    for (OMR::CompilationSymRefs **link = &_compilationSymRefs; *link; link = (*link)->nextLink()) {
+        OMR::CompilationSymRefs *symRefs = *link;
+        if (symRefs->comp() == comp) {
+            *link = symRefs->getNext();
+            jitPersistentFree(symRefs);
+            return;
+        }
     }
 }
 
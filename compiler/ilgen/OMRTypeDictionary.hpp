@@ -32,10 +32,13 @@ class TR_Memory;
 namespace OMR {
 class StructType;
 class UnionType;
+class CompilationSymRefs;
 } // namespace OMR
 
 namespace TR {
+class Compilation;
 class IlReference;
+class Monitor;
 }
 
 namespace TR {
@@ -167,8 +170,11 @@ public:
     TR::IlType *getWord() { return Word; }
 
     /*
-     * @brief advise that compilation is complete so compilation-specific objects like symbol references can be cleared
-     * from caches
+     * @brief advise that the current compilation no longer needs the field symbol references created for it, so they
+     * can be dropped from the cache; has no effect when called outside a compilation
+     *
+     * Field symbol references are cached per compilation, so several MethodBuilders sharing this dictionary can
+     * generate IL concurrently on different threads as long as all types are defined before those compilations start.
      */
     void NotifyCompilationDone();
 
@@ -214,6 +220,11 @@ protected:
     OMR::StructType *getStruct(const char *structName);
     OMR::UnionType *getUnion(const char *unionName);
 
+    /**
+     * @brief returns the field symbol reference cache of the given compilation, creating it if needed
+     */
+    OMR::CompilationSymRefs *symRefsFor(TR::Compilation *comp);
+
     /**
      * @brief pointer to a client object that corresponds to this object
      */
@@ -244,6 +255,16 @@ protected:
     typedef std::map<const char *, OMR::UnionType *, StrComparator, UnionMapAllocator> UnionMap;
     UnionMap _unionsByName;
 
+    /**
+     * @brief field symbol reference caches of the compilations currently using this dictionary
+     */
+    OMR::CompilationSymRefs *_compilationSymRefs;
+
+    /**
+     * @brief guards _compilationSymRefs and _pointersByName against concurrent compilations
+     */
+    TR::Monitor *_monitor;
+
 public:
     // convenience for primitive types
     TR::IlType *_primitiveType[TR::NumAllTypes];
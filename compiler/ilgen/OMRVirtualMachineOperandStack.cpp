@@ -40,6 +40,7 @@ OMR::VirtualMachineOperandStack::VirtualMachineOperandStack(TR::MethodBuilder *m
     , _elementType(elementType)
     , _pushAmount(growsUp ? +1 : -1)
     , _stackOffset(stackInitialOffset)
+    , _committed(NULL)
 {
     init();
 }
@@ -54,10 +55,15 @@ OMR::VirtualMachineOperandStack::VirtualMachineOperandStack(TR::VirtualMachineOp
     , _pushAmount(other->_pushAmount)
     , _stackOffset(other->_stackOffset)
     , _stackBaseName(other->_stackBaseName)
+    , _committed(NULL)
 {
     int32_t numBytes = _stackMax * sizeof(TR::IlValue *);
     _stack = (TR::IlValue **)TR::comp()->trMemory()->allocateHeapMemory(numBytes);
     memcpy(_stack, other->_stack, numBytes);
+    if (other->_committed != NULL) {
+        _committed = (TR::IlValue **)TR::comp()->trMemory()->allocateHeapMemory(numBytes);
+        memcpy(_committed, other->_committed, numBytes);
+    }
 }
 
 // commits the simulated operand stack of values to the virtual machine state
@@ -79,9 +85,19 @@ void OMR::VirtualMachineOperandStack::Commit(TR::IlBuilder *b)
     for (int32_t i = _stackTop; i >= 0; i--) {
         // TBD: how to handle hitting the end of stack?
 
+        // with dirty slot tracking, skip slots that already hold their value
+        if (_committed != NULL) {
+            if (_committed[i] == _stack[i])
+                continue;
+            _committed[i] = _stack[i];
+        }
+
         b->StoreAt(b->IndexAt(pElement, stack, b->ConstInt32(i - _stackOffset)),
             Pick(_stackTop - i)); // should generalize, maybe delegate element storage ?
     }
+
+    // the virtual machine is free to use the stack above the top
+    forgetCommittedSlots(_stackTop + 1);
 }
 
 void OMR::VirtualMachineOperandStack::Reload(TR::IlBuilder *b)
@@ -94,6 +110,8 @@ void OMR::VirtualMachineOperandStack::Reload(TR::IlBuilder *b)
     TR::IlValue *stack = b->Load(_stackBaseName);
     for (int32_t i = _stackTop; i >= 0; i--) {
         _stack[i] = b->LoadAt(pElement, b->IndexAt(pElement, stack, b->ConstInt32(i - _stackOffset)));
+        if (_committed != NULL)
+            _committed[i] = _stack[i];
     }
 }
 
@@ -114,6 +132,19 @@ void OMR::VirtualMachineOperandStack::MergeInto(TR::VirtualMachineState *o, TR::
             b->StoreOver(other->_stack[i], _stack[i]);
         }
     }
+
+    // code at the merge point may rely on slots being committed, so commit them on this path if needed
+    if (other->_committed != NULL) {
+        TR::IlType *pElement = _mb->typeDictionary()->PointerTo(_elementType);
+        TR::IlValue *stack = NULL;
+        for (int32_t i = _stackTop; i >= 0; i--) {
+            if (other->_committed[i] != NULL && (_committed == NULL || _committed[i] != _stack[i])) {
+                if (stack == NULL)
+                    stack = b->Load(_stackBaseName);
+                b->StoreAt(b->IndexAt(pElement, stack, b->ConstInt32(i - _stackOffset)), _stack[i]);
+            }
+        }
+    }
 }
 
 // Update the OperandStack_base and _stackTopRegister after the Virtual Machine moves the stack.
@@ -121,6 +152,18 @@ void OMR::VirtualMachineOperandStack::MergeInto(TR::VirtualMachineState *o, TR::
 void OMR::VirtualMachineOperandStack::UpdateStack(TR::IlBuilder *b, TR::IlValue *stack)
 {
     b->Store(_stackBaseName, stack);
+    forgetCommittedSlots(0);
+}
+
+void OMR::VirtualMachineOperandStack::SetDirtySlotTracking(bool enabled)
+{
+    if (!enabled) {
+        _committed = NULL;
+    } else if (_committed == NULL) {
+        int32_t numBytes = _stackMax * sizeof(TR::IlValue *);
+        _committed = (TR::IlValue **)TR::comp()->trMemory()->allocateHeapMemory(numBytes);
+        memset(_committed, 0, numBytes);
+    }
 }
 
 // Allocate a new operand stack and copy everything in this state
@@ -138,6 +181,9 @@ void OMR::VirtualMachineOperandStack::Push(TR::IlBuilder *b, TR::IlValue *value)
 {
     checkSize();
     _stack[++_stackTop] = value;
+    // a committed slot either holds the value at that depth or is forgotten, which keeps MergeInto simple
+    if (_committed != NULL && _committed[_stackTop] != value)
+        _committed[_stackTop] = NULL;
 }
 
 TR::IlValue *OMR::VirtualMachineOperandStack::Top()
@@ -161,7 +207,15 @@ TR::IlValue *OMR::VirtualMachineOperandStack::Pick(int32_t depth)
 void OMR::VirtualMachineOperandStack::Drop(TR::IlBuilder *b, int32_t depth)
 {
     TR_ASSERT_FATAL(_stackTop >= depth - 1, "stack underflow");
+    int32_t oldTop = _stackTop;
     _stackTop -= depth;
+    // slots exposed by a negative drop are only known once they are reloaded
+    if (_committed != NULL) {
+        if (_stackTop >= _stackMax)
+            grow(_stackTop + 1 - _stackMax);
+        for (int32_t i = oldTop + 1; i <= _stackTop; i++)
+            _committed[i] = NULL;
+    }
 }
 
 void OMR::VirtualMachineOperandStack::Dup(TR::IlBuilder *b)
@@ -197,10 +251,25 @@ void OMR::VirtualMachineOperandStack::grow(int32_t growAmount)
     int32_t numBytes = _stackMax * sizeof(TR::IlValue *);
     memcpy(newStack, _stack, numBytes);
 
+    if (_committed != NULL) {
+        TR::IlValue **newCommitted = (TR::IlValue **)TR::comp()->trMemory()->allocateHeapMemory(newBytes);
+        memset(newCommitted, 0, newBytes);
+        memcpy(newCommitted, _committed, numBytes);
+        _committed = newCommitted;
+    }
+
     _stack = newStack;
     _stackMax = newMax;
 }
 
+void OMR::VirtualMachineOperandStack::forgetCommittedSlots(int32_t fromSlot)
+{
+    if (_committed != NULL) {
+        for (int32_t i = fromSlot; i < _stackMax; i++)
+            _committed[i] = NULL;
+    }
+}
+
 void *OMR::VirtualMachineOperandStack::client()
 {
     if (_client == NULL && _clientAllocator != NULL)
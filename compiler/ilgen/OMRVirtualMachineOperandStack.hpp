@@ -78,6 +78,14 @@ namespace OMR {
  *   Drop() discards "depth" elements from the stack
  *   Dup() is a convenience function for Push(Top())
  *
+ * With SetDirtySlotTracking(true), the stack remembers which value each
+ * virtual machine stack slot is known to hold, either because Commit() stored
+ * it there or because Reload() loaded it from there. Commit() then only stores
+ * the slots whose value has changed since, so values that stay on the stack
+ * across many bytecodes are written once rather than at every Commit(). At a
+ * merge point, MergeInto() stores any slot that the target state relies on
+ * but that has not been committed on the incoming path.
+ *
  */
 
 class VirtualMachineOperandStack : public TR::VirtualMachineState {
@@ -146,6 +154,14 @@ public:
      */
     virtual void UpdateStack(TR::IlBuilder *b, TR::IlValue *stack);
 
+    /**
+     * @brief only store the stack slots that have changed since they were last committed or reloaded
+     * @param enabled true to track which slots must be stored by Commit, false to store every slot
+     * While tracking is enabled, the virtual machine must not change a committed stack slot unless
+     * Reload() is called afterwards. Slots above the top of the stack may be changed freely.
+     */
+    virtual void SetDirtySlotTracking(bool enabled);
+
     /**
      * @brief Push an expression onto the simulated operand stack
      * @param b builder object to use for any operations used to implement the push (e.g. update the top of stack)
@@ -209,6 +225,7 @@ protected:
     void checkSize();
     void grow(int32_t growAmount = 0);
     void init();
+    void forgetCommittedSlots(int32_t fromSlot);
 
 private:
     TR::MethodBuilder *_mb;
@@ -220,6 +237,8 @@ private:
     int32_t _pushAmount;
     int32_t _stackOffset;
     const char *_stackBaseName;
+    // value known to be in each virtual machine stack slot; NULL unless dirty slot tracking is enabled
+    TR::IlValue **_committed;
 
     static ClientAllocator _clientAllocator;
     static ImplGetter _getImpl;
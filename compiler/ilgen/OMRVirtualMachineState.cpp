@@ -32,12 +32,16 @@ void OMR::VirtualMachineState::commit(TR::IlBuilder *b)
 {
     if (_clientCallbackCommit)
         (*_clientCallbackCommit)(client(), b->client());
+    else
+        Commit(b);
 }
 
 void OMR::VirtualMachineState::reload(TR::IlBuilder *b)
 {
     if (_clientCallbackReload)
         (*_clientCallbackReload)(client(), b->client());
+    else
+        Reload(b);
 }
 
 TR::VirtualMachineState *OMR::VirtualMachineState::MakeCopy()
@@ -61,6 +65,8 @@ void OMR::VirtualMachineState::mergeInto(TR::VirtualMachineState *other, TR::IlB
 {
     if (_clientCallbackMergeInto)
         (*_clientCallbackMergeInto)(client(), other->client(), b->client());
+    else
+        MergeInto(other, b);
 }
 
 void *OMR::VirtualMachineState::client()
@@ -26,7 +26,7 @@
 
 namespace OMR { namespace StatementName {
 
-static const int16_t VERSION_MAJOR = 0;
+static const int16_t VERSION_MAJOR = 1;
 static const int16_t VERSION_MINOR = 0;
 static const int16_t VERSION_PATCH = 0;
 static const char * const RECORDER_SIGNATURE = "JBIL";
@@ -41,6 +41,7 @@ static const char * const STATEMENT_DEFINEARRAYPARAMETER = "DefineArrayParameter
 static const char * const STATEMENT_DEFINERETURNTYPE = "DefineReturnType";
 static const char * const STATEMENT_DEFINELOCAL = "DefineLocal";
 static const char * const STATEMENT_DEFINEMEMORY = "DefineMemory";
+static const char * const STATEMENT_DEFINEGLOBAL = "DefineGlobal";
 static const char * const STATEMENT_DEFINEFUNCTION = "DefineFunction";
 static const char * const STATEMENT_DEFINESTRUCT = "DefineStruct";
 static const char * const STATEMENT_DEFINEUNION = "DefineUnion";
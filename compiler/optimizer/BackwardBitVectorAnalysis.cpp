@@ -39,8 +39,6 @@
 class TR_BitVector;
 #define MAX_CASES_FOR_STACK_ALLOCATION 16
 
-static int32_t numIterations = 0;
-
 // This file contains the methods specifying the backward
 // bit vector analysis rules for each structure. Also contain
 // definitions of other methods in class BackwardBitVectorAnalysis.
@@ -213,9 +211,9 @@ void TR_BackwardDFSetAnalysis<Container *>::initializeGenAndKillSetInfo(TR_Regio
     while (this->_analysisQueue.getListHead()
         && (this->_analysisQueue.getListHead()->getData()->getStructure() != regionStructure)) {
         if (!this->_analysisInterrupted) {
-            numIterations++;
-            if ((numIterations % 20) == 0) {
-                numIterations = 0;
+            this->_numIterations++;
+            if ((this->_numIterations % 20) == 0) {
+                this->_numIterations = 0;
                 if (this->comp()->compilationShouldBeInterrupted(BBVA_INITIALIZE_CONTEXT))
                     this->_analysisInterrupted = true;
             }
@@ -928,6 +926,30 @@ bool TR_BackwardDFSetAnalysis<Container *>::analyzeRegionStructure(TR_RegionStru
     int32_t numIterations = 1;
     this->_firstIteration = true;
 
+    if (this->useWorklistSolver()) {
+        // Visit the subnodes in post-order, re-queueing a node only when the
+        // in set of one of its successors has changed.
+        //
+        TR_DataFlowWorklist worklist(this->comp(), regionStructure, true);
+
+        logprintf(traceBBVA(), log, "\nREGION : %p NUMBER : %d with worklist of %d nodes\n", regionStructure,
+            regionStructure->getNumber(), worklist.getNumNodes());
+
+        this->_numRegionPasses++;
+        this->_nodesInCycle->empty();
+        while (!worklist.isEmpty()) {
+            this->addToAnalysisQueue(worklist.removeFirst(), 1);
+            analyzeNodeIfSuccessorsAnalyzed(regionStructure, pendingList, exitNodes, &worklist);
+        }
+
+        // Re-visits of some subnodes are interleaved with the first visit
+        // of others, so the first pass is only over once the worklist is
+        // drained
+        //
+        this->_firstIteration = false;
+        changed = false;
+    }
+
     while (changed) {
         this->_nodesInCycle->empty();
         changed = false;
@@ -936,6 +958,7 @@ bool TR_BackwardDFSetAnalysis<Container *>::analyzeRegionStructure(TR_RegionStru
             regionStructure->getNumber(), numIterations);
 
         numIterations++;
+        this->_numRegionPasses++;
 
         ei.reset();
         for (edge = ei.getCurrent(); edge != NULL; edge = ei.getNext()) {
@@ -978,7 +1001,7 @@ bool TR_BackwardDFSetAnalysis<Container *>::analyzeRegionStructure(TR_RegionStru
 
 template<class Container>
 bool TR_BackwardDFSetAnalysis<Container *>::analyzeNodeIfSuccessorsAnalyzed(TR_RegionStructure *regionStructure,
-    TR_BitVector &pendingList, TR_BitVector &exitNodes)
+    TR_BitVector &pendingList, TR_BitVector &exitNodes, TR_DataFlowWorklist *worklist)
 {
     OMR::Logger *log = this->comp()->log();
     bool anyNodeChanged = false;
@@ -986,9 +1009,9 @@ bool TR_BackwardDFSetAnalysis<Container *>::analyzeNodeIfSuccessorsAnalyzed(TR_R
     while (this->_analysisQueue.getListHead()
         && (this->_analysisQueue.getListHead()->getData()->getStructure() != regionStructure)) {
         if (!this->_analysisInterrupted) {
-            numIterations++;
-            if ((numIterations % 20) == 0) {
-                numIterations = 0;
+            this->_numIterations++;
+            if ((this->_numIterations % 20) == 0) {
+                this->_numIterations = 0;
                 if (this->comp()->compilationShouldBeInterrupted(BBVA_ANALYZE_CONTEXT))
                     this->_analysisInterrupted = true;
             }
@@ -1026,7 +1049,8 @@ bool TR_BackwardDFSetAnalysis<Container *>::analyzeNodeIfSuccessorsAnalyzed(TR_R
             if (!regionStructure->isExitEdge(succ)) {
                 TR_StructureSubGraphNode *succNode = (TR_StructureSubGraphNode *)succ->getTo();
                 TR_Structure *succStructure = succNode->getStructure();
-                if (pendingList.get(succStructure->getNumber()) && (!alreadyVisitedNode)) {
+                // The worklist already orders successors first, except along back edges
+                if (pendingList.get(succStructure->getNumber()) && (!alreadyVisitedNode) && worklist == NULL) {
                     this->removeHeadFromAnalysisQueue();
                     this->addToAnalysisQueue(succNode, 0);
                     stopAnalyzingThisNode = true;
@@ -1052,6 +1076,7 @@ bool TR_BackwardDFSetAnalysis<Container *>::analyzeNodeIfSuccessorsAnalyzed(TR_R
         if (stopAnalyzingThisNode)
             continue;
 
+        this->_numNodeVisits++;
         firstSucc = false;
 
         if (exitNodes.get(nodeStructure->getNumber())) {
@@ -1298,7 +1323,10 @@ bool TR_BackwardDFSetAnalysis<Container *>::analyzeNodeIfSuccessorsAnalyzed(TR_R
             if ((needToIterate || (node != regionStructure->getEntry()))
                 && (pendingList.get(predStructure->getNumber()) || inSetChanged)) {
                 this->_nodesInCycle->empty();
-                this->addToAnalysisQueue(toStructureSubGraphNode(predNode), inSetChanged ? 1 : 0);
+                if (worklist)
+                    worklist->add(predNode);
+                else
+                    this->addToAnalysisQueue(toStructureSubGraphNode(predNode), inSetChanged ? 1 : 0);
             }
         }
         if (changed)
@@ -1312,6 +1340,7 @@ bool TR_BackwardDFSetAnalysis<Container *>::analyzeBlockStructure(TR_BlockStruct
     bool checkForChange)
 {
     OMR::Logger *log = this->comp()->log();
+    this->_numTransferFunctions++;
 
     initializeInfo(this->_regularInfo);
     initializeInfo(this->_exceptionInfo);
@@ -42,8 +42,6 @@
 
 class TR_BitVector;
 
-static int32_t numIterations = 0;
-
 // This file contains the methods specifying the forward
 // bit vector analysis rules for each structure. Also contain
 // definitions of other methods in class BitVectorAnalysis.
@@ -69,7 +67,15 @@ bool TR_BasicDFSetAnalysis<Container *>::performAnalysis(TR_Structure *rootStruc
     initializeDFSetAnalysis();
     if (!postInitializationProcessing())
         return false;
+    _numRegionPasses = 0;
+    _numNodeVisits = 0;
+    _numTransferFunctions = 0;
     doAnalysis(rootStructure, checkForChanges);
+
+    if (trace() || traceBVA()) {
+        comp()->log()->printf("\n%s solver: %d region passes, %d node visits, %d transfer functions\n",
+            useWorklistSolver() ? "Worklist" : "Structural", _numRegionPasses, _numNodeVisits, _numTransferFunctions);
+    }
     return true;
 }
 
@@ -532,9 +538,9 @@ void TR_ForwardDFSetAnalysis<Container *>::initializeGenAndKillSetInfo(TR_Region
     while (this->_analysisQueue.getListHead()
         && (this->_analysisQueue.getListHead()->getData()->getStructure() != regionStructure)) {
         if (!this->_analysisInterrupted) {
-            numIterations++;
-            if ((numIterations % 20) == 0) {
-                numIterations = 0;
+            this->_numIterations++;
+            if ((this->_numIterations % 20) == 0) {
+                this->_numIterations = 0;
                 if (this->comp()->compilationShouldBeInterrupted(FBVA_INITIALIZE_CONTEXT))
                     this->_analysisInterrupted = true;
             }
@@ -996,6 +1002,30 @@ bool TR_ForwardDFSetAnalysis<Container *>::analyzeRegionStructure(TR_RegionStruc
     int32_t numIterations = 1;
     this->_firstIteration = true;
 
+    if (this->useWorklistSolver()) {
+        // Visit the subnodes in reverse post-order, re-queueing a node only
+        // when the out set of one of its predecessors has changed.
+        //
+        TR_DataFlowWorklist worklist(this->comp(), regionStructure, false);
+
+        logprintf(this->traceBVA(), log, "\nAnalyzing REGION : %p NUMBER : %d with worklist of %d nodes\n",
+            regionStructure, regionStructure->getNumber(), worklist.getNumNodes());
+
+        this->_numRegionPasses++;
+        this->_nodesInCycle->empty();
+        while (!worklist.isEmpty()) {
+            this->addToAnalysisQueue(worklist.removeFirst(), 1);
+            this->analyzeNodeIfPredecessorsAnalyzed(regionStructure, pendingList, &worklist);
+        }
+
+        // Re-visits of some subnodes are interleaved with the first visit
+        // of others, so the first pass is only over once the worklist is
+        // drained
+        //
+        this->_firstIteration = false;
+        changed = false;
+    }
+
     while (changed) {
         this->_nodesInCycle->empty();
 
@@ -1005,6 +1035,7 @@ bool TR_ForwardDFSetAnalysis<Container *>::analyzeRegionStructure(TR_RegionStruc
             regionStructure->getNumber(), numIterations);
 
         numIterations++;
+        this->_numRegionPasses++;
 
         {
             this->addToAnalysisQueue(regionStructure->getEntry(), 0);
@@ -1065,7 +1096,7 @@ bool TR_ForwardDFSetAnalysis<Container *>::analyzeRegionStructure(TR_RegionStruc
 
 template<class Container>
 bool TR_ForwardDFSetAnalysis<Container *>::analyzeNodeIfPredecessorsAnalyzed(TR_RegionStructure *regionStructure,
-    TR_BitVector &pendingList)
+    TR_BitVector &pendingList, TR_DataFlowWorklist *worklist)
 {
     OMR::Logger *log = this->comp()->log();
     bool anyNodeChanged = false;
@@ -1073,9 +1104,9 @@ bool TR_ForwardDFSetAnalysis<Container *>::analyzeNodeIfPredecessorsAnalyzed(TR_
     while (this->_analysisQueue.getListHead()
         && (this->_analysisQueue.getListHead()->getData()->getStructure() != regionStructure)) {
         if (!this->_analysisInterrupted) {
-            numIterations++;
-            if ((numIterations % 20) == 0) {
-                numIterations = 0;
+            this->_numIterations++;
+            if ((this->_numIterations % 20) == 0) {
+                this->_numIterations = 0;
                 if (this->comp()->compilationShouldBeInterrupted(FBVA_ANALYZE_CONTEXT))
                     this->_analysisInterrupted = true;
             }
@@ -1114,7 +1145,8 @@ bool TR_ForwardDFSetAnalysis<Container *>::analyzeNodeIfPredecessorsAnalyzed(TR_
         for (auto pred = predecessors.getFirst(); pred; pred = predecessors.getNext()) {
             TR_StructureSubGraphNode *predNode = (TR_StructureSubGraphNode *)pred->getFrom();
             TR_Structure *predStructure = predNode->getStructure();
-            if (pendingList.get(predStructure->getNumber()) && (!alreadyVisitedNode)) {
+            // The worklist already orders predecessors first, except along back edges
+            if (pendingList.get(predStructure->getNumber()) && (!alreadyVisitedNode) && worklist == NULL) {
                 this->removeHeadFromAnalysisQueue();
                 this->addToAnalysisQueue(predNode, 0);
                 stopAnalyzingThisNode = true;
@@ -1138,6 +1170,8 @@ bool TR_ForwardDFSetAnalysis<Container *>::analyzeNodeIfPredecessorsAnalyzed(TR_
         if (stopAnalyzingThisNode)
             continue;
 
+        this->_numNodeVisits++;
+
         if (node == regionStructure->getEntry()) {
             if (regionStructure != this->_cfg->getStructure())
                 compose(_currentInSetInfo, this->getAnalysisInfo(regionStructure)->_inSetInfo);
@@ -1266,7 +1300,10 @@ bool TR_ForwardDFSetAnalysis<Container *>::analyzeNodeIfPredecessorsAnalyzed(TR_
             if ((!regionStructure->isExitEdge(*succ)) && (needToIterate || (succNode != regionStructure->getEntry()))
                 && (pendingList.get(succNode->getNumber()) || outSetChanged)) {
                 this->_nodesInCycle->empty();
-                this->addToAnalysisQueue(toStructureSubGraphNode(succNode), outSetChanged ? 1 : 0);
+                if (worklist)
+                    worklist->add(succNode);
+                else
+                    this->addToAnalysisQueue(toStructureSubGraphNode(succNode), outSetChanged ? 1 : 0);
             }
         }
 
@@ -1275,7 +1312,10 @@ bool TR_ForwardDFSetAnalysis<Container *>::analyzeNodeIfPredecessorsAnalyzed(TR_
             if ((!regionStructure->isExitEdge(*succ)) && (needToIterate || (succNode != regionStructure->getEntry()))
                 && (pendingList.get(succNode->getNumber()) || outSetChanged)) {
                 this->_nodesInCycle->empty();
-                this->addToAnalysisQueue(toStructureSubGraphNode(succNode), outSetChanged ? 1 : 0);
+                if (worklist)
+                    worklist->add(succNode);
+                else
+                    this->addToAnalysisQueue(toStructureSubGraphNode(succNode), outSetChanged ? 1 : 0);
             }
         }
 
@@ -1290,6 +1330,7 @@ template<class Container>
 bool TR_ForwardDFSetAnalysis<Container *>::analyzeBlockStructure(TR_BlockStructure *blockStructure, bool checkForChange)
 {
     OMR::Logger *log = this->comp()->log();
+    this->_numTransferFunctions++;
 
     if (this->supportsGenAndKillSets() && canGenAndKillForStructure(blockStructure)) {
         blockStructure->setAnalyzedStatus(true);
@@ -946,7 +946,12 @@ int32_t TR_CopyPropagation::perform()
         requestOpt(OMR::partialRedundancyElimination, true);
     }
 
-    optimizer()->setUseDefInfo(NULL);
+    // Propagation rewrote uses and may have added stores to new temps, so the
+    // use/def info no longer describes the trees.  If nothing was changed it
+    // is still accurate and is kept for the next optimization that asks for it
+    //
+    if (donePropagation || _cleanupTemps)
+        optimizer()->setUseDefInfo(NULL);
 
     return 1; // actual cost
 }
@@ -117,6 +117,108 @@ void TR_DataFlowAnalysis::removeHeadFromAnalysisQueue()
     _changedSetsQueue.setListHead(_changedSetsQueue.getListHead()->getNextElement());
 }
 
+TR_DataFlowWorklist::TR_DataFlowWorklist(TR::Compilation *comp, TR_RegionStructure *region, bool isBackward)
+    : _memoryRegion(comp->trMemory()->currentStackRegion())
+    , _order(NULL)
+    , _numNodes(0)
+    , _positions(NULL)
+    , _numPositions(0)
+    , _pending(_memoryRegion)
+{
+
+    int32_t numSubNodes = 0;
+    TR_RegionStructure::Cursor si(*region);
+    TR_StructureSubGraphNode *subNode;
+    for (subNode = si.getCurrent(); subNode; subNode = si.getNext()) {
+        numSubNodes++;
+        if (subNode->getNumber() >= _numPositions)
+            _numPositions = subNode->getNumber() + 1;
+    }
+
+    if (numSubNodes == 0)
+        return;
+
+    // -1 marks a node that has not been visited yet, -2 one that is on the
+    // depth first search stack
+    //
+    _positions = (int32_t *)_memoryRegion.allocate(_numPositions * sizeof(int32_t));
+    for (int32_t i = 0; i < _numPositions; i++)
+        _positions[i] = -1;
+
+    _order = (TR_StructureSubGraphNode **)_memoryRegion.allocate(numSubNodes * sizeof(TR_StructureSubGraphNode *));
+    TR_StructureSubGraphNode **stack
+        = (TR_StructureSubGraphNode **)_memoryRegion.allocate(numSubNodes * sizeof(TR_StructureSubGraphNode *));
+    TR_SuccessorIterator **successors
+        = (TR_SuccessorIterator **)_memoryRegion.allocate(numSubNodes * sizeof(TR_SuccessorIterator *));
+
+    // Record the subnodes in post-order of a depth first search from the
+    // entry.  Backward problems also need the nodes that cannot be reached
+    // from the entry since they may still reach an exit.
+    //
+    addNodesInPostOrder(region, region->getEntry(), stack, successors);
+    if (isBackward) {
+        si.reset();
+        for (subNode = si.getCurrent(); subNode; subNode = si.getNext())
+            addNodesInPostOrder(region, subNode, stack, successors);
+    }
+
+    if (!isBackward) {
+        for (int32_t i = 0, j = _numNodes - 1; i < j; i++, j--) {
+            TR_StructureSubGraphNode *tmp = _order[i];
+            _order[i] = _order[j];
+            _order[j] = tmp;
+        }
+    }
+
+    for (int32_t i = 0; i < _numNodes; i++)
+        _positions[_order[i]->getNumber()] = i;
+
+    _pending.setAll(_numNodes);
+}
+
+void TR_DataFlowWorklist::addNodesInPostOrder(TR_RegionStructure *region, TR_StructureSubGraphNode *root,
+    TR_StructureSubGraphNode **stack, TR_SuccessorIterator **successors)
+{
+    if (_positions[root->getNumber()] != -1)
+        return;
+
+    int32_t depth = 0;
+    _positions[root->getNumber()] = -2;
+    stack[depth] = root;
+    successors[depth++] = new (_memoryRegion) TR_SuccessorIterator(root);
+
+    while (depth > 0) {
+        TR::CFGEdge *edge = successors[depth - 1]->getCurrent();
+        if (edge == NULL) {
+            _order[_numNodes++] = stack[--depth];
+            continue;
+        }
+
+        successors[depth - 1]->getNext();
+        if (region->isExitEdge(edge))
+            continue;
+
+        TR_StructureSubGraphNode *succ = toStructureSubGraphNode(edge->getTo());
+        if (succ->getNumber() >= _numPositions || _positions[succ->getNumber()] != -1)
+            continue;
+
+        _positions[succ->getNumber()] = -2;
+        stack[depth] = succ;
+        successors[depth++] = new (_memoryRegion) TR_SuccessorIterator(succ);
+    }
+}
+
+TR_StructureSubGraphNode *TR_DataFlowWorklist::removeFirst()
+{
+    if (_pending.isEmpty())
+        return NULL;
+
+    TR_BitVectorIterator bvi(_pending);
+    int32_t position = bvi.getFirstElement();
+    _pending.reset(position);
+    return _order[position];
+}
+
 bool TR_DataFlowAnalysis::isSameAsOrAliasedWith(TR::SymbolReference *symRef1, TR::SymbolReference *symRef2)
 {
     if (symRef1->getReferenceNumber() == symRef2->getReferenceNumber())
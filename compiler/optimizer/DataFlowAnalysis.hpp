@@ -104,6 +104,52 @@ template<class Container> class TR_BackwardIntersectionDFSetAnalysis<Container *
 template<class Container> class TR_BackwardUnionDFSetAnalysis {};
 template<class Container> class TR_BackwardUnionDFSetAnalysis<Container *>;
 
+// Worklist used by the bit vector analyses to iterate over the subnodes of a
+// region until their sets no longer change.  Subnodes are handed out in
+// reverse post-order from the region entry for forward problems and in
+// post-order for backward problems, so that on every acyclic path a node is
+// analyzed only after all the nodes its input sets are computed from.  A node
+// is only re-added once one of the sets it depends on has changed.
+//
+class TR_DataFlowWorklist {
+public:
+    TR_DataFlowWorklist(TR::Compilation *comp, TR_RegionStructure *region, bool isBackward);
+
+    bool isEmpty() { return _pending.isEmpty(); }
+
+    /**
+     * @brief Queue a subnode of the region for (re-)analysis
+     *
+     * @param[in] node : the subnode; nodes outside the ordering are ignored
+     */
+    void add(TR::CFGNode *node)
+    {
+        int32_t number = node->getNumber();
+        if (number < _numPositions && _positions[number] >= 0)
+            _pending.set(_positions[number]);
+    }
+
+    /**
+     * @brief Remove the earliest queued subnode in iteration order
+     *
+     * @return the subnode, or NULL if the worklist is empty
+     */
+    TR_StructureSubGraphNode *removeFirst();
+
+    int32_t getNumNodes() { return _numNodes; }
+
+private:
+    void addNodesInPostOrder(TR_RegionStructure *region, TR_StructureSubGraphNode *root,
+        TR_StructureSubGraphNode **stack, TR_SuccessorIterator **successors);
+
+    TR::Region &_memoryRegion;
+    TR_StructureSubGraphNode **_order;
+    int32_t _numNodes;
+    int32_t *_positions;
+    int32_t _numPositions;
+    TR_BitVector _pending;
+};
+
 // The root of the DataFlowAnalysis hierarchy. All
 // dataflow analysis classes extend this class. This class
 // also contains some general helper methods used by
@@ -271,10 +317,31 @@ public:
         _blockAnalysisInfo = 0;
         _hasImproperRegion = false;
         _nodesInCycle = NULL;
+        _useWorklistSolver = comp()->getOption(TR_EnableWorklistDataFlowSolver);
+        _numIterations = 0;
+        _numRegionPasses = 0;
+        _numNodeVisits = 0;
+        _numTransferFunctions = 0;
     }
 
     bool traceBVA() { return _traceBVA; }
 
+    /**
+     * @brief Whether regions are iterated to a fixed point with a
+     *        TR_DataFlowWorklist instead of the structure-driven analysis queue
+     */
+    bool useWorklistSolver() { return _useWorklistSolver; }
+
+    void setUseWorklistSolver(bool b) { _useWorklistSolver = b; }
+
+    // Convergence statistics for the last call to performAnalysis
+    //
+    int32_t getNumRegionPasses() { return _numRegionPasses; }
+
+    int32_t getNumNodeVisits() { return _numNodeVisits; }
+
+    int32_t getNumTransferFunctions() { return _numTransferFunctions; }
+
     virtual Kind getKind();
 
     // virtual TR_BitVectorAnalysis *asBitVectorAnalysis();
@@ -386,6 +453,11 @@ public:
     int32_t _maxReferenceNumber;
     TR::Node **_supportedNodesAsArray;
     bool _hasImproperRegion;
+    bool _useWorklistSolver;
+    int32_t _numIterations; // node visits since the last interrupt check
+    int32_t _numRegionPasses;
+    int32_t _numNodeVisits;
+    int32_t _numTransferFunctions;
 };
 
 // The root of the Forward bit vector analysis hierarchy. Extended
@@ -426,7 +498,7 @@ public:
     virtual void analyzeTreeTopsInBlockStructure(TR_BlockStructure *);
     virtual void analyzeNode(TR::Node *, vcount_t, TR_BlockStructure *, Container *);
 
-    bool analyzeNodeIfPredecessorsAnalyzed(TR_RegionStructure *, TR_BitVector &);
+    bool analyzeNodeIfPredecessorsAnalyzed(TR_RegionStructure *, TR_BitVector &, TR_DataFlowWorklist *worklist = NULL);
 
     virtual void initializeGenAndKillSetInfo(TR_RegionStructure *, TR_BitVector &);
     virtual void initializeGenAndKillSetInfoForRegion(TR_RegionStructure *);
@@ -567,7 +639,8 @@ public:
     virtual void analyzeTreeTopsInBlockStructure(TR_BlockStructure *);
     virtual void analyzeNode(TR::Node *, vcount_t, TR_BlockStructure *, Container *);
 
-    bool analyzeNodeIfSuccessorsAnalyzed(TR_RegionStructure *, TR_BitVector &, TR_BitVector &);
+    bool analyzeNodeIfSuccessorsAnalyzed(TR_RegionStructure *, TR_BitVector &, TR_BitVector &,
+        TR_DataFlowWorklist *worklist = NULL);
 
     virtual void initializeGenAndKillSetInfo(TR_RegionStructure *, TR_BitVector &, TR_BitVector &, bool);
     virtual void initializeGenAndKillSetInfoForRegion(TR_RegionStructure *);
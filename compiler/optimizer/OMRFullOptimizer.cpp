@@ -107,6 +107,7 @@
 #include "optimizer/StripMiner.hpp"
 #include "optimizer/FieldPrivatizer.hpp"
 #include "optimizer/ReorderIndexExpr.hpp"
+#include "optimizer/ScalarReplacement.hpp"
 #include "optimizer/GlobalRegisterAllocator.hpp"
 #include "optimizer/SwitchAnalyzer.hpp"
 #include "env/RegionProfiler.hpp"
@@ -193,6 +194,8 @@ static const OptimizationStrategy partialRedundancyEliminationOpts[] = {
     { OMR::preEscapeAnalysis, OMR::IfOSR },
     { OMR::escapeAnalysis, OMR::IfEAOpportunitiesMarkLastRun }, // to stack-allocate after loopversioner and localCSE
     { OMR::postEscapeAnalysis, OMR::IfOSR },
+#else
+    { OMR::escapeAnalysis, OMR::IfEAOpportunities }, // replace non-escaping allocations after localCSE
 #endif
     { OMR::basicBlockOrdering, OMR::IfLoops }, // early ordering with no extension
     { OMR::globalCopyPropagation, OMR::IfLoops }, // for Loop Versioner
@@ -586,6 +589,8 @@ OMR::FullOptimizer::FullOptimizer(TR::Compilation *comp, TR::ResolvedMethodSymbo
         TR::OptimizationManager(self(), TR::ConstRefPrivatization::create, OMR::constRefPrivatization);
     _opts[OMR::loopSpecializer]
         = new (comp->allocator()) TR::OptimizationManager(self(), TR_LoopSpecializer::create, OMR::loopSpecializer);
+    _opts[OMR::escapeAnalysis]
+        = new (comp->allocator()) TR::OptimizationManager(self(), TR::ScalarReplacement::create, OMR::escapeAnalysis);
     // NOTE: Please add new OMR optimizations here!
 
     // initialize OMR optimization groups
@@ -60,6 +60,7 @@
 #include "infra/Assert.hpp"
 #include "infra/BitVector.hpp"
 #include "infra/Cfg.hpp"
+#include "infra/ILWalk.hpp"
 #include "infra/List.hpp"
 #include "infra/SimpleRegex.hpp"
 #include "infra/CfgNode.hpp"
@@ -366,9 +367,77 @@ TR_ValueNumberInfo *OMR::SmallOptimizer::setValueNumberInfo(TR_ValueNumberInfo *
 
     if (_valueNumberInfo)
         delete _valueNumberInfo;
+
+    if (v && !comp()->getOption(TR_DisableIncrementalValueNumbers))
+        v->enableIncrementalUpdates();
     return (_valueNumberInfo = v);
 }
 
+bool OMR::SmallOptimizer::updateValueNumberInfo()
+{
+    if (_valueNumberInfo == NULL)
+        return false;
+
+    if (!_valueNumberInfo->updateValueNumbers()) {
+        setValueNumberInfo(NULL);
+        return false;
+    }
+
+    dumpOptDetails(comp(), "     (Updated value number info)\n");
+
+    if (comp()->getOption(TR_VerifyIncrementalAnalyses))
+        verifyValueNumberInfo();
+    return true;
+}
+
+void OMR::SmallOptimizer::verifyValueNumberInfo()
+{
+    TR::StackMemoryRegion stackMemoryRegion(*trMemory());
+
+    // A rebuild needs use/def info.  If there is none, build it for the
+    // rebuild only and drop it again so that later optimizations see the
+    // same state as without verification.
+    //
+    bool hadUseDefInfo = getUseDefInfo() != NULL;
+    TR_ValueNumberInfo *updated = _valueNumberInfo;
+    TR_ValueNumberInfo *rebuilt = createValueNumberInfo(updated->hasGlobalsValueNumbers(), false);
+    if (!hadUseDefInfo)
+        setUseDefInfo(NULL);
+
+    if (!rebuilt->infoIsValid()) {
+        delete rebuilt;
+        return;
+    }
+
+    TR_BitVector inTrees(comp()->getNodeCount(), trMemory(), stackAlloc);
+    TR_BitVector checked(comp()->getNodeCount(), trMemory(), stackAlloc);
+    TR::list<TR::Node *> nodes(getTypedAllocator<TR::Node *>(comp()->allocator()));
+    for (TR::PreorderNodeIterator iter(comp()->getStartTree(), comp()); iter.currentTree(); ++iter) {
+        inTrees.set(iter.currentNode()->getGlobalIndex());
+        nodes.push_back(iter.currentNode());
+    }
+
+    // The updated info may share fewer value numbers than a rebuild, but every
+    // pair of nodes it still considers equal must also be equal after a rebuild.
+    //
+    for (auto it = nodes.begin(); it != nodes.end(); ++it) {
+        TR::Node *node = *it;
+        if (checked.get(node->getGlobalIndex()))
+            continue;
+        checked.set(node->getGlobalIndex());
+        for (TR::Node *next = updated->getNext(node); next != node; next = updated->getNext(next)) {
+            checked.set(next->getGlobalIndex());
+            if (!inTrees.get(next->getGlobalIndex()))
+                continue;
+            TR_ASSERT_FATAL(rebuilt->getValueNumber(node) == rebuilt->getValueNumber(next),
+                "Updated value numbers share a value number between n%dn and n%dn but a rebuild does not",
+                node->getGlobalIndex(), next->getGlobalIndex());
+        }
+    }
+
+    delete rebuilt;
+}
+
 TR_UseDefInfo *OMR::SmallOptimizer::createUseDefInfo(TR::Compilation *comp, bool requiresGlobals, bool prefersGlobals,
     bool loadsShouldBeDefs, bool cannotOmitTrivialDefs, bool conversionRegsOnly, bool doCompletion)
 {
@@ -1375,11 +1444,13 @@ int32_t OMR::SmallOptimizer::performOptimization(const OptimizationStrategy *opt
             comp()->reportOptimizationPhaseForSnap(optNum);
 
         if (comp()->getNodeCount() > unsigned(origNodeCount)) {
-            // If nodes were added, invalidate
+            // If nodes were added, invalidate use/def info unless the
+            // optimization maintained it, and patch the value numbers if
+            // possible.  Use/def info is not updated incrementally.
             //
-            setValueNumberInfo(NULL);
             if (!manager->getMaintainsUseDefInfo())
                 setUseDefInfo(NULL);
+            updateValueNumberInfo();
         }
 
         if ((comp()->getSymRefCount() != origSymRefCount) /* || manager->getCanAddSymbolReference()*/) {
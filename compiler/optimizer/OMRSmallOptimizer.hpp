@@ -237,6 +237,19 @@ public:
         bool noUseDefInfo = false);
     TR_ValueNumberInfo *setValueNumberInfo(TR_ValueNumberInfo *v);
 
+    /**
+     * @brief Patch the value number info after an optimization added nodes,
+     *        or invalidate it if that is not possible
+     *
+     * Edits are found by comparing the trees against the snapshot taken when
+     * the info was installed, so optimizations do not report what they
+     * changed.  Only value numbers are patched; use/def info is invalidated
+     * as before.
+     *
+     * @return true if the value number info is still valid
+     */
+    bool updateValueNumberInfo();
+
     bool cantBuildGlobalsValueNumberInfo() { return _cantBuildGlobalsValueNumberInfo; }
 
     bool cantBuildLocalsValueNumberInfo() { return _cantBuildLocalsValueNumberInfo; }
@@ -380,6 +393,8 @@ private:
 
     void dumpStrategy(const OptimizationStrategy *);
 
+    void verifyValueNumberInfo();
+
     TR::Compilation *_compilation;
     TR_Memory *_trMemory;
     TR::CodeGenerator *_cg;
@@ -0,0 +1,363 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "optimizer/ScalarReplacement.hpp"
+
+#include "compile/Compilation.hpp"
+#include "compile/SymbolReferenceTable.hpp"
+#include "control/Options.hpp"
+#include "control/Options_inlines.hpp"
+#include "env/CompilerEnv.hpp"
+#include "env/ObjectModel.hpp"
+#include "env/StackMemoryRegion.hpp"
+#include "il/ILOpCodes.hpp"
+#include "il/ILOps.hpp"
+#include "il/Node.hpp"
+#include "il/Node_inlines.hpp"
+#include "il/ResolvedMethodSymbol.hpp"
+#include "il/Symbol.hpp"
+#include "il/SymbolReference.hpp"
+#include "il/TreeTop.hpp"
+#include "il/TreeTop_inlines.hpp"
+#include "infra/Assert.hpp"
+#include "infra/Checklist.hpp"
+#include "optimizer/Dominators.hpp"
+#include "optimizer/Optimization_inlines.hpp"
+#include "optimizer/Optimizer.hpp"
+#include "ras/Logger.hpp"
+
+TR::ScalarReplacement::ScalarReplacement(TR::OptimizationManager *manager)
+    : TR::Optimization(manager)
+    , _currentBlock(NULL)
+    , _dominators(NULL)
+{}
+
+int32_t TR::ScalarReplacement::perform()
+{
+    // Field values held in temps cannot be described to the debugger or to
+    // an OSR transition, both of which expect the object to exist
+    //
+    if (comp()->getOption(TR_FullSpeedDebug) || comp()->getOption(TR_EnableOSR))
+        return 0;
+
+    TR::StackMemoryRegion stackMemoryRegion(*trMemory());
+
+    CandidateList candidates(stackMemoryRegion);
+    findCandidates(candidates, stackMemoryRegion);
+    if (candidates.empty())
+        return 0;
+
+    _dominators = NULL;
+    findEscapes(candidates);
+
+    bool replacedAllocation = false;
+    for (auto it = candidates.begin(); it != candidates.end(); ++it) {
+        Candidate *candidate = *it;
+        if (candidate->_escapes)
+            continue;
+
+        if (!performTransformation(comp(), "%sReplacing allocation n%dn [%p] by %d locals\n", optDetailString(),
+                candidate->_allocation->getGlobalIndex(), candidate->_allocation,
+                (int32_t)candidate->_fields.size()))
+            continue;
+
+        replaceAllocation(candidate);
+        replacedAllocation = true;
+    }
+
+    if (replacedAllocation) {
+        // Field accesses were turned into accesses to new temps in place
+        //
+        optimizer()->setUseDefInfo(NULL);
+        optimizer()->setValueNumberInfo(NULL);
+        optimizer()->setAliasSetsAreValid(false);
+        requestOpt(OMR::localCSE);
+        requestOpt(OMR::treeSimplification);
+    }
+
+    return 1;
+}
+
+void TR::ScalarReplacement::findCandidates(CandidateList &candidates, TR::Region &region)
+{
+    TR::Block *block = NULL;
+    for (TR::TreeTop *tt = comp()->getStartTree(); tt; tt = tt->getNextTreeTop()) {
+        TR::Node *node = tt->getNode();
+        if (node->getOpCodeValue() == TR::BBStart) {
+            block = node->getBlock();
+            continue;
+        }
+
+        TR::Symbol *autoSymbol = NULL;
+        if (node->getOpCode().isStoreDirect() && node->getSymbol()->isAuto())
+            autoSymbol = node->getSymbol();
+        else if (node->getOpCodeValue() != TR::treetop)
+            continue;
+
+        TR::Node *allocation = node->getFirstChild();
+        if (!allocation->getOpCode().isNew() || !TR::Compiler->om.canScalarReplaceAllocation(allocation))
+            continue;
+
+        // An allocation stored to two autos, or two allocations stored to the
+        // same auto, leave more than one handle on an object
+        //
+        Candidate *other = findCandidateForAllocation(candidates, allocation);
+        if (other == NULL && autoSymbol != NULL)
+            other = findCandidateForAuto(candidates, autoSymbol);
+
+        Candidate *candidate = new (region) Candidate(allocation, tt, block, autoSymbol, region);
+        candidates.push_back(candidate);
+
+        logprintf(trace(), comp()->log(), "Allocation n%dn [%p] is a candidate\n", allocation->getGlobalIndex(),
+            allocation);
+
+        if (other != NULL) {
+            escape(candidate, node, "allocation or auto has more than one store");
+            escape(other, node, "allocation or auto has more than one store");
+        }
+    }
+}
+
+void TR::ScalarReplacement::findEscapes(CandidateList &candidates)
+{
+    TR::NodeChecklist visited(comp());
+    for (TR::TreeTop *tt = comp()->getStartTree(); tt; tt = tt->getNextTreeTop()) {
+        TR::Node *node = tt->getNode();
+        if (node->getOpCodeValue() == TR::BBStart)
+            _currentBlock = node->getBlock();
+
+        for (auto it = candidates.begin(); it != candidates.end(); ++it) {
+            if ((*it)->_allocationTree == tt)
+                (*it)->_allocationVisited = true;
+        }
+
+        findEscapes(candidates, tt, node, visited);
+    }
+}
+
+void TR::ScalarReplacement::findEscapes(CandidateList &candidates, TR::TreeTop *tt, TR::Node *node,
+    TR::NodeChecklist &visited)
+{
+    if (visited.contains(node))
+        return;
+    visited.add(node);
+
+    TR::ILOpCode &opCode = node->getOpCode();
+    if (opCode.hasSymbolReference() && node->getSymbol()->isAuto()) {
+        Candidate *candidate = findCandidateForAuto(candidates, node->getSymbol());
+        if (candidate != NULL) {
+            if (opCode.isStoreDirect() && node != candidate->_allocationTree->getNode())
+                escape(candidate, node, "auto has more than one store");
+            else if (node->getOpCodeValue() == TR::loadaddr)
+                escape(candidate, node, "address of auto is taken");
+        }
+    }
+
+    // Every edge to the object is examined, including those to commoned
+    // references, but each subtree is only walked once
+    //
+    for (int32_t i = 0; i < node->getNumChildren(); i++) {
+        checkUse(candidates, node, i);
+        findEscapes(candidates, tt, node->getChild(i), visited);
+    }
+}
+
+void TR::ScalarReplacement::checkUse(CandidateList &candidates, TR::Node *parent, int32_t childIndex)
+{
+    TR::Node *child = parent->getChild(childIndex);
+    Candidate *candidate = NULL;
+    if (child->getOpCode().isLoadVarDirect() && child->getSymbol()->isAuto()) {
+        candidate = findCandidateForAuto(candidates, child->getSymbol());
+    } else if (child->getOpCode().isNew()) {
+        candidate = findCandidateForAllocation(candidates, child);
+        if (candidate != NULL && parent == candidate->_allocationTree->getNode())
+            return;
+    }
+
+    if (candidate == NULL || candidate->_escapes)
+        return;
+
+    if (!isDominatedByAllocation(candidate))
+        escape(candidate, parent, "use is not dominated by the allocation");
+    else if (childIndex != 0)
+        escape(candidate, parent, "object is used as a value");
+    else if (!recordFieldAccess(candidate, parent))
+        escape(candidate, parent, "object is not used as the base of a field access");
+}
+
+bool TR::ScalarReplacement::isDominatedByAllocation(Candidate *candidate)
+{
+    // Trees are walked in order, so a use in the allocating block is dominated
+    // by the allocation exactly when the allocation tree was already walked
+    //
+    if (_currentBlock == candidate->_allocationBlock)
+        return candidate->_allocationVisited;
+
+    if (_dominators == NULL)
+        _dominators = new (trStackMemory()) TR_Dominators(comp());
+
+    return _dominators->dominates(candidate->_allocationBlock, _currentBlock) != 0;
+}
+
+bool TR::ScalarReplacement::recordFieldAccess(Candidate *candidate, TR::Node *access)
+{
+    TR::ILOpCode &opCode = access->getOpCode();
+    if (!opCode.isLoadIndirect() && !(opCode.isStoreIndirect() && access->getNumChildren() == 2))
+        return false;
+
+    TR::SymbolReference *symRef = access->getSymbolReference();
+    if (symRef->isUnresolved() || symRef->getSymbol()->isArrayShadowSymbol())
+        return false;
+
+    TR::DataType type = access->getDataType();
+    if (!type.isIntegral() && !type.isFloatingPoint() && type != TR::Address)
+        return false;
+
+    intptr_t offset = symRef->getOffset();
+    if (offset < (intptr_t)TR::Compiler->om.objectHeaderSizeInBytes())
+        return false;
+
+    // Fields are told apart by offset alone since frontends are free to use
+    // different shadows for the same field; overlapping accesses would need
+    // the temps to share storage, so they make the object escape
+    //
+    intptr_t size = TR::DataType::getSize(type);
+    bool isNewField = true;
+    for (auto it = candidate->_fields.begin(); it != candidate->_fields.end(); ++it) {
+        if (it->_offset == offset) {
+            if (it->_type != type)
+                return false;
+            isNewField = false;
+        } else if (offset < it->_offset + (intptr_t)TR::DataType::getSize(it->_type)
+            && it->_offset < offset + size) {
+            return false;
+        }
+    }
+
+    if (isNewField) {
+        if ((int32_t)candidate->_fields.size() >= TR::Compiler->om.maxScalarReplacedFields())
+            return false;
+
+        Field field = { offset, type, NULL };
+        candidate->_fields.push_back(field);
+    }
+
+    candidate->_accesses.push_back(access);
+    return true;
+}
+
+void TR::ScalarReplacement::escape(Candidate *candidate, TR::Node *use, const char *reason)
+{
+    if (candidate->_escapes)
+        return;
+
+    logprintf(trace(), comp()->log(), "Allocation n%dn escapes at n%dn: %s\n",
+        candidate->_allocation->getGlobalIndex(), use->getGlobalIndex(), reason);
+    candidate->_escapes = true;
+}
+
+void TR::ScalarReplacement::replaceAllocation(Candidate *candidate)
+{
+    TR::Node *allocation = candidate->_allocation;
+    TR::TreeTop *allocationTree = candidate->_allocationTree;
+
+    for (auto it = candidate->_fields.begin(); it != candidate->_fields.end(); ++it) {
+        it->_temp = comp()->getSymRefTab()->createTemporary(comp()->getMethodSymbol(), it->_type);
+
+        if (!allocation->canSkipZeroInitialization()) {
+            TR::Node *zero = TR::Node::createConstZeroValue(allocation, it->_type);
+            allocationTree->insertAfter(TR::TreeTop::create(comp(), TR::Node::createStore(it->_temp, zero)));
+        }
+
+        logprintf(trace(), comp()->log(), "   field at offset %" OMR_PRIdPTR " replaced by #%d\n", it->_offset,
+            it->_temp->getReferenceNumber());
+    }
+
+    TR::NodeChecklist replaced(comp());
+    for (auto it = candidate->_accesses.begin(); it != candidate->_accesses.end(); ++it) {
+        TR::Node *access = *it;
+        if (replaced.contains(access))
+            continue;
+        replaced.add(access);
+
+        TR::SymbolReference *temp = NULL;
+        for (auto field = candidate->_fields.begin(); field != candidate->_fields.end(); ++field) {
+            if (field->_offset == access->getSymbolReference()->getOffset()) {
+                temp = field->_temp;
+                break;
+            }
+        }
+        TR_ASSERT_FATAL(temp != NULL, "No local for field access n%dn", access->getGlobalIndex());
+
+        // Remove the base, leaving only the value child of a store
+        //
+        access->removeChild(0);
+        if (access->getOpCode().isStore())
+            TR::Node::recreateWithSymRef(access, comp()->il.opCodeForDirectStore(temp->getSymbol()->getDataType()),
+                temp);
+        else
+            TR::Node::recreateWithSymRef(access, comp()->il.opCodeForDirectLoad(temp->getSymbol()->getDataType()),
+                temp);
+    }
+
+    // Every access is dominated by the allocation, so the object could never
+    // be null where its fields used to be accessed
+    //
+    for (TR::TreeTop *tt = comp()->getStartTree(); tt; tt = tt->getNextTreeTop()) {
+        TR::Node *node = tt->getNode();
+        if (!node->getOpCode().isNullCheck() || !replaced.contains(node->getFirstChild()))
+            continue;
+
+        TR::Node *access = node->getFirstChild();
+        if (access->getOpCode().isStore()) {
+            tt->setNode(access);
+            access->decReferenceCount();
+        } else {
+            TR::Node::recreate(node, TR::treetop);
+        }
+    }
+
+    TR_ASSERT_FATAL(allocation->getReferenceCount() == 1, "Allocation n%dn still has uses after replacement",
+        allocation->getGlobalIndex());
+    allocationTree->unlink(true);
+}
+
+TR::ScalarReplacement::Candidate *TR::ScalarReplacement::findCandidateForAllocation(CandidateList &candidates,
+    TR::Node *allocation)
+{
+    for (auto it = candidates.begin(); it != candidates.end(); ++it) {
+        if ((*it)->_allocation == allocation)
+            return *it;
+    }
+    return NULL;
+}
+
+TR::ScalarReplacement::Candidate *TR::ScalarReplacement::findCandidateForAuto(CandidateList &candidates,
+    TR::Symbol *autoSymbol)
+{
+    for (auto it = candidates.begin(); it != candidates.end(); ++it) {
+        if ((*it)->_autoSymbol == autoSymbol)
+            return *it;
+    }
+    return NULL;
+}
+
+const char *TR::ScalarReplacement::optDetailString() const throw() { return "O^O SCALAR REPLACEMENT: "; }
@@ -0,0 +1,133 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#ifndef SCALARREPLACEMENT_INCL
+#define SCALARREPLACEMENT_INCL
+
+#include <stdint.h>
+#include "env/TRMemory.hpp"
+#include "il/DataTypes.hpp"
+#include "infra/vector.hpp"
+#include "optimizer/Optimization.hpp"
+#include "optimizer/OptimizationManager.hpp"
+
+class TR_Dominators;
+
+namespace TR {
+class Block;
+class Node;
+class NodeChecklist;
+class Symbol;
+class SymbolReference;
+class TreeTop;
+} // namespace TR
+
+namespace TR {
+
+/**
+ * Language-neutral escape analysis that replaces allocations that never
+ * escape the method by locals holding their fields.
+ *
+ * An allocation is a candidate if the object model allows it (see
+ * OMR::ObjectModel::canScalarReplaceAllocation) and it is either anchored
+ * by a treetop or stored to an auto that is not stored to anywhere else.
+ * The object, whether referenced through the auto or through the commoned
+ * allocation node, must only be used as the base of field loads and stores
+ * at constant offsets past the object header.  Any other use makes it
+ * escape: passing it to a call, storing it to memory, returning it,
+ * comparing it or taking the address of the auto.
+ *
+ * Every use of the object must be dominated by the allocation; a use that
+ * can be reached without allocating would see whatever the auto held before,
+ * typically null.
+ *
+ * Each distinct field becomes a temp that is zero initialized where the
+ * object was allocated, unless the allocation skips zero initialization.
+ * Since the auto is the only handle on the object, it has a single store and
+ * that store dominates every use, the temps always hold the fields of the
+ * most recent allocation, which is what the original loads and stores
+ * observed, and null checks on them can never fail.
+ */
+class ScalarReplacement : public TR::Optimization {
+public:
+    ScalarReplacement(TR::OptimizationManager *manager);
+
+    static TR::Optimization *create(TR::OptimizationManager *manager)
+    {
+        return new (manager->allocator()) ScalarReplacement(manager);
+    }
+
+    virtual int32_t perform();
+    virtual const char *optDetailString() const throw();
+
+private:
+    struct Field {
+        intptr_t _offset;
+        TR::DataType _type;
+        TR::SymbolReference *_temp;
+    };
+
+    struct Candidate {
+        TR_ALLOC(TR_Memory::EscapeAnalysis)
+
+        Candidate(TR::Node *allocation, TR::TreeTop *allocationTree, TR::Block *allocationBlock,
+            TR::Symbol *autoSymbol, TR::Region &region)
+            : _allocation(allocation)
+            , _allocationTree(allocationTree)
+            , _allocationBlock(allocationBlock)
+            , _autoSymbol(autoSymbol)
+            , _allocationVisited(false)
+            , _escapes(false)
+            , _fields(region)
+            , _accesses(region)
+        {}
+
+        TR::Node *_allocation;
+        TR::TreeTop *_allocationTree;
+        TR::Block *_allocationBlock;
+        TR::Symbol *_autoSymbol;
+        bool _allocationVisited;
+        bool _escapes;
+        TR::vector<Field, TR::Region &> _fields;
+        TR::vector<TR::Node *, TR::Region &> _accesses;
+    };
+
+    typedef TR::vector<Candidate *, TR::Region &> CandidateList;
+
+    void findCandidates(CandidateList &candidates, TR::Region &region);
+    void findEscapes(CandidateList &candidates);
+    void findEscapes(CandidateList &candidates, TR::TreeTop *tt, TR::Node *node, TR::NodeChecklist &visited);
+    void checkUse(CandidateList &candidates, TR::Node *parent, int32_t childIndex);
+    bool isDominatedByAllocation(Candidate *candidate);
+    bool recordFieldAccess(Candidate *candidate, TR::Node *access);
+    void escape(Candidate *candidate, TR::Node *use, const char *reason);
+    void replaceAllocation(Candidate *candidate);
+
+    Candidate *findCandidateForAllocation(CandidateList &candidates, TR::Node *allocation);
+    Candidate *findCandidateForAuto(CandidateList &candidates, TR::Symbol *autoSymbol);
+
+    TR::Block *_currentBlock;
+    TR_Dominators *_dominators;
+};
+
+} // namespace TR
+
+#endif // SCALARREPLACEMENT_INCL
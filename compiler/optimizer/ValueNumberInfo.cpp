@@ -31,6 +31,7 @@
 #include "env/StackMemoryRegion.hpp"
 #include "env/TRMemory.hpp"
 #include "env/jittypes.h"
+#include "il/Block.hpp"
 #include "il/DataTypes.hpp"
 #include "il/ILOpCodes.hpp"
 #include "il/ILOps.hpp"
@@ -45,6 +46,7 @@
 #include "infra/Array.hpp"
 #include "infra/Assert.hpp"
 #include "infra/BitVector.hpp"
+#include "infra/CfgEdge.hpp"
 #include "infra/List.hpp"
 #include "optimizer/Optimizer.hpp"
 #include "optimizer/UseDefInfo.hpp"
@@ -56,6 +58,9 @@ TR_ValueNumberInfo::TR_ValueNumberInfo(TR::Compilation *comp)
     , _nodes(comp->allocator())
     , _valueNumbers(comp->allocator())
     , _nextInRing(comp->allocator())
+    , _signatures(comp->allocator())
+    , _numberOfSignatures(0)
+    , _defSignature(0)
 {}
 
 TR_ValueNumberInfo::TR_ValueNumberInfo(TR::Compilation *comp, TR::Optimizer *optimizer, bool requiresGlobals,
@@ -66,6 +71,9 @@ TR_ValueNumberInfo::TR_ValueNumberInfo(TR::Compilation *comp, TR::Optimizer *opt
     , _nodes(comp->allocator())
     , _valueNumbers(comp->allocator())
     , _nextInRing(comp->allocator())
+    , _signatures(comp->allocator())
+    , _numberOfSignatures(0)
+    , _defSignature(0)
 {
     OMR::Logger *log = comp->log();
     dumpOptDetails(comp, "PREPARTITION VN   (Building value number info)\n");
@@ -1241,6 +1249,157 @@ void TR_ValueNumberInfo::growTo(int32_t index)
     }
 }
 
+// A load's value also depends on the defs that reach it, so a load carries
+// its position relative to the defs of its block: the block and the last def
+// before it.  Moving a load across a def then changes its signature even
+// though the defs themselves stay put.
+//
+uint32_t TR_ValueNumberInfo::computeNodeSignature(TR::Node *node, uint32_t defPosition)
+{
+    uint32_t signature = 2166136261u;
+    if (node->getOpCode().isLoadVar())
+        hashSignature(signature, defPosition);
+
+    hashSignature(signature, node->getOpCodeValue());
+    hashSignature(signature, node->getNumChildren());
+
+    if (node->getOpCode().hasSymbolReference() && node->getSymbolReference())
+        hashSignature(signature, node->getSymbolReference()->getReferenceNumber());
+    else if (node->getOpCode().isLoadConst()) {
+        if (node->getOpCode().is8Byte()) {
+            hashSignature(signature, node->getLongIntHigh());
+            hashSignature(signature, node->getLongIntLow());
+        } else if (node->getOpCodeValue() == TR::fconst) {
+            hashSignature(signature, node->getFloatBits());
+        } else {
+            hashSignature(signature, node->getInt());
+        }
+    }
+
+    for (int32_t i = 0; i < node->getNumChildren(); i++)
+        hashSignature(signature, node->getChild(i)->getGlobalIndex());
+
+    return signature;
+}
+
+void TR_ValueNumberInfo::hashBlockSignature(uint32_t &signature, TR::Block *block)
+{
+    hashSignature(signature, block->getNumber());
+    for (auto e = block->getSuccessors().begin(); e != block->getSuccessors().end(); ++e)
+        hashSignature(signature, (*e)->getTo()->getNumber());
+    for (auto e = block->getExceptionSuccessors().begin(); e != block->getExceptionSuccessors().end(); ++e)
+        hashSignature(signature, (*e)->getTo()->getNumber());
+}
+
+void TR_ValueNumberInfo::enableIncrementalUpdates()
+{
+    if (!_infoIsValid)
+        return;
+
+    _numberOfSignatures = comp()->getNodeCount();
+    _signatures.GrowTo(_numberOfSignatures);
+    _defSignature = 2166136261u;
+    uint32_t defPosition = 0;
+
+    vcount_t visitCount = comp()->incOrResetVisitCount();
+    for (TR::TreeTop *tt = comp()->getStartTree(); tt; tt = tt->getNextTreeTop()) {
+        if (tt->getNode()->getOpCodeValue() == TR::BBStart) {
+            hashBlockSignature(_defSignature, tt->getNode()->getBlock());
+            defPosition = tt->getNode()->getBlock()->getNumber();
+        }
+        recordSignatures(tt->getNode(), visitCount, defPosition);
+    }
+}
+
+void TR_ValueNumberInfo::recordSignatures(TR::Node *node, vcount_t visitCount, uint32_t &defPosition)
+{
+    if (node->getVisitCount() == visitCount)
+        return;
+    node->setVisitCount(visitCount);
+
+    for (int32_t i = 0; i < node->getNumChildren(); i++)
+        recordSignatures(node->getChild(i), visitCount, defPosition);
+
+    _signatures.ElementAt(node->getGlobalIndex()) = computeNodeSignature(node, defPosition);
+
+    if (node->getOpCode().isStore() || node->getOpCode().isLikeDef()) {
+        hashSignature(_defSignature, node->getGlobalIndex());
+        hashSignature(defPosition, node->getGlobalIndex());
+    }
+}
+
+bool TR_ValueNumberInfo::updateValueNumbers()
+{
+    if (!_infoIsValid || _numberOfSignatures == 0)
+        return false;
+
+    OMR::Logger *log = comp()->log();
+    TR::StackMemoryRegion stackMemoryRegion(*trMemory());
+
+    int32_t numberOfOldNodes = _numberOfSignatures;
+    _numberOfSignatures = comp()->getNodeCount();
+    _signatures.GrowTo(_numberOfSignatures);
+
+    TR_BitVector renumbered(_numberOfSignatures, trMemory(), stackAlloc);
+    uint32_t defSignature = 2166136261u;
+    uint32_t defPosition = 0;
+    bool defChanged = false;
+
+    vcount_t visitCount = comp()->incOrResetVisitCount();
+    for (TR::TreeTop *tt = comp()->getStartTree(); tt && !defChanged; tt = tt->getNextTreeTop()) {
+        TR::Node *node = tt->getNode();
+        if (node->getOpCodeValue() == TR::BBStart) {
+            hashBlockSignature(defSignature, node->getBlock());
+            defPosition = node->getBlock()->getNumber();
+        }
+        updateValueNumbers(node, visitCount, numberOfOldNodes, renumbered, defSignature, defPosition, defChanged);
+    }
+
+    if (defChanged || defSignature != _defSignature) {
+        logprints(trace(), log, "Value numbers cannot be updated: defs or CFG changed\n");
+        _numberOfSignatures = 0;
+        return false;
+    }
+
+    logprintf(trace(), log, "Updated value numbers, %d nodes renumbered\n", renumbered.elementCount());
+    return true;
+}
+
+void TR_ValueNumberInfo::updateValueNumbers(TR::Node *node, vcount_t visitCount, int32_t numberOfOldNodes,
+    TR_BitVector &renumbered, uint32_t &defSignature, uint32_t &defPosition, bool &defChanged)
+{
+    if (node->getVisitCount() == visitCount)
+        return;
+    node->setVisitCount(visitCount);
+
+    bool childRenumbered = false;
+    for (int32_t i = 0; i < node->getNumChildren(); i++) {
+        TR::Node *child = node->getChild(i);
+        updateValueNumbers(child, visitCount, numberOfOldNodes, renumbered, defSignature, defPosition, defChanged);
+        if (renumbered.get(child->getGlobalIndex()))
+            childRenumbered = true;
+    }
+
+    int32_t index = node->getGlobalIndex();
+    uint32_t signature = computeNodeSignature(node, defPosition);
+
+    if (node->getOpCode().isStore() || node->getOpCode().isLikeDef()) {
+        hashSignature(defSignature, index);
+        hashSignature(defPosition, index);
+    }
+
+    if (childRenumbered || index >= numberOfOldNodes || _signatures.ElementAt(index) != signature) {
+        // A changed def affects the value numbers of loads anywhere in the method
+        //
+        if (node->getOpCode().isStore() || node->getOpCode().isLikeDef())
+            defChanged = true;
+
+        setUniqueValueNumber(node);
+        _signatures.ElementAt(index) = signature;
+        renumbered.set(index);
+    }
+}
+
 void TR_ValueNumberInfo::printValueNumberInfo(TR::Node *node)
 {
     comp()->log()->printf("Node : %p    Index = %d    Value number = %d\n", node, node->getUseDefIndex(), getVN(node));
@@ -31,9 +31,11 @@
 #include "il/Node.hpp"
 #include "infra/Array.hpp"
 
+class TR_BitVector;
 class TR_UseDefInfo;
 
 namespace TR {
+class Block;
 class Optimizer;
 class ParameterSymbol;
 } // namespace TR
@@ -130,6 +132,27 @@ public:
     /** Clean up information for a node that is about to be removed. */
     void removeNodeInfo(TR::Node *node);
 
+    /**
+     * @brief Take a snapshot of the trees so that later edits can be patched
+     *        into this info with updateValueNumbers() instead of rebuilding it
+     */
+    void enableIncrementalUpdates();
+
+    /**
+     * @brief Patch the value numbers after the trees have been edited
+     *
+     * A node gets a new unique value number if it is new, differs from the
+     * snapshot in its operation, symbol, constant or children, or has a child
+     * that got a new value number.  A load also gets one if it was moved to
+     * another block or across a def.  Nodes never gain a value number they did
+     * not already share, so the result is conservative.
+     *
+     * @return false if the edits cannot be patched because a def was added,
+     *         changed or moved or the CFG changed; the info must then be
+     *         rebuilt
+     */
+    bool updateValueNumbers();
+
     void printValueNumberInfo(TR::Node *);
 
     bool congruentNodes(TR::Node *, TR::Node *);
@@ -150,6 +173,14 @@ protected:
 
     virtual void initializeNode(TR::Node *node, int32_t &negativeValueNumber);
 
+    static void hashSignature(uint32_t &signature, uint32_t data) { signature = (signature ^ data) * 16777619; }
+
+    uint32_t computeNodeSignature(TR::Node *node, uint32_t defPosition);
+    void hashBlockSignature(uint32_t &signature, TR::Block *block);
+    void recordSignatures(TR::Node *node, vcount_t visitCount, uint32_t &defPosition);
+    void updateValueNumbers(TR::Node *node, vcount_t visitCount, int32_t numberOfOldNodes, TR_BitVector &renumbered,
+        uint32_t &defSignature, uint32_t &defPosition, bool &defChanged);
+
     TR::Compilation *_compilation;
     TR::Optimizer *_optimizer;
     TR_UseDefInfo *_useDefInfo;
@@ -164,6 +195,14 @@ protected:
     int32_t _numberOfShareableValues;
     int32_t _nextValue;
 
+    // Snapshot used to patch the info incrementally: a signature per node and
+    // one covering the defs and the CFG. _numberOfSignatures is zero when
+    // incremental updates are not enabled.
+    //
+    CS2::ArrayOf<uint32_t, TR::Allocator> _signatures;
+    int32_t _numberOfSignatures;
+    uint32_t _defSignature;
+
     bool _infoIsValid;
     bool _hasGlobalsValueNumbers;
     bool _trace;
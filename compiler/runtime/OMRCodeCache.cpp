@@ -158,14 +158,124 @@ void OMR::CodeCache::reserve(int32_t reservingCompThreadID)
 {
     _reserved = true;
     _reservingCompThreadID = reservingCompThreadID;
+    _lastReservingCompThreadID = reservingCompThreadID;
 }
 
 void OMR::CodeCache::unreserve()
 {
+    TR_ASSERT(_threadRegionAlloc == _threadRegionTop, "Thread region of code cache %p must be released before unreserve",
+        this);
     _reserved = false;
     _reservingCompThreadID = -2;
 }
 
+// Thread regions
+//
+// A compilation thread that holds the reservation of a code cache is the only
+// thread that allocates method bodies from it.  When thread regions are enabled
+// the reserving thread carves a chunk of the warm code heap once, under the
+// code cache monitor, and then satisfies warm allocations by bumping a private
+// pointer.  The code cache monitor and the manager's repository and usage
+// monitors are only taken again when the region is exhausted or released.
+//
+// The region is keyed by the omrthread that carved it; any other thread that
+// ends up allocating from this code cache goes through the locked path.
+//
+uint8_t *OMR::CodeCache::allocateFromThreadRegion(size_t warmSize, bool isMethodHeaderNeeded)
+{
+    TR::CodeCacheConfig &config = _manager->codeCacheConfig();
+
+    if (!config.codeCacheThreadRegionKB() || config.doSanityChecks() || !_reserved)
+        return NULL;
+
+    omrthread_t currentThread = omrthread_self();
+    if (currentThread == NULL)
+        return NULL;
+
+    if (_threadRegionOwner != NULL && _threadRegionOwner != currentThread) {
+        TR_ASSERT(false, "Thread %p allocating from code cache %p whose thread region is owned by thread %p",
+            currentThread, this, _threadRegionOwner);
+        return NULL;
+    }
+
+    if (warmSize > self()->getThreadRegionFreeSpace() && !self()->refillThreadRegion(warmSize))
+        return NULL;
+
+    uint8_t *warmCodeAddress = _threadRegionAlloc;
+    _threadRegionAlloc += warmSize;
+
+    if (isMethodHeaderNeeded)
+        self()->writeMethodHeader(warmCodeAddress, warmSize, false);
+
+    return warmCodeAddress;
+}
+
+bool OMR::CodeCache::refillThreadRegion(size_t minimumSize)
+{
+    TR::CodeCacheConfig &config = _manager->codeCacheConfig();
+    size_t round = config.codeCacheAlignment() - 1;
+
+    CacheCriticalSection refillRegion(self());
+
+    self()->releaseThreadRegionLocked();
+
+    uint8_t *regionStart = (uint8_t *)(((size_t)_warmCodeAlloc + round) & ~round);
+    if (regionStart > _coldCodeAlloc || (size_t)(_coldCodeAlloc - regionStart) < minimumSize)
+        return false;
+
+    // Do not let the region eat into space the slow path could still hand out;
+    // shrink it to whatever is left in the code cache if necessary
+    size_t regionSize = std::max<size_t>(config.codeCacheThreadRegionKB() << 10, minimumSize);
+    regionSize = std::min<size_t>(regionSize, (_coldCodeAlloc - regionStart) & ~round);
+    if (regionSize < minimumSize)
+        return false;
+
+    _manager->increaseCurrTotalUsedInBytes(regionStart + regionSize - _warmCodeAlloc);
+    _warmCodeAlloc = regionStart + regionSize;
+
+    _threadRegionAlloc = regionStart;
+    _threadRegionTop = regionStart + regionSize;
+    _threadRegionOwner = omrthread_self();
+
+    return true;
+}
+
+void OMR::CodeCache::releaseThreadRegion()
+{
+    if (_threadRegionAlloc == _threadRegionTop)
+        return;
+
+    TR_ASSERT(_threadRegionOwner == omrthread_self(), "Thread %p releasing code cache %p thread region owned by thread %p",
+        omrthread_self(), this, _threadRegionOwner);
+
+    CacheCriticalSection releaseRegion(self());
+    self()->releaseThreadRegionLocked();
+}
+
+void OMR::CodeCache::releaseThreadRegionLocked()
+{
+    uint8_t *start = _threadRegionAlloc;
+    uint8_t *end = _threadRegionTop;
+
+    _threadRegionAlloc = _threadRegionTop = NULL;
+    _threadRegionOwner = NULL;
+
+    if (start == end)
+        return;
+
+    if (end == _warmCodeAlloc) {
+        // Nothing was allocated past the region, so simply move the heap back
+        _manager->decreaseCurrTotalUsedInBytes(end - start);
+        _warmCodeAlloc = start;
+    } else if ((size_t)(end - start) >= MIN_SIZE_BLOCK) {
+        self()->addFreeBlock2(start, end);
+    } else if ((size_t)(end - start) >= sizeof(CodeCacheMethodHeader)) {
+        // Too small to be tracked as a free block; keep the heap walkable by
+        // covering the gap with an empty method header
+        self()->writeMethodHeader(start, end - start, false);
+    }
+}
+
 void OMR::CodeCache::writeMethodHeader(void *freeBlock, size_t size, bool isCold)
 {
     omrthread_jit_write_protect_disable();
@@ -215,7 +325,16 @@ bool OMR::CodeCache::trimCodeMemoryAllocation(void *codeMemoryStart, size_t actu
             cacheHeader, oldSize, actualSizeInBytes, shrinkage);
     }
 
-    if (expectedHeapAlloc == _warmCodeAlloc) {
+    if (expectedHeapAlloc == _threadRegionAlloc) {
+        // Last allocation from the thread region; the region was accounted for
+        // as a whole so usage does not change
+        _threadRegionAlloc -= shrinkage;
+
+        omrthread_jit_write_protect_disable();
+        cacheHeader->_size = static_cast<uint32_t>(actualSizeInBytes);
+        omrthread_jit_write_protect_enable();
+        return true;
+    } else if (expectedHeapAlloc == _warmCodeAlloc) {
         _manager->decreaseCurrTotalUsedInBytes(shrinkage);
         _warmCodeAlloc -= shrinkage;
 
@@ -279,7 +398,10 @@ bool OMR::CodeCache::initialize(TR::CodeCacheManager *manager, TR::CodeCacheMemo
     _freeBlockList = NULL;
     _flags = 0;
     _CCPreLoadedCodeInitialized = false;
+    _threadRegionAlloc = _threadRegionTop = NULL;
+    _threadRegionOwner = NULL;
     self()->unreserve();
+    _lastReservingCompThreadID = -2;
     _almostFull = TR_no;
     _sizeOfLargestFreeColdBlock = 0;
     _sizeOfLargestFreeWarmBlock = 0;
@@ -1401,9 +1523,29 @@ uint8_t *OMR::CodeCache::allocateCodeMemory(size_t warmCodeSize, size_t coldCode
     _manager->performSizeAdjustments(warmSize, coldSize, needsToBeContiguous,
         isMethodHeaderNeeded); // side effect on warmSize and coldSize
 
+    // Warm-only requests from the reserving thread are served from its thread
+    // region without taking the code cache monitor
+    if (warmSize && !coldSize) {
+        warmCodeAddress = self()->allocateFromThreadRegion(warmSize, isMethodHeaderNeeded);
+        if (warmCodeAddress) {
+            _lastAllocatedBlock = (CodeCacheMethodHeader *)warmCodeAddress;
+            if (isMethodHeaderNeeded)
+                warmCodeAddress += sizeof(CodeCacheMethodHeader);
+            // The cold heap is not locked here; a concurrent cold allocation
+            // may move it, so read it once
+            *coldCode = needsToBeContiguous ? warmCodeAddress : readUnlocked(_coldCodeAlloc);
+            return warmCodeAddress;
+        }
+    }
+
     // Acquire mutex because we are walking the list of free blocks
     CacheCriticalSection walkingFreeList(self());
 
+    // Hand the caller's own thread region back first so that the space it
+    // still holds at the top of the warm heap is visible to this path
+    if (_threadRegionOwner != NULL && _threadRegionOwner == omrthread_self())
+        self()->releaseThreadRegionLocked();
+
     // See if we can get a warm and/or cold block from the reclaimed method list
     if (!needsToBeContiguous) {
         if (warmSize)
@@ -1417,7 +1559,7 @@ uint8_t *OMR::CodeCache::allocateCodeMemory(size_t warmCodeSize, size_t coldCode
     // another code cache. Therefore, lets make sure that we can allocate
     // cold before proceding with the allocation
     if (coldSize != 0 && !coldIsFreeBlock
-        && coldSize + (warmIsFreeBlock ? 0 : warmSize) > self()->getFreeContiguousSpace()) {
+        && coldSize + (warmIsFreeBlock ? 0 : warmSize) > (size_t)(_coldCodeAlloc - _warmCodeAlloc)) {
         return NULL;
     }
 
@@ -35,6 +35,7 @@ typedef CodeCache CodeCacheConnector;
 } // namespace OMR
 #endif
 
+#include <algorithm>
 #include <stddef.h>
 #include <stdint.h>
 #include "control/OptionsUtil.hpp"
@@ -46,6 +47,7 @@ typedef CodeCache CodeCacheConnector;
 #include "runtime/CodeCacheTypes.hpp"
 #include "runtime/OMRRSSReport.hpp"
 #include "OMR/Bytes.hpp"
+#include "omrthread.h"
 
 class TR_OpaqueMethodBlock;
 
@@ -137,6 +139,37 @@ public:
 
     bool isReserved() { return _reserved; }
 
+    /**
+     * @brief Allocate warm code from the bump region owned by the calling
+     *        thread, refilling the region from the code cache heap when it is
+     *        exhausted.
+     *
+     * @details
+     *    The region belongs to the thread that carved it and only that thread
+     *    allocates from it, so allocations that fit in the region neither
+     *    acquire the code cache monitor nor update the manager's usage counters.
+     *    The whole region is accounted for when it is carved.  Threads that are
+     *    not attached to the thread library, or that do not own the region, get
+     *    NULL and fall back to the regular allocation path.
+     *
+     * @param[in] warmSize : the adjusted (aligned, header-inclusive) warm size
+     * @param[in] isMethodHeaderNeeded : whether a method header must be written
+     *
+     * @return the address of the allocated block, or NULL if thread regions are
+     *         disabled or the region cannot be refilled.
+     */
+    uint8_t *allocateFromThreadRegion(size_t warmSize, bool isMethodHeaderNeeded);
+
+    /**
+     * @brief Give the unused part of the thread region back to the code cache.
+     *        Must be called before the reservation of this code cache is released.
+     */
+    void releaseThreadRegion();
+
+    size_t getThreadRegionFreeSpace() const { return _threadRegionTop - _threadRegionAlloc; }
+
+    omrthread_t getThreadRegionOwner() const { return _threadRegionOwner; }
+
     TR_YesNoMaybe almostFull() { return _almostFull; }
 
     void setAlmostFull(TR_YesNoMaybe fullness) { _almostFull = fullness; }
@@ -181,13 +214,41 @@ public:
 
     void freeHashEntry(CodeCacheHashEntry *entry);
 
-    size_t getFreeContiguousSpace() const { return _coldCodeAlloc - _warmCodeAlloc; }
+    /**
+     * @brief The size of the gap between warm and cold code.  A thread region
+     *        is carved from the top of the warm heap, so its unused tail is
+     *        part of that gap and is handed back when the region is released.
+     */
+    size_t getFreeContiguousSpace() const
+    {
+        uint8_t *warmCodeAlloc = readUnlocked(_warmCodeAlloc);
+        uint8_t *coldCodeAlloc = readUnlocked(_coldCodeAlloc);
+        uint8_t *warmTop = (readUnlocked(_threadRegionTop) == warmCodeAlloc) ? readUnlocked(_threadRegionAlloc)
+                                                                             : warmCodeAlloc;
+        return (coldCodeAlloc > warmTop) ? coldCodeAlloc - warmTop : 0;
+    }
 
     int32_t getReservingCompThreadID() const { return _reservingCompThreadID; }
 
+    /**
+     * @brief The ID of the compilation thread that most recently reserved this
+     *        code cache.  Unlike the reserving thread ID this survives unreserve(),
+     *        which gives reservations thread affinity.
+     */
+    int32_t getLastReservingCompThreadID() const { return _lastReservingCompThreadID; }
+
     void setReservingCompThreadID(int32_t n) { _reservingCompThreadID = n; }
 
-    size_t getSizeOfLargestFreeWarmBlock() const { return _sizeOfLargestFreeWarmBlock; }
+    /**
+     * @brief The largest warm block that can be reused.  A thread region that
+     *        is no longer at the top of the warm heap becomes a free block when
+     *        it is released, so its unused tail counts as one.
+     */
+    size_t getSizeOfLargestFreeWarmBlock() const
+    {
+        size_t threadRegionFreeSpace = (_threadRegionTop != _warmCodeAlloc) ? getThreadRegionFreeSpace() : 0;
+        return std::max(threadRegionFreeSpace, _sizeOfLargestFreeWarmBlock);
+    }
 
     size_t getSizeOfLargestFreeColdBlock() const { return _sizeOfLargestFreeColdBlock; }
 
@@ -241,6 +302,10 @@ public:
         size_t allocatedCodeCacheSizeInBytes, TR::CodeCacheKind kind);
 
 private:
+    bool refillThreadRegion(size_t minimumSize);
+
+    void releaseThreadRegionLocked();
+
     void updateMaxSizeOfFreeBlocks(CodeCacheFreeCacheBlock *blockPtr, size_t blockSize);
 
     CodeCacheFreeCacheBlock *removeFreeBlock(size_t blockSize, CodeCacheFreeCacheBlock *prev,
@@ -419,6 +484,13 @@ public:
      */
     void setTrampolineBase(uint8_t *address) { _trampolineBase = address; }
 
+    /**
+     * @brief Read a heap pointer that other threads update under the code cache
+     *        monitor without holding it.  The pointer is read exactly once, so
+     *        the caller sees either the old or the new value.
+     */
+    static uint8_t *readUnlocked(uint8_t *const &heapPointer) { return *(uint8_t *const volatile *)&heapPointer; }
+
     uint8_t *_warmCodeAlloc;
 
     uint8_t *_coldCodeAlloc;
@@ -447,6 +519,15 @@ public:
     // TODO: When we move to C++11 replace volatile with something that actually enforces ordering semantics.
     volatile bool _reserved;
     int32_t _reservingCompThreadID;
+    int32_t _lastReservingCompThreadID;
+
+    // Bump region carved from the warm code heap by the reserving compilation
+    // thread.  Only _threadRegionOwner moves _threadRegionAlloc; the region is
+    // handed back to the code cache when the reservation ends or when its owner
+    // needs the code cache heap itself.
+    uint8_t *_threadRegionAlloc;
+    uint8_t *_threadRegionTop;
+    omrthread_t _threadRegionOwner;
 
     size_t _sizeOfLargestFreeColdBlock;
     size_t _sizeOfLargestFreeWarmBlock;
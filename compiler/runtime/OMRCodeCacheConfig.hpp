@@ -73,6 +73,7 @@ public:
         , _codeCacheTotalKB(0)
         , _codeCachePadKB(0)
         , _codeCacheAlignment(0)
+        , _codeCacheThreadRegionKB(0)
         , _codeCacheHelperAlignmentBytes(32)
         , _codeCacheTrampolineAlignmentBytes(8)
         , _codeCacheMethodBodyAllocRetries(3)
@@ -148,6 +149,11 @@ public:
 
     int32_t codeCacheMethodBodyAllocRetries() const { return _codeCacheMethodBodyAllocRetries; }
 
+    // Size of the thread-local bump region a reserving compilation thread carves
+    // out of its code cache.  Zero disables thread regions.
+    //
+    size_t codeCacheThreadRegionKB() const { return _codeCacheThreadRegionKB; }
+
     size_t codeCacheTempTrampolineSyncArraySize() const { return _codeCacheTempTrampolineSyncArraySize; }
 
     size_t codeCacheHashEntryAllocatorSlabSize() const { return _codeCacheHashEntryAllocatorSlabSize; }
@@ -192,6 +198,7 @@ public:
     size_t _codeCacheTotalKB;
     size_t _codeCachePadKB;
     size_t _codeCacheAlignment;
+    size_t _codeCacheThreadRegionKB; /*!< size of the per-thread bump region carved from a reserved code cache */
 
     size_t _highCodeCacheOccupancyThresholdInBytes;
 
@@ -139,6 +139,8 @@ TR::CodeCache *OMR::CodeCacheManager::initialize(bool allocateMonolithicCodeCach
     // Initialize the list of code caches
     //
     _codeCacheList._head = NULL;
+    for (int32_t i = 0; i < MAX_AFFINITY_COMP_THREADS; i++)
+        _lastReservedCodeCache[i] = NULL;
     _codeCacheList._mutex = TR::Monitor::create("JIT-CodeCacheListMutex");
     if (_codeCacheList._mutex == NULL)
         return NULL;
@@ -269,6 +271,8 @@ void OMR::CodeCacheManager::unreserveCodeCache(TR::CodeCache *codeCache)
     if (!codeCache)
         return;
 
+    codeCache->releaseThreadRegion();
+
     CacheListCriticalSection scanCacheList(self());
     codeCache->unreserve();
 }
@@ -302,38 +306,62 @@ TR::CodeCache *OMR::CodeCacheManager::reserveCodeCache(bool compilationCodeAlloc
     return codeCache;
 }
 
+bool OMR::CodeCacheManager::isReservable(TR::CodeCache *codeCache, bool compilationCodeAllocationsMustBeContiguous,
+    size_t sizeEstimate, TR::CodeCacheKind kind, bool ignoreKind)
+{
+    // we cannot touch the reserved ones
+    if (codeCache->isReserved() || (codeCache->_kind != kind && !ignoreKind))
+        return false;
+
+    TR_YesNoMaybe almostFull = codeCache->almostFull();
+    if (almostFull == TR_yes || (almostFull == TR_maybe && compilationCodeAllocationsMustBeContiguous))
+        return false;
+
+    // Is the free space big enough?
+    return
+        // If size estimate is not given we'll blindly pick anything
+        sizeEstimate == 0 || codeCache->getFreeContiguousSpace() >= sizeEstimate ||
+        // we don't know yet the warm/cold requirements so check
+        // only for warm part
+        codeCache->getSizeOfLargestFreeWarmBlock() >= sizeEstimate;
+}
+
 TR::CodeCache *OMR::CodeCacheManager::reserveCodeCacheImpl(bool compilationCodeAllocationsMustBeContiguous,
     size_t sizeEstimate, int32_t compThreadID, int32_t *numReserved, TR::CodeCacheKind kind,
     bool ignoreKindAndSkipAllocate)
 {
     int32_t numCachesAlreadyReserved = 0;
     TR::CodeCache *codeCache = NULL;
+    bool hasAffinity = compThreadID >= 0 && compThreadID < MAX_AFFINITY_COMP_THREADS;
 
     // Scan the list of code caches; must acquire a mutex
     //
     {
         CacheListCriticalSection scanCacheList(self());
-        for (codeCache = self()->getFirstCodeCache(); codeCache; codeCache = codeCache->next()) {
-            // we cannot touch the reserved ones
-            if (!codeCache->isReserved() && (codeCache->_kind == kind || ignoreKindAndSkipAllocate)) {
-                TR_YesNoMaybe almostFull = codeCache->almostFull();
-                if (almostFull == TR_no || (almostFull == TR_maybe && !compilationCodeAllocationsMustBeContiguous)) {
-                    // Is the free space big enough?
-                    if (
-                        // If size estimate is not given we'll blindly pick anything
-                        sizeEstimate == 0 || codeCache->getFreeContiguousSpace() >= sizeEstimate ||
-                        // we don't know yet the warm/cold requirements so check
-                        // only for warm part
-                        codeCache->getSizeOfLargestFreeWarmBlock() >= sizeEstimate) {
-                        codeCache->reserve(compThreadID);
-                        break;
-                    }
-                }
-            } else // code cache is reserved
-            {
-                numCachesAlreadyReserved++;
-            }
-        } // end for
+
+        // Prefer the cache this compilation thread used last so that each
+        // compilation thread keeps working out of its own cache
+        codeCache = hasAffinity ? _lastReservedCodeCache[compThreadID] : NULL;
+        if (codeCache
+            && !isReservable(codeCache, compilationCodeAllocationsMustBeContiguous, sizeEstimate, kind,
+                ignoreKindAndSkipAllocate))
+            codeCache = NULL;
+
+        if (!codeCache) {
+            for (codeCache = self()->getFirstCodeCache(); codeCache; codeCache = codeCache->next()) {
+                if (isReservable(codeCache, compilationCodeAllocationsMustBeContiguous, sizeEstimate, kind,
+                        ignoreKindAndSkipAllocate))
+                    break;
+                if (codeCache->isReserved() || (codeCache->_kind != kind && !ignoreKindAndSkipAllocate))
+                    numCachesAlreadyReserved++;
+            } // end for
+        }
+
+        if (codeCache) {
+            codeCache->reserve(compThreadID);
+            if (hasAffinity)
+                _lastReservedCodeCache[compThreadID] = codeCache;
+        }
     }
 
     *numReserved = numCachesAlreadyReserved;
@@ -355,6 +383,10 @@ TR::CodeCache *OMR::CodeCacheManager::reserveCodeCacheImpl(bool compilationCodeA
     if (self()->canAddNewCodeCache()) {
         TR::CodeCacheConfig &config = self()->codeCacheConfig();
         codeCache = self()->allocateCodeCacheFromNewSegment(config.codeCacheKB() << 10, compThreadID, kind);
+        if (codeCache && hasAffinity) {
+            CacheListCriticalSection updateAffinity(self());
+            _lastReservedCodeCache[compThreadID] = codeCache;
+        }
     } else {
         if (numCachesAlreadyReserved > 0)
             self()->setHasFailedCodeCacheAllocation();
@@ -610,6 +642,7 @@ uint8_t *OMR::CodeCacheManager::allocateCodeMemoryWithRetries(size_t warmCodeSiz
         {
             TR_ASSERT((*codeCache_pp)->isReserved(), "Original code cache must have been reserved"); // MCT
             TR_ASSERT(codeCache->isReserved(), "Selected code cache must have been reserved"); // MCT
+            (*codeCache_pp)->releaseThreadRegion();
             (*codeCache_pp)->unreserve();
 #ifdef MCT_DEBUG
             fprintf(stderr, "cache %p reset reservation in allocateCodeMemory after searching\n", *codeCache_pp);
@@ -681,6 +714,7 @@ uint8_t *OMR::CodeCacheManager::allocateCodeMemoryWithRetries(size_t warmCodeSiz
     TR_ASSERT((*codeCache_pp)->isReserved(), "Code cache must be reserved. Original code cache=%p pp=%p\n",
         originalCodeCache, *codeCache_pp); // MCT
 
+    (*codeCache_pp)->releaseThreadRegion();
     (*codeCache_pp)->unreserve();
 
 #ifdef MCT_DEBUG
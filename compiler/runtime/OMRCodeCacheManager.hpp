@@ -340,6 +340,13 @@ public:
     size_t getMaxUsedInBytes() const { return _maxUsedInBytes; }
 
 private:
+    /**
+     * @brief Whether an unreserved code cache can be handed out by a reservation
+     *        with the given requirements
+     */
+    bool isReservable(TR::CodeCache *codeCache, bool compilationCodeAllocationsMustBeContiguous, size_t sizeEstimate,
+        TR::CodeCacheKind kind, bool ignoreKind);
+
     TR::CodeCache *reserveCodeCacheImpl(bool compilationCodeAllocationsMustBeContiguous, size_t sizeEstimate,
         int32_t compThreadID, int32_t *numReserved, TR::CodeCacheKind kind, bool ignoreKindAndSkipAllocate);
 
@@ -348,6 +355,10 @@ protected:
     TR::CodeCacheConfig _config;
     TR::CodeCache *_lastCache; /*!< last code cache round robined through */
     CodeCacheList _codeCacheList; /*!< list of allocated code caches */
+
+    // Compilation threads with a higher ID get no reservation affinity
+    static const int32_t MAX_AFFINITY_COMP_THREADS = 64;
+    TR::CodeCache *_lastReservedCodeCache[MAX_AFFINITY_COMP_THREADS]; /*!< code cache each compilation thread reserved last */
     int32_t _curNumberOfCodeCaches;
 
     // The following 3 fields are for implementation of code cache consolidation
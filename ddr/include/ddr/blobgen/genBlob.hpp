@@ -36,7 +36,7 @@ class Type;
 class TypedefUDT;
 class UnionUDT;
 
-DDR_RC genBlob(OMRPortLibrary *portLibrary, Symbol_IR *ir, const char *supersetFile, const char *blobFile, bool printEmptyTypes);
+DDR_RC genBlob(OMRPortLibrary *portLibrary, Symbol_IR *ir, const char *supersetFile, const char *blobFile, bool printEmptyTypes, bool indexBlob);
 
 class BlobGenerator
 {
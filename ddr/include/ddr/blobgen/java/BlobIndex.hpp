@@ -0,0 +1,92 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+#ifndef BLOBINDEX_HPP
+#define BLOBINDEX_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * An optional index appended to a version 1 blob. It starts at the first
+ * 4-byte aligned file offset after the string data; readers that don't know
+ * about it never look past the string data. Like the rest of the blob, it is
+ * written in the byte order of the generating system.
+ *
+ *   BlobIndexHeader
+ *   uint32_t         structOffsets[structureCount]
+ *   uint32_t         structBuckets[structBucketCount]
+ *   BlobMemberBucket memberBuckets[memberBucketCount]
+ *
+ * structOffsets[i] is the offset of structure i within the struct data.
+ * The bucket arrays are open-addressed hash tables with linear probing:
+ * structure names hash with blobIndexHash(name, 0) and hold 1 + the index
+ * of the structure; fields and constants hash with blobIndexHash(name, 1 +
+ * index of their structure) and are numbered fields first, then constants.
+ * Zero marks an empty bucket.
+ */
+
+#define BLOB_INDEX_MAGIC 0x49524444 /* "DDRI" */
+#define BLOB_INDEX_VERSION 1
+
+struct BlobIndexHeader {
+	uint32_t magic;
+	uint32_t version;
+	uint32_t indexSize;
+	uint32_t structureCount;
+	uint32_t structBucketCount;
+	uint32_t memberBucketCount;
+};
+
+struct BlobMemberBucket {
+	uint32_t structIndex;
+	uint32_t memberIndex;
+};
+
+/* FNV-1a */
+inline uint32_t
+blobIndexHash(const char *data, size_t length, uint32_t seed)
+{
+	uint32_t hash = 2166136261U ^ (seed * 16777619U);
+
+	for (size_t i = 0; i < length; ++i) {
+		hash ^= (uint8_t)data[i];
+		hash *= 16777619U;
+	}
+
+	return hash;
+}
+
+/* A power of two, at most half full. */
+inline uint32_t
+blobIndexBucketCount(uint32_t entries)
+{
+	uint32_t count = 4;
+
+	while (count < (entries * 2)) {
+		count *= 2;
+	}
+
+	return count;
+}
+
+#endif /* BLOBINDEX_HPP */
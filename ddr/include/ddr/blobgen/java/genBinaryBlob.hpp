@@ -125,6 +125,7 @@ private:
 	BuildBlobInfo _buildInfo;
 	OMRPortLibrary * const _portLibrary;
 	bool const _printEmptyTypes;
+	bool const _indexBlob;
 
 	void copyStringTable();
 	DDR_RC stringTableOffset(BlobHeader *blobHeader, J9HashTable *stringTable, const char *cString, uint32_t *offset);
@@ -135,15 +136,17 @@ private:
 	DDR_RC addBlobConst(const string &name, long long value, uint32_t *constCount);
 	DDR_RC addBlobStruct(const string &name, const string &superName, uint32_t constCount, uint32_t fieldCount, uint32_t size);
 	DDR_RC formatFieldType(Field *field, string *fieldType);
+	DDR_RC writeBlobIndex(intptr_t fd);
 
 	friend class BlobBuildVisitor;
 	friend class BlobEnumerateVisitor;
 
 public:
-	JavaBlobGenerator(struct OMRPortLibrary *portLibrary, bool printEmptyTypes)
+	JavaBlobGenerator(struct OMRPortLibrary *portLibrary, bool printEmptyTypes, bool indexBlob)
 		: _buildInfo()
 		, _portLibrary(portLibrary)
 		, _printEmptyTypes(printEmptyTypes)
+		, _indexBlob(indexBlob)
 	{
 	}
 	DDR_RC genBinaryBlob(struct OMRPortLibrary *portLibrary, Symbol_IR *ir, const char *blobFile);
@@ -0,0 +1,137 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+#ifndef BLOBREADER_HPP
+#define BLOBREADER_HPP
+
+#include "ddr/blobgen/java/BlobIndex.hpp"
+#include "ddr/error.hpp"
+
+#include "omrport.h"
+
+/* A string in the blob's string table: it is not NUL-terminated. */
+struct BlobStringRef {
+	const char *data;
+	uint16_t length;
+};
+
+struct BlobStructureInfo {
+	BlobStringRef name;
+	BlobStringRef superName; /* data is NULL if there is no superclass */
+	uint32_t size;
+	uint32_t fieldCount;
+	uint32_t constantCount;
+};
+
+struct BlobFieldInfo {
+	BlobStringRef name;
+	BlobStringRef type;
+	uint32_t offset;
+};
+
+struct BlobConstantInfo {
+	BlobStringRef name;
+	uint64_t value;
+};
+
+/*
+ * Reads a blob written by JavaBlobGenerator without loading it: the file is
+ * mapped and only the parts that are asked for are decoded. Structures are
+ * numbered in blob order; fields and constants are numbered within their
+ * structure. Lookups by name use the index appended by ddrgen --blob-index;
+ * for a blob without one, open() builds the same index in memory, which
+ * costs two passes over the structure data but decodes nothing else.
+ *
+ * Blobs written on a system of the other byte order are supported; the
+ * mapping is never modified.
+ */
+class BlobReader
+{
+private:
+	OMRPortLibrary * const _portLibrary;
+	J9MmapHandle *_mapping;
+	const uint8_t *_blob;
+	uint64_t _blobSize;
+	bool _swapped;
+	bool _storedIndex;
+
+	uint32_t _coreVersion;
+	uint8_t _sizeofBool;
+	uint8_t _sizeofUDATA;
+	uint8_t _bitfieldFormat;
+	uint32_t _structDataSize;
+	uint32_t _stringDataSize;
+	uint32_t _structureCount;
+	const uint8_t *_structData;
+	const uint8_t *_stringData;
+
+	/* The index is in blob byte order when stored, host byte order when built. */
+	bool _indexSwapped;
+	const uint8_t *_structOffsets;
+	uint32_t _structBucketCount;
+	const uint8_t *_structBuckets;
+	uint32_t _memberBucketCount;
+	const uint8_t *_memberBuckets;
+	uint8_t *_builtIndex;
+
+	uint16_t readU16(const uint8_t *data) const;
+	uint32_t readU32(const uint8_t *data) const;
+	uint32_t readIndex(const uint8_t *data) const;
+	const uint8_t *structureAt(uint32_t structIndex) const;
+	bool stringEquals(uint32_t offset, const char *name, size_t length) const;
+	bool findMember(uint32_t structIndex, const char *name, bool isField, uint32_t *memberIndex) const;
+	bool useStoredIndex();
+	DDR_RC buildIndex();
+
+public:
+	explicit BlobReader(OMRPortLibrary *portLibrary);
+	~BlobReader();
+
+	DDR_RC open(const char *blobFile);
+	void close();
+
+	/* Whether the blob carries its own index, rather than it being built by open(). */
+	bool hasStoredIndex() const { return _storedIndex; }
+
+	uint32_t getCoreVersion() const { return _coreVersion; }
+	uint8_t getSizeofBool() const { return _sizeofBool; }
+	uint8_t getSizeofUDATA() const { return _sizeofUDATA; }
+	uint8_t getBitfieldFormat() const { return _bitfieldFormat; }
+	uint32_t getStructDataSize() const { return _structDataSize; }
+	uint32_t getStringDataSize() const { return _stringDataSize; }
+	uint32_t getStructureCount() const { return _structureCount; }
+
+	/* Strings are identified by their offset in the string data. */
+	DDR_RC getString(uint32_t offset, BlobStringRef *string) const;
+	/* Returns the string data size if offset does not name a valid string. */
+	uint32_t getNextStringOffset(uint32_t offset) const;
+
+	DDR_RC getStructure(uint32_t structIndex, BlobStructureInfo *info) const;
+	DDR_RC getField(uint32_t structIndex, uint32_t fieldIndex, BlobFieldInfo *info) const;
+	DDR_RC getConstant(uint32_t structIndex, uint32_t constantIndex, BlobConstantInfo *info) const;
+
+	bool findStructure(const char *name, uint32_t *structIndex) const;
+	bool findField(uint32_t structIndex, const char *name, uint32_t *fieldIndex) const;
+	bool findConstant(uint32_t structIndex, const char *name, uint32_t *constantIndex) const;
+};
+
+#endif /* BLOBREADER_HPP */
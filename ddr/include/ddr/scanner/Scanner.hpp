@@ -45,12 +45,23 @@ using std::vector;
 class Scanner
 {
 public:
+	Scanner()
+		: _excludedFiles()
+		, _excludedTypes()
+		, _threadCount(1)
+	{
+	}
+
 	virtual DDR_RC startScan(OMRPortLibrary *portLibrary, Symbol_IR *ir,
 			vector<string> *debugFiles, const char *excludesFilePath) = 0;
 
+	/* Scanners that cannot process input files concurrently ignore the thread count. */
+	void setThreadCount(uintptr_t threadCount) { _threadCount = (0 == threadCount) ? 1 : threadCount; }
+
 protected:
 	set<string> _excludedFiles;
 	set<string> _excludedTypes;
+	uintptr_t _threadCount;
 
 	bool checkExcludedType(const string &name) const;
 	bool checkExcludedFile(const string &name) const;
@@ -86,6 +86,7 @@ private:
 	Dwarf_Debug _debug;
 
 	DDR_RC scanFile(OMRPortLibrary *portLibrary, Symbol_IR *ir, const char *filepath);
+	DDR_RC scanFilesInParallel(OMRPortLibrary *portLibrary, Symbol_IR *ir, vector<string> *debugFiles);
 	DDR_RC traverse_cu_in_debug_section(Symbol_IR *ir);
 	DDR_RC addDieToIR(Dwarf_Die die, Dwarf_Half tag, NamespaceUDT *outerUDT, Type **type);
 	DDR_RC getOrCreateNewType(Dwarf_Die die, Dwarf_Half tag, Type **newUDT, NamespaceUDT *outerUDT, bool *isNewType);
@@ -104,6 +105,7 @@ private:
 	DDR_RC getBitField(Dwarf_Die die, size_t *bitField);
 
 	friend class DwarfVisitor;
+	friend class ParallelScan;
 };
 
 #endif /* DWARFSCANNER_HPP */
@@ -20,6 +20,7 @@
  *******************************************************************************/
 
 #include "ddr/blobgen/java/genBinaryBlob.hpp"
+#include "ddr/blobgen/java/BlobIndex.hpp"
 #include "ddr/ir/ClassUDT.hpp"
 #include "ddr/ir/EnumMember.hpp"
 #include "ddr/ir/EnumUDT.hpp"
@@ -328,6 +329,10 @@ JavaBlobGenerator::genBinaryBlob(OMRPortLibrary *portLibrary, Symbol_IR *ir, con
 		/* write string data */
 		wb = omrfile_write(fd, _buildInfo.stringBuffer, _buildInfo.header.stringDataSize);
 
+		if (_indexBlob) {
+			rc = writeBlobIndex(fd);
+		}
+
 		/* close blob file */
 		omrfile_close(fd);
 
@@ -341,6 +346,113 @@ JavaBlobGenerator::genBinaryBlob(OMRPortLibrary *portLibrary, Symbol_IR *ir, con
 	return rc;
 }
 
+static void
+addToStructBuckets(vector<uint32_t> *buckets, const char *name, size_t nameLength, uint32_t structIndex)
+{
+	const uint32_t mask = (uint32_t)buckets->size() - 1;
+	uint32_t bucket = blobIndexHash(name, nameLength, 0) & mask;
+
+	while (0 != (*buckets)[bucket]) {
+		bucket = (bucket + 1) & mask;
+	}
+	(*buckets)[bucket] = structIndex + 1;
+}
+
+static void
+addToMemberBuckets(vector<BlobMemberBucket> *buckets, const char *name, size_t nameLength, uint32_t structIndex, uint32_t memberIndex)
+{
+	const uint32_t mask = (uint32_t)buckets->size() - 1;
+	uint32_t bucket = blobIndexHash(name, nameLength, structIndex + 1) & mask;
+
+	while (0 != (*buckets)[bucket].structIndex) {
+		bucket = (bucket + 1) & mask;
+	}
+	(*buckets)[bucket].structIndex = structIndex + 1;
+	(*buckets)[bucket].memberIndex = memberIndex;
+}
+
+/* Append the index described in BlobIndex.hpp; the string table must already be populated. */
+DDR_RC
+JavaBlobGenerator::writeBlobIndex(intptr_t fd)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(_portLibrary);
+	DDR_RC rc = DDR_RC_OK;
+	const uint32_t structureCount = _buildInfo.header.structureCount;
+	uint32_t memberCount = 0;
+
+	for (uint32_t s_ix = 0; s_ix < structureCount; ++s_ix) {
+		memberCount += _buildInfo.blobStructs[s_ix].fieldCount + _buildInfo.blobStructs[s_ix].constantCount;
+	}
+
+	BlobIndexHeader indexHeader;
+
+	indexHeader.magic = BLOB_INDEX_MAGIC;
+	indexHeader.version = BLOB_INDEX_VERSION;
+	indexHeader.structureCount = structureCount;
+	indexHeader.structBucketCount = blobIndexBucketCount(structureCount);
+	indexHeader.memberBucketCount = blobIndexBucketCount(memberCount);
+	indexHeader.indexSize = (uint32_t)(sizeof(indexHeader)
+			+ (sizeof(uint32_t) * (structureCount + indexHeader.structBucketCount))
+			+ (sizeof(BlobMemberBucket) * indexHeader.memberBucketCount));
+
+	vector<uint32_t> structOffsets(structureCount);
+	vector<uint32_t> structBuckets(indexHeader.structBucketCount, 0);
+	vector<BlobMemberBucket> memberBuckets(indexHeader.memberBucketCount);
+	uint32_t structOffset = 0;
+	uint32_t f_ix = 0;
+	uint32_t c_ix = 0;
+
+	for (uint32_t s_ix = 0; s_ix < structureCount; ++s_ix) {
+		const BlobStruct *blobStruct = &_buildInfo.blobStructs[s_ix];
+		const J9UTF8 *name = (const J9UTF8 *)(_buildInfo.stringBuffer + blobStruct->nameOffset);
+
+		structOffsets[s_ix] = structOffset;
+		structOffset += (uint32_t)(sizeof(BlobStruct)
+				+ (sizeof(BlobField) * blobStruct->fieldCount)
+				+ (sizeof(BlobConstant) * blobStruct->constantCount));
+
+		addToStructBuckets(&structBuckets, (const char *)name->data, name->length, s_ix);
+
+		for (uint32_t i = 0; i < blobStruct->fieldCount; ++i) {
+			name = (const J9UTF8 *)(_buildInfo.stringBuffer + _buildInfo.blobFields[f_ix + i].nameOffset);
+			addToMemberBuckets(&memberBuckets, (const char *)name->data, name->length, s_ix, i);
+		}
+
+		for (uint32_t i = 0; i < blobStruct->constantCount; ++i) {
+			name = (const J9UTF8 *)(_buildInfo.stringBuffer + _buildInfo.blobConsts[c_ix + i].nameOffset);
+			addToMemberBuckets(&memberBuckets, (const char *)name->data, name->length, s_ix, blobStruct->fieldCount + i);
+		}
+
+		f_ix += blobStruct->fieldCount;
+		c_ix += blobStruct->constantCount;
+	}
+
+	/* align the index to 4 bytes */
+	const uint8_t padding[4] = { 0, 0, 0, 0 };
+	const size_t dataSize = sizeof(_buildInfo.header) + _buildInfo.header.structDataSize + _buildInfo.header.stringDataSize;
+	const intptr_t paddingSize = (intptr_t)((sizeof(padding) - (dataSize % sizeof(padding))) % sizeof(padding));
+	intptr_t amountWritten = 0;
+	intptr_t amountExpected = paddingSize + indexHeader.indexSize;
+
+	if (0 != paddingSize) {
+		amountWritten += omrfile_write(fd, padding, paddingSize);
+	}
+	amountWritten += omrfile_write(fd, &indexHeader, sizeof(indexHeader));
+	if (0 != structureCount) {
+		amountWritten += omrfile_write(fd, &structOffsets[0], sizeof(uint32_t) * structureCount);
+	}
+	amountWritten += omrfile_write(fd, &structBuckets[0], sizeof(uint32_t) * indexHeader.structBucketCount);
+	amountWritten += omrfile_write(fd, &memberBuckets[0], sizeof(BlobMemberBucket) * indexHeader.memberBucketCount);
+
+	if (amountWritten != amountExpected) {
+		ERRMSG("Expected %u bytes of blob index to be written, but %u was written.\n",
+				(uint32_t)amountExpected, (uint32_t)amountWritten);
+		rc = DDR_RC_ERROR;
+	}
+
+	return rc;
+}
+
 /* iterate ir:
  * - count structs - update blob header
  * - build string hash table
@@ -26,12 +26,12 @@
 #include <stdio.h>
 
 DDR_RC
-genBlob(struct OMRPortLibrary *portLibrary, Symbol_IR *ir, const char *supersetFile, const char *blobFile, bool printEmptyTypes)
+genBlob(struct OMRPortLibrary *portLibrary, Symbol_IR *ir, const char *supersetFile, const char *blobFile, bool printEmptyTypes, bool indexBlob)
 {
 	DDR_RC rc = DDR_RC_OK;
 
 	if (NULL != blobFile) {
-		JavaBlobGenerator blobGenerator(portLibrary, printEmptyTypes);
+		JavaBlobGenerator blobGenerator(portLibrary, printEmptyTypes, indexBlob);
 
 		rc = blobGenerator.genBinaryBlob(portLibrary, ir, blobFile);
 
@@ -0,0 +1,625 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+#include "ddr/blobreader/BlobReader.hpp"
+
+#include <stdlib.h>
+#include <string.h>
+
+/* The records of a version 1 blob, as written by JavaBlobGenerator. */
+struct RawBlobHeader {
+	uint32_t coreVersion;
+	uint8_t sizeofBool;
+	uint8_t sizeofUDATA;
+	uint8_t bitfieldFormat;
+	uint8_t padding;
+	uint32_t structDataSize;
+	uint32_t stringDataSize;
+	uint32_t structureCount;
+};
+
+struct RawBlobStruct {
+	uint32_t nameOffset;
+	uint32_t superOffset;
+	uint32_t structSize;
+	uint32_t fieldCount;
+	uint32_t constantCount;
+};
+
+struct RawBlobField {
+	uint32_t nameOffset;
+	uint32_t typeOffset;
+	uint32_t offset;
+};
+
+struct RawBlobConstant {
+	uint32_t nameOffset;
+	uint32_t value[2];
+};
+
+#define INVALID_OFFSET (~(uint32_t)0)
+
+static uint32_t
+swapU32(uint32_t value)
+{
+	return ((value & 0xFF) << 24) | ((value & 0xFF00) << 8) | ((value >> 8) & 0xFF00) | (value >> 24);
+}
+
+BlobReader::BlobReader(OMRPortLibrary *portLibrary)
+	: _portLibrary(portLibrary)
+	, _mapping(NULL)
+	, _blob(NULL)
+	, _blobSize(0)
+	, _swapped(false)
+	, _storedIndex(false)
+	, _coreVersion(0)
+	, _sizeofBool(0)
+	, _sizeofUDATA(0)
+	, _bitfieldFormat(0)
+	, _structDataSize(0)
+	, _stringDataSize(0)
+	, _structureCount(0)
+	, _structData(NULL)
+	, _stringData(NULL)
+	, _indexSwapped(false)
+	, _structOffsets(NULL)
+	, _structBucketCount(0)
+	, _structBuckets(NULL)
+	, _memberBucketCount(0)
+	, _memberBuckets(NULL)
+	, _builtIndex(NULL)
+{
+}
+
+BlobReader::~BlobReader()
+{
+	close();
+}
+
+DDR_RC
+BlobReader::open(const char *blobFile)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(_portLibrary);
+	DDR_RC rc = DDR_RC_OK;
+
+	close();
+
+	intptr_t fd = omrfile_open(blobFile, EsOpenRead, 0);
+
+	if (fd < 0) {
+		ERRMSG("Failure attempting to open %s\n", blobFile);
+		rc = DDR_RC_ERROR;
+	} else {
+		const int64_t length = omrfile_flength(fd);
+
+		if (length < (int64_t)sizeof(RawBlobHeader)) {
+			ERRMSG("%s is too short to be a blob\n", blobFile);
+			rc = DDR_RC_ERROR;
+		} else {
+			_mapping = omrmmap_map_file(fd, 0, (uintptr_t)length, NULL, OMRPORT_MMAP_FLAG_READ, OMRMEM_CATEGORY_UNKNOWN);
+			if (NULL == _mapping) {
+				ERRMSG("Failure attempting to map %s: %s\n", blobFile, omrerror_last_error_message());
+				rc = DDR_RC_ERROR;
+			} else {
+				_blob = (const uint8_t *)_mapping->pointer;
+				_blobSize = (uint64_t)length;
+			}
+		}
+
+		/* the mapping outlives the file handle */
+		omrfile_close(fd);
+	}
+
+	if (DDR_RC_OK == rc) {
+		/* Data is written in the blob in the natural byte order of the originating system.
+		 * All version numbers thus far are small: a large version number is interpreted as
+		 * a mismatch between the byte order of this system and the originating system.
+		 */
+		_coreVersion = readU32(_blob + offsetof(RawBlobHeader, coreVersion));
+		if (_coreVersion > (uint32_t)0xFFFF) {
+			_swapped = true;
+			_coreVersion = swapU32(_coreVersion);
+		}
+		_sizeofBool = _blob[offsetof(RawBlobHeader, sizeofBool)];
+		_sizeofUDATA = _blob[offsetof(RawBlobHeader, sizeofUDATA)];
+		_bitfieldFormat = _blob[offsetof(RawBlobHeader, bitfieldFormat)];
+		_structDataSize = readU32(_blob + offsetof(RawBlobHeader, structDataSize));
+		_stringDataSize = readU32(_blob + offsetof(RawBlobHeader, stringDataSize));
+		_structureCount = readU32(_blob + offsetof(RawBlobHeader, structureCount));
+
+		if ((sizeof(RawBlobHeader) + (uint64_t)_structDataSize + _stringDataSize) > _blobSize) {
+			ERRMSG("%s is truncated\n", blobFile);
+			rc = DDR_RC_ERROR;
+		} else {
+			_structData = _blob + sizeof(RawBlobHeader);
+			_stringData = _structData + _structDataSize;
+		}
+	}
+
+	if ((DDR_RC_OK == rc) && !useStoredIndex()) {
+		rc = buildIndex();
+		if (DDR_RC_OK != rc) {
+			ERRMSG("%s contains invalid structure data\n", blobFile);
+		}
+	}
+
+	if (DDR_RC_OK != rc) {
+		close();
+	}
+
+	return rc;
+}
+
+void
+BlobReader::close()
+{
+	if (NULL != _mapping) {
+		OMRPORT_ACCESS_FROM_OMRPORT(_portLibrary);
+
+		omrmmap_unmap_file(_mapping);
+		_mapping = NULL;
+	}
+
+	free(_builtIndex);
+
+	_blob = NULL;
+	_blobSize = 0;
+	_swapped = false;
+	_storedIndex = false;
+	_coreVersion = 0;
+	_sizeofBool = 0;
+	_sizeofUDATA = 0;
+	_bitfieldFormat = 0;
+	_structDataSize = 0;
+	_stringDataSize = 0;
+	_structureCount = 0;
+	_structData = NULL;
+	_stringData = NULL;
+	_indexSwapped = false;
+	_structOffsets = NULL;
+	_structBucketCount = 0;
+	_structBuckets = NULL;
+	_memberBucketCount = 0;
+	_memberBuckets = NULL;
+	_builtIndex = NULL;
+}
+
+uint16_t
+BlobReader::readU16(const uint8_t *data) const
+{
+	uint16_t value = 0;
+
+	memcpy(&value, data, sizeof(value));
+
+	return _swapped ? (uint16_t)((value << 8) | (value >> 8)) : value;
+}
+
+uint32_t
+BlobReader::readU32(const uint8_t *data) const
+{
+	uint32_t value = 0;
+
+	memcpy(&value, data, sizeof(value));
+
+	return _swapped ? swapU32(value) : value;
+}
+
+uint32_t
+BlobReader::readIndex(const uint8_t *data) const
+{
+	uint32_t value = 0;
+
+	memcpy(&value, data, sizeof(value));
+
+	return _indexSwapped ? swapU32(value) : value;
+}
+
+static bool
+isPowerOfTwo(uint32_t value)
+{
+	return (0 != value) && (0 == (value & (value - 1)));
+}
+
+bool
+BlobReader::useStoredIndex()
+{
+	const uint64_t dataEnd = sizeof(RawBlobHeader) + (uint64_t)_structDataSize + _stringDataSize;
+	const uint64_t indexStart = (dataEnd + 3) & ~(uint64_t)3;
+
+	if ((indexStart + sizeof(BlobIndexHeader)) > _blobSize) {
+		return false;
+	}
+
+	const uint8_t *index = _blob + indexStart;
+
+	if ((BLOB_INDEX_MAGIC != readU32(index + offsetof(BlobIndexHeader, magic)))
+		|| (BLOB_INDEX_VERSION != readU32(index + offsetof(BlobIndexHeader, version)))
+		|| (_structureCount != readU32(index + offsetof(BlobIndexHeader, structureCount)))
+	) {
+		return false;
+	}
+
+	const uint32_t indexSize = readU32(index + offsetof(BlobIndexHeader, indexSize));
+	const uint32_t structBucketCount = readU32(index + offsetof(BlobIndexHeader, structBucketCount));
+	const uint32_t memberBucketCount = readU32(index + offsetof(BlobIndexHeader, memberBucketCount));
+	const uint64_t expectedSize = sizeof(BlobIndexHeader)
+			+ (sizeof(uint32_t) * ((uint64_t)_structureCount + structBucketCount))
+			+ (sizeof(BlobMemberBucket) * (uint64_t)memberBucketCount);
+
+	if (!isPowerOfTwo(structBucketCount)
+		|| !isPowerOfTwo(memberBucketCount)
+		|| (expectedSize != indexSize)
+		|| ((indexStart + expectedSize) > _blobSize)
+	) {
+		return false;
+	}
+
+	_indexSwapped = _swapped;
+	_structOffsets = index + sizeof(BlobIndexHeader);
+	_structBucketCount = structBucketCount;
+	_structBuckets = _structOffsets + (sizeof(uint32_t) * _structureCount);
+	_memberBucketCount = memberBucketCount;
+	_memberBuckets = _structBuckets + (sizeof(uint32_t) * structBucketCount);
+	_storedIndex = true;
+
+	return true;
+}
+
+/* Build, in host byte order, the index that ddrgen --blob-index would have stored. */
+DDR_RC
+BlobReader::buildIndex()
+{
+	DDR_RC rc = DDR_RC_OK;
+	uint64_t memberCount = 0;
+	uint32_t offset = 0;
+
+	/* validate the structure data and count the members */
+	for (uint32_t s_ix = 0; s_ix < _structureCount; ++s_ix) {
+		if ((_structDataSize - offset) < sizeof(RawBlobStruct)) {
+			rc = DDR_RC_ERROR;
+			break;
+		}
+
+		const uint8_t *blobStruct = _structData + offset;
+		const uint32_t fieldCount = readU32(blobStruct + offsetof(RawBlobStruct, fieldCount));
+		const uint32_t constantCount = readU32(blobStruct + offsetof(RawBlobStruct, constantCount));
+		const uint64_t structSize = sizeof(RawBlobStruct)
+				+ (sizeof(RawBlobField) * (uint64_t)fieldCount)
+				+ (sizeof(RawBlobConstant) * (uint64_t)constantCount);
+
+		if (structSize > (_structDataSize - offset)) {
+			rc = DDR_RC_ERROR;
+			break;
+		}
+
+		offset += (uint32_t)structSize;
+		memberCount += fieldCount + constantCount;
+	}
+
+	if (DDR_RC_OK == rc) {
+		_structBucketCount = blobIndexBucketCount(_structureCount);
+		_memberBucketCount = blobIndexBucketCount((uint32_t)memberCount);
+
+		const size_t indexSize = (sizeof(uint32_t) * ((size_t)_structureCount + _structBucketCount))
+				+ (sizeof(BlobMemberBucket) * (size_t)_memberBucketCount);
+
+		_builtIndex = (uint8_t *)malloc(indexSize);
+		if (NULL == _builtIndex) {
+			ERRMSG("Unable to allocate memory for blob index\n");
+			rc = DDR_RC_ERROR;
+		} else {
+			memset(_builtIndex, 0, indexSize);
+		}
+	}
+
+	if (DDR_RC_OK == rc) {
+		uint32_t * const structOffsets = (uint32_t *)_builtIndex;
+		uint32_t * const structBuckets = structOffsets + _structureCount;
+		BlobMemberBucket * const memberBuckets = (BlobMemberBucket *)(structBuckets + _structBucketCount);
+		const uint32_t structMask = _structBucketCount - 1;
+		const uint32_t memberMask = _memberBucketCount - 1;
+		BlobStringRef name;
+
+		_indexSwapped = false;
+		_structOffsets = (const uint8_t *)structOffsets;
+		_structBuckets = (const uint8_t *)structBuckets;
+		_memberBuckets = (const uint8_t *)memberBuckets;
+
+		offset = 0;
+		for (uint32_t s_ix = 0; (DDR_RC_OK == rc) && (s_ix < _structureCount); ++s_ix) {
+			const uint8_t *blobStruct = _structData + offset;
+			const uint32_t fieldCount = readU32(blobStruct + offsetof(RawBlobStruct, fieldCount));
+			const uint32_t constantCount = readU32(blobStruct + offsetof(RawBlobStruct, constantCount));
+			const uint8_t *member = blobStruct + sizeof(RawBlobStruct);
+
+			structOffsets[s_ix] = offset;
+			offset += (uint32_t)(sizeof(RawBlobStruct)
+					+ (sizeof(RawBlobField) * fieldCount)
+					+ (sizeof(RawBlobConstant) * constantCount));
+
+			rc = getString(readU32(blobStruct + offsetof(RawBlobStruct, nameOffset)), &name);
+			if (DDR_RC_OK == rc) {
+				uint32_t bucket = blobIndexHash(name.data, name.length, 0) & structMask;
+
+				while (0 != structBuckets[bucket]) {
+					bucket = (bucket + 1) & structMask;
+				}
+				structBuckets[bucket] = s_ix + 1;
+			}
+
+			/* fields and constants both start with their name offset */
+			for (uint32_t m_ix = 0; (DDR_RC_OK == rc) && (m_ix < (fieldCount + constantCount)); ++m_ix) {
+				rc = getString(readU32(member), &name);
+				if (DDR_RC_OK == rc) {
+					uint32_t bucket = blobIndexHash(name.data, name.length, s_ix + 1) & memberMask;
+
+					while (0 != memberBuckets[bucket].structIndex) {
+						bucket = (bucket + 1) & memberMask;
+					}
+					memberBuckets[bucket].structIndex = s_ix + 1;
+					memberBuckets[bucket].memberIndex = m_ix;
+				}
+				member += (m_ix < fieldCount) ? sizeof(RawBlobField) : sizeof(RawBlobConstant);
+			}
+		}
+	}
+
+	return rc;
+}
+
+const uint8_t *
+BlobReader::structureAt(uint32_t structIndex) const
+{
+	if (structIndex >= _structureCount) {
+		return NULL;
+	}
+
+	const uint32_t offset = readIndex(_structOffsets + (sizeof(uint32_t) * structIndex));
+
+	if ((offset > _structDataSize) || ((_structDataSize - offset) < sizeof(RawBlobStruct))) {
+		return NULL;
+	}
+
+	const uint8_t *blobStruct = _structData + offset;
+	const uint64_t structSize = sizeof(RawBlobStruct)
+			+ (sizeof(RawBlobField) * (uint64_t)readU32(blobStruct + offsetof(RawBlobStruct, fieldCount)))
+			+ (sizeof(RawBlobConstant) * (uint64_t)readU32(blobStruct + offsetof(RawBlobStruct, constantCount)));
+
+	return (structSize <= (_structDataSize - offset)) ? blobStruct : NULL;
+}
+
+DDR_RC
+BlobReader::getString(uint32_t offset, BlobStringRef *string) const
+{
+	if ((offset > _stringDataSize) || ((_stringDataSize - offset) < sizeof(uint16_t))) {
+		return DDR_RC_ERROR;
+	}
+
+	const uint16_t length = readU16(_stringData + offset);
+
+	if (length > (_stringDataSize - offset - sizeof(uint16_t))) {
+		return DDR_RC_ERROR;
+	}
+
+	string->data = (const char *)(_stringData + offset + sizeof(uint16_t));
+	string->length = length;
+
+	return DDR_RC_OK;
+}
+
+uint32_t
+BlobReader::getNextStringOffset(uint32_t offset) const
+{
+	if ((offset > _stringDataSize) || ((_stringDataSize - offset) < sizeof(uint16_t))) {
+		return _stringDataSize;
+	}
+
+	const uint16_t length = readU16(_stringData + offset);
+
+	if (length > (_stringDataSize - offset - sizeof(uint16_t))) {
+		return _stringDataSize;
+	}
+
+	/* string data is padded to an even length */
+	return offset + (uint32_t)sizeof(uint16_t) + length + (length & 1);
+}
+
+bool
+BlobReader::stringEquals(uint32_t offset, const char *name, size_t length) const
+{
+	BlobStringRef string;
+
+	return (DDR_RC_OK == getString(offset, &string))
+		&& (length == string.length)
+		&& (0 == memcmp(string.data, name, length));
+}
+
+DDR_RC
+BlobReader::getStructure(uint32_t structIndex, BlobStructureInfo *info) const
+{
+	const uint8_t *blobStruct = structureAt(structIndex);
+
+	if (NULL == blobStruct) {
+		return DDR_RC_ERROR;
+	}
+
+	DDR_RC rc = getString(readU32(blobStruct + offsetof(RawBlobStruct, nameOffset)), &info->name);
+
+	if (DDR_RC_OK == rc) {
+		const uint32_t superOffset = readU32(blobStruct + offsetof(RawBlobStruct, superOffset));
+
+		if (INVALID_OFFSET == superOffset) {
+			info->superName.data = NULL;
+			info->superName.length = 0;
+		} else {
+			rc = getString(superOffset, &info->superName);
+		}
+	}
+
+	info->size = readU32(blobStruct + offsetof(RawBlobStruct, structSize));
+	info->fieldCount = readU32(blobStruct + offsetof(RawBlobStruct, fieldCount));
+	info->constantCount = readU32(blobStruct + offsetof(RawBlobStruct, constantCount));
+
+	return rc;
+}
+
+DDR_RC
+BlobReader::getField(uint32_t structIndex, uint32_t fieldIndex, BlobFieldInfo *info) const
+{
+	const uint8_t *blobStruct = structureAt(structIndex);
+
+	if ((NULL == blobStruct) || (fieldIndex >= readU32(blobStruct + offsetof(RawBlobStruct, fieldCount)))) {
+		return DDR_RC_ERROR;
+	}
+
+	const uint8_t *blobField = blobStruct + sizeof(RawBlobStruct) + (sizeof(RawBlobField) * fieldIndex);
+	DDR_RC rc = getString(readU32(blobField + offsetof(RawBlobField, nameOffset)), &info->name);
+
+	if (DDR_RC_OK == rc) {
+		rc = getString(readU32(blobField + offsetof(RawBlobField, typeOffset)), &info->type);
+	}
+
+	info->offset = readU32(blobField + offsetof(RawBlobField, offset));
+
+	return rc;
+}
+
+DDR_RC
+BlobReader::getConstant(uint32_t structIndex, uint32_t constantIndex, BlobConstantInfo *info) const
+{
+	const uint8_t *blobStruct = structureAt(structIndex);
+
+	if ((NULL == blobStruct) || (constantIndex >= readU32(blobStruct + offsetof(RawBlobStruct, constantCount)))) {
+		return DDR_RC_ERROR;
+	}
+
+	const uint32_t fieldCount = readU32(blobStruct + offsetof(RawBlobStruct, fieldCount));
+	const uint8_t *blobConst = blobStruct + sizeof(RawBlobStruct)
+			+ (sizeof(RawBlobField) * fieldCount)
+			+ (sizeof(RawBlobConstant) * constantIndex);
+	uint8_t value[sizeof(uint64_t)];
+
+	/* value may not be properly aligned to be treated as uint64_t */
+	memcpy(value, blobConst + offsetof(RawBlobConstant, value), sizeof(value));
+	if (_swapped) {
+		for (size_t i = 0; i < (sizeof(value) / 2); ++i) {
+			uint8_t temp = value[i];
+
+			value[i] = value[sizeof(value) - 1 - i];
+			value[sizeof(value) - 1 - i] = temp;
+		}
+	}
+	memcpy(&info->value, value, sizeof(info->value));
+
+	return getString(readU32(blobConst + offsetof(RawBlobConstant, nameOffset)), &info->name);
+}
+
+bool
+BlobReader::findStructure(const char *name, uint32_t *structIndex) const
+{
+	const size_t length = strlen(name);
+	const uint32_t mask = _structBucketCount - 1;
+	uint32_t bucket = blobIndexHash(name, length, 0) & mask;
+
+	for (uint32_t probes = 0; probes < _structBucketCount; ++probes) {
+		const uint32_t entry = readIndex(_structBuckets + (sizeof(uint32_t) * bucket));
+
+		if (0 == entry) {
+			break;
+		}
+
+		const uint8_t *blobStruct = structureAt(entry - 1);
+
+		if ((NULL != blobStruct) && stringEquals(readU32(blobStruct + offsetof(RawBlobStruct, nameOffset)), name, length)) {
+			*structIndex = entry - 1;
+			return true;
+		}
+
+		bucket = (bucket + 1) & mask;
+	}
+
+	return false;
+}
+
+bool
+BlobReader::findMember(uint32_t structIndex, const char *name, bool isField, uint32_t *memberIndex) const
+{
+	const uint8_t *blobStruct = structureAt(structIndex);
+
+	if (NULL == blobStruct) {
+		return false;
+	}
+
+	const uint32_t fieldCount = readU32(blobStruct + offsetof(RawBlobStruct, fieldCount));
+	const uint32_t constantCount = readU32(blobStruct + offsetof(RawBlobStruct, constantCount));
+	const size_t length = strlen(name);
+	const uint32_t mask = _memberBucketCount - 1;
+	uint32_t bucket = blobIndexHash(name, length, structIndex + 1) & mask;
+
+	for (uint32_t probes = 0; probes < _memberBucketCount; ++probes) {
+		const uint8_t *entry = _memberBuckets + (sizeof(BlobMemberBucket) * bucket);
+		const uint32_t owner = readIndex(entry + offsetof(BlobMemberBucket, structIndex));
+
+		if (0 == owner) {
+			break;
+		}
+
+		if ((structIndex + 1) == owner) {
+			const uint32_t member = readIndex(entry + offsetof(BlobMemberBucket, memberIndex));
+			const uint8_t *record = NULL;
+
+			if (member < fieldCount) {
+				if (isField) {
+					record = blobStruct + sizeof(RawBlobStruct) + (sizeof(RawBlobField) * member);
+				}
+			} else if ((member - fieldCount) < constantCount) {
+				if (!isField) {
+					record = blobStruct + sizeof(RawBlobStruct)
+							+ (sizeof(RawBlobField) * fieldCount)
+							+ (sizeof(RawBlobConstant) * (member - fieldCount));
+				}
+			}
+
+			/* fields and constants both start with their name offset */
+			if ((NULL != record) && stringEquals(readU32(record), name, length)) {
+				*memberIndex = isField ? member : (member - fieldCount);
+				return true;
+			}
+		}
+
+		bucket = (bucket + 1) & mask;
+	}
+
+	return false;
+}
+
+bool
+BlobReader::findField(uint32_t structIndex, const char *name, uint32_t *fieldIndex) const
+{
+	return findMember(structIndex, name, true, fieldIndex);
+}
+
+bool
+BlobReader::findConstant(uint32_t structIndex, const char *name, uint32_t *constantIndex) const
+{
+	return findMember(structIndex, name, false, constantIndex);
+}
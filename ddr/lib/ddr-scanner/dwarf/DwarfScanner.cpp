@@ -29,6 +29,8 @@
 #include "ddr/ir/Symbol_IR.hpp"
 #include "ddr/ir/UnionUDT.hpp"
 
+#include "thread_api.h"
+
 #include <algorithm>
 #include <cerrno>
 #include <cstdlib>
@@ -52,6 +54,16 @@
 #define OMR_LIBDWARF_VERSION 0
 #endif /* defined(DW_LIBDWARF_VERSION_MAJOR) && defined(DW_LIBDWARF_VERSION_MINOR) */
 
+/* Scanning files in parallel is only built with OMR_DDR_PARALLEL_SCAN: it relies on
+ * libdwarf allowing concurrent use of separate Dwarf_Debug handles. The AIX and OSX
+ * DWARF parsers keep global state (see scanFileName), so they always scan serially.
+ */
+#if defined(OMR_DDR_PARALLEL_SCAN) && !defined(AIXPPC) && !defined(OSX)
+#define DDR_PARALLEL_SCAN 1
+#else /* defined(OMR_DDR_PARALLEL_SCAN) && !defined(AIXPPC) && !defined(OSX) */
+#define DDR_PARALLEL_SCAN 0
+#endif /* defined(OMR_DDR_PARALLEL_SCAN) && !defined(AIXPPC) && !defined(OSX) */
+
 /* Wrappers to adapt to differences across libdwarf API versions. */
 
 #if OMR_LIBDWARF_VERSION >= DW_LIBDWARF_MAKE_VERSION(0, 9)
@@ -232,6 +244,168 @@ public:
 	virtual DDR_RC visitUnion(UnionUDT *type) const;
 };
 
+/* Scans debug files on a set of worker threads. Each file is scanned into a
+ * private Symbol_IR; the calling thread merges those into the result in input
+ * order, as soon as each one is available, so the result is exactly what a
+ * sequential scan would produce.
+ */
+class ParallelScan
+{
+private:
+	struct FileResult
+	{
+		Symbol_IR *ir;
+		DDR_RC rc;
+		bool done;
+
+		FileResult()
+			: ir(NULL)
+			, rc(DDR_RC_OK)
+			, done(false)
+		{
+		}
+	};
+
+	/* DWARF traversal recurses through nested types; the omrthread default is far too small. */
+	static const uintptr_t workerStackSize = 8 * 1024 * 1024;
+
+	DwarfScanner * const _scanner;
+	OMRPortLibrary * const _portLibrary;
+	Symbol_IR * const _ir;
+	vector<string> * const _debugFiles;
+	vector<FileResult> _results;
+	omrthread_monitor_t _monitor;
+	size_t _nextFile;
+	uintptr_t _liveWorkers;
+	bool _abort;
+
+	static int J9THREAD_PROC workerMain(void *arg);
+	void scanFiles();
+
+public:
+	ParallelScan(DwarfScanner *scanner, OMRPortLibrary *portLibrary, Symbol_IR *ir, vector<string> *debugFiles)
+		: _scanner(scanner)
+		, _portLibrary(portLibrary)
+		, _ir(ir)
+		, _debugFiles(debugFiles)
+		, _results(debugFiles->size())
+		, _monitor(NULL)
+		, _nextFile(0)
+		, _liveWorkers(0)
+		, _abort(false)
+	{
+	}
+
+	DDR_RC run(uintptr_t threadCount);
+};
+
+int J9THREAD_PROC
+ParallelScan::workerMain(void *arg)
+{
+	((ParallelScan *)arg)->scanFiles();
+	return 0;
+}
+
+void
+ParallelScan::scanFiles()
+{
+	/* Scanner state is per file, but not shareable between threads. */
+	DwarfScanner scanner;
+
+	scanner._excludedFiles = _scanner->_excludedFiles;
+	scanner._excludedTypes = _scanner->_excludedTypes;
+
+	omrthread_monitor_enter(_monitor);
+	while (!_abort && (_nextFile < _results.size())) {
+		const size_t index = _nextFile;
+
+		_nextFile += 1;
+		omrthread_monitor_exit(_monitor);
+
+		Symbol_IR *fileIR = new Symbol_IR(_ir);
+		DDR_RC rc = scanner.scanFile(_portLibrary, fileIR, (*_debugFiles)[index].c_str());
+
+		omrthread_monitor_enter(_monitor);
+		_results[index].ir = fileIR;
+		_results[index].rc = rc;
+		_results[index].done = true;
+		if (DDR_RC_OK != rc) {
+			/* Files already claimed are finished; no new ones are started. */
+			_abort = true;
+		}
+		omrthread_monitor_notify_all(_monitor);
+	}
+	_liveWorkers -= 1;
+	omrthread_monitor_notify_all(_monitor);
+	omrthread_monitor_exit(_monitor);
+}
+
+DDR_RC
+ParallelScan::run(uintptr_t threadCount)
+{
+	if (0 != omrthread_monitor_init_with_name(&_monitor, 0, "DDR scan")) {
+		ERRMSG("Failed to create scan monitor\n");
+		return DDR_RC_ERROR;
+	}
+
+	DDR_RC rc = DDR_RC_OK;
+
+	omrthread_monitor_enter(_monitor);
+
+	for (uintptr_t i = 0; i < threadCount; ++i) {
+		omrthread_t thread = NULL;
+
+		if (0 != omrthread_create(&thread, workerStackSize, J9THREAD_PRIORITY_NORMAL, 0, workerMain, this)) {
+			/* Carry on with the workers that did start. */
+			break;
+		}
+		_liveWorkers += 1;
+	}
+
+	if (0 == _liveWorkers) {
+		ERRMSG("Failed to start scan threads\n");
+		rc = DDR_RC_ERROR;
+	}
+
+	/* Merge in input order. Every file before the first failure has been
+	 * claimed by a worker, so waiting for it always terminates.
+	 */
+	for (size_t index = 0; (DDR_RC_OK == rc) && (index < _results.size()); ++index) {
+		FileResult *result = &_results[index];
+
+		while (!result->done) {
+			omrthread_monitor_wait(_monitor);
+		}
+
+		if (DDR_RC_OK != result->rc) {
+			ERRMSG("Failure scanning %s\n", (*_debugFiles)[index].c_str());
+			rc = result->rc;
+		} else {
+			Symbol_IR *fileIR = result->ir;
+
+			result->ir = NULL;
+			omrthread_monitor_exit(_monitor);
+			_ir->mergeIR(fileIR);
+			delete fileIR;
+			omrthread_monitor_enter(_monitor);
+		}
+	}
+
+	_abort = true;
+	while (0 != _liveWorkers) {
+		omrthread_monitor_wait(_monitor);
+	}
+
+	omrthread_monitor_exit(_monitor);
+	omrthread_monitor_destroy(_monitor);
+
+	for (vector<FileResult>::iterator it = _results.begin(); it != _results.end(); ++it) {
+		delete it->ir;
+	}
+
+	return rc;
+}
+
 const char * DwarfScanner::scanFileName = NULL;
 
 DwarfScanner::DwarfScanner()
@@ -1799,21 +1973,38 @@ DwarfScanner::startScan(OMRPortLibrary *portLibrary, Symbol_IR *ir, vector<strin
 	DDR_RC rc = loadExcludesFile(portLibrary, excludesFilePath);
 
 	if (DDR_RC_OK == rc) {
-		/* Read list of debug files to scan from the input file. */
-		for (vector<string>::iterator it = debugFiles->begin(); it != debugFiles->end(); ++it) {
-			Symbol_IR newIR(ir);
-			rc = scanFile(portLibrary, &newIR, it->c_str());
-			if (DDR_RC_OK != rc) {
-				ERRMSG("Failure scanning %s\n", it->c_str());
-				break;
+		if (DDR_PARALLEL_SCAN && (_threadCount > 1) && (debugFiles->size() > 1)) {
+			rc = scanFilesInParallel(portLibrary, ir, debugFiles);
+		} else {
+			/* Read list of debug files to scan from the input file. */
+			for (vector<string>::iterator it = debugFiles->begin(); it != debugFiles->end(); ++it) {
+				Symbol_IR newIR(ir);
+				rc = scanFile(portLibrary, &newIR, it->c_str());
+				if (DDR_RC_OK != rc) {
+					ERRMSG("Failure scanning %s\n", it->c_str());
+					break;
+				}
+				ir->mergeIR(&newIR);
 			}
-			ir->mergeIR(&newIR);
 		}
 	}
 
 	return rc;
 }
 
+DDR_RC
+DwarfScanner::scanFilesInParallel(OMRPortLibrary *portLibrary, Symbol_IR *ir, vector<string> *debugFiles)
+{
+	ParallelScan scan(this, portLibrary, ir, debugFiles);
+	uintptr_t threadCount = _threadCount;
+
+	if (threadCount > debugFiles->size()) {
+		threadCount = debugFiles->size();
+	}
+
+	return scan.run(threadCount);
+}
+
 DDR_RC
 DwarfScanner::scanFile(OMRPortLibrary *portLibrary, Symbol_IR *ir, const char *filepath)
 {
@@ -1831,7 +2022,9 @@ DwarfScanner::scanFile(OMRPortLibrary *portLibrary, Symbol_IR *ir, const char *f
 		Dwarf_Handler errhand = 0;
 		Dwarf_Ptr errarg = NULL;
 		intptr_t native_fd = omrfile_convert_omrfile_fd_to_native_fd(fd);
+#if defined(AIXPPC) || defined(OSX)
 		DwarfScanner::scanFileName = filepath;
+#endif /* defined(AIXPPC) || defined(OSX) */
 		res = ddr_dw_init((int)native_fd, filepath, errhand, errarg, &_debug, &error);
 
 #if defined(J9ZOS390) && defined(__open_xl__) && !defined(OMR_EBCDIC)
@@ -1879,7 +2072,9 @@ done:
 		omrfile_close(fd);
 	}
 
+#if defined(AIXPPC) || defined(OSX)
 	DwarfScanner::scanFileName = NULL;
+#endif /* defined(AIXPPC) || defined(OSX) */
 	DEBUGPRINTF("Start Scan Finished: Returning...");
 
 	return rc;
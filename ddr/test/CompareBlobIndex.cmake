@@ -0,0 +1,90 @@
+###############################################################################
+# Copyright IBM Corp. and others 2026
+#
+# This program and the accompanying materials are made available under
+# the terms of the Eclipse Public License 2.0 which accompanies this
+# distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+# or the Apache License, Version 2.0 which accompanies this distribution
+# and is available at https://www.apache.org/licenses/LICENSE-2.0.
+#
+# This Source Code may also be made available under the following Secondary
+# Licenses when the conditions for such availability set forth in the
+# Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+# version 2 with the GNU Classpath Exception [1] and GNU General Public
+# License, version 2 with the OpenJDK Assembly Exception [2].
+#
+# [1] https://www.gnu.org/software/classpath/license.html
+# [2] https://openjdk.org/legal/assembly-exception.html
+#
+# SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+#############################################################################
+
+# Run ddrgen over FILE_LIST with and without --blob-index and check that
+# blob_reader describes both blobs identically, and that names can be
+# looked up in the indexed blob.
+#
+# Usage:
+#   cmake -DDDRGEN=<ddrgen> -DBLOB_READER=<blob_reader> -DFILE_LIST=<file> -DOUTPUT_DIR=<dir> -P CompareBlobIndex.cmake
+
+foreach(var IN ITEMS DDRGEN BLOB_READER FILE_LIST OUTPUT_DIR)
+	if(NOT DEFINED ${var})
+		message(FATAL_ERROR "${var} is not defined")
+	endif()
+endforeach()
+
+file(REMOVE_RECURSE "${OUTPUT_DIR}")
+file(MAKE_DIRECTORY "${OUTPUT_DIR}")
+
+foreach(kind IN ITEMS plain indexed)
+	set(options --show-empty)
+	if(kind STREQUAL "indexed")
+		list(APPEND options --blob-index)
+	endif()
+
+	execute_process(
+		COMMAND "${DDRGEN}" --filelist "${FILE_LIST}" ${options}
+			--blob "${OUTPUT_DIR}/${kind}.dat"
+		RESULT_VARIABLE result
+	)
+	if(NOT result EQUAL 0)
+		message(FATAL_ERROR "ddrgen failed for the ${kind} blob: ${result}")
+	endif()
+
+	execute_process(
+		COMMAND "${BLOB_READER}" "${OUTPUT_DIR}/${kind}.dat"
+		OUTPUT_FILE "${OUTPUT_DIR}/${kind}.txt"
+		RESULT_VARIABLE result
+	)
+	if(NOT result EQUAL 0)
+		message(FATAL_ERROR "blob_reader failed for the ${kind} blob: ${result}")
+	endif()
+endforeach()
+
+execute_process(
+	COMMAND ${CMAKE_COMMAND} -E compare_files
+		"${OUTPUT_DIR}/plain.txt" "${OUTPUT_DIR}/indexed.txt"
+	RESULT_VARIABLE result
+)
+if(NOT result EQUAL 0)
+	message(FATAL_ERROR "the indexed blob reads differently from the plain blob")
+endif()
+
+# struct A is declared in sample1.cpp
+execute_process(
+	COMMAND "${BLOB_READER}" "${OUTPUT_DIR}/indexed.dat" A.y
+	OUTPUT_VARIABLE lookup
+	RESULT_VARIABLE result
+)
+if((NOT result EQUAL 0) OR (NOT lookup MATCHES "Field declaredName: y"))
+	message(FATAL_ERROR "A.y was not found in the indexed blob: ${result}\n${lookup}")
+endif()
+
+execute_process(
+	COMMAND "${BLOB_READER}" "${OUTPUT_DIR}/indexed.dat" A.noSuchField
+	OUTPUT_QUIET
+	ERROR_QUIET
+	RESULT_VARIABLE result
+)
+if(result EQUAL 0)
+	message(FATAL_ERROR "A.noSuchField was unexpectedly found in the indexed blob")
+endif()
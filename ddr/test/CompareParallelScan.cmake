@@ -0,0 +1,58 @@
+###############################################################################
+# Copyright IBM Corp. and others 2026
+#
+# This program and the accompanying materials are made available under
+# the terms of the Eclipse Public License 2.0 which accompanies this
+# distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+# or the Apache License, Version 2.0 which accompanies this distribution
+# and is available at https://www.apache.org/licenses/LICENSE-2.0.
+#
+# This Source Code may also be made available under the following Secondary
+# Licenses when the conditions for such availability set forth in the
+# Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+# version 2 with the GNU Classpath Exception [1] and GNU General Public
+# License, version 2 with the OpenJDK Assembly Exception [2].
+#
+# [1] https://www.gnu.org/software/classpath/license.html
+# [2] https://openjdk.org/legal/assembly-exception.html
+#
+# SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+#############################################################################
+
+# Run ddrgen over FILE_LIST with one and with several scan threads and
+# check that the superset and blob files are identical.
+#
+# Usage:
+#   cmake -DDDRGEN=<ddrgen> -DFILE_LIST=<file> -DOUTPUT_DIR=<dir> -P CompareParallelScan.cmake
+
+foreach(var IN ITEMS DDRGEN FILE_LIST OUTPUT_DIR)
+	if(NOT DEFINED ${var})
+		message(FATAL_ERROR "${var} is not defined")
+	endif()
+endforeach()
+
+foreach(jobs IN ITEMS 1 4)
+	set(dir "${OUTPUT_DIR}/jobs${jobs}")
+	file(REMOVE_RECURSE "${dir}")
+	file(MAKE_DIRECTORY "${dir}")
+
+	execute_process(
+		COMMAND "${DDRGEN}" --filelist "${FILE_LIST}" --show-empty --jobs ${jobs}
+			--superset "${dir}/superset.out" --blob "${dir}/blob.dat"
+		RESULT_VARIABLE result
+	)
+	if(NOT result EQUAL 0)
+		message(FATAL_ERROR "ddrgen --jobs ${jobs} failed: ${result}")
+	endif()
+endforeach()
+
+foreach(output IN ITEMS superset.out blob.dat)
+	execute_process(
+		COMMAND ${CMAKE_COMMAND} -E compare_files
+			"${OUTPUT_DIR}/jobs1/${output}" "${OUTPUT_DIR}/jobs4/${output}"
+		RESULT_VARIABLE result
+	)
+	if(NOT result EQUAL 0)
+		message(FATAL_ERROR "${output} differs between sequential and parallel scans")
+	endif()
+endforeach()
@@ -22,7 +22,6 @@
 #include "ddr/config.hpp"
 
 #include <algorithm>
-#include <errno.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -33,154 +32,231 @@
 #include "atoe.h"
 #endif /* defined(J9ZOS390) && !defined(OMR_EBCDIC) */
 
+#include "ddr/blobreader/BlobReader.hpp"
 #include "omrport.h"
 #include "thread_api.h"
 
 using std::vector;
 
-static void
-swap_bytes(uint8_t *left, uint8_t *right)
+class CompareStructs
 {
-	uint8_t temp = *left;
+private:
+	const BlobReader * const _reader;
 
-	*left = *right;
-	*right = temp;
-}
+public:
+	explicit CompareStructs(const BlobReader *reader)
+		: _reader(reader)
+	{
+	}
+
+	bool operator()(uint32_t first, uint32_t second) const
+	{
+		BlobStructureInfo firstInfo;
+		BlobStructureInfo secondInfo;
+
+		_reader->getStructure(first, &firstInfo);
+		_reader->getStructure(second, &secondInfo);
+
+		const int result = memcmp(firstInfo.name.data, secondInfo.name.data,
+				std::min(firstInfo.name.length, secondInfo.name.length));
+
+		return (0 != result) ? (result < 0) : (firstInfo.name.length < secondInfo.name.length);
+	}
+};
 
 static void
-swap_u16(uint16_t *value)
+printField(OMRPortLibrary *portLibrary, const BlobFieldInfo &field)
 {
-	uint8_t *bytes = (uint8_t *)value;
-
-	swap_bytes(&bytes[0], &bytes[1]);
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+
+	omrfile_printf(OMRPORT_TTY_OUT, " Field declaredName: %.*s\n",
+			field.name.length,
+			field.name.data);
+	omrfile_printf(OMRPORT_TTY_OUT, "  declaredType: %.*s\n",
+			field.type.length,
+			field.type.data);
+	omrfile_printf(OMRPORT_TTY_OUT, "  offset: %u\n", field.offset);
 }
 
 static void
-swap_u32(uint32_t *value)
+printConstant(OMRPortLibrary *portLibrary, const BlobConstantInfo &constant)
 {
-	uint8_t *bytes = (uint8_t *)value;
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
 
-	swap_bytes(&bytes[0], &bytes[3]);
-	swap_bytes(&bytes[1], &bytes[2]);
+	omrfile_printf(OMRPORT_TTY_OUT, " Constant name: %.*s\n",
+			constant.name.length,
+			constant.name.data);
+	omrfile_printf(OMRPORT_TTY_OUT, "  value: %llu\n", (unsigned long long)constant.value);
 }
 
-struct BlobHeaderV1 {
-	uint32_t coreVersion;
-	uint8_t sizeofBool;
-	uint8_t sizeofUDATA;
-	uint8_t bitfieldFormat;
-	uint8_t padding;
-	uint32_t structDataSize;
-	uint32_t stringTableDataSize;
-	uint32_t structureCount;
-
-	void endian_swap()
-	{
-		swap_u32(&coreVersion);
-		swap_u32(&structDataSize);
-		swap_u32(&stringTableDataSize);
-		swap_u32(&structureCount);
+static int
+printStructure(OMRPortLibrary *portLibrary, const BlobReader &reader, uint32_t structIndex)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	BlobStructureInfo info;
+
+	if (DDR_RC_OK != reader.getStructure(structIndex, &info)) {
+		omrfile_printf(OMRPORT_TTY_ERR, "structure #%u is invalid\n", structIndex);
+		return -1;
+	}
+
+	omrfile_printf(OMRPORT_TTY_OUT, "\nStruct name: %.*s\n",
+			info.name.length,
+			info.name.data);
+	if (NULL == info.superName.data) {
+		omrfile_printf(OMRPORT_TTY_OUT, " no superName\n");
+	} else {
+		omrfile_printf(OMRPORT_TTY_OUT, " superName: %.*s\n",
+				info.superName.length,
+				info.superName.data);
+	}
+	omrfile_printf(OMRPORT_TTY_OUT, " sizeOf: %u\n"
+			" fieldCount: %u\n"
+			" constCount: %u\n",
+			info.size,
+			info.fieldCount,
+			info.constantCount);
+
+	/* print fields in the structure */
+	for (uint32_t i = 0; i < info.fieldCount; ++i) {
+		BlobFieldInfo field;
+
+		if (DDR_RC_OK != reader.getField(structIndex, i, &field)) {
+			omrfile_printf(OMRPORT_TTY_ERR, "field #%u of %.*s is invalid\n", i, info.name.length, info.name.data);
+			return -1;
+		}
+		printField(portLibrary, field);
 	}
-};
 
-struct BlobString {
-	uint16_t length;
-	char data[1]; /* flexible array member */
+	/* print constants in the structure */
+	for (uint32_t i = 0; i < info.constantCount; ++i) {
+		BlobConstantInfo constant;
 
-	void endian_swap()
-	{
-		swap_u16(&length);
+		if (DDR_RC_OK != reader.getConstant(structIndex, i, &constant)) {
+			omrfile_printf(OMRPORT_TTY_ERR, "constant #%u of %.*s is invalid\n", i, info.name.length, info.name.data);
+			return -1;
+		}
+		printConstant(portLibrary, constant);
 	}
-};
 
-struct BlobStruct {
-	uint32_t nameOffset;
-	uint32_t superName;
-	uint32_t sizeOf;
-	uint32_t fieldCount;
-	uint32_t constCount;
+	return 0;
+}
+
+static int
+printBlob(OMRPortLibrary *portLibrary, const BlobReader &reader)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+
+	omrfile_printf(OMRPORT_TTY_OUT, "Blob Header:\n"
+			" coreVersion: %u\n"
+			" sizeofBool: %u\n"
+			" sizeofUDATA: %u\n"
+			" bitfieldFormat: %u\n" /* see initializeBitfieldEncoding in j9ddr.c */
+			" structDataSize: %u\n"
+			" stringTableDataSize: %u\n"
+			" structureCount: %u\n",
+			reader.getCoreVersion(),
+			reader.getSizeofBool(),
+			reader.getSizeofUDATA(),
+			reader.getBitfieldFormat(),
+			reader.getStructDataSize(),
+			reader.getStringDataSize(),
+			reader.getStructureCount());
+
+	/* print strings */
+	omrfile_printf(OMRPORT_TTY_OUT, "\n== STRINGS ==\n");
+
+	uint32_t offset = 0;
+
+	for (uint32_t stringNum = 1; offset < reader.getStringDataSize(); ++stringNum) {
+		BlobStringRef string;
+
+		if (DDR_RC_OK != reader.getString(offset, &string)) {
+			omrfile_printf(OMRPORT_TTY_ERR, "string at offset %x is invalid\n", offset);
+			return -1;
+		}
 
-	void endian_swap()
-	{
-		swap_u32(&nameOffset);
-		swap_u32(&superName);
-		swap_u32(&sizeOf);
-		swap_u32(&fieldCount);
-		swap_u32(&constCount);
+		/* The format of the printed list is:
+		 * #: <offset in string data> [<string length>] <string data>
+		 */
+		omrfile_printf(OMRPORT_TTY_OUT, "%5u: %8zx [%u] %.*s\n",
+				stringNum,
+				(uintptr_t)offset,
+				string.length,
+				string.length,
+				string.data);
+
+		offset = reader.getNextStringOffset(offset);
 	}
-};
 
-struct BlobField {
-	uint32_t declaredName;
-	uint32_t declaredType;
-	uint32_t offset;
+	/* print structures, sorted by name */
+	vector<uint32_t> structs;
 
-	void endian_swap()
-	{
-		swap_u32(&declaredName);
-		swap_u32(&declaredType);
-		swap_u32(&offset);
+	for (uint32_t i = 0; i < reader.getStructureCount(); ++i) {
+		BlobStructureInfo info;
+
+		if (DDR_RC_OK != reader.getStructure(i, &info)) {
+			omrfile_printf(OMRPORT_TTY_ERR, "structure #%u is invalid\n", i);
+			return -1;
+		}
+		structs.push_back(i);
 	}
-};
+	sort(structs.begin(), structs.end(), CompareStructs(&reader));
 
-struct BlobConstant {
-	uint32_t name;
-	/* don't declare value as uint64_t to ensure that no padding is added between it and name */
-	uint32_t value[2];
+	omrfile_printf(OMRPORT_TTY_OUT, "\n== STRUCTS ==\n");
+	for (size_t i = 0; i < structs.size(); ++i) {
+		if (0 != printStructure(portLibrary, reader, structs[i])) {
+			return -1;
+		}
+	}
 
-	void endian_swap()
-	{
-		swap_u32(&name);
+	return 0;
+}
 
-		/* value may not be properly aligned to be treated as uint64_t - swap pairs of bytes */
-		uint8_t *bytes = (uint8_t *)value;
+/* Print the structure or member named by query, which is either 'Struct' or 'Struct.member'. */
+static int
+printQuery(OMRPortLibrary *portLibrary, const BlobReader &reader, const char *query)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	const char *dot = strchr(query, '.');
+	const size_t structNameLength = (NULL == dot) ? strlen(query) : (size_t)(dot - query);
+	vector<char> structName(query, query + structNameLength);
+	uint32_t structIndex = 0;
+
+	structName.push_back('\0');
+	if (!reader.findStructure(&structName[0], &structIndex)) {
+		omrfile_printf(OMRPORT_TTY_ERR, "%s: no such structure\n", &structName[0]);
+		return 1;
+	}
 
-		swap_bytes(&bytes[0], &bytes[7]);
-		swap_bytes(&bytes[1], &bytes[6]);
-		swap_bytes(&bytes[2], &bytes[5]);
-		swap_bytes(&bytes[3], &bytes[4]);
+	if (NULL == dot) {
+		return printStructure(portLibrary, reader, structIndex);
 	}
-};
 
-struct Constant {
-	const char *name;
-	uint32_t nameLength;
-	uint64_t value;
-};
+	const char *memberName = dot + 1;
+	uint32_t memberIndex = 0;
 
-struct Field {
-	const char *name;
-	uint32_t nameLength;
-	const char *type;
-	uint32_t typeLength;
-	uint32_t offset;
-};
+	if (reader.findField(structIndex, memberName, &memberIndex)) {
+		BlobFieldInfo field;
 
-struct Structure {
-	const char *name;
-	uint32_t nameLength;
-	const char *superName;
-	uint32_t superNameLength;
-	uint32_t size;
-	vector<Field *> fields;
-	vector<Constant *> constants;
-
-	Structure()
-		: name(NULL)
-		, nameLength(0)
-		, superName(NULL)
-		, superNameLength(0)
-		, size(0)
-		, fields()
-		, constants()
-	{
+		if (DDR_RC_OK == reader.getField(structIndex, memberIndex, &field)) {
+			printField(portLibrary, field);
+			return 0;
+		}
+	} else if (reader.findConstant(structIndex, memberName, &memberIndex)) {
+		BlobConstantInfo constant;
+
+		if (DDR_RC_OK == reader.getConstant(structIndex, memberIndex, &constant)) {
+			printConstant(portLibrary, constant);
+			return 0;
+		}
+	} else {
+		omrfile_printf(OMRPORT_TTY_ERR, "%s: no such field or constant\n", query);
+		return 1;
 	}
-};
 
-static bool
-compareStructs(const Structure *first, const Structure *second)
-{
-	return strcmp(first->name, second->name) < 0;
+	omrfile_printf(OMRPORT_TTY_ERR, "%s is invalid\n", query);
+	return -1;
 }
 
 int
@@ -214,239 +290,34 @@ main(int argc, char *argv[])
 
 	OMRPORT_ACCESS_FROM_OMRPORT(&portLibrary);
 	int rc = -1;
-	intptr_t fd = -1;
-	size_t rb = 0;
-	uint8_t *blobBuffer = NULL;
-	BlobHeaderV1 blobHdrV1;
-
-	memset(&blobHdrV1, 0, sizeof(blobHdrV1));
 
 	if (argc < 2) {
 		omrfile_printf(OMRPORT_TTY_ERR, "Please specify a blob filename.\n");
-		omrfile_printf(OMRPORT_TTY_ERR, "Usage: %s <blobfile>\n", argv[0]);
-		goto done;
-	}
-
-	fd = omrfile_open(argv[1], EsOpenRead, 0);
-	if (fd < 0) {
-		omrfile_printf(OMRPORT_TTY_ERR, "fopen failed: %s\n", strerror(errno));
-		goto done;
-	}
-
-	/* read header */
-	rb = omrfile_read(fd, &blobHdrV1, sizeof(blobHdrV1));
-	if (sizeof(blobHdrV1) != rb) {
-		omrfile_printf(OMRPORT_TTY_ERR, "read blob header returned %zu, expected %zu\n", rb, sizeof(blobHdrV1));
+		omrfile_printf(OMRPORT_TTY_ERR, "Usage: %s <blobfile> [<struct>[.<member>] ...]\n", argv[0]);
 	} else {
-		/* Data is written in the blob in the natural byte order of the originating system.
-		 * All version numbers thus far are small: a large version number is interpreted as
-		 * a mismatch between the byte order of this system and the originating system.
-		 */
-		const bool swapsNeeded = blobHdrV1.coreVersion > (uint32_t) 0xFFFF;
-
-		if (swapsNeeded) {
-			blobHdrV1.endian_swap();
-		}
-
-		omrfile_printf(OMRPORT_TTY_OUT, "Blob Header:\n"
-				" coreVersion: %u\n"
-				" sizeofBool: %u\n"
-				" sizeofUDATA: %u\n"
-				" bitfieldFormat: %u\n" /* see initializeBitfieldEncoding in j9ddr.c */
-				" structDataSize: %u\n"
-				" stringTableDataSize: %u\n"
-				" structureCount: %u\n",
-				blobHdrV1.coreVersion,
-				blobHdrV1.sizeofBool,
-				blobHdrV1.sizeofUDATA,
-				blobHdrV1.bitfieldFormat,
-				blobHdrV1.structDataSize,
-				blobHdrV1.stringTableDataSize,
-				blobHdrV1.structureCount);
-
-		/* read the file into memory */
-		const size_t blobLength = blobHdrV1.structDataSize + blobHdrV1.stringTableDataSize;
-		blobBuffer = (uint8_t *)malloc(blobLength);
-		if (NULL == blobBuffer) {
-			omrfile_printf(OMRPORT_TTY_ERR, "malloc blobBuffer failed\n");
-			goto done;
-		}
-
-		rb = omrfile_read(fd, blobBuffer, blobLength);
-		if (blobLength != rb) {
-			omrfile_printf(OMRPORT_TTY_ERR, "read blob data returned %zu, expected %zu\n", rb, blobLength);
-			goto done;
-		}
-
-		/* read strings */
-		{
-			omrfile_printf(OMRPORT_TTY_OUT, "\n== STRINGS ==\n");
-
-			const uint8_t * const stringDataStart = blobBuffer + blobHdrV1.structDataSize;
-			const uint8_t * const stringDataEnd = stringDataStart + blobHdrV1.stringTableDataSize;
-			const uint8_t *currentString = stringDataStart;
-
-			for (uint32_t stringNum = 1; currentString < stringDataEnd; ++stringNum) {
-				BlobString *blobString = (BlobString *)currentString;
-
-				if (swapsNeeded) {
-					blobString->endian_swap();
-				}
-
-				/* NOTE string lengths appear to be padded to an even length */
-				const uint16_t padding = blobString->length & 1;
-
-				/* The format of the printed list is:
-				 * #: <offset in string data> [<string length>] <string data>
-				 */
-				omrfile_printf(OMRPORT_TTY_OUT, "%5u: %8zx [%u] %.*s\n",
-						stringNum,
-						(uintptr_t)(currentString - stringDataStart),
-						blobString->length,
-						blobString->length,
-						blobString->data);
-
-				/* NOTE stringTableDataSize includes the space for the lengths */
-				currentString += blobString->length + sizeof(blobString->length) + padding;
-			}
-		}
-
-		/* read structuress */
-		{
-			const uint8_t * const stringDataStart = blobBuffer + blobHdrV1.structDataSize;
-	#define BLOBSTRING_AT(offset) \
-			((const BlobString *)(stringDataStart + (offset)))
-
-			/* set offset to start of struct data */
-			const uint8_t *currentStruct = blobBuffer;
-
-			vector<Structure *> structs;
-			for (uint32_t structCount = 1; structCount <= blobHdrV1.structureCount; ++structCount) {
-				BlobStruct *blobStruct = (BlobStruct *)currentStruct;
-
-				if (swapsNeeded) {
-					blobStruct->endian_swap();
-				}
-
-				currentStruct += sizeof(BlobStruct);
-
-				Structure *builtStruct = new Structure;
-
-				builtStruct->name = BLOBSTRING_AT(blobStruct->nameOffset)->data;
-				builtStruct->nameLength = BLOBSTRING_AT(blobStruct->nameOffset)->length;
-				if ((uint32_t)-1 == blobStruct->superName) {
-					builtStruct->superName = NULL;
-					builtStruct->superNameLength = 0;
-				} else {
-					builtStruct->superName = BLOBSTRING_AT(blobStruct->superName)->data;
-					builtStruct->superNameLength = BLOBSTRING_AT(blobStruct->superName)->length;
-				}
-				builtStruct->size = blobStruct->sizeOf;
-
-				for (uint32_t fieldCount = 1; fieldCount <= blobStruct->fieldCount; ++fieldCount) {
-					BlobField *blobField = (BlobField *)currentStruct;
-
-					if (swapsNeeded) {
-						blobField->endian_swap();
+		/* the reader must be gone before the port library is shut down */
+		BlobReader reader(&portLibrary);
+
+		if (DDR_RC_OK == reader.open(argv[1])) {
+			if (argc < 3) {
+				/* no queries: print everything */
+				rc = printBlob(&portLibrary, reader);
+			} else {
+				rc = 0;
+				for (int i = 2; i < argc; ++i) {
+					int queryRC = printQuery(&portLibrary, reader, argv[i]);
+
+					if (0 != queryRC) {
+						rc = queryRC;
 					}
-
-					currentStruct += sizeof(BlobField);
-
-					Field *field = new Field;
-
-					field->name = BLOBSTRING_AT(blobField->declaredName)->data;
-					field->nameLength = BLOBSTRING_AT(blobField->declaredName)->length;
-					field->type = BLOBSTRING_AT(blobField->declaredType)->data;
-					field->typeLength = BLOBSTRING_AT(blobField->declaredType)->length;
-					field->offset = blobField->offset;
-
-					builtStruct->fields.push_back(field);
 				}
-
-				for (uint32_t constCount = 1; constCount <= blobStruct->constCount; ++constCount) {
-					BlobConstant *blobConst = (BlobConstant *)currentStruct;
-
-					if (swapsNeeded) {
-						blobConst->endian_swap();
-					}
-
-					currentStruct += sizeof(BlobConstant);
-
-					Constant *constant = new Constant;
-
-					constant->name = BLOBSTRING_AT(blobConst->name)->data;
-					constant->nameLength = BLOBSTRING_AT(blobConst->name)->length;
-					constant->value = *(uint64_t *)blobConst->value;
-
-					builtStruct->constants.push_back(constant);
-				}
-
-				structs.push_back(builtStruct);
 			}
-			sort(structs.begin(), structs.end(), compareStructs);
-
-			omrfile_printf(OMRPORT_TTY_OUT, "\n== STRUCTS ==\n");
-			for (size_t i = 0; i < structs.size(); ++i) {
-				Structure *builtStruct = structs[i];
-				omrfile_printf(OMRPORT_TTY_OUT, "\nStruct name: %.*s\n",
-						builtStruct->nameLength,
-						builtStruct->name);
-				if (NULL == builtStruct->superName) {
-					omrfile_printf(OMRPORT_TTY_OUT, " no superName\n");
-				} else {
-					omrfile_printf(OMRPORT_TTY_OUT, " superName: %.*s\n",
-							builtStruct->superNameLength,
-							builtStruct->superName);
-				}
-				omrfile_printf(OMRPORT_TTY_OUT, " sizeOf: %u\n"
-						" fieldCount: %zu\n"
-						" constCount: %zu\n",
-						builtStruct->size,
-						builtStruct->fields.size(),
-						builtStruct->constants.size());
-
-				/* print fields in the structure */
-				for (size_t j = 0; j < builtStruct->fields.size(); ++j) {
-					Field *field = builtStruct->fields[j];
-
-					omrfile_printf(OMRPORT_TTY_OUT, " Field declaredName: %.*s\n",
-							field->nameLength,
-							field->name);
-					omrfile_printf(OMRPORT_TTY_OUT, "  declaredType: %.*s\n",
-							field->typeLength,
-							field->type);
-					omrfile_printf(OMRPORT_TTY_OUT, "  offset: %u\n", field->offset);
-					delete field;
-				}
-
-				/* print constants in the structure */
-				for (size_t j = 0; j < builtStruct->constants.size(); ++j) {
-					Constant *constant = builtStruct->constants[j];
-
-					omrfile_printf(OMRPORT_TTY_OUT, " Constant name: %.*s\n",
-							constant->nameLength,
-							constant->name);
-					omrfile_printf(OMRPORT_TTY_OUT, "  value: %llu\n", constant->value);
-					delete constant;
-				}
-				delete builtStruct;
-			}
-	#undef BLOBSTRING_AT
 		}
 	}
 
-	rc = 0;
-
-done:
-	if (fd >= 0) {
-		omrfile_close(fd);
-		fd = -1;
-	}
-
-	if (NULL != blobBuffer) {
-		free(blobBuffer);
-		blobBuffer = NULL;
-	}
+	portLibrary.port_shutdown_library(&portLibrary);
+	omrthread_detach(NULL);
+	omrthread_shutdown_library();
 
 	return rc;
 }
@@ -53,6 +53,8 @@ struct Options
 	const char *excludesFile;
 	bool printEmptyTypes;
 	bool showExcluded;
+	bool indexBlob;
+	uintptr_t threadCount;
 
 	Options()
 		: macroFile(NULL)
@@ -63,6 +65,8 @@ struct Options
 		, excludesFile(NULL)
 		, printEmptyTypes(false)
 		, showExcluded(false)
+		, indexBlob(false)
+		, threadCount(1)
 	{
 	}
 
@@ -129,6 +133,7 @@ main(int argc, char *argv[])
 #endif /* DEBUG_PRINT_TYPES */
 
 	if ((DDR_RC_OK == rc) && !options.debugFiles.empty()) {
+		scanner.setThreadCount(options.threadCount);
 		rc = scanner.startScan(&portLibrary, &ir, &options.debugFiles, options.excludesFile);
 
 #if defined(DEBUG_PRINT_TYPES)
@@ -190,7 +195,7 @@ main(int argc, char *argv[])
 
 	/* Generate output. */
 	if ((DDR_RC_OK == rc) && !ir._types.empty()) {
-		rc = genBlob(&portLibrary, &ir, options.supersetFile, options.blobFile, options.printEmptyTypes);
+		rc = genBlob(&portLibrary, &ir, options.supersetFile, options.blobFile, options.printEmptyTypes, options.indexBlob);
 	}
 
 	portLibrary.port_shutdown_library(&portLibrary);
@@ -240,6 +245,8 @@ Options::configure(OMRPortLibrary *portLibrary, int argc, char *argv[])
 			} else {
 				blobFile = argv[++i];
 			}
+		} else if (matchesEither(argv[i], "-bi", "--blob-index")) {
+			indexBlob = true;
 		} else if (matchesEither(argv[i], "-o", "--overrides")) {
 			if (argc < i + 2) {
 				showHelp = true;
@@ -252,6 +259,19 @@ Options::configure(OMRPortLibrary *portLibrary, int argc, char *argv[])
 			} else {
 				excludesFile = argv[++i];
 			}
+		} else if (matchesEither(argv[i], "-j", "--jobs")) {
+			if (argc < i + 2) {
+				showHelp = true;
+			} else {
+				char *end = NULL;
+				unsigned long jobs = strtoul(argv[++i], &end, 10);
+
+				if ((0 == jobs) || ('\0' != *end)) {
+					showHelp = true;
+				} else {
+					threadCount = (uintptr_t)jobs;
+				}
+			}
 		} else if (matchesEither(argv[i], "-e", "--show-empty")) {
 			printEmptyTypes = true;
 		} else if (matchesEither(argv[i], "-sx", "--show-excluded")) {
@@ -283,6 +303,10 @@ Options::configure(OMRPortLibrary *portLibrary, int argc, char *argv[])
 			"      Output superset file.\n"
 			"  -b FILE, --blob FILE\n"
 			"      Output binary blob file.\n"
+			"  -bi, --blob-index\n"
+			"      Append an index to the blob so that readers can look up structures\n"
+			"      and fields without parsing the whole blob. Readers that do not know\n"
+			"      about the index ignore it.\n"
 			"  -o FILE, --overrides FILE\n"
 			"      Optional file containing a list of files which contain rules\n"
 			"      modifying the default treatment of types.\n"
@@ -295,6 +319,11 @@ Options::configure(OMRPortLibrary *portLibrary, int argc, char *argv[])
 			"  -x FILE, --exclude FILE\n"
 			"      Optional file containing list of type names and source file paths to\n"
 			"      exclude. Format is 'file:[filename]' or 'type:[typename]' on each line.\n"
+			"  -j N, --jobs N\n"
+			"      Scan input files using N threads. The output is identical to\n"
+			"      that of a sequential scan. Default is 1. Experimental: other\n"
+			"      values are ignored unless OMR_DDR_PARALLEL_SCAN was enabled in\n"
+			"      the build, and only DWARF input is scanned in parallel.\n"
 			"  -e, --show-empty\n"
 			"      Print structures, enums, and unions to the superset and blob even if\n"
 			"      they do not contain any fields. The default behaviour is to hide them.\n"
@@ -187,6 +187,22 @@ TEST(OmrAlgoTest, PoolTestPuddleSharing)
 	ASSERT_EQ(0, testPoolPuddleListSharing(omrTestEnv->getPortLibrary()));
 }
 
+class PoolThreadCacheTest: public ::testing::TestWithParam<uintptr_t>
+{
+};
+
+TEST_P(PoolThreadCacheTest, Stress)
+{
+	ASSERT_EQ(0, testPoolThreadCache(omrTestEnv->getPortLibrary(), GetParam()));
+}
+
+TEST_P(PoolThreadCacheTest, Benchmark)
+{
+	ASSERT_EQ(0, benchmarkPoolThreadCache(omrTestEnv->getPortLibrary(), GetParam()));
+}
+
+INSTANTIATE_TEST_CASE_P(OmrAlgoTest, PoolThreadCacheTest, ::testing::Values(1, 2, 4, 8));
+
 TEST(OmrAlgoTest, hookabletest)
 {
 	uintptr_t passCount = 0;
@@ -199,6 +215,17 @@ TEST(OmrAlgoTest, hookabletest)
 	showResult(omrTestEnv->getPortLibrary(), passCount, failCount, numSuitesNotRun);
 }
 
+class HookDispatchTest: public ::testing::TestWithParam<uintptr_t>
+{
+};
+
+TEST_P(HookDispatchTest, Benchmark)
+{
+	ASSERT_EQ(0, benchmarkHookDispatch(omrTestEnv->getPortLibrary(), GetParam()));
+}
+
+INSTANTIATE_TEST_CASE_P(OmrAlgoTest, HookDispatchTest, ::testing::Values(1, 2, 4, 8));
+
 class HashtableTest: public ::testing::TestWithParam<HashtableInputData>
 {
 };
@@ -254,6 +281,38 @@ INSTANTIATE_TEST_CASE_P(OmrAlgoTest, CollisionResilientHashtableTest,
 	)
 );
 
+TEST_P(HashtableTest, ConcurrentForce)
+{
+	HashtableInputData params = GetParam();
+	params.forceCollisions = TRUE;
+
+	ASSERT_EQ(0, buildAndVerifyConcurrentHashtable(omrTestEnv->getPortLibrary(), &params)) << "Test verification failed for " << params.hashtableName;
+}
+
+TEST_P(HashtableTest, ConcurrentNoForce)
+{
+	HashtableInputData params = GetParam();
+	params.forceCollisions = FALSE;
+
+	ASSERT_EQ(0, buildAndVerifyConcurrentHashtable(omrTestEnv->getPortLibrary(), &params)) << "Test verification failed for " << params.hashtableName;
+}
+
+class ConcurrentHashtableThreadsTest: public ::testing::TestWithParam<uintptr_t>
+{
+};
+
+TEST_P(ConcurrentHashtableThreadsTest, Stress)
+{
+	ASSERT_EQ(0, verifyConcurrentHashtableStress(omrTestEnv->getPortLibrary(), GetParam()));
+}
+
+TEST_P(ConcurrentHashtableThreadsTest, Benchmark)
+{
+	ASSERT_EQ(0, benchmarkConcurrentHashtable(omrTestEnv->getPortLibrary(), GetParam()));
+}
+
+INSTANTIATE_TEST_CASE_P(OmrAlgoTest, ConcurrentHashtableThreadsTest, ::testing::Values(1, 2, 4, 8));
+
 static void
 showResult(OMRPortLibrary *portlib, uintptr_t passCount, uintptr_t failCount, int32_t numSuitesNotRun)
 {
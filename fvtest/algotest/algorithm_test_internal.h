@@ -82,6 +82,24 @@ createAndVerifyPool(OMRPortLibrary *portLib, PoolInputData *input);
 int32_t
 testPoolPuddleListSharing(OMRPortLibrary *portLib);
 
+/**
+* @brief
+* @param *portLib
+* @param threadCount
+* @return int32_t
+*/
+int32_t
+testPoolThreadCache(OMRPortLibrary *portLib, uintptr_t threadCount);
+
+/**
+* @brief
+* @param *portLib
+* @param threadCount
+* @return int32_t
+*/
+int32_t
+benchmarkPoolThreadCache(OMRPortLibrary *portLib, uintptr_t threadCount);
+
 /* ---------------- hooktest.c ---------------- */
 
 /**
@@ -94,6 +112,15 @@ testPoolPuddleListSharing(OMRPortLibrary *portLib);
 int32_t
 verifyHookable(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *failCount);
 
+/**
+* @brief
+* @param *portLib
+* @param threadCount
+* @return int32_t
+*/
+int32_t
+benchmarkHookDispatch(OMRPortLibrary *portLib, uintptr_t threadCount);
+
 /* ---------------- hashtabletest.c ---------------- */
 
 /**
@@ -110,6 +137,17 @@ verifyHashtable(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *failCo
 int32_t
 buildAndVerifyHashtable(OMRPortLibrary *portLib, HashtableInputData *inputData);
 
+/* ---------------- concurrenthashtabletest.c ---------------- */
+
+int32_t
+buildAndVerifyConcurrentHashtable(OMRPortLibrary *portLib, HashtableInputData *inputData);
+
+int32_t
+verifyConcurrentHashtableStress(OMRPortLibrary *portLib, uintptr_t threadCount);
+
+int32_t
+benchmarkConcurrentHashtable(OMRPortLibrary *portLib, uintptr_t threadCount);
+
 #ifdef __cplusplus
 }
 #endif
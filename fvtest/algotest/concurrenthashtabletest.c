@@ -0,0 +1,450 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include <string.h>
+#include "algorithm_test_internal.h"
+#include "hashtable_api.h"
+#include "omrport.h"
+#include "omrthread.h"
+
+/*
+ * Testing the following functions of J9ConcurrentHashTable:
+ * 		concurrentHashTableAdd()
+ * 		concurrentHashTableFind()
+ * 		concurrentHashTableRemove()
+ * 		concurrentHashTableForEachDo()
+ * 		concurrentHashTableGetCount()
+ * from one thread and from several threads at once, and comparing the
+ * throughput of a mostly-read workload against a J9HashTable guarded by a monitor.
+ */
+
+#define STRESS_KEYS_PER_THREAD 2000
+#define STRESS_ROUNDS 4
+#define BENCHMARK_KEYS 4096
+#define BENCHMARK_OPERATIONS 200000
+#define BENCHMARK_WRITE_PERCENT 10
+
+typedef struct ConcurrentEntry {
+	uintptr_t key;
+	uintptr_t value;
+} ConcurrentEntry;
+
+typedef struct ConcurrentThreadData {
+	OMRPortLibrary *portLib;
+	J9ConcurrentHashTable *table;
+	J9HashTable *lockedTable;
+	omrthread_monitor_t tableMutex;
+	uintptr_t threadIndex;
+	uintptr_t threadCount;
+	int32_t result;
+} ConcurrentThreadData;
+
+static uintptr_t
+entryHashFn(void *entry, void *userData)
+{
+	BOOLEAN forceCollisions = (BOOLEAN)((uintptr_t)userData);
+	uintptr_t key = ((ConcurrentEntry *)entry)->key;
+	return forceCollisions ? (key & 0x1) : key;
+}
+
+static uintptr_t
+entryEqualFn(void *leftEntry, void *rightEntry, void *userData)
+{
+	return ((ConcurrentEntry *)leftEntry)->key == ((ConcurrentEntry *)rightEntry)->key;
+}
+
+static uintptr_t
+countAndRemoveOddFn(void *entry, void *userData)
+{
+	*(uintptr_t *)userData += 1;
+	return 0 != (((ConcurrentEntry *)entry)->key & 0x1);
+}
+
+static uintptr_t
+valueForKey(uintptr_t key)
+{
+	return (key * 7) + 1;
+}
+
+/* Simple xorshift generator so that every thread gets a repeatable sequence */
+static uintptr_t
+nextRandom(uintptr_t *seed)
+{
+	uintptr_t x = *seed;
+	x ^= x << 13;
+	x ^= x >> 7;
+	x ^= x << 17;
+	*seed = x;
+	return x;
+}
+
+static int32_t
+runConcurrentHashtableTests(OMRPortLibrary *portLib, J9ConcurrentHashTable *table, const uintptr_t *data, uintptr_t dataLength)
+{
+	ConcurrentEntry entry;
+	ConcurrentEntry *found = NULL;
+	uintptr_t visited = 0;
+	uintptr_t odd = 0;
+	uintptr_t i = 0;
+
+	for (i = 0; i < dataLength; i++) {
+		entry.key = data[i];
+		entry.value = valueForKey(data[i]);
+		found = (ConcurrentEntry *)concurrentHashTableAdd(table, &entry);
+		if ((NULL == found) || (found->key != entry.key)) {
+			return -1;
+		}
+		if (data[i] & 0x1) {
+			odd += 1;
+		}
+	}
+	if (concurrentHashTableGetCount(table) != dataLength) {
+		return -2;
+	}
+
+	/* adding a duplicate key returns the entry already present */
+	entry.key = data[0];
+	entry.value = 0;
+	found = (ConcurrentEntry *)concurrentHashTableAdd(table, &entry);
+	if ((NULL == found) || (found->value != valueForKey(data[0])) || (concurrentHashTableGetCount(table) != dataLength)) {
+		return -3;
+	}
+
+	for (i = 0; i < dataLength; i++) {
+		entry.key = data[i];
+		found = (ConcurrentEntry *)concurrentHashTableFind(table, &entry);
+		if ((NULL == found) || (found->value != valueForKey(data[i]))) {
+			return -4;
+		}
+	}
+
+	concurrentHashTableForEachDo(table, countAndRemoveOddFn, &visited);
+	if ((visited != dataLength) || (concurrentHashTableGetCount(table) != (dataLength - odd))) {
+		return -5;
+	}
+
+	for (i = 0; i < dataLength; i++) {
+		uint32_t rc = 0;
+		entry.key = data[i];
+		found = (ConcurrentEntry *)concurrentHashTableFind(table, &entry);
+		if ((NULL == found) != (0 != (data[i] & 0x1))) {
+			return -6;
+		}
+		rc = concurrentHashTableRemove(table, &entry);
+		if ((0 == rc) == (0 != (data[i] & 0x1))) {
+			return -7;
+		}
+		if (NULL != concurrentHashTableFind(table, &entry)) {
+			return -8;
+		}
+	}
+	if (0 != concurrentHashTableGetCount(table)) {
+		return -9;
+	}
+	return 0;
+}
+
+int32_t
+buildAndVerifyConcurrentHashtable(OMRPortLibrary *portLib, HashtableInputData *inputData)
+{
+	J9ConcurrentHashTable *table = NULL;
+	uintptr_t grown[1024];
+	uintptr_t i = 0;
+	int32_t result = 0;
+
+	/* Start small so the second pass has to grow the table */
+	table = concurrentHashTableNew(portLib, inputData->hashtableName, 0, sizeof(ConcurrentEntry), 0,
+			OMRMEM_CATEGORY_VM, entryHashFn, entryEqualFn, (void *)(uintptr_t)inputData->forceCollisions);
+	if (NULL == table) {
+		result = -1;
+		goto fail;
+	}
+	if (0 != runConcurrentHashtableTests(portLib, table, inputData->data, inputData->dataLength)) {
+		result = -2;
+		goto fail;
+	}
+	for (i = 0; i < sizeof(grown) / sizeof(uintptr_t); i++) {
+		grown[i] = inputData->data[i % inputData->dataLength] + (i * 256);
+	}
+	if (0 != runConcurrentHashtableTests(portLib, table, grown, sizeof(grown) / sizeof(uintptr_t))) {
+		result = -3;
+		goto fail;
+	}
+fail:
+	concurrentHashTableFree(table);
+	return result;
+}
+
+/*
+ * Each thread owns a range of keys that it adds, checks and removes, while
+ * also looking up keys owned by the other threads. Any entry found must
+ * carry the value belonging to its key.
+ */
+static int J9THREAD_PROC
+stressThread(void *arg)
+{
+	ConcurrentThreadData *data = (ConcurrentThreadData *)arg;
+	J9ConcurrentHashTable *table = data->table;
+	uintptr_t base = data->threadIndex * STRESS_KEYS_PER_THREAD;
+	uintptr_t totalKeys = data->threadCount * STRESS_KEYS_PER_THREAD;
+	uintptr_t seed = (data->threadIndex * 7919) + 17;
+	uintptr_t round = 0;
+	uintptr_t i = 0;
+	ConcurrentEntry entry;
+	ConcurrentEntry *found = NULL;
+
+	for (round = 0; round < STRESS_ROUNDS; round++) {
+		for (i = 0; i < STRESS_KEYS_PER_THREAD; i++) {
+			entry.key = base + i;
+			entry.value = valueForKey(entry.key);
+			if (NULL == concurrentHashTableAdd(table, &entry)) {
+				data->result = -1;
+				return 0;
+			}
+
+			/* look at a key owned by any thread */
+			entry.key = nextRandom(&seed) % totalKeys;
+			found = (ConcurrentEntry *)concurrentHashTableFind(table, &entry);
+			if ((NULL != found) && (found->key != entry.key)) {
+				data->result = -2;
+				return 0;
+			}
+		}
+		for (i = 0; i < STRESS_KEYS_PER_THREAD; i++) {
+			uintptr_t token = 0;
+			entry.key = base + i;
+			token = concurrentHashTableReadEnter(table);
+			found = (ConcurrentEntry *)concurrentHashTableFind(table, &entry);
+			if ((NULL == found) || (found->value != valueForKey(entry.key))) {
+				data->result = -3;
+			}
+			concurrentHashTableReadExit(table, token);
+			if (0 != data->result) {
+				return 0;
+			}
+		}
+		/* keep the even keys of the last round */
+		for (i = 0; i < STRESS_KEYS_PER_THREAD; i++) {
+			if ((round + 1 == STRESS_ROUNDS) && (0 == (i & 0x1))) {
+				continue;
+			}
+			entry.key = base + i;
+			if (0 != concurrentHashTableRemove(table, &entry)) {
+				data->result = -4;
+				return 0;
+			}
+		}
+	}
+	return 0;
+}
+
+static int32_t
+runThreads(OMRPortLibrary *portLib, ConcurrentThreadData *data, uintptr_t threadCount, omrthread_entrypoint_t entryPoint)
+{
+	omrthread_t threads[16];
+	uintptr_t i = 0;
+	int32_t result = 0;
+
+	if (threadCount > sizeof(threads) / sizeof(omrthread_t)) {
+		return -1;
+	}
+	for (i = 0; i < threadCount; i++) {
+		omrthread_attr_t attr = NULL;
+		if ((J9THREAD_SUCCESS != omrthread_attr_init(&attr))
+			|| (J9THREAD_SUCCESS != omrthread_attr_set_detachstate(&attr, J9THREAD_CREATE_JOINABLE))
+			|| (J9THREAD_SUCCESS != omrthread_create_ex(&threads[i], &attr, 0, entryPoint, &data[i]))
+		) {
+			return -2;
+		}
+		omrthread_attr_destroy(&attr);
+	}
+	for (i = 0; i < threadCount; i++) {
+		if (J9THREAD_SUCCESS != omrthread_join(threads[i])) {
+			result = -3;
+		}
+		if (0 != data[i].result) {
+			result = data[i].result;
+		}
+	}
+	return result;
+}
+
+int32_t
+verifyConcurrentHashtableStress(OMRPortLibrary *portLib, uintptr_t threadCount)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLib);
+	ConcurrentThreadData *data = NULL;
+	J9ConcurrentHashTable *table = NULL;
+	ConcurrentEntry entry;
+	ConcurrentEntry *found = NULL;
+	uintptr_t i = 0;
+	int32_t result = 0;
+
+	table = concurrentHashTableNew(portLib, "concurrent stress", 0, sizeof(ConcurrentEntry), 0,
+			OMRMEM_CATEGORY_VM, entryHashFn, entryEqualFn, (void *)(uintptr_t)FALSE);
+	data = (ConcurrentThreadData *)omrmem_allocate_memory(sizeof(ConcurrentThreadData) * threadCount, OMRMEM_CATEGORY_VM);
+	if ((NULL == table) || (NULL == data)) {
+		result = -100;
+		goto done;
+	}
+	memset(data, 0, sizeof(ConcurrentThreadData) * threadCount);
+	for (i = 0; i < threadCount; i++) {
+		data[i].portLib = portLib;
+		data[i].table = table;
+		data[i].threadIndex = i;
+		data[i].threadCount = threadCount;
+	}
+
+	result = runThreads(portLib, data, threadCount, stressThread);
+	if (0 != result) {
+		goto done;
+	}
+
+	/* only the even keys of the last round remain */
+	if (concurrentHashTableGetCount(table) != (threadCount * (STRESS_KEYS_PER_THREAD / 2))) {
+		result = -101;
+		goto done;
+	}
+	for (i = 0; i < threadCount * STRESS_KEYS_PER_THREAD; i++) {
+		entry.key = i;
+		found = (ConcurrentEntry *)concurrentHashTableFind(table, &entry);
+		if ((NULL == found) != (0 != ((i % STRESS_KEYS_PER_THREAD) & 0x1))) {
+			result = -102;
+			goto done;
+		}
+	}
+done:
+	concurrentHashTableFree(table);
+	omrmem_free_memory(data);
+	return result;
+}
+
+static int J9THREAD_PROC
+benchmarkConcurrentThread(void *arg)
+{
+	ConcurrentThreadData *data = (ConcurrentThreadData *)arg;
+	uintptr_t seed = (data->threadIndex * 104729) + 3;
+	uintptr_t i = 0;
+	ConcurrentEntry entry;
+
+	for (i = 0; i < BENCHMARK_OPERATIONS; i++) {
+		uintptr_t random = nextRandom(&seed);
+		entry.key = random % BENCHMARK_KEYS;
+		entry.value = valueForKey(entry.key);
+		if ((random >> 20) % 100 < BENCHMARK_WRITE_PERCENT) {
+			if (0 != concurrentHashTableRemove(data->table, &entry)) {
+				concurrentHashTableAdd(data->table, &entry);
+			}
+		} else {
+			concurrentHashTableFind(data->table, &entry);
+		}
+	}
+	return 0;
+}
+
+static int J9THREAD_PROC
+benchmarkLockedThread(void *arg)
+{
+	ConcurrentThreadData *data = (ConcurrentThreadData *)arg;
+	uintptr_t seed = (data->threadIndex * 104729) + 3;
+	uintptr_t i = 0;
+	ConcurrentEntry entry;
+
+	for (i = 0; i < BENCHMARK_OPERATIONS; i++) {
+		uintptr_t random = nextRandom(&seed);
+		entry.key = random % BENCHMARK_KEYS;
+		entry.value = valueForKey(entry.key);
+		omrthread_monitor_enter(data->tableMutex);
+		if ((random >> 20) % 100 < BENCHMARK_WRITE_PERCENT) {
+			if (0 != hashTableRemove(data->lockedTable, &entry)) {
+				hashTableAdd(data->lockedTable, &entry);
+			}
+		} else {
+			hashTableFind(data->lockedTable, &entry);
+		}
+		omrthread_monitor_exit(data->tableMutex);
+	}
+	return 0;
+}
+
+int32_t
+benchmarkConcurrentHashtable(OMRPortLibrary *portLib, uintptr_t threadCount)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLib);
+	ConcurrentThreadData *data = NULL;
+	J9ConcurrentHashTable *table = NULL;
+	J9HashTable *lockedTable = NULL;
+	omrthread_monitor_t tableMutex = NULL;
+	ConcurrentEntry entry;
+	uint64_t start = 0;
+	uint64_t concurrentMillis = 0;
+	uint64_t lockedMillis = 0;
+	uintptr_t i = 0;
+	int32_t result = 0;
+
+	table = concurrentHashTableNew(portLib, "concurrent benchmark", BENCHMARK_KEYS, sizeof(ConcurrentEntry), 0,
+			OMRMEM_CATEGORY_VM, entryHashFn, entryEqualFn, (void *)(uintptr_t)FALSE);
+	lockedTable = hashTableNew(portLib, "locked benchmark", BENCHMARK_KEYS, sizeof(ConcurrentEntry), sizeof(char *), 0,
+			OMRMEM_CATEGORY_VM, entryHashFn, entryEqualFn, NULL, (void *)(uintptr_t)FALSE);
+	data = (ConcurrentThreadData *)omrmem_allocate_memory(sizeof(ConcurrentThreadData) * threadCount, OMRMEM_CATEGORY_VM);
+	if ((NULL == table) || (NULL == lockedTable) || (NULL == data)
+		|| (0 != omrthread_monitor_init_with_name(&tableMutex, 0, "locked benchmark table"))
+	) {
+		result = -100;
+		goto done;
+	}
+	for (i = 0; i < BENCHMARK_KEYS; i += 2) {
+		entry.key = i;
+		entry.value = valueForKey(i);
+		concurrentHashTableAdd(table, &entry);
+		hashTableAdd(lockedTable, &entry);
+	}
+	memset(data, 0, sizeof(ConcurrentThreadData) * threadCount);
+	for (i = 0; i < threadCount; i++) {
+		data[i].portLib = portLib;
+		data[i].table = table;
+		data[i].lockedTable = lockedTable;
+		data[i].tableMutex = tableMutex;
+		data[i].threadIndex = i;
+		data[i].threadCount = threadCount;
+	}
+
+	start = omrtime_current_time_millis();
+	result = runThreads(portLib, data, threadCount, benchmarkConcurrentThread);
+	concurrentMillis = omrtime_current_time_millis() - start;
+	if (0 != result) {
+		goto done;
+	}
+	start = omrtime_current_time_millis();
+	result = runThreads(portLib, data, threadCount, benchmarkLockedThread);
+	lockedMillis = omrtime_current_time_millis() - start;
+
+	omrtty_printf("hashtable benchmark: threads=%zu operations/thread=%d writes=%d%% concurrent=%llu ms monitor=%llu ms\n",
+			threadCount, BENCHMARK_OPERATIONS, BENCHMARK_WRITE_PERCENT, concurrentMillis, lockedMillis);
+done:
+	if (NULL != tableMutex) {
+		omrthread_monitor_destroy(tableMutex);
+	}
+	concurrentHashTableFree(table);
+	hashTableFree(lockedTable);
+	omrmem_free_memory(data);
+	return result;
+}
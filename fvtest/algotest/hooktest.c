@@ -21,10 +21,22 @@
 
 #include <string.h>
 #include "omrport.h"
+#include "omrthread.h"
 #include "hookable_api.h"
+#include "ute_module.h"
 #include "hooksample_internal.h"
 
+#define DISPATCH_BENCHMARK_MAX_THREADS 16
+#define DISPATCH_BENCHMARK_ROUNDS 200000
+
+typedef struct DispatchBenchmarkData {
+	J9HookInterface **hookInterface;
+	uintptr_t listenerCalls;
+	int32_t result;
+} DispatchBenchmarkData;
+
 static int32_t testHookInterface(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *failCount, J9HookInterface **hookInterface);
+static void testThresholdTrace(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *failCount, J9HookInterface **hookInterface);
 static void testEnabled(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *failCount, J9HookInterface **hookInterface, uintptr_t event, uintptr_t expectedResult);
 static void testDisable(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *failCount, J9HookInterface **hookInterface, uintptr_t event, uintptr_t expectedResult);
 static void testReserve(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *failCount, J9HookInterface **hookInterface, uintptr_t event, uintptr_t expectedResult);
@@ -33,11 +45,17 @@ static void testRegisterWithAgent(OMRPortLibrary *portLib, uintptr_t *passCount,
 static void testUnregister(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *failCount, J9HookInterface **hookInterface, uintptr_t event);
 static void testUnregisterWithAgent(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *failCount, J9HookInterface **hookInterface, uintptr_t event, uintptr_t userData);
 static void testDispatch(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *failCount, uintptr_t event, uintptr_t expectedResult);
+static void testEventCount(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *failCount, J9HookInterface **hookInterface, uintptr_t event, uintptr_t expectedResult);
+static void testDumpInfoCount(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *failCount, J9HookInterface **hookInterface, uintptr_t event, uintptr_t expectedResult);
 static uintptr_t testAllocateAgentID(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *failCount, J9HookInterface **hookInterface);
 static void hookNormalEvent(J9HookInterface **hook, uintptr_t eventNum, void *voidEventData, void *userData);
 static void hookOrderedEvent(J9HookInterface **hook, uintptr_t eventNum, void *voidEventData, void *userData);
+static void hookBenchmarkEvent(J9HookInterface **hook, uintptr_t eventNum, void *voidEventData, void *userData);
+static int J9THREAD_PROC dispatchBenchmarkThread(void *arg);
+static int32_t runDispatchBenchmark(OMRPortLibrary *portLib, J9HookInterface **hookInterface, uintptr_t threadCount, uintptr_t listenerCount, uintptr_t collectDumpInfo);
 
 static SampleHookInterface sampleHookInterface;
+static SampleHookInterface benchmarkHookInterface;
 
 int32_t
 verifyHookable(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *failCount)
@@ -58,6 +76,15 @@ verifyHookable(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *failCou
 		(*hookInterface)->J9HookShutdownInterface(hookInterface);
 	}
 
+	if (J9HookInitializeInterface(hookInterface, portLib, sizeof(sampleHookInterface))) {
+		(*failCount)++;
+		rc = -1;
+	} else {
+		testThresholdTrace(portLib, passCount, failCount, hookInterface);
+
+		(*hookInterface)->J9HookShutdownInterface(hookInterface);
+	}
+
 	omrtty_printf("Finished testing hookable interface.\n");
 
 	return rc;
@@ -163,9 +190,95 @@ testHookInterface(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *fail
 	testRegisterWithAgent(portLib, passCount, failCount, hookInterface, TESTHOOK_EVENT3, agent2, 3, 0);
 	testDispatch(portLib, passCount, failCount, TESTHOOK_EVENT3, 5);
 
+	/* listener invocations are only counted while a dump consumer is registered */
+	testEventCount(portLib, passCount, failCount, hookInterface, TESTHOOK_EVENT3, 0);
+	if (0 == (*hookInterface)->J9HookRegisterDumpConsumer(hookInterface)) {
+		(*passCount)++;
+	} else {
+		(*failCount)++;
+	}
+	testDispatch(portLib, passCount, failCount, TESTHOOK_EVENT3, 5);
+	testDispatch(portLib, passCount, failCount, TESTHOOK_EVENT3, 5);
+	testEventCount(portLib, passCount, failCount, hookInterface, TESTHOOK_EVENT3, 10);
+	testDumpInfoCount(portLib, passCount, failCount, hookInterface, TESTHOOK_EVENT3, 10);
+	(*hookInterface)->J9HookUnregisterDumpConsumer(hookInterface);
+	testDispatch(portLib, passCount, failCount, TESTHOOK_EVENT3, 5);
+	testEventCount(portLib, passCount, failCount, hookInterface, TESTHOOK_EVENT3, 10);
+
 	return rc;
 }
 
+#if defined(OMR_RAS_TDF_TRACE)
+static uintptr_t thresholdTracepoints;
+static UtModuleInterface thresholdTraceModule;
+
+static void
+countThresholdTrace(void *env, UtModuleInfo *modInfo, uint32_t traceId, const char *spec, ...)
+{
+	thresholdTracepoints += 1;
+}
+
+static void
+startThresholdTrace(void *env, UtModuleInfo *modInfo)
+{
+	/* like the trace engine, route the module's tracepoints through this interface */
+	modInfo->intf = &thresholdTraceModule;
+	modInfo->active[0] = 1;
+}
+
+static void
+stopThresholdTrace(void *env, UtModuleInfo *modInfo)
+{
+	modInfo->active[0] = 0;
+}
+
+static UtModuleInterface thresholdTraceModule = { countThresholdTrace, NULL, NULL, startThresholdTrace, stopThresholdTrace };
+static UtInterface thresholdTraceInterface = { NULL, NULL, &thresholdTraceModule };
+#endif /* OMR_RAS_TDF_TRACE */
+
+/*
+ * A listener running for at least threshold4Trace microseconds fires the threshold
+ * tracepoint while it is enabled, even without a dump consumer.
+ */
+static void
+testThresholdTrace(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *failCount, J9HookInterface **hookInterface)
+{
+#if defined(OMR_RAS_TDF_TRACE)
+	OMRPORT_ACCESS_FROM_OMRPORT(portLib);
+	J9CommonHookInterface *commonInterface = (J9CommonHookInterface *)hookInterface;
+	uintptr_t eventNum = TESTHOOK_EVENT3 & J9HOOK_EVENT_NUM_MASK;
+	OMREventInfo4Dump *eventDump = J9HOOK_DUMPINFO(commonInterface, eventNum);
+
+	testRegister(portLib, passCount, failCount, hookInterface, TESTHOOK_EVENT3, 0);
+	commonInterface->threshold4Trace = 0;
+
+	thresholdTracepoints = 0;
+	if (0 != omrhook_lib_control(J9HOOK_LIB_CONTROL_TRACE_START, (uintptr_t)&thresholdTraceInterface)) {
+		omrtty_printf("Could not start hook tracing\n");
+		(*failCount)++;
+		return;
+	}
+	testDispatch(portLib, passCount, failCount, TESTHOOK_EVENT3, 1);
+	testDispatch(portLib, passCount, failCount, TESTHOOK_EVENT3, 1);
+	omrhook_lib_control(J9HOOK_LIB_CONTROL_TRACE_STOP, (uintptr_t)&thresholdTraceInterface);
+
+	if (2 == thresholdTracepoints) {
+		(*passCount)++;
+	} else {
+		omrtty_printf("Threshold tracepoint fired %zu times, expected 2\n", thresholdTracepoints);
+		(*failCount)++;
+	}
+	if ((NULL != eventDump->lastHook.func_ptr) && (0 != eventDump->lastHook.startTime)) {
+		(*passCount)++;
+	} else {
+		omrtty_printf("Listener timing was not recorded\n");
+		(*failCount)++;
+	}
+
+	testUnregister(portLib, passCount, failCount, hookInterface, TESTHOOK_EVENT3);
+#endif /* OMR_RAS_TDF_TRACE */
+}
+
 static void
 testEnabled(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *failCount, J9HookInterface **hookInterface, uintptr_t event, uintptr_t expectedResult)
 {
@@ -249,6 +362,39 @@ testAllocateAgentID(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *fa
 	return agentID;
 }
 
+static void
+testEventCount(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *failCount, J9HookInterface **hookInterface, uintptr_t event, uintptr_t expectedResult)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLib);
+	uintptr_t count = (*hookInterface)->J9HookGetEventCount(hookInterface, event);
+
+	if (count == expectedResult) {
+		(*passCount)++;
+	} else {
+		omrtty_printf("J9HookGetEventCount for 0x%zx returned %zu, expected %zu\n", event, count, expectedResult);
+		(*failCount)++;
+	}
+}
+
+/*
+ * Readers of the dump info, such as dump writers, read the count straight from the
+ * event's OMREventInfo4Dump rather than through J9HookGetEventCount.
+ */
+static void
+testDumpInfoCount(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *failCount, J9HookInterface **hookInterface, uintptr_t event, uintptr_t expectedResult)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLib);
+	uintptr_t eventNum = event & J9HOOK_EVENT_NUM_MASK;
+	OMREventInfo4Dump *eventDump = J9HOOK_DUMPINFO((J9CommonHookInterface *)hookInterface, eventNum);
+
+	if (eventDump->count == expectedResult) {
+		(*passCount)++;
+	} else {
+		omrtty_printf("OMREventInfo4Dump count for 0x%zx is %zu, expected %zu\n", event, eventDump->count, expectedResult);
+		(*failCount)++;
+	}
+}
+
 static void
 testUnregister(OMRPortLibrary *portLib, uintptr_t *passCount, uintptr_t *failCount, J9HookInterface **hookInterface, uintptr_t event)
 {
@@ -369,3 +515,133 @@ hookOrderedEvent(J9HookInterface **hook, uintptr_t eventNum, void *voidEventData
 	}
 
 }
+
+static void
+hookBenchmarkEvent(J9HookInterface **hook, uintptr_t eventNum, void *voidEventData, void *userData)
+{
+	((TestHookEvent1 *)voidEventData)->count += 1;
+}
+
+static int J9THREAD_PROC
+dispatchBenchmarkThread(void *arg)
+{
+	DispatchBenchmarkData *data = (DispatchBenchmarkData *)arg;
+	uintptr_t i = 0;
+
+	for (i = 0; i < DISPATCH_BENCHMARK_ROUNDS; i++) {
+		uintptr_t count = 0;
+
+		/* dispatch even without listeners so that the cost of J9HookDispatch itself is measured */
+		ALWAYS_TRIGGER_TESTHOOK_EVENT1(benchmarkHookInterface, count, -1);
+		data->listenerCalls += count;
+	}
+	return 0;
+}
+
+/*
+ * Dispatch TESTHOOK_EVENT1 from threadCount threads and return the elapsed time in
+ * microseconds, or a negative value on failure.
+ */
+static int32_t
+runDispatchBenchmark(OMRPortLibrary *portLib, J9HookInterface **hookInterface, uintptr_t threadCount, uintptr_t listenerCount, uintptr_t collectDumpInfo)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLib);
+	DispatchBenchmarkData data[DISPATCH_BENCHMARK_MAX_THREADS];
+	omrthread_t threads[DISPATCH_BENCHMARK_MAX_THREADS];
+	uintptr_t countBefore = 0;
+	uintptr_t countAfter = 0;
+	uint64_t start = 0;
+	uint64_t elapsed = 0;
+	uintptr_t i = 0;
+	int32_t result = 0;
+
+	for (i = 0; i < listenerCount; i++) {
+		if (0 != (*hookInterface)->J9HookRegisterWithCallSite(hookInterface, TESTHOOK_EVENT1, hookBenchmarkEvent, OMR_GET_CALLSITE(), (void *)(i + 1))) {
+			return -1;
+		}
+	}
+	if (collectDumpInfo && (0 != (*hookInterface)->J9HookRegisterDumpConsumer(hookInterface))) {
+		return -1;
+	}
+	countBefore = (*hookInterface)->J9HookGetEventCount(hookInterface, TESTHOOK_EVENT1);
+
+	memset(data, 0, sizeof(data));
+	start = omrtime_hires_clock();
+	for (i = 0; i < threadCount; i++) {
+		omrthread_attr_t attr = NULL;
+
+		data[i].hookInterface = hookInterface;
+		if ((J9THREAD_SUCCESS != omrthread_attr_init(&attr))
+			|| (J9THREAD_SUCCESS != omrthread_attr_set_detachstate(&attr, J9THREAD_CREATE_JOINABLE))
+			|| (J9THREAD_SUCCESS != omrthread_create_ex(&threads[i], &attr, 0, dispatchBenchmarkThread, &data[i]))
+		) {
+			return -2;
+		}
+		omrthread_attr_destroy(&attr);
+	}
+	for (i = 0; i < threadCount; i++) {
+		if (J9THREAD_SUCCESS != omrthread_join(threads[i])) {
+			result = -2;
+		}
+		if (data[i].listenerCalls != (DISPATCH_BENCHMARK_ROUNDS * listenerCount)) {
+			omrtty_printf("dispatch benchmark: thread %zu saw %zu listener calls, expected %zu\n",
+					i, data[i].listenerCalls, (uintptr_t)DISPATCH_BENCHMARK_ROUNDS * listenerCount);
+			result = -3;
+		}
+	}
+	elapsed = omrtime_hires_delta(start, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+
+	countAfter = (*hookInterface)->J9HookGetEventCount(hookInterface, TESTHOOK_EVENT1);
+	if (collectDumpInfo) {
+		if ((countAfter - countBefore) != (DISPATCH_BENCHMARK_ROUNDS * listenerCount * threadCount)) {
+			omrtty_printf("dispatch benchmark: counted %zu listener calls, expected %zu\n",
+					countAfter - countBefore, (uintptr_t)DISPATCH_BENCHMARK_ROUNDS * listenerCount * threadCount);
+			result = -3;
+		}
+		(*hookInterface)->J9HookUnregisterDumpConsumer(hookInterface);
+	} else if (countAfter != countBefore) {
+		omrtty_printf("dispatch benchmark: listener calls counted without a dump consumer\n");
+		result = -3;
+	}
+
+	for (i = 0; i < listenerCount; i++) {
+		(*hookInterface)->J9HookUnregister(hookInterface, TESTHOOK_EVENT1, hookBenchmarkEvent, (void *)(i + 1));
+	}
+
+	if (0 == result) {
+		result = (int32_t)elapsed;
+	}
+	return result;
+}
+
+int32_t
+benchmarkHookDispatch(OMRPortLibrary *portLib, uintptr_t threadCount)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLib);
+	J9HookInterface **hookInterface = J9_HOOK_INTERFACE(benchmarkHookInterface);
+	const uintptr_t listenerCounts[] = { 0, 1, 4 };
+	uintptr_t i = 0;
+	int32_t rc = 0;
+
+	if (threadCount > DISPATCH_BENCHMARK_MAX_THREADS) {
+		return -1;
+	}
+	if (J9HookInitializeInterface(hookInterface, portLib, sizeof(benchmarkHookInterface))) {
+		return -1;
+	}
+
+	for (i = 0; i < sizeof(listenerCounts) / sizeof(listenerCounts[0]); i++) {
+		int32_t plainMicros = runDispatchBenchmark(portLib, hookInterface, threadCount, listenerCounts[i], FALSE);
+		int32_t dumpMicros = runDispatchBenchmark(portLib, hookInterface, threadCount, listenerCounts[i], TRUE);
+
+		if ((plainMicros < 0) || (dumpMicros < 0)) {
+			rc = -1;
+			break;
+		}
+		omrtty_printf("hook dispatch benchmark: threads=%zu listeners=%zu dispatches/thread=%d no dump consumer=%d us dump consumer=%d us\n",
+				threadCount, listenerCounts[i], DISPATCH_BENCHMARK_ROUNDS, plainMicros, dumpMicros);
+	}
+
+	(*hookInterface)->J9HookShutdownInterface(hookInterface);
+	return rc;
+}
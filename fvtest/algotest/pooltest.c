@@ -21,6 +21,7 @@
 
 #include <string.h>
 #include "omrport.h"
+#include "omrthread.h"
 #include "omrutil.h"
 #include "pool_api.h"
 #include "algorithm_test_internal.h"
@@ -33,6 +34,12 @@ static int32_t sharedPuddleListReferenceCount = 0;
 
 #define NUM_POOLS_TO_SHARE_PUDDLE_LIST 16
 
+#define THREAD_CACHE_MAX_THREADS 16
+#define THREAD_CACHE_ELEMENTS_HELD 100
+#define THREAD_CACHE_ROUNDS 50
+#define THREAD_CACHE_BENCHMARK_ROUNDS 20000
+#define THREAD_CACHE_BENCHMARK_BATCH 8
+
 #define FIRST_BYTE_MARKER 1
 #define BYTE_MARKER 2
 #define LAST_BYTE_MARKER 4
@@ -401,3 +408,233 @@ error:
 
 	return result;
 }
+
+typedef struct ThreadCacheElement {
+	uintptr_t owner;
+	uintptr_t index;
+	uint8_t payload[32];
+} ThreadCacheElement;
+
+typedef struct ThreadCacheTestData {
+	J9Pool *pool;
+	omrthread_monitor_t poolMutex;
+	uintptr_t threadIndex;
+	int32_t result;
+} ThreadCacheTestData;
+
+static int32_t
+runPoolThreads(ThreadCacheTestData *data, uintptr_t threadCount, omrthread_entrypoint_t entryPoint)
+{
+	omrthread_t threads[THREAD_CACHE_MAX_THREADS];
+	uintptr_t i = 0;
+	int32_t result = 0;
+
+	if (threadCount > THREAD_CACHE_MAX_THREADS) {
+		return -1;
+	}
+	for (i = 0; i < threadCount; i++) {
+		omrthread_attr_t attr = NULL;
+		if ((J9THREAD_SUCCESS != omrthread_attr_init(&attr))
+			|| (J9THREAD_SUCCESS != omrthread_attr_set_detachstate(&attr, J9THREAD_CREATE_JOINABLE))
+			|| (J9THREAD_SUCCESS != omrthread_create_ex(&threads[i], &attr, 0, entryPoint, &data[i]))
+		) {
+			return -2;
+		}
+		omrthread_attr_destroy(&attr);
+	}
+	for (i = 0; i < threadCount; i++) {
+		if (J9THREAD_SUCCESS != omrthread_join(threads[i])) {
+			result = -3;
+		}
+		if (0 != data[i].result) {
+			result = data[i].result;
+		}
+	}
+	return result;
+}
+
+/*
+ * Each thread keeps THREAD_CACHE_ELEMENTS_HELD elements stamped with its
+ * index, and repeatedly frees and reallocates half of them. A stamp changed
+ * by another thread means the same element was handed out twice.
+ */
+static int J9THREAD_PROC
+threadCacheStressThread(void *arg)
+{
+	ThreadCacheTestData *data = (ThreadCacheTestData *)arg;
+	ThreadCacheElement *held[THREAD_CACHE_ELEMENTS_HELD];
+	J9PoolThreadCache cache;
+	uintptr_t round = 0;
+	uintptr_t i = 0;
+
+	pool_threadCacheInit(data->pool, &cache);
+	memset(held, 0, sizeof(held));
+
+	for (round = 0; round < THREAD_CACHE_ROUNDS; round++) {
+		for (i = 0; i < THREAD_CACHE_ELEMENTS_HELD; i++) {
+			if (NULL == held[i]) {
+				ThreadCacheElement *element = (ThreadCacheElement *)pool_newElementCached(&cache);
+				if (NULL == element) {
+					data->result = -10;
+					goto done;
+				}
+				if ((0 != element->owner) || (0 != element->index) || (0 != element->payload[0])) {
+					data->result = -11;
+					goto done;
+				}
+				element->owner = data->threadIndex + 1;
+				element->index = i;
+				memset(element->payload, (int)i, sizeof(element->payload));
+				held[i] = element;
+			}
+		}
+		for (i = 0; i < THREAD_CACHE_ELEMENTS_HELD; i++) {
+			if ((held[i]->owner != (data->threadIndex + 1)) || (held[i]->index != i) || (held[i]->payload[31] != (uint8_t)i)) {
+				data->result = -12;
+				goto done;
+			}
+			if (((i + round) & 0x1) == 0) {
+				pool_removeElementCached(&cache, held[i]);
+				held[i] = NULL;
+			}
+		}
+	}
+
+done:
+	for (i = 0; i < THREAD_CACHE_ELEMENTS_HELD; i++) {
+		pool_removeElementCached(&cache, held[i]);
+	}
+	pool_threadCacheFlush(&cache);
+	return 0;
+}
+
+int32_t
+testPoolThreadCache(OMRPortLibrary *portLib, uintptr_t threadCount)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLib);
+	ThreadCacheTestData data[THREAD_CACHE_MAX_THREADS];
+	J9Pool *pool = NULL;
+	uintptr_t i = 0;
+	int32_t result = 0;
+
+	if (threadCount > THREAD_CACHE_MAX_THREADS) {
+		return -1;
+	}
+	pool = pool_new(sizeof(ThreadCacheElement), 0, 0, POOL_THREAD_CACHE, OMR_GET_CALLSITE(), OMRMEM_CATEGORY_VM, POOL_FOR_PORT(portLib));
+	if (NULL == pool) {
+		return -2;
+	}
+	memset(data, 0, sizeof(data));
+	for (i = 0; i < threadCount; i++) {
+		data[i].pool = pool;
+		data[i].threadIndex = i;
+	}
+	result = runPoolThreads(data, threadCount, threadCacheStressThread);
+	if ((0 == result) && (0 != pool_numElements(pool))) {
+		omrtty_printf("pool thread cache: %zu elements not returned\n", pool_numElements(pool));
+		result = -3;
+	}
+	pool_kill(pool);
+	return result;
+}
+
+static int J9THREAD_PROC
+threadCacheBenchmarkThread(void *arg)
+{
+	ThreadCacheTestData *data = (ThreadCacheTestData *)arg;
+	void *elements[THREAD_CACHE_BENCHMARK_BATCH];
+	J9PoolThreadCache cache;
+	uintptr_t round = 0;
+	uintptr_t i = 0;
+
+	pool_threadCacheInit(data->pool, &cache);
+	for (round = 0; round < THREAD_CACHE_BENCHMARK_ROUNDS; round++) {
+		for (i = 0; i < THREAD_CACHE_BENCHMARK_BATCH; i++) {
+			elements[i] = pool_newElementCached(&cache);
+		}
+		for (i = 0; i < THREAD_CACHE_BENCHMARK_BATCH; i++) {
+			pool_removeElementCached(&cache, elements[i]);
+		}
+	}
+	pool_threadCacheFlush(&cache);
+	return 0;
+}
+
+static int J9THREAD_PROC
+lockedPoolBenchmarkThread(void *arg)
+{
+	ThreadCacheTestData *data = (ThreadCacheTestData *)arg;
+	void *elements[THREAD_CACHE_BENCHMARK_BATCH];
+	uintptr_t round = 0;
+	uintptr_t i = 0;
+
+	for (round = 0; round < THREAD_CACHE_BENCHMARK_ROUNDS; round++) {
+		for (i = 0; i < THREAD_CACHE_BENCHMARK_BATCH; i++) {
+			omrthread_monitor_enter(data->poolMutex);
+			elements[i] = pool_newElement(data->pool);
+			omrthread_monitor_exit(data->poolMutex);
+		}
+		for (i = 0; i < THREAD_CACHE_BENCHMARK_BATCH; i++) {
+			omrthread_monitor_enter(data->poolMutex);
+			pool_removeElement(data->pool, elements[i]);
+			omrthread_monitor_exit(data->poolMutex);
+		}
+	}
+	return 0;
+}
+
+int32_t
+benchmarkPoolThreadCache(OMRPortLibrary *portLib, uintptr_t threadCount)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLib);
+	ThreadCacheTestData data[THREAD_CACHE_MAX_THREADS];
+	J9Pool *cachedPool = NULL;
+	J9Pool *lockedPool = NULL;
+	omrthread_monitor_t poolMutex = NULL;
+	uint64_t start = 0;
+	uint64_t cachedMillis = 0;
+	uint64_t lockedMillis = 0;
+	uintptr_t i = 0;
+	int32_t result = 0;
+
+	if (threadCount > THREAD_CACHE_MAX_THREADS) {
+		return -1;
+	}
+	cachedPool = pool_new(sizeof(ThreadCacheElement), 0, 0, POOL_THREAD_CACHE, OMR_GET_CALLSITE(), OMRMEM_CATEGORY_VM, POOL_FOR_PORT(portLib));
+	lockedPool = pool_new(sizeof(ThreadCacheElement), 0, 0, 0, OMR_GET_CALLSITE(), OMRMEM_CATEGORY_VM, POOL_FOR_PORT(portLib));
+	if ((NULL == cachedPool) || (NULL == lockedPool) || (0 != omrthread_monitor_init_with_name(&poolMutex, 0, "pool benchmark"))) {
+		result = -2;
+		goto done;
+	}
+
+	memset(data, 0, sizeof(data));
+	for (i = 0; i < threadCount; i++) {
+		data[i].pool = cachedPool;
+		data[i].threadIndex = i;
+	}
+	start = omrtime_current_time_millis();
+	result = runPoolThreads(data, threadCount, threadCacheBenchmarkThread);
+	cachedMillis = omrtime_current_time_millis() - start;
+	if (0 != result) {
+		goto done;
+	}
+
+	for (i = 0; i < threadCount; i++) {
+		data[i].pool = lockedPool;
+		data[i].poolMutex = poolMutex;
+	}
+	start = omrtime_current_time_millis();
+	result = runPoolThreads(data, threadCount, lockedPoolBenchmarkThread);
+	lockedMillis = omrtime_current_time_millis() - start;
+
+	omrtty_printf("pool benchmark: threads=%zu allocations/thread=%d thread cache=%llu ms monitor=%llu ms\n",
+			threadCount, THREAD_CACHE_BENCHMARK_ROUNDS * THREAD_CACHE_BENCHMARK_BATCH, cachedMillis, lockedMillis);
+
+done:
+	if (NULL != poolMutex) {
+		omrthread_monitor_destroy(poolMutex);
+	}
+	pool_kill(cachedPool);
+	pool_kill(lockedPool);
+	return result;
+}
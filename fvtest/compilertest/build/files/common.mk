@@ -173,6 +173,7 @@ JIT_PRODUCT_BACKEND_SOURCES+=\
     $(JIT_OMR_DIRTY_DIR)/optimizer/VirtualGuardHeadMerger.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/RegDepCopyRemoval.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/ReorderIndexExpr.cpp \
+    $(JIT_OMR_DIRTY_DIR)/optimizer/ScalarReplacement.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/SinkStores.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/StripMiner.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/VPConstraint.cpp \
@@ -231,6 +232,8 @@ JIT_PRODUCT_SOURCE_FILES+=\
     $(JIT_PRODUCT_DIR)/tests/injectors/Qux2IlInjector.cpp \
     $(JIT_PRODUCT_DIR)/tests/BuilderTest.cpp \
     $(JIT_PRODUCT_DIR)/tests/FooBarTest.cpp \
+    $(JIT_PRODUCT_DIR)/tests/JitBuilderReplayTest.cpp \
+    $(JIT_PRODUCT_DIR)/tests/TraceCompilationTest.cpp \
     $(JIT_PRODUCT_DIR)/tests/LimitFileTest.cpp \
     $(JIT_PRODUCT_DIR)/tests/LogFileTest.cpp \
     $(JIT_PRODUCT_DIR)/tests/OMRTestEnv.cpp \
@@ -266,7 +269,9 @@ JIT_PRODUCT_SOURCE_FILES+=\
     $(JIT_OMR_DIRTY_DIR)/ilgen/OMRJitBuilderRecorderBinaryFile.cpp \
     $(JIT_OMR_DIRTY_DIR)/ilgen/OMRJitBuilderRecorderTextFile.cpp \
     $(JIT_OMR_DIRTY_DIR)/ilgen/OMRMethodBuilder.cpp \
+    $(JIT_OMR_DIRTY_DIR)/ilgen/OMRMethodBuilderReplay.cpp \
     $(JIT_OMR_DIRTY_DIR)/ilgen/OMRThunkBuilder.cpp \
+    $(JIT_OMR_DIRTY_DIR)/ilgen/OMRTraceRecorder.cpp \
     $(JIT_OMR_DIRTY_DIR)/ilgen/OMRTypeDictionary.cpp \
     $(JIT_OMR_DIRTY_DIR)/ilgen/OMRVirtualMachineOperandArray.cpp \
     $(JIT_OMR_DIRTY_DIR)/ilgen/OMRVirtualMachineOperandStack.cpp \
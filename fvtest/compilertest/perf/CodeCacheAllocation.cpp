@@ -0,0 +1,291 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/*
+ * codecachealloc measures how fast concurrent compilation threads allocate
+ * method bodies from the code cache, with and without thread regions.
+ *
+ * Every thread reserves a code cache, allocates a number of small warm-only
+ * method bodies from it the way a compilation would and releases the
+ * reservation, over and over. The same run is timed once with thread regions
+ * disabled and once with the size set through the codeCacheThreadRegionKB JIT
+ * option; the best of --repeat runs is reported for both.
+ *
+ * Every run also checks that all allocations succeeded and that no two blocks
+ * overlap, and the exit status reports any failure.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include "control/SimpleJit.hpp"
+#include "omrthread.h"
+#include "runtime/CodeCache.hpp"
+#include "runtime/CodeCacheManager.hpp"
+
+namespace
+{
+
+struct Options
+   {
+   Options() : threads(4), compilations(32), allocations(16), size(200), threadRegionKB(16), repeat(5) {}
+
+   int32_t threads;
+   int32_t compilations; // reservations per thread
+   int32_t allocations;  // method bodies allocated per reservation
+   int32_t size;
+   int32_t threadRegionKB;
+   int32_t repeat;
+   };
+
+struct CompThreadData
+   {
+   const Options *options;
+   int32_t compThreadID;
+   int32_t failures;
+   std::vector<uint8_t *> blocks;
+   };
+
+/* One compilation thread: reserve, allocate a few method bodies, unreserve. */
+int J9THREAD_PROC
+compThread(void *arg)
+   {
+   CompThreadData *data = static_cast<CompThreadData *>(arg);
+   const Options &options = *data->options;
+   TR::CodeCacheManager *manager = TR::CodeCacheManager::instance();
+   size_t sizeEstimate = (size_t)options.allocations * (options.size + 64);
+
+   for (int32_t c = 0; c < options.compilations; c++)
+      {
+      int32_t numReserved = 0;
+      TR::CodeCache *codeCache = manager->reserveCodeCache(false, sizeEstimate, data->compThreadID, &numReserved,
+         TR::CodeCacheKind::DEFAULT_CC);
+      if (codeCache == NULL)
+         {
+         data->failures++;
+         return 0;
+         }
+
+      for (int32_t i = 0; i < options.allocations; i++)
+         {
+         uint8_t *coldCode = NULL;
+         uint8_t *warmCode = manager->allocateCodeMemory(options.size, 0, &codeCache, &coldCode, false);
+         if (warmCode == NULL)
+            {
+            data->failures++;
+            break;
+            }
+         data->blocks.push_back(warmCode);
+         }
+
+      if (codeCache != NULL)
+         manager->unreserveCodeCache(codeCache);
+      }
+   return 0;
+   }
+
+/*
+ * Runs all compilation threads once and returns the elapsed time in
+ * microseconds, or -1 if any allocation failed or two blocks overlap.
+ */
+int64_t
+runOnce(const Options &options)
+   {
+   std::vector<CompThreadData> data(options.threads);
+   std::vector<omrthread_t> threads(options.threads);
+
+   std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+   for (int32_t t = 0; t < options.threads; t++)
+      {
+      omrthread_attr_t attr = NULL;
+      data[t].options = &options;
+      data[t].compThreadID = t;
+      data[t].failures = 0;
+      if (omrthread_attr_init(&attr) != J9THREAD_SUCCESS
+         || omrthread_attr_set_detachstate(&attr, J9THREAD_CREATE_JOINABLE) != J9THREAD_SUCCESS
+         || omrthread_create_ex(&threads[t], &attr, 0, compThread, &data[t]) != J9THREAD_SUCCESS)
+         {
+         fprintf(stderr, "FAIL: could not start compilation thread %d\n", t);
+         return -1;
+         }
+      omrthread_attr_destroy(&attr);
+      }
+   for (int32_t t = 0; t < options.threads; t++)
+      omrthread_join(threads[t]);
+   std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+   std::vector<uint8_t *> blocks;
+   for (int32_t t = 0; t < options.threads; t++)
+      {
+      if (data[t].failures != 0)
+         {
+         printf("FAIL: compilation thread %d ran out of code cache\n", t);
+         return -1;
+         }
+      blocks.insert(blocks.end(), data[t].blocks.begin(), data[t].blocks.end());
+      }
+
+   std::sort(blocks.begin(), blocks.end());
+   for (size_t i = 1; i < blocks.size(); i++)
+      {
+      if ((size_t)(blocks[i] - blocks[i - 1]) < (size_t)options.size)
+         {
+         printf("FAIL: code blocks overlap at %p\n", (void *)blocks[i]);
+         return -1;
+         }
+      }
+
+   return std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+   }
+
+/* Best time of options.repeat runs with the given thread region size, or -1 on failure. */
+int64_t
+bestOf(const Options &options, size_t threadRegionKB)
+   {
+   TR::CodeCacheConfig &config = TR::CodeCacheManager::instance()->codeCacheConfig();
+   size_t savedThreadRegionKB = config._codeCacheThreadRegionKB;
+   config._codeCacheThreadRegionKB = threadRegionKB;
+
+   int64_t best = -1;
+   for (int32_t r = 0; r < options.repeat; r++)
+      {
+      int64_t micros = runOnce(options);
+      if (micros < 0)
+         {
+         best = -1;
+         break;
+         }
+      if (best < 0 || micros < best)
+         best = micros;
+      }
+
+   config._codeCacheThreadRegionKB = savedThreadRegionKB;
+   return best;
+   }
+
+bool
+parseOptions(int argc, char **argv, Options &options)
+   {
+   for (int i = 1; i < argc; i++)
+      {
+      const char *arg = argv[i];
+      if (strcmp(arg, "--help") == 0 || i + 1 >= argc)
+         return false;
+
+      int32_t value = atoi(argv[++i]);
+      if (strcmp(arg, "--threads") == 0)
+         options.threads = value;
+      else if (strcmp(arg, "--compilations") == 0)
+         options.compilations = value;
+      else if (strcmp(arg, "--allocations") == 0)
+         options.allocations = value;
+      else if (strcmp(arg, "--size") == 0)
+         options.size = value;
+      else if (strcmp(arg, "--region-kb") == 0)
+         options.threadRegionKB = value;
+      else if (strcmp(arg, "--repeat") == 0)
+         options.repeat = value;
+      else
+         return false;
+      }
+   return options.threads > 0 && options.compilations > 0 && options.allocations > 0 && options.size > 0
+      && options.threadRegionKB > 0 && options.repeat > 0;
+   }
+
+void
+printUsage(const char *program)
+   {
+   fprintf(stderr,
+      "usage: %s [options]\n"
+      "  --threads <n>          concurrent compilation threads (default 4)\n"
+      "  --compilations <n>     code cache reservations per thread (default 32)\n"
+      "  --allocations <n>      method bodies allocated per reservation (default 16)\n"
+      "  --size <bytes>         size of every method body (default 200)\n"
+      "  --region-kb <n>        thread region size passed as codeCacheThreadRegionKB (default 16)\n"
+      "  --repeat <n>           runs per configuration; the best time is reported (default 5)\n",
+      program);
+   }
+
+} // namespace
+
+int
+main(int argc, char **argv)
+   {
+   Options options;
+   if (!parseOptions(argc, argv, options))
+      {
+      printUsage(argv[0]);
+      return 2;
+      }
+
+   // nothing is ever freed, so the defaults stay well within the 16 MB of code cache SimpleJit sets up
+   std::string jitOptions = "-Xjit:codeCacheThreadRegionKB=" + std::to_string(options.threadRegionKB);
+   if (!initializeSimpleJitWithOptions(const_cast<char *>(jitOptions.c_str())))
+      {
+      fprintf(stderr, "FAIL: could not initialize JIT with %s\n", jitOptions.c_str());
+      return 2;
+      }
+
+   omrthread_t self = NULL;
+   if (omrthread_init_library() != 0 || omrthread_attach_ex(&self, J9THREAD_ATTR_DEFAULT) != J9THREAD_SUCCESS)
+      {
+      fprintf(stderr, "FAIL: could not attach to the thread library\n");
+      return 2;
+      }
+
+   int32_t failures = 0;
+   size_t configuredKB = TR::CodeCacheManager::instance()->codeCacheConfig().codeCacheThreadRegionKB();
+   if (configuredKB != (size_t)options.threadRegionKB)
+      {
+      printf("FAIL: %s set a %zu KB thread region\n", jitOptions.c_str(), configuredKB);
+      failures++;
+      }
+
+   int64_t allocationsPerRun = (int64_t)options.threads * options.compilations * options.allocations;
+   printf("%d threads x %d compilations x %d allocations of %d bytes, best of %d\n", options.threads,
+      options.compilations, options.allocations, options.size, options.repeat);
+   printf("%-10s %12s %12s\n", "regionKB", "elapsed(us)", "ns/alloc");
+
+   int64_t baseline = bestOf(options, 0);
+   int64_t withRegions = bestOf(options, configuredKB);
+   if (baseline < 0 || withRegions < 0)
+      failures++;
+   else
+      {
+      printf("%-10d %12lld %12.1f\n", 0, (long long)baseline, baseline * 1000.0 / allocationsPerRun);
+      printf("%-10zu %12lld %12.1f\n", configuredKB, (long long)withRegions, withRegions * 1000.0 / allocationsPerRun);
+      printf("speedup with thread regions: %.2fx\n", (double)baseline / std::max<int64_t>(withRegions, 1));
+      }
+
+   omrthread_detach(self);
+   shutdownSimpleJit();
+
+   if (failures > 0)
+      {
+      printf("FAIL\n");
+      return 1;
+      }
+   return 0;
+   }
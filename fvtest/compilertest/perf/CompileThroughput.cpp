@@ -0,0 +1,515 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/*
+ * compilethroughput measures how fast the compiler itself is.
+ *
+ * It generates large synthetic methods with MethodBuilder and compiles every
+ * one of them at every requested optimization level, reporting for each
+ * compilation its total time, peak scratch memory, the number of IL nodes
+ * created and the scratch memory they occupy, and the time spent in its most
+ * expensive phases. The shapes stress
+ * different parts of the compiler:
+ *
+ *   blocks  a long chain of if-then-else diamonds
+ *   loops   a deep nest of counted loops
+ *   switch  a lookup switch with thousands of cases
+ *   temps   thousands of locals that stay live across a loop
+ *   mixed   a bit of everything
+ *
+ * --scale shrinks or grows every shape, which makes it easy to see how a pass
+ * scales with method size. Every compiled method is also run once and checked
+ * against a C++ implementation of the same shape.
+ */
+
+#include <algorithm>
+#include <map>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include "compile/CompilationTypes.hpp"
+#include "control/CompilationStatistics.hpp"
+#include "control/SimpleJit.hpp"
+#include "ilgen/MethodBuilder.hpp"
+#include "ilgen/TypeDictionary.hpp"
+
+namespace
+{
+
+struct MethodShape
+   {
+   const char *name;
+   int32_t diamonds;     // if-then-else diamonds in the innermost loop body
+   int32_t loopDepth;    // counted loops nested around the body
+   int32_t switchCases;  // cases of a lookup switch at the end of the body, or 0
+   int32_t temps;        // Int64 locals that stay live across the whole method
+   };
+
+const MethodShape SHAPES[] =
+   {
+   { "blocks", 2000,  1,    0,   16 },
+   { "loops",    32, 12,    0,   32 },
+   { "switch",    4,  1, 2000,   16 },
+   { "temps",    64,  1,    0, 3000 },
+   { "mixed",   300,  4,  256,  500 },
+   };
+
+struct OptLevel
+   {
+   const char *name;
+   TR_Hotness hotness;
+   };
+
+// the optimizer has no strategies beyond warm
+const OptLevel OPT_LEVELS[] =
+   {
+   { "noOpt", noOpt },
+   { "cold", cold },
+   { "warm", warm },
+   };
+
+// all shapes run their loops this many times when checked
+const int32_t TRIP_COUNT = 2;
+
+int32_t
+scaled(int32_t size, double scale)
+   {
+   return size == 0 ? 0 : std::max(1, (int32_t)(size * scale));
+   }
+
+MethodShape
+scaleShape(const MethodShape &shape, double scale)
+   {
+   MethodShape s = shape;
+   s.diamonds = scaled(shape.diamonds, scale);
+   s.switchCases = scaled(shape.switchCases, scale);
+   s.temps = scaled(shape.temps, scale);
+   return s;
+   }
+
+/* the switch selector keeps enough bits of acc to reach every case value */
+int64_t
+selectorMask(int32_t switchCases)
+   {
+   int64_t mask = 1;
+   while (mask < 3 * (int64_t)switchCases)
+      mask <<= 1;
+   return mask - 1;
+   }
+
+typedef int64_t (SyntheticFunction)(int64_t, int32_t);
+
+class SyntheticMethod : public TR::MethodBuilder
+   {
+   public:
+   SyntheticMethod(TR::TypeDictionary *types, const MethodShape &shape)
+      : TR::MethodBuilder(types),
+        _shape(shape)
+      {
+      DefineLine(LINETOSTR(__LINE__));
+      DefineFile(__FILE__);
+
+      DefineName(shape.name);
+      DefineParameter("x", Int64);
+      DefineParameter("trips", Int32);
+      DefineReturnType(Int64);
+
+      // MethodBuilder keeps the name pointers, so they must outlive every compilation
+      char name[32];
+      for (int32_t t = 0; t < shape.temps; t++)
+         {
+         snprintf(name, sizeof(name), "t%d", t);
+         _tempNames.push_back(name);
+         }
+      for (int32_t d = 0; d < shape.loopDepth; d++)
+         {
+         snprintf(name, sizeof(name), "i%d", d);
+         _loopNames.push_back(name);
+         }
+
+      DefineLocal("acc", Int64);
+      for (int32_t t = 0; t < shape.temps; t++)
+         DefineLocal(temp(t), Int64);
+      }
+
+   virtual bool buildIL()
+      {
+      Store("acc", Load("x"));
+      for (int32_t t = 0; t < _shape.temps; t++)
+         Store(temp(t), Add(Load("x"), ConstInt64(t)));
+
+      TR::IlBuilder *body = this;
+      for (int32_t d = 0; d < _shape.loopDepth; d++)
+         {
+         TR::IlBuilder *loop = NULL;
+         body->ForLoopUp(_loopNames[d].c_str(), &loop, body->ConstInt32(0), body->Load("trips"), body->ConstInt32(1));
+         body = loop;
+         }
+      buildBody(body);
+
+      TR::IlValue *result = Load("acc");
+      for (int32_t t = 0; t < _shape.temps; t++)
+         result = Add(result, Load(temp(t)));
+      Return(result);
+      return true;
+      }
+
+   private:
+   const char *temp(int32_t t) { return _tempNames[t].c_str(); }
+
+   void buildBody(TR::IlBuilder *b)
+      {
+      for (int32_t k = 0; k < _shape.diamonds; k++)
+         {
+         const char *t = temp(k % _shape.temps);
+         TR::IlBuilder *thenPath = NULL;
+         TR::IlBuilder *elsePath = NULL;
+         b->IfThenElse(&thenPath, &elsePath,
+            b->NotEqualTo(b->And(b->Load("acc"), b->ConstInt64((int64_t)1 << (k % 63))), b->ConstInt64(0)));
+         thenPath->Store(t, thenPath->Add(thenPath->Load(t), thenPath->Load("acc")));
+         elsePath->Store("acc", elsePath->Xor(elsePath->Load("acc"), elsePath->Load(t)));
+         }
+
+      // temps no diamond touched still change on every iteration
+      for (int32_t t = _shape.diamonds; t < _shape.temps; t++)
+         b->Store(temp(t), b->Add(b->Load(temp(t)), b->Load("acc")));
+
+      if (_shape.switchCases > 0)
+         {
+         // sparse case values make this a lookup switch rather than a table
+         std::vector<TR::IlBuilder::JBCase *> cases(_shape.switchCases);
+         for (int32_t c = 0; c < _shape.switchCases; c++)
+            {
+            TR::IlBuilder *caseBuilder = NULL;
+            cases[c] = b->MakeCase(3 * c, &caseBuilder, 0);
+            caseBuilder->Store("acc", caseBuilder->Add(caseBuilder->Load("acc"), caseBuilder->ConstInt64(7 * c + 1)));
+            }
+         TR::IlBuilder *defaultBuilder = NULL;
+         b->Switch(b->ConvertTo(Int32, b->And(b->Load("acc"), b->ConstInt64(selectorMask(_shape.switchCases)))),
+            &defaultBuilder, _shape.switchCases, &cases[0]);
+         defaultBuilder->Store("acc", defaultBuilder->Sub(defaultBuilder->Load("acc"), defaultBuilder->ConstInt64(1)));
+         }
+      }
+
+   MethodShape _shape;
+   std::vector<std::string> _tempNames;
+   std::vector<std::string> _loopNames;
+   };
+
+/* what SyntheticMethod computes, with the wrapping arithmetic of the compiled code */
+class Reference
+   {
+   public:
+   Reference(const MethodShape &shape, int64_t x, int32_t trips)
+      : _shape(shape), _trips(trips), _acc(x), _temps(shape.temps)
+      {
+      for (int32_t t = 0; t < shape.temps; t++)
+         _temps[t] = (uint64_t)x + t;
+      }
+
+   int64_t run()
+      {
+      loop(0);
+      uint64_t result = _acc;
+      for (int32_t t = 0; t < _shape.temps; t++)
+         result += _temps[t];
+      return (int64_t)result;
+      }
+
+   private:
+   void loop(int32_t depth)
+      {
+      if (depth == _shape.loopDepth)
+         {
+         body();
+         return;
+         }
+      for (int32_t i = 0; i < _trips; i++)
+         loop(depth + 1);
+      }
+
+   void body()
+      {
+      for (int32_t k = 0; k < _shape.diamonds; k++)
+         {
+         uint64_t &t = _temps[k % _shape.temps];
+         if ((_acc & ((uint64_t)1 << (k % 63))) != 0)
+            t += _acc;
+         else
+            _acc ^= t;
+         }
+      for (int32_t t = _shape.diamonds; t < _shape.temps; t++)
+         _temps[t] += _acc;
+      if (_shape.switchCases > 0)
+         {
+         int32_t selector = (int32_t)(_acc & selectorMask(_shape.switchCases));
+         if (selector % 3 == 0 && selector / 3 < _shape.switchCases)
+            _acc += 7 * (selector / 3) + 1;
+         else
+            _acc -= 1;
+         }
+      }
+
+   const MethodShape &_shape;
+   int32_t _trips;
+   uint64_t _acc;
+   std::vector<uint64_t> _temps;
+   };
+
+/* sums the phase times of the compilations of one method at one level */
+class PhaseTotals : public TR::CompilationStatistics
+   {
+   public:
+   struct Phase
+      {
+      Phase() : micros(0), count(0), depth(0) {}
+      uint64_t micros;
+      uint32_t count;
+      uint32_t depth;
+      };
+
+   virtual void recordPhase(const char *name, uint32_t depth, uint64_t micros, uint32_t count)
+      {
+      Phase &phase = _phases[phaseName(name)];
+      phase.micros += micros;
+      phase.count += count;
+      phase.depth = depth;
+      }
+
+   /* phases ordered by total time, most expensive first */
+   std::vector<std::pair<std::string, Phase> > sortedPhases() const
+      {
+      std::vector<std::pair<std::string, Phase> > sorted(_phases.begin(), _phases.end());
+      std::sort(sorted.begin(), sorted.end(), byTime);
+      return sorted;
+      }
+
+   uint64_t phaseMicros(const char *name) const
+      {
+      std::map<std::string, Phase>::const_iterator it = _phases.find(name);
+      return it == _phases.end() ? 0 : it->second.micros;
+      }
+
+   private:
+   static bool byTime(const std::pair<std::string, Phase> &a, const std::pair<std::string, Phase> &b)
+      {
+      return a.second.micros > b.second.micros;
+      }
+
+   /* phases such as "optimize <signature>" carry the method signature, which only adds noise here */
+   static std::string phaseName(const char *name)
+      {
+      const char *space = strchr(name, ' ');
+      if (space != NULL && strchr(space, ':') != NULL)
+         return std::string(name, space - name);
+      return name;
+      }
+
+   std::map<std::string, Phase> _phases;
+   };
+
+struct Options
+   {
+   Options()
+      : jitOptions(NULL), shapes(NULL), levels(NULL), scale(1.0), repeat(1), phases(8), csv(false)
+      {}
+
+   const char *jitOptions;
+   const char *shapes;
+   const char *levels;
+   double scale;
+   int32_t repeat;
+   int32_t phases;
+   bool csv;
+   };
+
+/* true if name is one of the comma separated entries of list, or list is NULL */
+bool
+selected(const char *list, const char *name)
+   {
+   if (list == NULL)
+      return true;
+   size_t length = strlen(name);
+   for (const char *entry = list; entry != NULL; entry = strchr(entry, ','))
+      {
+      if (*entry == ',')
+         entry++;
+      if (strncmp(entry, name, length) == 0 && (entry[length] == ',' || entry[length] == '\0'))
+         return true;
+      }
+   return false;
+   }
+
+bool
+parseOptions(int argc, char **argv, Options &options)
+   {
+   for (int i = 1; i < argc; i++)
+      {
+      const char *arg = argv[i];
+      if (strcmp(arg, "--csv") == 0)
+         {
+         options.csv = true;
+         continue;
+         }
+      if (strcmp(arg, "--help") == 0 || i + 1 >= argc)
+         return false;
+
+      const char *value = argv[++i];
+      if (strcmp(arg, "--jit-options") == 0)
+         options.jitOptions = value;
+      else if (strcmp(arg, "--shapes") == 0)
+         options.shapes = value;
+      else if (strcmp(arg, "--levels") == 0)
+         options.levels = value;
+      else if (strcmp(arg, "--scale") == 0)
+         options.scale = atof(value);
+      else if (strcmp(arg, "--repeat") == 0)
+         options.repeat = atoi(value);
+      else if (strcmp(arg, "--phases") == 0)
+         options.phases = atoi(value);
+      else
+         return false;
+      }
+   return options.scale > 0 && options.repeat > 0 && options.phases >= 0;
+   }
+
+void
+printUsage(const char *program)
+   {
+   fprintf(stderr,
+      "usage: %s [options]\n"
+      "  --shapes <list>        comma separated shapes to compile: blocks,loops,switch,temps,mixed (default all)\n"
+      "  --levels <list>        comma separated levels: noOpt,cold,warm (default all)\n"
+      "  --scale <factor>       multiplies the size of every shape (default 1.0)\n"
+      "  --repeat <n>           compilations per shape and level; times are averaged (default 1)\n"
+      "  --phases <n>           most expensive phases to list per compilation (default 8)\n"
+      "  --csv                  print every phase of every compilation as CSV instead\n"
+      "  --jit-options <opts>   extra JIT options, appended to -Xjit:timing\n",
+      program);
+   }
+
+} // namespace
+
+int
+main(int argc, char **argv)
+   {
+   Options options;
+   if (!parseOptions(argc, argv, options))
+      {
+      printUsage(argv[0]);
+      return 2;
+      }
+
+   // phase times are only collected with the timing option, and the larger
+   // shapes exceed the block limit beyond which optimization normally gives up
+   std::string jitOptions("-Xjit:timing,acceptHugeMethods");
+   if (options.jitOptions != NULL)
+      jitOptions = jitOptions + "," + options.jitOptions;
+   if (!initializeSimpleJitWithOptions(const_cast<char *>(jitOptions.c_str())))
+      {
+      fprintf(stderr, "FAIL: could not initialize JIT with %s\n", jitOptions.c_str());
+      return 2;
+      }
+
+   if (options.csv)
+      printf("shape,level,phase,depth,micros,count\n");
+   else
+      printf("%-8s %-10s %12s %12s %12s %10s %12s\n", "shape", "level", "compile(ms)", "ilgen(ms)", "scratch(KB)", "nodes",
+         "nodeMem(KB)");
+
+   int32_t failures = 0;
+   for (size_t s = 0; s < sizeof(SHAPES) / sizeof(SHAPES[0]); s++)
+      {
+      if (!selected(options.shapes, SHAPES[s].name))
+         continue;
+      MethodShape shape = scaleShape(SHAPES[s], options.scale);
+      int64_t expected = Reference(shape, 1, TRIP_COUNT).run();
+
+      for (size_t l = 0; l < sizeof(OPT_LEVELS) / sizeof(OPT_LEVELS[0]); l++)
+         {
+         const OptLevel &level = OPT_LEVELS[l];
+         if (!selected(options.levels, level.name))
+            continue;
+
+         PhaseTotals totals;
+         uint64_t compileMicros = 0;
+         int32_t rc = 0;
+         void *entry = NULL;
+         for (int32_t r = 0; r < options.repeat && rc == 0; r++)
+            {
+            TR::TypeDictionary types;
+            SyntheticMethod method(&types, shape);
+            rc = method.Compile(&entry, level.hotness, &totals);
+            compileMicros += totals.compileMicros;
+            }
+
+         if (rc != 0)
+            {
+            printf("%-8s %-10s FAILED to compile, rc=%d\n", shape.name, level.name, rc);
+            failures++;
+            continue;
+            }
+
+         int64_t result = ((SyntheticFunction *)entry)(1, TRIP_COUNT);
+         if (result != expected)
+            {
+            printf("%-8s %-10s FAILED, returned %lld, expected %lld\n", shape.name, level.name, (long long)result,
+               (long long)expected);
+            failures++;
+            }
+
+         std::vector<std::pair<std::string, PhaseTotals::Phase> > phases = totals.sortedPhases();
+         if (options.csv)
+            {
+            for (size_t p = 0; p < phases.size(); p++)
+               printf("%s,%s,\"%s\",%u,%.1f,%.1f\n", shape.name, level.name, phases[p].first.c_str(),
+                  phases[p].second.depth, (double)phases[p].second.micros / options.repeat,
+                  (double)phases[p].second.count / options.repeat);
+            continue;
+            }
+
+         printf("%-8s %-10s %12.2f %12.2f %12zu %10u %12zu\n", shape.name, level.name,
+            compileMicros / 1000.0 / options.repeat, totals.phaseMicros("ilgen") / 1000.0 / options.repeat,
+            totals.scratchBytesAllocated / 1024, totals.nodesAllocated, totals.nodeBytesAllocated / 1024);
+         int32_t listed = 0;
+         for (size_t p = 0; p < phases.size() && listed < options.phases; p++)
+            {
+            // the enclosing compile and optimize meters would just repeat the total
+            if (phases[p].second.depth <= 2 && phases[p].first != "ilgen")
+               continue;
+            printf("    %-44s %10.2f ms %6u\n", phases[p].first.c_str(),
+               phases[p].second.micros / 1000.0 / options.repeat, phases[p].second.count / options.repeat);
+            listed++;
+            }
+         }
+      }
+
+   shutdownSimpleJit();
+
+   if (failures > 0)
+      {
+      printf("FAIL: %d compilation(s) failed\n", failures);
+      return 1;
+      }
+   return 0;
+   }
@@ -0,0 +1,531 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2000
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include <chrono>
+#include <stdio.h>
+#include <vector>
+#include "gtest/gtest.h"
+#include "ilgen/JitBuilderRecorderBinaryBuffer.hpp"
+#include "ilgen/MethodBuilder.hpp"
+#include "ilgen/MethodBuilderReplay.hpp"
+#include "ilgen/TypeDictionary.hpp"
+#include "tests/TestDriver.hpp"
+
+namespace
+{
+
+typedef int32_t (SumFunctionType)(int32_t);
+typedef int32_t (ArrayMaxFunctionType)(int32_t *, int32_t);
+typedef int64_t (ClampFunctionType)(int32_t);
+typedef int32_t (RemainderFunctionType)(int32_t, int32_t);
+typedef int32_t (LoadCounterFunctionType)();
+
+const int32_t NUM_TIMING_COMPILATIONS = 20;
+
+class SumMethod : public TR::MethodBuilder
+   {
+   public:
+   SumMethod(TR::TypeDictionary *types)
+      : TR::MethodBuilder(types)
+      {
+      DefineLine(LINETOSTR(__LINE__));
+      DefineFile(__FILE__);
+
+      DefineName("replaySum");
+      DefineParameter("n", Int32);
+      DefineReturnType(Int32);
+      }
+
+   virtual bool buildIL()
+      {
+      Store("sum",
+         ConstInt32(0));
+
+      TR::IlBuilder *body = NULL;
+      ForLoopUp("i", &body,
+         ConstInt32(0),
+         Load("n"),
+         ConstInt32(1));
+
+      body->Store("sum",
+      body->   Add(
+      body->      Load("sum"),
+      body->      Load("i")));
+
+      Return(
+         Load("sum"));
+
+      return true;
+      }
+   };
+
+class ArrayMaxMethod : public TR::MethodBuilder
+   {
+   public:
+   ArrayMaxMethod(TR::TypeDictionary *types)
+      : TR::MethodBuilder(types)
+      {
+      DefineLine(LINETOSTR(__LINE__));
+      DefineFile(__FILE__);
+
+      DefineName("replayArrayMax");
+      DefineParameter("array", types->PointerTo(Int32));
+      DefineParameter("length", Int32);
+      DefineReturnType(Int32);
+      }
+
+   virtual bool buildIL()
+      {
+      TR::IlType *pInt32 = typeDictionary()->PointerTo(Int32);
+
+      Store("max",
+         LoadAt(pInt32,
+            IndexAt(pInt32,
+               Load("array"),
+               ConstInt32(0))));
+      Store("i",
+         ConstInt32(1));
+      Store("keepGoing",
+         LessThan(
+            Load("i"),
+            Load("length")));
+
+      TR::IlBuilder *body = NULL;
+      WhileDoLoop("keepGoing", &body);
+
+      body->Store("x",
+      body->   LoadAt(pInt32,
+      body->      IndexAt(pInt32,
+      body->         Load("array"),
+      body->         Load("i"))));
+
+      TR::IlBuilder *larger = NULL;
+      body->IfThen(&larger,
+      body->   GreaterThan(
+      body->      Load("x"),
+      body->      Load("max")));
+      larger->Store("max",
+      larger->   Load("x"));
+
+      body->Store("i",
+      body->   Add(
+      body->      Load("i"),
+      body->      ConstInt32(1)));
+      body->Store("keepGoing",
+      body->   LessThan(
+      body->      Load("i"),
+      body->      Load("length")));
+
+      Return(
+         Load("max"));
+
+      return true;
+      }
+   };
+
+int32_t
+replayDouble(int32_t value)
+   {
+   return 2 * value;
+   }
+
+class ClampMethod : public TR::MethodBuilder
+   {
+   public:
+   ClampMethod(TR::TypeDictionary *types)
+      : TR::MethodBuilder(types)
+      {
+      DefineLine(LINETOSTR(__LINE__));
+      DefineFile(__FILE__);
+
+      DefineName("replayClamp");
+      DefineParameter("value", Int32);
+      DefineReturnType(Int64);
+      DefineFunction("replayDouble", __FILE__, LINETOSTR(__LINE__), (void *)&replayDouble, Int32, 1, Int32);
+      }
+
+   virtual bool buildIL()
+      {
+      TR::IlValue *doubled = ConvertTo(Int64,
+         Call("replayDouble", 1,
+            Load("value")));
+
+      TR::IlBuilder *negative = NULL;
+      IfCmpLessThan(&negative,
+         doubled,
+         ConstInt64(0));
+
+      Return(
+         Select(
+            GreaterThan(
+               doubled,
+               ConstInt64(100)),
+            ConstInt64(100),
+            doubled));
+
+      AppendBuilder(negative);
+      negative->Return(
+      negative->   ConstInt64(-1));
+
+      return true;
+      }
+   };
+
+int32_t recordedCounter = 7;
+int32_t replayedCounter = 11;
+
+/**
+ * Loads a counter through ConstAddress. The recording refers to the counter
+ * by the name it is given, so a replay can resolve it to another counter.
+ */
+class LoadCounterMethod : public TR::MethodBuilder
+   {
+   public:
+   LoadCounterMethod(TR::TypeDictionary *types)
+      : TR::MethodBuilder(types)
+      {
+      DefineLine(LINETOSTR(__LINE__));
+      DefineFile(__FILE__);
+
+      DefineName("replayLoadCounter");
+      DefineReturnType(Int32);
+      }
+
+   virtual bool buildIL()
+      {
+      Return(
+         LoadAt(typeDictionary()->PointerTo(Int32),
+            ConstAddress(&recordedCounter)));
+
+      return true;
+      }
+   };
+
+/**
+ * UnsignedRem is not written by the recorder, so a replay of this method must
+ * fail rather than silently drop the operation.
+ */
+class UnsignedRemainderMethod : public TR::MethodBuilder
+   {
+   public:
+   UnsignedRemainderMethod(TR::TypeDictionary *types)
+      : TR::MethodBuilder(types)
+      {
+      DefineLine(LINETOSTR(__LINE__));
+      DefineFile(__FILE__);
+
+      DefineName("replayUnsignedRemainder");
+      DefineParameter("left", Int32);
+      DefineParameter("right", Int32);
+      DefineReturnType(Int32);
+      }
+
+   virtual bool buildIL()
+      {
+      Return(
+         UnsignedRem(
+            Load("left"),
+            Load("right")));
+
+      return true;
+      }
+   };
+
+/**
+ * Compiles \a method while recording it into \a recorder.
+ */
+template <typename FunctionType>
+FunctionType *
+compileRecorded(TR::MethodBuilder *method, TR::JitBuilderRecorderBinaryBuffer *recorder)
+   {
+   void *entry = NULL;
+   method->setRecorder(recorder);
+   EXPECT_EQ(0, method->Compile(&entry)) << "failed to compile " << method->GetMethodName();
+   EXPECT_TRUE(recorder->isComplete()) << method->GetMethodName() << " recording is incomplete";
+   return (FunctionType *)entry;
+   }
+
+/**
+ * Compiles the method recorded in \a recorder without running the recorded buildIL().
+ */
+template <typename FunctionType>
+FunctionType *
+compileReplay(TR::TypeDictionary *types, TR::JitBuilderRecorderBinaryBuffer *recorder,
+              TR::MethodBuilderReplay::Locations *locations = NULL)
+   {
+   std::vector<uint8_t> &buffer = recorder->buffer();
+   TR::MethodBuilderReplay replay(types, &buffer[0], buffer.size(), locations);
+   EXPECT_TRUE(replay.isValid());
+
+   void *entry = NULL;
+   EXPECT_EQ(0, replay.Compile(&entry)) << "failed to compile replay of " << replay.GetMethodName();
+   return (FunctionType *)entry;
+   }
+
+/**
+ * Measures the time spent in buildIL() alone, so the comparison is not
+ * dominated by the optimizer and code generator.
+ */
+class TimedSumMethod : public SumMethod
+   {
+   public:
+   TimedSumMethod(TR::TypeDictionary *types, int64_t *elapsedNs) : SumMethod(types), _elapsedNs(elapsedNs) { }
+
+   virtual bool buildIL()
+      {
+      std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+      bool rc = SumMethod::buildIL();
+      *_elapsedNs += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+      return rc;
+      }
+
+   private:
+   int64_t *_elapsedNs;
+   };
+
+class TimedReplay : public TR::MethodBuilderReplay
+   {
+   public:
+   TimedReplay(TR::TypeDictionary *types, const uint8_t *buffer, size_t length, int64_t *elapsedNs)
+      : TR::MethodBuilderReplay(types, buffer, length), _elapsedNs(elapsedNs) { }
+
+   virtual bool buildIL()
+      {
+      std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+      bool rc = TR::MethodBuilderReplay::buildIL();
+      *_elapsedNs += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+      return rc;
+      }
+
+   private:
+   int64_t *_elapsedNs;
+   };
+
+} // namespace
+
+TEST(JITReplayTest, ReplayForLoop)
+   {
+   TR::TypeDictionary types;
+   SumMethod method(&types);
+   TR::JitBuilderRecorderBinaryBuffer recorder(&method, NULL);
+
+   SumFunctionType *recorded = compileRecorded<SumFunctionType>(&method, &recorder);
+   SumFunctionType *replayed = compileReplay<SumFunctionType>(&types, &recorder);
+   ASSERT_TRUE(recorded != NULL);
+   ASSERT_TRUE(replayed != NULL);
+
+   int32_t values[] = { 0, 1, 2, 10, 1000 };
+   for (size_t i = 0; i < sizeof(values) / sizeof(values[0]); i++)
+      EXPECT_EQ(recorded(values[i]), replayed(values[i])) << "n = " << values[i];
+   }
+
+TEST(JITReplayTest, ReplayCompiledTwice)
+   {
+   TR::TypeDictionary types;
+   SumMethod method(&types);
+   TR::JitBuilderRecorderBinaryBuffer recorder(&method, NULL);
+   ASSERT_TRUE(compileRecorded<SumFunctionType>(&method, &recorder) != NULL);
+
+   std::vector<uint8_t> &buffer = recorder.buffer();
+   TR::MethodBuilderReplay replay(&types, &buffer[0], buffer.size());
+   for (int32_t i = 0; i < 2; i++)
+      {
+      void *entry = NULL;
+      ASSERT_EQ(0, replay.Compile(&entry)) << "compilation " << i;
+      ASSERT_TRUE(entry != NULL);
+      EXPECT_EQ(45, ((SumFunctionType *)entry)(10)) << "compilation " << i;
+      }
+   }
+
+TEST(JITReplayTest, ReplayWhileDoLoopWithArrayAccess)
+   {
+   TR::TypeDictionary types;
+   ArrayMaxMethod method(&types);
+   TR::JitBuilderRecorderBinaryBuffer recorder(&method, NULL);
+
+   ArrayMaxFunctionType *recorded = compileRecorded<ArrayMaxFunctionType>(&method, &recorder);
+   ArrayMaxFunctionType *replayed = compileReplay<ArrayMaxFunctionType>(&types, &recorder);
+   ASSERT_TRUE(recorded != NULL);
+   ASSERT_TRUE(replayed != NULL);
+
+   int32_t array[] = { 3, -7, 12, 5, 12, 40, -2, 0 };
+   int32_t length = sizeof(array) / sizeof(array[0]);
+   for (int32_t n = 1; n <= length; n++)
+      EXPECT_EQ(recorded(array, n), replayed(array, n)) << "length = " << n;
+   EXPECT_EQ(40, replayed(array, length));
+   }
+
+#if (defined(TR_TARGET_X86) && defined(TR_TARGET_64BIT)) || defined(TR_TARGET_S390)
+TEST(JITReplayTest, ReplayCallConvertAndSelect)
+   {
+   TR::TypeDictionary types;
+   ClampMethod method(&types);
+   TR::JitBuilderRecorderBinaryBuffer recorder(&method, NULL);
+
+   TR::MethodBuilderReplay::Locations locations;
+   locations.DefineLocation("replayDouble", (void *)&replayDouble);
+
+   ClampFunctionType *recorded = compileRecorded<ClampFunctionType>(&method, &recorder);
+   ClampFunctionType *replayed = compileReplay<ClampFunctionType>(&types, &recorder, &locations);
+   ASSERT_TRUE(recorded != NULL);
+   ASSERT_TRUE(replayed != NULL);
+
+   int32_t values[] = { -100, -1, 0, 1, 49, 50, 51, 1000 };
+   for (size_t i = 0; i < sizeof(values) / sizeof(values[0]); i++)
+      EXPECT_EQ(recorded(values[i]), replayed(values[i])) << "value = " << values[i];
+
+   // the function's entry point is recorded by name, so it cannot be defined without it
+   std::vector<uint8_t> &buffer = recorder.buffer();
+   TR::MethodBuilderReplay unresolved(&types, &buffer[0], buffer.size());
+   EXPECT_FALSE(unresolved.isValid());
+   }
+#endif
+
+TEST(JITReplayTest, ReplayResolvesAddressesByName)
+   {
+   TR::TypeDictionary types;
+   LoadCounterMethod method(&types);
+   TR::JitBuilderRecorderBinaryBuffer recorder(&method, NULL);
+   recorder.DefineLocation("replayCounter", &recordedCounter);
+
+   TR::MethodBuilderReplay::Locations locations;
+   locations.DefineLocation("replayCounter", &replayedCounter);
+
+   LoadCounterFunctionType *recorded = compileRecorded<LoadCounterFunctionType>(&method, &recorder);
+   LoadCounterFunctionType *replayed = compileReplay<LoadCounterFunctionType>(&types, &recorder, &locations);
+   ASSERT_TRUE(recorded != NULL);
+   ASSERT_TRUE(replayed != NULL);
+   EXPECT_EQ(recordedCounter, recorded());
+   EXPECT_EQ(replayedCounter, replayed());
+
+   // a name the replay cannot resolve fails the compilation
+   std::vector<uint8_t> &buffer = recorder.buffer();
+   TR::MethodBuilderReplay unresolved(&types, &buffer[0], buffer.size());
+   void *entry = NULL;
+   EXPECT_NE(0, unresolved.Compile(&entry));
+   EXPECT_TRUE(entry == NULL);
+   }
+
+TEST(JITReplayTest, UnnamedAddressFailsReplay)
+   {
+   TR::TypeDictionary types;
+   LoadCounterMethod method(&types);
+   TR::JitBuilderRecorderBinaryBuffer recorder(&method, NULL);
+
+   void *entry = NULL;
+   method.setRecorder(&recorder);
+   ASSERT_EQ(0, method.Compile(&entry));
+   ASSERT_TRUE(entry != NULL);
+   EXPECT_FALSE(recorder.isComplete());
+
+   std::vector<uint8_t> &buffer = recorder.buffer();
+   TR::MethodBuilderReplay replay(&types, &buffer[0], buffer.size());
+   entry = NULL;
+   EXPECT_NE(0, replay.Compile(&entry));
+   EXPECT_TRUE(entry == NULL);
+   }
+
+TEST(JITReplayTest, UnsupportedServiceFailsReplay)
+   {
+   TR::TypeDictionary types;
+   UnsignedRemainderMethod method(&types);
+   TR::JitBuilderRecorderBinaryBuffer recorder(&method, NULL);
+
+   void *entry = NULL;
+   method.setRecorder(&recorder);
+   ASSERT_EQ(0, method.Compile(&entry));
+   ASSERT_TRUE(entry != NULL);
+   EXPECT_FALSE(recorder.isComplete());
+
+   std::vector<uint8_t> &buffer = recorder.buffer();
+   TR::MethodBuilderReplay replay(&types, &buffer[0], buffer.size());
+   entry = NULL;
+   EXPECT_NE(0, replay.Compile(&entry));
+   EXPECT_TRUE(entry == NULL);
+   }
+
+TEST(JITReplayTest, TruncatedStreamFailsReplay)
+   {
+   TR::TypeDictionary types;
+   SumMethod method(&types);
+   TR::JitBuilderRecorderBinaryBuffer recorder(&method, NULL);
+   ASSERT_TRUE(compileRecorded<SumFunctionType>(&method, &recorder) != NULL);
+
+   std::vector<uint8_t> &buffer = recorder.buffer();
+   TR::MethodBuilderReplay replay(&types, &buffer[0], buffer.size() - 1);
+   void *entry = NULL;
+   EXPECT_NE(0, replay.Compile(&entry));
+   EXPECT_TRUE(entry == NULL);
+
+   TR::MethodBuilderReplay empty(&types, &buffer[0], 4);
+   EXPECT_FALSE(empty.isValid());
+   }
+
+TEST(JITReplayTest, OtherFormatVersionFailsReplay)
+   {
+   TR::TypeDictionary types;
+   SumMethod method(&types);
+   TR::JitBuilderRecorderBinaryBuffer recorder(&method, NULL);
+   ASSERT_TRUE(compileRecorded<SumFunctionType>(&method, &recorder) != NULL);
+
+   // the header is the signature string (a 2 byte length and 4 characters) followed by the 2 byte versions
+   const size_t majorOffset = 6;
+   const size_t minorOffset = 8;
+   std::vector<uint8_t> buffer = recorder.buffer();
+
+   buffer[majorOffset]++;
+   TR::MethodBuilderReplay newerMajor(&types, &buffer[0], buffer.size());
+   EXPECT_FALSE(newerMajor.isValid());
+   buffer[majorOffset]--;
+
+   buffer[minorOffset]++;
+   TR::MethodBuilderReplay newerMinor(&types, &buffer[0], buffer.size());
+   EXPECT_FALSE(newerMinor.isValid());
+   buffer[minorOffset]--;
+
+   TR::MethodBuilderReplay current(&types, &buffer[0], buffer.size());
+   EXPECT_TRUE(current.isValid());
+   }
+
+TEST(JITReplayTest, ReplayILGenerationTime)
+   {
+   TR::TypeDictionary types;
+   SumMethod method(&types);
+   TR::JitBuilderRecorderBinaryBuffer recorder(&method, NULL);
+   ASSERT_TRUE(compileRecorded<SumFunctionType>(&method, &recorder) != NULL);
+   std::vector<uint8_t> &buffer = recorder.buffer();
+
+   int64_t buildILNs = 0;
+   int64_t replayNs = 0;
+   for (int32_t i = 0; i < NUM_TIMING_COMPILATIONS; i++)
+      {
+      void *entry = NULL;
+      TimedSumMethod timed(&types, &buildILNs);
+      ASSERT_EQ(0, timed.Compile(&entry));
+
+      TimedReplay replay(&types, &buffer[0], buffer.size(), &replayNs);
+      ASSERT_EQ(0, replay.Compile(&entry));
+      }
+
+   printf("IL generation: compilations=%d buildIL=%lld ns replay=%lld ns (%u byte stream)\n",
+      NUM_TIMING_COMPILATIONS, (long long)(buildILNs / NUM_TIMING_COMPILATIONS),
+      (long long)(replayNs / NUM_TIMING_COMPILATIONS), (uint32_t)buffer.size());
+   }
@@ -0,0 +1,348 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include <vector>
+#include "gtest/gtest.h"
+#include "compile/Compilation.hpp"
+#include "ilgen/BytecodeBuilder.hpp"
+#include "ilgen/MethodBuilder.hpp"
+#include "ilgen/TraceRecorder.hpp"
+#include "ilgen/TypeDictionary.hpp"
+#include "ilgen/VirtualMachineOperandArray.hpp"
+#include "ilgen/VirtualMachineRegister.hpp"
+#include "tests/TestDriver.hpp"
+
+namespace
+{
+
+/*
+ * A small register machine: every instruction is one bytecode, and the
+ * interpreter keeps the registers in memory reached through a Frame.
+ */
+enum Opcode
+   {
+   CONST,   // r[a] = b
+   ADD,     // r[a] = r[b] + r[c]
+   SUB,     // r[a] = r[b] - r[c]
+   SCALE,   // r[a] = r[b] * r[c], traces specialize on r[c]
+   JLT,     // if (r[a] < r[b]) goto c
+   RET      // return r[a]
+   };
+
+struct Instruction
+   {
+   Opcode op;
+   int32_t a;
+   int32_t b;
+   int32_t c;
+   };
+
+struct Frame
+   {
+   int64_t *regs;
+   };
+
+const int32_t NUM_REGS = 6;
+
+/*
+ * sum = 0; for (i = 0; i < r2; i++) { sum += i; if (i >= r4) sum -= 1; }
+ */
+const Instruction SUM_PROGRAM[] =
+   {
+   { CONST, 0, 0, 0 },
+   { CONST, 1, 0, 0 },
+   { CONST, 3, 1, 0 },
+   { ADD,   0, 0, 1 },  // 3: loop header
+   { JLT,   1, 4, 6 },
+   { SUB,   0, 0, 3 },  // 5: only executed once i >= r4
+   { ADD,   1, 1, 3 },
+   { JLT,   1, 2, 3 },
+   { RET,   0, 0, 0 },
+   };
+
+/*
+ * sum = 0; for (i = 0; i < r2; i++) sum += i * r4;
+ */
+const Instruction SCALED_SUM_PROGRAM[] =
+   {
+   { CONST, 0, 0, 0 },
+   { CONST, 1, 0, 0 },
+   { CONST, 3, 1, 0 },
+   { SCALE, 5, 1, 4 },  // 3: loop header
+   { ADD,   0, 0, 5 },
+   { ADD,   1, 1, 3 },
+   { JLT,   1, 2, 3 },
+   { RET,   0, 0, 0 },
+   };
+
+#define NUM_BYTECODES(program) ((int32_t)(sizeof(program) / sizeof(Instruction)))
+#define REGS(b) ((TR::VirtualMachineOperandArray *)(b)->vmState())
+
+class RegisterMachineTraceBuilder : public TR::MethodBuilder
+   {
+   public:
+   RegisterMachineTraceBuilder(TR::TypeDictionary *types, const Instruction *program, int32_t numBytecodes)
+      : TR::MethodBuilder(types),
+        _program(program),
+        _numBytecodes(numBytecodes)
+      {
+      DefineLine(LINETOSTR(__LINE__));
+      DefineFile(__FILE__);
+
+      DefineName("registerMachineTrace");
+      DefineParameter("frame", types->PointerTo(types->PointerTo(Int64)));
+      DefineReturnType(Int32);
+      }
+
+   virtual bool buildIL()
+      {
+      if (!IsCompilingTrace())
+         return false;
+
+      TR::IlType *pInt64 = typeDictionary()->PointerTo(Int64);
+      TR::VirtualMachineRegister *regsBase = new (comp()->trHeapMemory()) TR::VirtualMachineRegister(this, "regs",
+         typeDictionary()->PointerTo(pInt64), sizeof(int64_t), Load("frame"));
+      TR::VirtualMachineOperandArray *regs = new (comp()->trHeapMemory()) TR::VirtualMachineOperandArray(this,
+         NUM_REGS, Int64, regsBase);
+      regs->Reload(this);
+      setVMState(regs);
+
+      std::vector<TR::BytecodeBuilder *> builders(_numBytecodes);
+      for (int32_t i = 0; i < _numBytecodes; i++)
+         builders[i] = OrphanBytecodeBuilder(i);
+
+      AppendBytecodeBuilder(builders[GetTraceEntryBytecodeIndex()]);
+
+      for (int32_t bci = GetNextBytecodeFromWorklist(); bci != -1; bci = GetNextBytecodeFromWorklist())
+         {
+         if (!generate(builders, bci))
+            return false;
+         }
+      return true;
+      }
+
+   private:
+   bool generate(std::vector<TR::BytecodeBuilder *> &builders, int32_t bci)
+      {
+      TR::BytecodeBuilder *b = builders[bci];
+      const Instruction &ins = _program[bci];
+      TR::VirtualMachineOperandArray *regs = REGS(b);
+      switch (ins.op)
+         {
+         case CONST:
+            regs->Set(ins.a, b->ConstInt64(ins.b));
+            break;
+         case ADD:
+            regs->Set(ins.a, b->Add(regs->Get(ins.b), regs->Get(ins.c)));
+            break;
+         case SUB:
+            regs->Set(ins.a, b->Sub(regs->Get(ins.b), regs->Get(ins.c)));
+            break;
+         case SCALE:
+            {
+            TR::IlValue *scale = b->ConstInt64(GetTraceProfiledValue(bci));
+            b->GuardEqual(regs->Get(ins.c), scale);
+            regs->Set(ins.a, b->Mul(regs->Get(ins.b), scale));
+            break;
+            }
+         case JLT:
+            b->IfCmpLessThan(builders[ins.c], regs->Get(ins.a), regs->Get(ins.b));
+            break;
+         case RET:
+            // the interpreter never records returns
+            return false;
+         }
+      b->AddFallThroughBuilder(builders[bci + 1]);
+      return true;
+      }
+
+   const Instruction *_program;
+   int32_t _numBytecodes;
+   };
+
+int64_t
+interpret(const Instruction *program, int64_t *regs, TR::TraceRecorder *recorder)
+   {
+   Frame frame = { regs };
+   int32_t pc = 0;
+   while (true)
+      {
+      pc = recorder->RunTraces(pc, &frame);
+      const Instruction &ins = program[pc];
+      recorder->RecordBytecode(pc, ins.op == SCALE ? regs[ins.c] : 0);
+      switch (ins.op)
+         {
+         case CONST:
+            regs[ins.a] = ins.b;
+            pc++;
+            break;
+         case ADD:
+            regs[ins.a] = regs[ins.b] + regs[ins.c];
+            pc++;
+            break;
+         case SUB:
+            regs[ins.a] = regs[ins.b] - regs[ins.c];
+            pc++;
+            break;
+         case SCALE:
+            regs[ins.a] = regs[ins.b] * regs[ins.c];
+            pc++;
+            break;
+         case JLT:
+            if (regs[ins.a] < regs[ins.b])
+               {
+               if (ins.c <= pc)
+                  recorder->CountLoopHeader(ins.c);
+               pc = ins.c;
+               }
+            else
+               {
+               pc++;
+               }
+            break;
+         case RET:
+            recorder->AbortRecording();
+            return regs[ins.a];
+         }
+      }
+   }
+
+int64_t
+runSum(TR::TraceRecorder *recorder, int64_t n, int64_t switchPoint)
+   {
+   int64_t regs[NUM_REGS] = { 0, 0, n, 0, switchPoint, 0 };
+   return interpret(SUM_PROGRAM, regs, recorder);
+   }
+
+int64_t
+expectedSum(int64_t n, int64_t switchPoint)
+   {
+   int64_t sum = 0;
+   for (int64_t i = 0; i < n; i++)
+      {
+      sum += i;
+      if (i >= switchPoint)
+         sum -= 1;
+      }
+   return sum;
+   }
+
+}
+
+TEST(TraceCompilationTest, HotLoopCompilesClosedTrace)
+   {
+   TR::TypeDictionary types;
+   RegisterMachineTraceBuilder builder(&types, SUM_PROGRAM, NUM_BYTECODES(SUM_PROGRAM));
+   TR::TraceRecorder recorder(&builder, NUM_BYTECODES(SUM_PROGRAM));
+   recorder.setHotLoopThreshold(10);
+
+   EXPECT_EQ(expectedSum(1000, 1000), runSum(&recorder, 1000, 1000));
+   ASSERT_EQ(1, recorder.numTracesCompiled());
+   ASSERT_TRUE(recorder.GetTraceEntry(3) != NULL);
+
+   OMR::BytecodeTrace *trace = recorder.GetTrace(3);
+   EXPECT_TRUE(trace->closesLoop());
+   ASSERT_EQ(4, trace->length());
+   EXPECT_EQ(3, trace->bytecodeIndex(0));
+   EXPECT_EQ(4, trace->bytecodeIndex(1));
+   EXPECT_EQ(6, trace->bytecodeIndex(2));
+   EXPECT_EQ(7, trace->bytecodeIndex(3));
+
+   // the compiled loop runs until it leaves at the end of the loop
+   EXPECT_EQ(1, trace->executions());
+   OMR::TraceExit *loopExit = trace->findExit(8, false);
+   ASSERT_TRUE(loopExit != NULL);
+   EXPECT_EQ(1, loopExit->_count);
+
+   // the trace is reused by later runs
+   EXPECT_EQ(expectedSum(500, 1000), runSum(&recorder, 500, 1000));
+   EXPECT_EQ(1, recorder.numTracesCompiled());
+   EXPECT_EQ(2, loopExit->_count);
+   }
+
+TEST(TraceCompilationTest, HotSideExitCompilesLinkedSideTrace)
+   {
+   TR::TypeDictionary types;
+   RegisterMachineTraceBuilder builder(&types, SUM_PROGRAM, NUM_BYTECODES(SUM_PROGRAM));
+   TR::TraceRecorder recorder(&builder, NUM_BYTECODES(SUM_PROGRAM));
+   recorder.setHotLoopThreshold(10);
+   recorder.setHotExitThreshold(20);
+
+   EXPECT_EQ(expectedSum(1000, 300), runSum(&recorder, 1000, 300));
+   ASSERT_EQ(2, recorder.numTracesCompiled());
+
+   // every iteration from i == 300 on leaves the loop trace to the bytecode it did not record,
+   // except the one the interpreter runs right after it finishes recording the side trace
+   OMR::TraceExit *sideExit = recorder.GetTrace(3)->findExit(5, false);
+   ASSERT_TRUE(sideExit != NULL);
+   EXPECT_EQ(700 - 1, sideExit->_count);
+
+   OMR::BytecodeTrace *sideTrace = recorder.GetTrace(5);
+   ASSERT_TRUE(sideTrace != NULL);
+   ASSERT_TRUE(recorder.GetTraceEntry(5) != NULL);
+   EXPECT_FALSE(sideTrace->closesLoop());
+   EXPECT_EQ(3, sideTrace->linkTarget());
+   EXPECT_EQ(3, sideTrace->length());
+
+   // once the side trace exists, the two traces run each other without the interpreter: every
+   // side trace execution but the last links back to the loop, which links to all but the first
+   EXPECT_EQ(1000 - 320, sideTrace->executions());
+   EXPECT_EQ(2 * (sideTrace->executions() - 1), recorder.numLinkedTransfers());
+   }
+
+TEST(TraceCompilationTest, GuardExitReexecutesBytecode)
+   {
+   TR::TypeDictionary types;
+   RegisterMachineTraceBuilder builder(&types, SCALED_SUM_PROGRAM, NUM_BYTECODES(SCALED_SUM_PROGRAM));
+   TR::TraceRecorder recorder(&builder, NUM_BYTECODES(SCALED_SUM_PROGRAM));
+   recorder.setHotLoopThreshold(10);
+
+   int64_t regs[NUM_REGS] = { 0, 0, 200, 0, 3, 0 };
+   EXPECT_EQ(3 * 199 * 200 / 2, interpret(SCALED_SUM_PROGRAM, regs, &recorder));
+   ASSERT_EQ(1, recorder.numTracesCompiled());
+   OMR::BytecodeTrace *trace = recorder.GetTrace(3);
+   EXPECT_EQ(3, trace->profiledValue(0));
+   EXPECT_TRUE(trace->findExit(3, true) == NULL || trace->findExit(3, true)->_count == 0);
+
+   // the trace was specialized for r4 == 3, so every iteration with another value fails the guard
+   int64_t otherRegs[NUM_REGS] = { 0, 0, 200, 0, 5, 0 };
+   EXPECT_EQ(5 * 199 * 200 / 2, interpret(SCALED_SUM_PROGRAM, otherRegs, &recorder));
+   OMR::TraceExit *guardExit = trace->findExit(3, true);
+   ASSERT_TRUE(guardExit != NULL);
+   EXPECT_EQ(200, guardExit->_count);
+   EXPECT_EQ(0, recorder.numLinkedTransfers());
+   }
+
+TEST(TraceCompilationTest, LongRecordingIsAbandoned)
+   {
+   TR::TypeDictionary types;
+   RegisterMachineTraceBuilder builder(&types, SUM_PROGRAM, NUM_BYTECODES(SUM_PROGRAM));
+   TR::TraceRecorder recorder(&builder, NUM_BYTECODES(SUM_PROGRAM));
+   recorder.setHotLoopThreshold(10);
+   recorder.setMaxTraceLength(2);
+
+   EXPECT_EQ(expectedSum(1000, 1000), runSum(&recorder, 1000, 1000));
+   EXPECT_EQ(0, recorder.numTracesCompiled());
+   EXPECT_EQ(1, recorder.numRecordingsAborted());
+   EXPECT_TRUE(recorder.GetTraceEntry(3) == NULL);
+   ASSERT_TRUE(recorder.GetTrace(3) != NULL);
+   EXPECT_EQ(OMR::BytecodeTrace::Failed, recorder.GetTrace(3)->state());
+   }
@@ -0,0 +1,242 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include <algorithm>
+#include <vector>
+#include "JitTest.hpp"
+#include "omrthread.h"
+#include "runtime/CodeCache.hpp"
+#include "runtime/CodeCacheManager.hpp"
+
+namespace {
+
+const int32_t NUM_COMP_THREADS = 4;
+const int32_t NUM_ALLOCATIONS = 256;
+const size_t ALLOCATION_SIZE = 200;
+const size_t THREAD_REGION_KB = 16;
+
+struct CompThreadData {
+    int32_t compThreadID;
+    bool useThreadRegions;
+    std::vector<uint8_t *> blocks;
+    size_t spaceUsed;
+    size_t freeSpaceWhileReserved;
+    size_t freeSpaceAfterUnreserve;
+    bool ownedThreadRegion;
+};
+
+/**
+ * Simulates a compilation thread: reserve a new code cache, allocate a number
+ * of small method bodies from it and release the reservation.
+ *
+ * A new code cache is used so that every thread has room for all of its
+ * allocations, whatever earlier compilations left in the existing caches.
+ */
+int J9THREAD_PROC allocateFromCompThread(void *arg)
+{
+    CompThreadData *data = static_cast<CompThreadData *>(arg);
+    TR::CodeCacheManager *manager = TR::CodeCacheManager::instance();
+
+    TR::CodeCache *codeCache = manager->getNewCodeCache(data->compThreadID, TR::CodeCacheKind::DEFAULT_CC);
+    if (codeCache == NULL)
+        return 0;
+
+    size_t freeBefore = codeCache->getFreeContiguousSpace();
+    data->ownedThreadRegion = true;
+
+    for (int32_t i = 0; i < NUM_ALLOCATIONS; i++) {
+        uint8_t *coldCode = NULL;
+        TR::CodeCache *allocCache = codeCache;
+        uint8_t *warmCode = manager->allocateCodeMemory(ALLOCATION_SIZE, 0, &allocCache, &coldCode, false);
+        if (warmCode == NULL || allocCache != codeCache)
+            break;
+        data->blocks.push_back(warmCode);
+
+        omrthread_t expectedOwner = data->useThreadRegions ? omrthread_self() : NULL;
+        if (codeCache->getThreadRegionOwner() != expectedOwner)
+            data->ownedThreadRegion = false;
+    }
+
+    data->freeSpaceWhileReserved = codeCache->getFreeContiguousSpace();
+    manager->unreserveCodeCache(codeCache);
+    data->freeSpaceAfterUnreserve = codeCache->getFreeContiguousSpace();
+    data->spaceUsed = freeBefore - data->freeSpaceAfterUnreserve;
+
+    return 0;
+}
+
+} // namespace
+
+class CodeCacheTest : public TRTest::JitTest {
+public:
+    CodeCacheTest()
+        : _config(TR::CodeCacheManager::instance()->codeCacheConfig())
+        , _savedThreadRegionKB(_config._codeCacheThreadRegionKB)
+    {}
+
+    ~CodeCacheTest() { _config._codeCacheThreadRegionKB = _savedThreadRegionKB; }
+
+protected:
+    /**
+     * Runs NUM_COMP_THREADS concurrent compilation threads, each allocating
+     * from its own reserved code cache, and checks that every allocation
+     * succeeded and that no two blocks overlap.
+     */
+    void runCompThreads(bool useThreadRegions, CompThreadData *data)
+    {
+        omrthread_t threads[NUM_COMP_THREADS];
+
+        _config._codeCacheThreadRegionKB = useThreadRegions ? THREAD_REGION_KB : 0;
+
+        for (int32_t i = 0; i < NUM_COMP_THREADS; i++) {
+            omrthread_attr_t attr = NULL;
+            data[i].compThreadID = i;
+            data[i].useThreadRegions = useThreadRegions;
+            ASSERT_EQ(J9THREAD_SUCCESS, omrthread_attr_init(&attr));
+            ASSERT_EQ(J9THREAD_SUCCESS, omrthread_attr_set_detachstate(&attr, J9THREAD_CREATE_JOINABLE));
+            ASSERT_EQ(J9THREAD_SUCCESS,
+                omrthread_create_ex(&threads[i], &attr, 0, allocateFromCompThread, &data[i]));
+            omrthread_attr_destroy(&attr);
+        }
+
+        for (int32_t i = 0; i < NUM_COMP_THREADS; i++)
+            ASSERT_EQ(J9THREAD_SUCCESS, omrthread_join(threads[i]));
+
+        std::vector<uint8_t *> blocks;
+        for (int32_t i = 0; i < NUM_COMP_THREADS; i++) {
+            ASSERT_EQ((size_t)NUM_ALLOCATIONS, data[i].blocks.size()) << "compilation thread " << i << " ran out of code cache";
+            EXPECT_TRUE(data[i].ownedThreadRegion) << "compilation thread " << i;
+            blocks.insert(blocks.end(), data[i].blocks.begin(), data[i].blocks.end());
+        }
+
+        std::sort(blocks.begin(), blocks.end());
+        for (size_t i = 1; i < blocks.size(); i++)
+            EXPECT_GE((size_t)(blocks[i] - blocks[i - 1]), ALLOCATION_SIZE) << "code blocks overlap at " << (void *)blocks[i];
+    }
+
+    TR::CodeCacheConfig &_config;
+    size_t _savedThreadRegionKB;
+};
+
+TEST_F(CodeCacheTest, ConcurrentAllocationWithoutThreadRegions)
+{
+    CompThreadData data[NUM_COMP_THREADS];
+    runCompThreads(false, data);
+}
+
+TEST_F(CodeCacheTest, ConcurrentAllocationWithThreadRegions)
+{
+    CompThreadData data[NUM_COMP_THREADS];
+    runCompThreads(true, data);
+
+    for (int32_t i = 0; i < NUM_COMP_THREADS; i++) {
+        // The unused tail of the region is reported as free while it is held
+        // and nothing of it is lost once it is handed back
+        EXPECT_EQ(data[i].freeSpaceAfterUnreserve, data[i].freeSpaceWhileReserved) << "compilation thread " << i;
+    }
+}
+
+TEST_F(CodeCacheTest, ThreadRegionsUseNoExtraCodeCache)
+{
+    CompThreadData withoutRegions[NUM_COMP_THREADS];
+    CompThreadData withRegions[NUM_COMP_THREADS];
+
+    runCompThreads(false, withoutRegions);
+    runCompThreads(true, withRegions);
+
+    for (int32_t i = 0; i < NUM_COMP_THREADS; i++)
+        EXPECT_EQ(withoutRegions[i].spaceUsed, withRegions[i].spaceUsed) << "compilation thread " << i;
+}
+
+TEST_F(CodeCacheTest, ThreadRegionOwnedByAllocatingThread)
+{
+    TR::CodeCacheManager *manager = TR::CodeCacheManager::instance();
+    _config._codeCacheThreadRegionKB = THREAD_REGION_KB;
+
+    TR::CodeCache *codeCache = manager->getNewCodeCache(0, TR::CodeCacheKind::DEFAULT_CC);
+    ASSERT_NOTNULL(codeCache);
+    EXPECT_NULL(codeCache->getThreadRegionOwner());
+
+    size_t freeBefore = codeCache->getFreeContiguousSpace();
+    uint8_t *coldCode = NULL;
+    TR::CodeCache *allocCache = codeCache;
+    ASSERT_NOTNULL(manager->allocateCodeMemory(ALLOCATION_SIZE, 0, &allocCache, &coldCode, false));
+    ASSERT_EQ(codeCache, allocCache);
+
+    EXPECT_EQ(omrthread_self(), codeCache->getThreadRegionOwner());
+    EXPECT_GT(codeCache->getThreadRegionFreeSpace(), 0u);
+
+    size_t freeWhileReserved = codeCache->getFreeContiguousSpace();
+    EXPECT_GE(freeBefore - freeWhileReserved, ALLOCATION_SIZE);
+    EXPECT_LT(freeBefore - freeWhileReserved, (size_t)1024);
+
+    manager->unreserveCodeCache(codeCache);
+
+    // Only the allocated block stays in use once the region is handed back
+    EXPECT_NULL(codeCache->getThreadRegionOwner());
+    EXPECT_EQ(0u, codeCache->getThreadRegionFreeSpace());
+    EXPECT_EQ(freeWhileReserved, codeCache->getFreeContiguousSpace());
+}
+
+TEST_F(CodeCacheTest, SlowPathReclaimsOwnThreadRegion)
+{
+    TR::CodeCacheManager *manager = TR::CodeCacheManager::instance();
+    _config._codeCacheThreadRegionKB = THREAD_REGION_KB;
+
+    TR::CodeCache *codeCache = manager->getNewCodeCache(0, TR::CodeCacheKind::DEFAULT_CC);
+    ASSERT_NOTNULL(codeCache);
+
+    uint8_t *coldCode = NULL;
+    TR::CodeCache *allocCache = codeCache;
+    uint8_t *first = manager->allocateCodeMemory(ALLOCATION_SIZE, 0, &allocCache, &coldCode, false);
+    ASSERT_NOTNULL(first);
+    ASSERT_GT(codeCache->getThreadRegionFreeSpace(), 0u);
+
+    // A warm and cold allocation cannot be served from the region; the region
+    // is handed back so the warm part continues right after the first block
+    uint8_t *second = manager->allocateCodeMemory(ALLOCATION_SIZE, ALLOCATION_SIZE, &allocCache, &coldCode, false);
+    ASSERT_NOTNULL(second);
+    ASSERT_EQ(codeCache, allocCache);
+    EXPECT_EQ(0u, codeCache->getThreadRegionFreeSpace());
+    EXPECT_GT(second, first);
+    EXPECT_LT((size_t)(second - first), (size_t)1024);
+
+    manager->unreserveCodeCache(codeCache);
+}
+
+TEST_F(CodeCacheTest, ReservationPrefersLastCodeCacheOfCompThread)
+{
+    TR::CodeCacheManager *manager = TR::CodeCacheManager::instance();
+
+    int32_t numReserved = 0;
+    TR::CodeCache *first = manager->reserveCodeCache(false, 0, 1, &numReserved, TR::CodeCacheKind::DEFAULT_CC);
+    TR::CodeCache *second = manager->reserveCodeCache(false, 0, 2, &numReserved, TR::CodeCacheKind::DEFAULT_CC);
+    ASSERT_NOTNULL(first);
+    ASSERT_NOTNULL(second);
+    ASSERT_NE(first, second);
+    manager->unreserveCodeCache(first);
+    manager->unreserveCodeCache(second);
+
+    TR::CodeCache *again = manager->reserveCodeCache(false, 0, 2, &numReserved, TR::CodeCacheKind::DEFAULT_CC);
+    EXPECT_EQ(second, again);
+    EXPECT_EQ(2, again->getLastReservingCompThreadID());
+    manager->unreserveCodeCache(again);
+}
@@ -0,0 +1,243 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include <string>
+#include <vector>
+#include "JitTest.hpp"
+#include "default_compiler.hpp"
+#include "compile/Compilation.hpp"
+#include "control/Options.hpp"
+#include "infra/Cfg.hpp"
+#include "optimizer/DataFlowAnalysis.hpp"
+#include "optimizer/Optimizer.hpp"
+#include "optimizer/Structure.hpp"
+#include "optimizer/UseDefInfo.hpp"
+#include "ras/IlVerifier.hpp"
+
+/**
+ * Solves liveness (a backward problem) and reaching definitions (a forward
+ * problem, through use/def info) for the optimized trees, once with the
+ * structural solver and once with the worklist solver, and records both
+ * solutions.
+ *
+ * The verifier always stops the compilation, as only the solutions matter.
+ */
+class SolverComparisonVerifier : public TR::IlVerifier
+   {
+   public:
+   SolverComparisonVerifier() : _hasImproperRegion(false) {}
+
+   int32_t verify(TR::ResolvedMethodSymbol *sym)
+      {
+      TR::Compilation *comp = sym->comp();
+      TR::Optimizer *optimizer = comp->getOptimizer();
+      bool savedOption = comp->getOption(TR_EnableWorklistDataFlowSolver);
+
+      optimizer->doStructuralAnalysis();
+      TR_Structure *rootStructure = comp->getFlowGraph()->getStructure();
+      _hasImproperRegion = containsImproperRegion(rootStructure);
+
+      for (int32_t worklist = 0; worklist < 2; worklist++)
+         {
+         comp->getOptions()->setOption(TR_EnableWorklistDataFlowSolver, worklist != 0);
+         _liveness[worklist] = solveLiveness(comp, optimizer, rootStructure);
+         _useDefs[worklist] = solveUseDefs(comp, optimizer);
+         }
+
+      comp->getOptions()->setOption(TR_EnableWorklistDataFlowSolver, savedOption);
+      return 1;
+      }
+
+   /**
+    * Solutions are lists of the form "block_N:{bits}" or "use_N:{defs}", in
+    * block and use index order.
+    */
+   const std::string &liveness(bool worklist) { return _liveness[worklist ? 1 : 0]; }
+   const std::string &useDefs(bool worklist) { return _useDefs[worklist ? 1 : 0]; }
+   bool hasImproperRegion() { return _hasImproperRegion; }
+
+   private:
+   static bool containsImproperRegion(TR_Structure *structure)
+      {
+      TR_RegionStructure *region = structure->asRegion();
+      if (region == NULL)
+         return false;
+      if (region->containsInternalCycles())
+         return true;
+
+      TR_RegionStructure::Cursor si(*region);
+      for (TR_StructureSubGraphNode *subNode = si.getCurrent(); subNode; subNode = si.getNext())
+         {
+         if (containsImproperRegion(subNode->getStructure()))
+            return true;
+         }
+      return false;
+      }
+
+   static std::string solveLiveness(TR::Compilation *comp, TR::Optimizer *optimizer, TR_Structure *rootStructure)
+      {
+      TR_Liveness liveness(comp, optimizer, rootStructure);
+      liveness.perform(rootStructure);
+
+      std::string solution;
+      int32_t numberOfBits = liveness.getNumberOfBits();
+      for (int32_t i = 0; liveness._blockAnalysisInfo && i < liveness._numberOfNodes; i++)
+         {
+         if (liveness._blockAnalysisInfo[i] == NULL)
+            continue;
+         solution += "block_" + std::to_string(i) + ":{";
+         for (int32_t bit = 0; bit < numberOfBits; bit++)
+            {
+            if (liveness._blockAnalysisInfo[i]->get(bit))
+               solution += std::to_string(bit) + " ";
+            }
+         solution += "} ";
+         }
+      return solution;
+      }
+
+   static std::string solveUseDefs(TR::Compilation *comp, TR::Optimizer *optimizer)
+      {
+      optimizer->setUseDefInfo(NULL);
+      TR_UseDefInfo *info = optimizer->createUseDefInfo(comp);
+
+      std::string solution;
+      if (info->infoIsValid())
+         {
+         for (int32_t use = info->getFirstUseIndex(); use <= info->getLastUseIndex(); use++)
+            {
+            TR_UseDefInfo::BitVector defs(comp->allocator());
+            info->getUseDef(defs, use);
+            solution += "use_" + std::to_string(use) + ":{";
+            for (int32_t def = 0; def < info->getNumDefNodes(); def++)
+               {
+               if (defs.ValueAt(def))
+                  solution += std::to_string(def) + " ";
+               }
+            solution += "} ";
+            }
+         }
+
+      delete info;
+      return solution;
+      }
+
+   std::string _liveness[2];
+   std::string _useDefs[2];
+   bool _hasImproperRegion;
+   };
+
+class DataFlowSolverTest : public TRTest::JitOptTest
+   {
+   public:
+   DataFlowSolverTest()
+      {
+      /*
+       * A trivial optimization keeps the simplifier from folding the
+       * trees before the verifier looks at them.
+       */
+      addOptimization(OMR::trivialDeadTreeRemoval);
+      }
+
+   void compareSolvers(const char *inputTrees, bool expectImproperRegion)
+      {
+      auto trees = parseString(inputTrees);
+
+      ASSERT_NOTNULL(trees);
+
+      Tril::DefaultCompiler compiler(trees);
+      SolverComparisonVerifier verifier;
+
+      ASSERT_NE(0, compiler.compileWithVerifier(&verifier));
+      EXPECT_EQ(expectImproperRegion, verifier.hasImproperRegion()) << "Input trees: " << inputTrees;
+
+      ASSERT_FALSE(verifier.liveness(false).empty()) << "Liveness found no live variables";
+      EXPECT_EQ(verifier.liveness(false), verifier.liveness(true)) << "Input trees: " << inputTrees;
+
+      ASSERT_FALSE(verifier.useDefs(false).empty()) << "Use/def info was not built";
+      EXPECT_EQ(verifier.useDefs(false), verifier.useDefs(true)) << "Input trees: " << inputTrees;
+      }
+   };
+
+TEST_F(DataFlowSolverTest, StraightLineCode) {
+    compareSolvers("(method return=Int32 args=[Int32]                                     "
+                   " (block                                                               "
+                   "  (istore temp=\"x\" (iload parm=0))                                  "
+                   "  (ificmpgt target=\"big\" (iload temp=\"x\") (iconst 10)))           "
+                   " (block                                                               "
+                   "  (istore temp=\"x\" (iadd (iload temp=\"x\") (iconst 1))))           "
+                   " (block name=\"big\"                                                  "
+                   "  (ireturn (iload temp=\"x\"))))                                      ",
+        false);
+}
+
+TEST_F(DataFlowSolverTest, Loop) {
+    compareSolvers("(method return=Int32 args=[Int32]                                     "
+                   " (block                                                               "
+                   "  (istore temp=\"s\" (iconst 0))                                      "
+                   "  (istore temp=\"i\" (iconst 0)))                                     "
+                   " (block name=\"loop\"                                                 "
+                   "  (istore temp=\"s\" (iadd (iload temp=\"s\") (iload temp=\"i\")))    "
+                   "  (istore temp=\"i\" (iadd (iload temp=\"i\") (iconst 1)))            "
+                   "  (ificmplt target=\"loop\" (iload temp=\"i\") (iload parm=0)))       "
+                   " (block                                                               "
+                   "  (ireturn (iload temp=\"s\"))))                                      ",
+        false);
+}
+
+TEST_F(DataFlowSolverTest, NestedLoops) {
+    compareSolvers("(method return=Int32 args=[Int32]                                     "
+                   " (block                                                               "
+                   "  (istore temp=\"s\" (iconst 0))                                      "
+                   "  (istore temp=\"i\" (iconst 0)))                                     "
+                   " (block name=\"outer\"                                                "
+                   "  (istore temp=\"j\" (iconst 0)))                                     "
+                   " (block name=\"inner\"                                                "
+                   "  (istore temp=\"s\" (iadd (iload temp=\"s\") (iload temp=\"j\")))    "
+                   "  (istore temp=\"j\" (iadd (iload temp=\"j\") (iconst 1)))            "
+                   "  (ificmplt target=\"inner\" (iload temp=\"j\") (iload temp=\"i\")))  "
+                   " (block                                                               "
+                   "  (istore temp=\"i\" (iadd (iload temp=\"i\") (iconst 1)))            "
+                   "  (ificmplt target=\"outer\" (iload temp=\"i\") (iload parm=0)))      "
+                   " (block                                                               "
+                   "  (ireturn (iload temp=\"s\"))))                                      ",
+        false);
+}
+
+/*
+ * The cycle between "a" and "b" can be entered at either block, so it is not
+ * a natural loop and structural analysis builds an improper region for it.
+ */
+TEST_F(DataFlowSolverTest, IrreducibleLoop) {
+    compareSolvers("(method return=Int32 args=[Int32]                                     "
+                   " (block                                                               "
+                   "  (istore temp=\"s\" (iconst 0))                                      "
+                   "  (istore temp=\"i\" (iload parm=0))                                  "
+                   "  (ificmpgt target=\"b\" (iload temp=\"i\") (iconst 5)))              "
+                   " (block name=\"a\"                                                    "
+                   "  (istore temp=\"s\" (iadd (iload temp=\"s\") (iload temp=\"i\"))))   "
+                   " (block name=\"b\"                                                    "
+                   "  (istore temp=\"i\" (iadd (iload temp=\"i\") (iconst 1)))            "
+                   "  (ificmplt target=\"a\" (iload temp=\"i\") (iconst 10)))             "
+                   " (block                                                               "
+                   "  (ireturn (iload temp=\"s\"))))                                      ",
+        true);
+}
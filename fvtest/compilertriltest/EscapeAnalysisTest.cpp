@@ -0,0 +1,283 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "JitTest.hpp"
+#include "default_compiler.hpp"
+#include "il/Node.hpp"
+#include "infra/ILWalk.hpp"
+#include "ras/IlVerifier.hpp"
+
+/**
+ * Stops compilation if any allocation is left in the trees.
+ *
+ * OMR has no allocation helper, so the verifier also keeps methods whose
+ * allocations escape from reaching the code generator.
+ */
+class NoNewIlVerifier : public TR::IlVerifier
+   {
+   public:
+   int32_t verify(TR::ResolvedMethodSymbol *sym)
+      {
+      for (TR::PreorderNodeIterator iter(sym->getFirstTreeTop(), sym->comp()); iter.currentTree(); ++iter)
+         {
+         if (iter.currentNode()->getOpCodeValue() == TR::New)
+            return 1;
+         }
+      return 0;
+      }
+   };
+
+class EscapeAnalysisTest : public TRTest::JitOptTest
+   {
+   public:
+   EscapeAnalysisTest()
+      {
+      addOptimization(OMR::escapeAnalysis);
+      }
+   };
+
+TEST_F(EscapeAnalysisTest, ReplacesBoxedValue) {
+    auto inputTrees = "(method return=Int32 args=[Int32]                      "
+                      " (block                                                "
+                      "  (astore temp=\"box\" (new (aconst 0)))               "
+                      "  (istorei offset=8 (aload temp=\"box\") (iload parm=0))"
+                      "  (ireturn                                             "
+                      "   (iadd (iloadi offset=8 (aload temp=\"box\")) (iconst 1)))))";
+    auto trees = parseString(inputTrees);
+
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    NoNewIlVerifier verifier;
+
+    ASSERT_EQ(0, compiler.compileWithVerifier(&verifier)) << "Allocation was not replaced\n" << "Input trees: " << inputTrees;
+
+    auto entry_point = compiler.getEntryPoint<int32_t (*)(int32_t)>();
+    EXPECT_EQ(1, entry_point(0));
+    EXPECT_EQ(43, entry_point(42));
+    EXPECT_EQ(-9, entry_point(-10));
+}
+
+TEST_F(EscapeAnalysisTest, ReplacedFieldsAreZeroInitialized) {
+    auto inputTrees = "(method return=Int32                                  "
+                      " (block                                                "
+                      "  (astore temp=\"box\" (new (aconst 0)))               "
+                      "  (ireturn (iloadi offset=8 (aload temp=\"box\")))))   ";
+    auto trees = parseString(inputTrees);
+
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    NoNewIlVerifier verifier;
+
+    ASSERT_EQ(0, compiler.compileWithVerifier(&verifier)) << "Allocation was not replaced\n" << "Input trees: " << inputTrees;
+
+    auto entry_point = compiler.getEntryPoint<int32_t (*)(void)>();
+    EXPECT_EQ(0, entry_point());
+}
+
+TEST_F(EscapeAnalysisTest, ReplacesFieldsOfDifferentTypes) {
+    auto inputTrees = "(method return=Int64 args=[Int64, Int32]                  "
+                      " (block                                                    "
+                      "  (astore temp=\"pair\" (new (aconst 0)))                  "
+                      "  (lstorei offset=8 (aload temp=\"pair\") (lload parm=0))  "
+                      "  (istorei offset=16 (aload temp=\"pair\") (iload parm=1)) "
+                      "  (lreturn                                                 "
+                      "   (ladd                                                   "
+                      "    (lloadi offset=8 (aload temp=\"pair\"))                "
+                      "    (i2l (iloadi offset=16 (aload temp=\"pair\")))))))     ";
+    auto trees = parseString(inputTrees);
+
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    NoNewIlVerifier verifier;
+
+    ASSERT_EQ(0, compiler.compileWithVerifier(&verifier)) << "Allocation was not replaced\n" << "Input trees: " << inputTrees;
+
+    auto entry_point = compiler.getEntryPoint<int64_t (*)(int64_t, int32_t)>();
+    EXPECT_EQ(3, entry_point(1, 2));
+    EXPECT_EQ(0x100000000LL - 1, entry_point(0x100000000LL, -1));
+}
+
+TEST_F(EscapeAnalysisTest, ReplacesCommonedAllocation) {
+    auto inputTrees = "(method return=Int32 args=[Int32]                            "
+                      " (block                                                      "
+                      "  (treetop (new id=\"obj\" (aconst 0)))                      "
+                      "  (istorei offset=8 (@id \"obj\") (iload parm=0))            "
+                      "  (ireturn (imul (iloadi offset=8 (@id \"obj\")) (iconst 2)))))";
+    auto trees = parseString(inputTrees);
+
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    NoNewIlVerifier verifier;
+
+    ASSERT_EQ(0, compiler.compileWithVerifier(&verifier)) << "Allocation was not replaced\n" << "Input trees: " << inputTrees;
+
+    auto entry_point = compiler.getEntryPoint<int32_t (*)(int32_t)>();
+    EXPECT_EQ(14, entry_point(7));
+}
+
+/*
+ * The allocation happens once before the loop and its field accumulates the
+ * sum of 0 .. n-1 across iterations.
+ */
+TEST_F(EscapeAnalysisTest, ReplacesFieldUpdatedInLoop) {
+    auto inputTrees = "(method return=Int32 args=[Int32]                                     "
+                      " (block                                                               "
+                      "  (astore temp=\"acc\" (new (aconst 0)))                              "
+                      "  (istore temp=\"i\" (iconst 0)))                                     "
+                      " (block name=\"loop\"                                                 "
+                      "  (istorei offset=8 (aload temp=\"acc\")                              "
+                      "   (iadd (iloadi offset=8 (aload temp=\"acc\")) (iload temp=\"i\")))  "
+                      "  (istore temp=\"i\" (iadd (iload temp=\"i\") (iconst 1)))            "
+                      "  (ificmplt target=\"loop\" (iload temp=\"i\") (iload parm=0)))       "
+                      " (block                                                               "
+                      "  (ireturn (iloadi offset=8 (aload temp=\"acc\")))))                  ";
+    auto trees = parseString(inputTrees);
+
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    NoNewIlVerifier verifier;
+
+    ASSERT_EQ(0, compiler.compileWithVerifier(&verifier)) << "Allocation was not replaced\n" << "Input trees: " << inputTrees;
+
+    auto entry_point = compiler.getEntryPoint<int32_t (*)(int32_t)>();
+    EXPECT_EQ(0, entry_point(1));
+    EXPECT_EQ(45, entry_point(10));
+}
+
+TEST_F(EscapeAnalysisTest, ReturnedAllocationEscapes) {
+    auto inputTrees = "(method return=Address                                 "
+                      " (block                                                "
+                      "  (astore temp=\"box\" (new (aconst 0)))               "
+                      "  (istorei offset=8 (aload temp=\"box\") (iconst 1))   "
+                      "  (areturn (aload temp=\"box\"))))                     ";
+    auto trees = parseString(inputTrees);
+
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    NoNewIlVerifier verifier;
+
+    ASSERT_NE(0, compiler.compileWithVerifier(&verifier)) << "Escaping allocation was replaced\n" << "Input trees: " << inputTrees;
+}
+
+TEST_F(EscapeAnalysisTest, AllocationStoredToFieldEscapes) {
+    auto inputTrees = "(method return=Int32                                        "
+                      " (block                                                     "
+                      "  (astore temp=\"box\" (new (aconst 0)))                    "
+                      "  (astorei offset=8 (aload temp=\"box\") (aload temp=\"box\"))"
+                      "  (ireturn (iconst 0))))                                    ";
+    auto trees = parseString(inputTrees);
+
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    NoNewIlVerifier verifier;
+
+    ASSERT_NE(0, compiler.compileWithVerifier(&verifier)) << "Escaping allocation was replaced\n" << "Input trees: " << inputTrees;
+}
+
+TEST_F(EscapeAnalysisTest, OverlappingFieldsEscape) {
+    auto inputTrees = "(method return=Int32 args=[Int64]                           "
+                      " (block                                                     "
+                      "  (astore temp=\"box\" (new (aconst 0)))                    "
+                      "  (lstorei offset=8 (aload temp=\"box\") (lload parm=0))    "
+                      "  (ireturn (iloadi offset=12 (aload temp=\"box\")))))       ";
+    auto trees = parseString(inputTrees);
+
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    NoNewIlVerifier verifier;
+
+    ASSERT_NE(0, compiler.compileWithVerifier(&verifier)) << "Overlapping fields were replaced\n" << "Input trees: " << inputTrees;
+}
+
+/*
+ * The allocation and all of its uses are on the same conditional path, so
+ * the allocation is replaced.  No verifier is used: OMR cannot generate code
+ * for an allocation, so the method only compiles if it was replaced.
+ */
+TEST_F(EscapeAnalysisTest, ReplacesAllocationOnConditionalPath) {
+    auto inputTrees = "(method return=Int32 args=[Int32]                                 "
+                      " (block                                                           "
+                      "  (ificmpeq target=\"zero\" (iload parm=0) (iconst 0)))           "
+                      " (block                                                           "
+                      "  (astore temp=\"box\" (new (aconst 0)))                          "
+                      "  (istorei offset=8 (aload temp=\"box\") (iload parm=0))          "
+                      "  (NULLCHK (iloadi id=\"f\" offset=8 (aload temp=\"box\")))       "
+                      "  (ireturn (iadd (@id \"f\") (iconst 1))))                        "
+                      " (block name=\"zero\"                                             "
+                      "  (ireturn (iconst -1))))                                         ";
+    auto trees = parseString(inputTrees);
+
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+
+    ASSERT_EQ(0, compiler.compile()) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+
+    auto entry_point = compiler.getEntryPoint<int32_t (*)(int32_t)>();
+    EXPECT_EQ(-1, entry_point(0));
+    EXPECT_EQ(8, entry_point(7));
+}
+
+#if defined(GTEST_HAS_DEATH_TEST)
+/*
+ * The allocation only happens when the argument is non-zero, but the field
+ * is read after the paths join.  On the path that skips the allocation the
+ * null check must still fail, so the allocation cannot be replaced and the
+ * null check cannot be removed.
+ *
+ * No verifier is used.  A replaced allocation lets the null path return
+ * normally.  A kept one cannot be compiled since OMR has no allocation
+ * helper; in a frontend that has one the null path faults in the null check.
+ */
+TEST_F(EscapeAnalysisTest, AllocationOnConditionalPathKeepsNullCheck) {
+    auto inputTrees = "(method return=Int32 args=[Int32]                                 "
+                      " (block                                                           "
+                      "  (ificmpeq target=\"join\" (iload parm=0) (iconst 0)))           "
+                      " (block                                                           "
+                      "  (astore temp=\"box\" (new (aconst 0)))                          "
+                      "  (istorei offset=8 (aload temp=\"box\") (iload parm=0)))         "
+                      " (block name=\"join\"                                             "
+                      "  (NULLCHK (iloadi id=\"f\" offset=8 (aload temp=\"box\")))       "
+                      "  (ireturn (@id \"f\"))))                                         ";
+    auto trees = parseString(inputTrees);
+
+    ASSERT_NOTNULL(trees);
+
+    EXPECT_DEATH(
+        {
+            Tril::DefaultCompiler compiler(trees);
+            if (compiler.compile() != 0)
+                exit(1);
+            auto entry_point = compiler.getEntryPoint<int32_t (*)(int32_t)>();
+            entry_point(0);
+            exit(0);
+        },
+        "");
+}
+#endif /* defined(GTEST_HAS_DEATH_TEST) */
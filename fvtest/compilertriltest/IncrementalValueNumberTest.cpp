@@ -0,0 +1,271 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include <vector>
+#include "JitTest.hpp"
+#include "default_compiler.hpp"
+#include "compile/Compilation.hpp"
+#include "il/Node.hpp"
+#include "il/Node_inlines.hpp"
+#include "infra/Cfg.hpp"
+#include "infra/ILWalk.hpp"
+#include "optimizer/Optimizer.hpp"
+#include "optimizer/ValueNumberInfo.hpp"
+#include "ras/IlVerifier.hpp"
+
+/**
+ * Builds value numbers for the optimized trees, applies an edit, patches the
+ * value numbers incrementally and compares them against a full rebuild.
+ *
+ * The verifier always stops the compilation, so the edited trees never reach
+ * the code generator.
+ */
+class ValueNumberUpdateVerifier : public TR::IlVerifier
+   {
+   public:
+   ValueNumberUpdateVerifier() : _updated(false), _numberOfNodes(0), _numberOfMismatches(0), _numberOfUnsoundPairs(0) {}
+
+   int32_t verify(TR::ResolvedMethodSymbol *sym)
+      {
+      TR::Compilation *comp = sym->comp();
+      TR::Optimizer *optimizer = comp->getOptimizer();
+
+      // reaching definitions, which use/def info needs for temps stored more
+      // than once, run over the structure
+      if (comp->getFlowGraph()->getStructure() == NULL)
+         optimizer->doStructuralAnalysis();
+
+      optimizer->setValueNumberInfo(NULL);
+      optimizer->setUseDefInfo(NULL);
+      optimizer->setValueNumberInfo(optimizer->createValueNumberInfo(false, false));
+
+      editTrees(sym);
+
+      _updated = optimizer->updateValueNumberInfo();
+      if (!_updated)
+         return 1;
+
+      TR_ValueNumberInfo *updated = optimizer->getValueNumberInfo();
+      optimizer->setUseDefInfo(NULL);
+      TR_ValueNumberInfo *rebuilt = optimizer->createValueNumberInfo(false, false);
+
+      std::vector<TR::Node *> nodes;
+      for (TR::PreorderNodeIterator iter(sym->getFirstTreeTop(), comp); iter.currentTree(); ++iter)
+         nodes.push_back(iter.currentNode());
+      _numberOfNodes = nodes.size();
+
+      for (size_t i = 0; i < nodes.size(); i++)
+         {
+         for (size_t j = i + 1; j < nodes.size(); j++)
+            {
+            bool sharedByUpdate = updated->getValueNumber(nodes[i]) == updated->getValueNumber(nodes[j]);
+            bool sharedByRebuild = rebuilt->getValueNumber(nodes[i]) == rebuilt->getValueNumber(nodes[j]);
+            if (sharedByUpdate != sharedByRebuild)
+               _numberOfMismatches++;
+            if (sharedByUpdate && !sharedByRebuild)
+               _numberOfUnsoundPairs++;
+            }
+         }
+
+      delete rebuilt;
+      return 1;
+      }
+
+   bool updated() { return _updated; }
+   size_t numberOfNodes() { return _numberOfNodes; }
+   int32_t numberOfMismatches() { return _numberOfMismatches; }
+
+   /**
+    * Pairs of nodes that the update says have the same value but a rebuild
+    * does not.  Patching may split value numbers, but never share them wrongly.
+    */
+   int32_t numberOfUnsoundPairs() { return _numberOfUnsoundPairs; }
+
+   protected:
+   virtual void editTrees(TR::ResolvedMethodSymbol *sym) {}
+
+   /**
+    * Returns the last node in preorder that has the given opcode.
+    */
+   TR::Node *findLast(TR::ResolvedMethodSymbol *sym, TR::ILOpCodes op)
+      {
+      TR::Node *found = NULL;
+      for (TR::PreorderNodeIterator iter(sym->getFirstTreeTop(), sym->comp()); iter.currentTree(); ++iter)
+         {
+         if (iter.currentNode()->getOpCodeValue() == op)
+            found = iter.currentNode();
+         }
+      return found;
+      }
+
+   private:
+   bool _updated;
+   size_t _numberOfNodes;
+   int32_t _numberOfMismatches;
+   int32_t _numberOfUnsoundPairs;
+   };
+
+/**
+ * Replaces the constant operand of the last multiply, so that it no longer
+ * shares a value number with the first one.
+ */
+class ChangeMultiplierVerifier : public ValueNumberUpdateVerifier
+   {
+   protected:
+   void editTrees(TR::ResolvedMethodSymbol *sym)
+      {
+      TR::Node *mul = findLast(sym, TR::imul);
+      mul->getSecondChild()->recursivelyDecReferenceCount();
+      mul->setAndIncChild(1, TR::Node::iconst(4));
+      }
+   };
+
+/**
+ * Replaces the value stored to the temp, which changes a def.
+ */
+class ChangeStoredValueVerifier : public ValueNumberUpdateVerifier
+   {
+   protected:
+   void editTrees(TR::ResolvedMethodSymbol *sym)
+      {
+      TR::Node *store = findLast(sym, TR::istore);
+      store->getFirstChild()->recursivelyDecReferenceCount();
+      store->setAndIncChild(0, TR::Node::iconst(5));
+      }
+   };
+
+/**
+ * Moves the tree that anchors the first load of the temp below the store
+ * that follows it, so the load now sees the other value.  No def is added,
+ * changed or reordered.
+ */
+class MoveLoadAcrossStoreVerifier : public ValueNumberUpdateVerifier
+   {
+   protected:
+   void editTrees(TR::ResolvedMethodSymbol *sym)
+      {
+      TR::TreeTop *anchor = NULL;
+      TR::TreeTop *store = NULL;
+      for (TR::TreeTop *tt = sym->getFirstTreeTop(); tt; tt = tt->getNextTreeTop())
+         {
+         if (tt->getNode()->getOpCodeValue() == TR::treetop && anchor == NULL)
+            anchor = tt;
+         else if (tt->getNode()->getOpCodeValue() == TR::istore && anchor != NULL)
+            store = tt;
+         }
+
+      _load = anchor->getNode()->getFirstChild();
+      anchor->getPrevTreeTop()->join(anchor->getNextTreeTop());
+      store->insertAfter(anchor);
+      }
+
+   public:
+   MoveLoadAcrossStoreVerifier() : _load(NULL) {}
+
+   TR::Node *movedLoad() { return _load; }
+
+   private:
+   TR::Node *_load;
+   };
+
+class IncrementalValueNumberTest : public TRTest::JitOptTest
+   {
+   public:
+   IncrementalValueNumberTest()
+      {
+      /*
+       * A trivial optimization keeps the simplifier from folding the
+       * trees before the verifier looks at them.
+       */
+      addOptimization(OMR::trivialDeadTreeRemoval);
+      }
+   };
+
+static const char *sharedMultiplyTrees = "(method return=Int32 args=[Int32]              "
+                                         " (block                                        "
+                                         "  (ireturn                                     "
+                                         "   (iadd                                       "
+                                         "    (imul (iload parm=0) (iconst 3))           "
+                                         "    (imul (iload parm=0) (iconst 3))))))       ";
+
+TEST_F(IncrementalValueNumberTest, UnchangedTreesMatchRebuild) {
+    auto trees = parseString(sharedMultiplyTrees);
+
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    ValueNumberUpdateVerifier verifier;
+
+    ASSERT_NE(0, compiler.compileWithVerifier(&verifier));
+    ASSERT_TRUE(verifier.updated()) << "Value numbers were not updated";
+    EXPECT_GT(verifier.numberOfNodes(), 0u);
+    EXPECT_EQ(0, verifier.numberOfMismatches()) << "Updated value numbers differ from a rebuild";
+}
+
+TEST_F(IncrementalValueNumberTest, ChangedOperandMatchesRebuild) {
+    auto trees = parseString(sharedMultiplyTrees);
+
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    ChangeMultiplierVerifier verifier;
+
+    ASSERT_NE(0, compiler.compileWithVerifier(&verifier));
+    ASSERT_TRUE(verifier.updated()) << "Value numbers were not updated";
+    EXPECT_EQ(0, verifier.numberOfMismatches()) << "Updated value numbers differ from a rebuild";
+}
+
+TEST_F(IncrementalValueNumberTest, ChangedDefInvalidatesValueNumbers) {
+    auto inputTrees = "(method return=Int32 args=[Int32]                      "
+                      " (block                                                "
+                      "  (istore temp=\"t\" (iload parm=0))                   "
+                      "  (ireturn (iadd (iload temp=\"t\") (iconst 1)))))     ";
+    auto trees = parseString(inputTrees);
+
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    ChangeStoredValueVerifier verifier;
+
+    ASSERT_NE(0, compiler.compileWithVerifier(&verifier));
+    EXPECT_FALSE(verifier.updated()) << "Value numbers were patched after a def changed";
+}
+
+TEST_F(IncrementalValueNumberTest, LoadMovedAcrossStoreIsRenumbered) {
+    auto inputTrees = "(method return=Int32 args=[Int32]                      "
+                      " (block                                                "
+                      "  (istore temp=\"t\" (iload parm=0))                   "
+                      "  (treetop (iload id=\"first\" temp=\"t\"))            "
+                      "  (istore temp=\"t\" (iconst 7))                       "
+                      "  (ireturn (iadd (@id \"first\") (iload temp=\"t\")))))";
+    auto trees = parseString(inputTrees);
+
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    MoveLoadAcrossStoreVerifier verifier;
+
+    ASSERT_NE(0, compiler.compileWithVerifier(&verifier));
+    ASSERT_NOTNULL(verifier.movedLoad());
+    ASSERT_EQ(TR::iload, verifier.movedLoad()->getOpCodeValue());
+    ASSERT_TRUE(verifier.updated()) << "Value numbers were not updated";
+    EXPECT_EQ(0, verifier.numberOfUnsoundPairs()) << "The moved load kept the value number of the value it no longer sees";
+}
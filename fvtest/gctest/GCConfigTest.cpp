@@ -43,6 +43,7 @@
 const char *gcTests[] = {"fvtest/gctest/configuration/sample_GC_config.xml"
                         , "fvtest/gctest/configuration/test_system_gc.xml"
                         , "fvtest/gctest/configuration/global_GC_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_cpu_target_config.xml"
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
                         , "fvtest/gctest/configuration/optavgpause_GC_config.xml"
 #endif
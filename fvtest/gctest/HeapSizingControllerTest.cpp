@@ -0,0 +1,241 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+#include "HeapSizingController.hpp"
+#include "gcTestHelpers.hpp"
+
+#include <gtest/gtest.h>
+
+#define MB ((uintptr_t)1024 * 1024)
+#define REGION_SIZE (512 * 1024)
+#define MAXIMUM_HEAP_SIZE (8192 * MB)
+#define TARGET_GC_PERCENTAGE 5
+#define MEMORY_LIMIT_PERCENTAGE 75
+
+/* The controller leaves the heap alone once GC CPU is within this band around the target */
+#define LOWEST_SETTLED_PERCENTAGE (TARGET_GC_PERCENTAGE / (1.0 + HEAP_SIZING_CONTROLLER_TOLERANCE))
+#define HIGHEST_SETTLED_PERCENTAGE (TARGET_GC_PERCENTAGE * (1.0 + HEAP_SIZING_CONTROLLER_TOLERANCE))
+
+/**
+ * A simulated application. A collection traces the live data, and the mutator then runs
+ * until it has allocated the free memory again.
+ */
+struct SimulatedWorkload {
+	uintptr_t liveBytes;
+	double allocationRate; /**< bytes allocated per second */
+	double markRate; /**< bytes traced per second by each GC thread */
+	uintptr_t cycles; /**< number of collections the workload runs for */
+};
+
+static double
+measureGCPercentage(const SimulatedWorkload &workload, uintptr_t heapSize, uintptr_t gcThreadCount)
+{
+	double gcTime = (double)workload.liveBytes / (workload.markRate * (double)gcThreadCount);
+	double mutatorTime = (double)(heapSize - workload.liveBytes) / workload.allocationRate;
+
+	return (100.0 * gcTime) / (gcTime + mutatorTime);
+}
+
+/**
+ * Collect once and resize the heap as the controller asks. The heap cannot shrink below
+ * the live data, as contraction is limited to free memory.
+ * @return the new heap size
+ */
+static uintptr_t
+runCycle(MM_HeapSizingController *controller, const SimulatedWorkload &workload, uintptr_t heapSize, uintptr_t gcThreadCount)
+{
+	uintptr_t ceiling = controller->getHeapCeiling(MAXIMUM_HEAP_SIZE, REGION_SIZE);
+	double gcPercentage = measureGCPercentage(workload, heapSize, gcThreadCount);
+	uintptr_t targetHeapSize = controller->calculateTargetHeapSize(heapSize, heapSize - workload.liveBytes, gcPercentage, gcThreadCount, ceiling, REGION_SIZE);
+
+	EXPECT_LE(targetHeapSize, ceiling);
+
+	return OMR_MAX(targetHeapSize, workload.liveBytes + REGION_SIZE);
+}
+
+/**
+ * Run the workload through its cycles and check that the heap has settled: the GC CPU is
+ * within the controller's tolerance of the target (unless the ceiling prevents it) and the
+ * last few cycles did not resize the heap.
+ * @return the final heap size
+ */
+static uintptr_t
+runUntilSettled(MM_HeapSizingController *controller, const SimulatedWorkload &workload, uintptr_t heapSize, uintptr_t gcThreadCount)
+{
+	uintptr_t settledCycles = 0;
+
+	for (uintptr_t cycle = 0; cycle < workload.cycles; cycle++) {
+		uintptr_t newHeapSize = runCycle(controller, workload, heapSize, gcThreadCount);
+		settledCycles = (newHeapSize == heapSize) ? (settledCycles + 1) : 0;
+		heapSize = newHeapSize;
+	}
+
+	EXPECT_GE(settledCycles, (uintptr_t)5) << "heap size is still changing after " << workload.cycles << " cycles";
+
+	double gcCPUPercentage = controller->getGCCPUPercentage(measureGCPercentage(workload, heapSize, gcThreadCount), gcThreadCount);
+	if (heapSize < controller->getHeapCeiling(MAXIMUM_HEAP_SIZE, REGION_SIZE)) {
+		EXPECT_GE(gcCPUPercentage, LOWEST_SETTLED_PERCENTAGE);
+	}
+	EXPECT_LE(gcCPUPercentage, HIGHEST_SETTLED_PERCENTAGE) << "heap settled at " << (heapSize / MB) << "MB";
+
+	return heapSize;
+}
+
+/* 100MB live, allocating 200MB/s, tracing 1GB/s: 380MB free spends 5% in GC */
+static const SimulatedWorkload steadyWorkload = { 100 * MB, 200.0 * MB, 1000.0 * MB, 30 };
+
+TEST(HeapSizingController, disabled)
+{
+	MM_HeapSizingController controller(0, MEMORY_LIMIT_PERCENTAGE);
+
+	ASSERT_FALSE(controller.isEnabled());
+	EXPECT_EQ(110 * MB, controller.calculateTargetHeapSize(110 * MB, 10 * MB, 60.0, 1, MAXIMUM_HEAP_SIZE, REGION_SIZE));
+}
+
+TEST(HeapSizingController, noMeasurement)
+{
+	MM_HeapSizingController controller(TARGET_GC_PERCENTAGE, MEMORY_LIMIT_PERCENTAGE);
+
+	controller.updateLimits(0, 1);
+	EXPECT_EQ(110 * MB, controller.calculateTargetHeapSize(110 * MB, 10 * MB, 0.0, 1, MAXIMUM_HEAP_SIZE, REGION_SIZE));
+}
+
+TEST(HeapSizingController, heapCeiling)
+{
+	MM_HeapSizingController controller(TARGET_GC_PERCENTAGE, 50);
+
+	/* no limit */
+	controller.updateLimits(0, 1);
+	EXPECT_EQ(MAXIMUM_HEAP_SIZE, controller.getHeapCeiling(MAXIMUM_HEAP_SIZE, REGION_SIZE));
+
+	/* half of the limit, aligned down */
+	controller.updateLimits((1000 * MB) + (REGION_SIZE / 2), 1);
+	EXPECT_EQ(500 * MB, controller.getHeapCeiling(MAXIMUM_HEAP_SIZE, REGION_SIZE));
+
+	/* never above the maximum heap size */
+	controller.updateLimits(4 * MAXIMUM_HEAP_SIZE, 1);
+	EXPECT_EQ(MAXIMUM_HEAP_SIZE, controller.getHeapCeiling(MAXIMUM_HEAP_SIZE, REGION_SIZE));
+
+	/* never below one region */
+	controller.updateLimits(REGION_SIZE / 2, 1);
+	EXPECT_EQ((uintptr_t)REGION_SIZE, controller.getHeapCeiling(MAXIMUM_HEAP_SIZE, REGION_SIZE));
+}
+
+TEST(HeapSizingController, gcThreadsBelowCPULimit)
+{
+	MM_HeapSizingController controller(TARGET_GC_PERCENTAGE, MEMORY_LIMIT_PERCENTAGE);
+
+	/* 20% of the time in GC on 2 of 8 CPUs is 40 of 680 CPU-units */
+	controller.updateLimits(0, 8);
+	EXPECT_NEAR(100.0 * 40.0 / 680.0, controller.getGCCPUPercentage(20.0, 2), 0.001);
+
+	/* GC threads that can use every CPU use the same share of CPU as of time */
+	EXPECT_DOUBLE_EQ(20.0, controller.getGCCPUPercentage(20.0, 8));
+	controller.updateLimits(0, 2);
+	EXPECT_DOUBLE_EQ(20.0, controller.getGCCPUPercentage(20.0, 8));
+}
+
+TEST(HeapSizingController, expandsToMeetTarget)
+{
+	MM_HeapSizingController controller(TARGET_GC_PERCENTAGE, MEMORY_LIMIT_PERCENTAGE);
+
+	controller.updateLimits(0, 1);
+	uintptr_t heapSize = runUntilSettled(&controller, steadyWorkload, 110 * MB, 1);
+	EXPECT_GT(heapSize, 110 * MB);
+}
+
+TEST(HeapSizingController, contractsToMeetTarget)
+{
+	MM_HeapSizingController controller(TARGET_GC_PERCENTAGE, MEMORY_LIMIT_PERCENTAGE);
+
+	controller.updateLimits(0, 1);
+	uintptr_t heapSize = runUntilSettled(&controller, steadyWorkload, 4096 * MB, 1);
+	EXPECT_LT(heapSize, 4096 * MB);
+}
+
+TEST(HeapSizingController, scalesWithCPULimit)
+{
+	MM_HeapSizingController controller(TARGET_GC_PERCENTAGE, MEMORY_LIMIT_PERCENTAGE);
+
+	/* two GC threads on eight CPUs: the GC CPU share is lower than its share of time, so a smaller heap meets the target */
+	controller.updateLimits(0, 1);
+	uintptr_t oneCPUHeapSize = runUntilSettled(&controller, steadyWorkload, 110 * MB, 1);
+	controller.updateLimits(0, 8);
+	uintptr_t eightCPUHeapSize = runUntilSettled(&controller, steadyWorkload, 110 * MB, 2);
+	EXPECT_LT(eightCPUHeapSize, oneCPUHeapSize);
+}
+
+TEST(HeapSizingController, staysWithinMemoryLimit)
+{
+	MM_HeapSizingController controller(TARGET_GC_PERCENTAGE, MEMORY_LIMIT_PERCENTAGE);
+	/* 300MB live needs over 1GB of heap to meet the target, but may only use 384MB */
+	SimulatedWorkload workload = { 300 * MB, 200.0 * MB, 1000.0 * MB, 30 };
+
+	controller.updateLimits(512 * MB, 1);
+	uintptr_t heapSize = 310 * MB;
+	for (uintptr_t cycle = 0; cycle < workload.cycles; cycle++) {
+		heapSize = runCycle(&controller, workload, heapSize, 1);
+		ASSERT_LE(heapSize, 384 * MB);
+	}
+	EXPECT_EQ(384 * MB, heapSize);
+}
+
+TEST(HeapSizingController, followsMemoryLimitChanges)
+{
+	MM_HeapSizingController controller(TARGET_GC_PERCENTAGE, MEMORY_LIMIT_PERCENTAGE);
+
+	ASSERT_TRUE(controller.updateLimits(2048 * MB, 1));
+	uintptr_t heapSize = runUntilSettled(&controller, steadyWorkload, 110 * MB, 1);
+	ASSERT_GT(heapSize, 300 * MB);
+
+	/* the limit drops below what the heap uses: the very next cycle must fit in the new ceiling */
+	ASSERT_TRUE(controller.updateLimits(400 * MB, 1));
+	ASSERT_FALSE(controller.updateLimits(400 * MB, 1));
+	heapSize = runCycle(&controller, steadyWorkload, heapSize, 1);
+	EXPECT_LE(heapSize, 300 * MB);
+
+	/* the limit is lifted: the heap grows back to meet the target */
+	ASSERT_TRUE(controller.updateLimits(0, 1));
+	uintptr_t liftedHeapSize = runUntilSettled(&controller, steadyWorkload, heapSize, 1);
+	EXPECT_GT(liftedHeapSize, 300 * MB);
+}
+
+TEST(HeapSizingController, allocationTrace)
+{
+	MM_HeapSizingController controller(TARGET_GC_PERCENTAGE, MEMORY_LIMIT_PERCENTAGE);
+	/* phases of an application's run; the heap must settle on the target in each */
+	const SimulatedWorkload trace[] = {
+		{ 100 * MB, 200.0 * MB, 1000.0 * MB, 30 }, /* startup */
+		{ 100 * MB, 800.0 * MB, 1000.0 * MB, 30 }, /* allocation burst */
+		{ 400 * MB, 800.0 * MB, 1000.0 * MB, 30 }, /* live data grows */
+		{ 400 * MB, 50.0 * MB, 1000.0 * MB, 40 }, /* quiet */
+		{ 50 * MB, 50.0 * MB, 1000.0 * MB, 40 }, /* live data released */
+	};
+	uintptr_t heapSize = 110 * MB;
+
+	controller.updateLimits(0, 4);
+	for (size_t phase = 0; phase < sizeof(trace) / sizeof(trace[0]); phase++) {
+		SCOPED_TRACE(phase);
+		heapSize = OMR_MAX(heapSize, trace[phase].liveBytes + REGION_SIZE);
+		heapSize = runUntilSettled(&controller, trace[phase], heapSize, 4);
+	}
+}
@@ -82,6 +82,10 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 					extensions->allowMergedSpaces = atoi(attr.value()) * unitSize;
 				} else if (0 == strcmp(attr.name(), "maxSizeDefaultMemorySpace")) {
 					extensions->maxSizeDefaultMemorySpace = atoi(attr.value()) * unitSize;
+				} else if (0 == strcmp(attr.name(), "heapSizingGCCPUTarget")) {
+					extensions->heapSizingGCCPUTarget = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "heapSizingContainerMemoryPercentage")) {
+					extensions->heapSizingContainerMemoryPercentage = atoi(attr.value());
 				} else if (0 == strcmp(attr.name(), "gcthreadCount")) {
 					/* TODO: support multi-thread GC*/
 				} else if (0 == strcmp(attr.name(), "GCPolicy")) {
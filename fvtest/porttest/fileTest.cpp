@@ -206,6 +206,24 @@ TEST(PortInitializationTest, File)
 
 	/* omrfile_test16 */
 	OMRTEST_EXPECT_NOT_NULL(OMRPORTLIB->file_error_message);
+
+	/* PositionalReadWrite */
+	OMRTEST_EXPECT_NOT_NULL(OMRPORTLIB->file_pread);
+	OMRTEST_EXPECT_NOT_NULL(OMRPORTLIB->file_pwrite);
+
+	/* VectoredReadWrite */
+	OMRTEST_EXPECT_NOT_NULL(OMRPORTLIB->file_readv);
+	OMRTEST_EXPECT_NOT_NULL(OMRPORTLIB->file_writev);
+
+	/* PreallocateAndAdvise */
+	OMRTEST_EXPECT_NOT_NULL(OMRPORTLIB->file_preallocate);
+	OMRTEST_EXPECT_NOT_NULL(OMRPORTLIB->file_advise);
+
+	/* AsyncReadWrite */
+	OMRTEST_EXPECT_NOT_NULL(OMRPORTLIB->file_aio_context_create);
+	OMRTEST_EXPECT_NOT_NULL(OMRPORTLIB->file_aio_context_destroy);
+	OMRTEST_EXPECT_NOT_NULL(OMRPORTLIB->file_aio_submit);
+	OMRTEST_EXPECT_NOT_NULL(OMRPORTLIB->file_aio_complete);
 }
 
 /**
@@ -309,3 +327,424 @@ TEST_F(PortFileTest, WriteAppendRead)
 	rc = omrfile_close(fileDescriptor);
 	OMRTEST_ASSERT_TRUE((0 == rc), "omrfile_close() failed\n");
 }
+
+/**
+ * Verify
+ * @ref omrfile.c::omrfile_pread "omrfile_pread()" and
+ * @ref omrfile.c::omrfile_pwrite "omrfile_pwrite()"
+ * transfer data at the given offsets and leave the file position alone.
+ */
+TEST_F(PortFileTest, PositionalReadWrite)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+
+	char outputLine[] = "0123456789";
+	intptr_t rc = 0;
+
+	fileDescriptor = omrfile_open(fileName, EsOpenRead | EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+	OMRTEST_ASSERT_TRUE((-1 != fileDescriptor), "omrfile_open \"" << fileName << "\" failed\n");
+
+	/* write the second half first to leave a hole that the second write fills */
+	rc = omrfile_pwrite(fileDescriptor, "FGHIJ", 5, 5);
+	OMRTEST_ASSERT_TRUE((5 == rc), "omrfile_pwrite() returned " << rc << ", expected 5\n");
+	rc = omrfile_pwrite(fileDescriptor, "ABCDE", 5, 0);
+	OMRTEST_ASSERT_TRUE((5 == rc), "omrfile_pwrite() returned " << rc << ", expected 5\n");
+#if !defined(OMR_OS_WINDOWS)
+	/* positional transfers move the file pointer of synchronous handles on Windows */
+	OMRTEST_ASSERT_TRUE((0 == omrfile_seek(fileDescriptor, 0, EsSeekCur)), "omrfile_pwrite() moved the file position\n");
+#endif /* !defined(OMR_OS_WINDOWS) */
+
+	rc = omrfile_pread(fileDescriptor, outputLine, 10, 0);
+	OMRTEST_ASSERT_TRUE((10 == rc), "omrfile_pread() returned " << rc << ", expected 10\n");
+	OMRTEST_ASSERT_TRUE((0 == strcmp("ABCDEFGHIJ", outputLine)), "Read back data \"" << outputLine << "\" not matching expected data\n");
+
+	rc = omrfile_pread(fileDescriptor, outputLine, 10, 7);
+	OMRTEST_ASSERT_TRUE((3 == rc), "omrfile_pread() returned " << rc << " for a read past the end, expected 3\n");
+
+	rc = omrfile_pread(fileDescriptor, outputLine, 10, 10);
+	OMRTEST_ASSERT_TRUE((-1 == rc), "omrfile_pread() returned " << rc << " at the end of the file, expected -1\n");
+}
+
+/**
+ * Verify
+ * @ref omrfile.c::omrfile_readv "omrfile_readv()" and
+ * @ref omrfile.c::omrfile_writev "omrfile_writev()"
+ * both at the file position and at explicit offsets.
+ */
+TEST_F(PortFileTest, VectoredReadWrite)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+
+	char header[] = "HEAD";
+	char body[] = "body-of-record";
+	char trailer[] = "TAIL";
+	OMRFileIOVec writeVec[3] = { { header, 4 }, { body, 14 }, { trailer, 4 } };
+	char first[8];
+	char second[14];
+	OMRFileIOVec readVec[2] = { { first, sizeof(first) }, { second, sizeof(second) } };
+	intptr_t rc = 0;
+
+	fileDescriptor = omrfile_open(fileName, EsOpenRead | EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+	OMRTEST_ASSERT_TRUE((-1 != fileDescriptor), "omrfile_open \"" << fileName << "\" failed\n");
+
+	rc = omrfile_writev(fileDescriptor, writeVec, 3, OMRPORT_FILE_CURRENT_POSITION);
+	OMRTEST_ASSERT_TRUE((22 == rc), "omrfile_writev() returned " << rc << ", expected 22\n");
+	OMRTEST_ASSERT_TRUE((22 == omrfile_seek(fileDescriptor, 0, EsSeekCur)), "omrfile_writev() did not advance the file position\n");
+
+	/* a second copy of the record at an explicit offset */
+	rc = omrfile_writev(fileDescriptor, writeVec, 3, 100);
+	OMRTEST_ASSERT_TRUE((22 == rc), "omrfile_writev() returned " << rc << ", expected 22\n");
+	OMRTEST_ASSERT_TRUE((122 == omrfile_flength(fileDescriptor)), "omrfile_writev() wrote to the wrong offset\n");
+
+	rc = omrfile_readv(fileDescriptor, readVec, 2, 100);
+	OMRTEST_ASSERT_TRUE((22 == rc), "omrfile_readv() returned " << rc << ", expected 22\n");
+	OMRTEST_ASSERT_TRUE((0 == memcmp(first, "HEADbody", sizeof(first))), "omrfile_readv() filled the first buffer incorrectly\n");
+	OMRTEST_ASSERT_TRUE((0 == memcmp(second, "-of-recordTAIL", sizeof(second))), "omrfile_readv() filled the second buffer incorrectly\n");
+
+	OMRTEST_ASSERT_TRUE((0 == omrfile_seek(fileDescriptor, 0, EsSeekSet)), "omrfile_seek() failed\n");
+	rc = omrfile_readv(fileDescriptor, readVec, 2, OMRPORT_FILE_CURRENT_POSITION);
+	OMRTEST_ASSERT_TRUE((22 == rc), "omrfile_readv() returned " << rc << ", expected 22\n");
+	OMRTEST_ASSERT_TRUE((22 == omrfile_seek(fileDescriptor, 0, EsSeekCur)), "omrfile_readv() did not advance the file position\n");
+	OMRTEST_ASSERT_TRUE((0 == memcmp(first, "HEADbody", sizeof(first))), "omrfile_readv() filled the first buffer incorrectly\n");
+}
+
+/**
+ * Verify
+ * @ref omrfile.c::omrfile_preallocate "omrfile_preallocate()" extends the file and
+ * @ref omrfile.c::omrfile_advise "omrfile_advise()" accepts every hint.
+ */
+TEST_F(PortFileTest, PreallocateAndAdvise)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+
+	const int64_t length = 256 * 1024;
+	int32_t rc = 0;
+	int32_t advice = 0;
+
+	fileDescriptor = omrfile_open(fileName, EsOpenRead | EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+	OMRTEST_ASSERT_TRUE((-1 != fileDescriptor), "omrfile_open \"" << fileName << "\" failed\n");
+
+	rc = omrfile_preallocate(fileDescriptor, 0, length);
+	OMRTEST_ASSERT_TRUE((0 == rc), "omrfile_preallocate() returned " << rc << "\n");
+	OMRTEST_ASSERT_TRUE((length == omrfile_flength(fileDescriptor)), "omrfile_preallocate() did not extend the file\n");
+
+	/* preallocating inside the file must not shrink it */
+	rc = omrfile_preallocate(fileDescriptor, 0, 4096);
+	OMRTEST_ASSERT_TRUE((0 == rc), "omrfile_preallocate() returned " << rc << "\n");
+	OMRTEST_ASSERT_TRUE((length == omrfile_flength(fileDescriptor)), "omrfile_preallocate() changed the file length\n");
+
+	rc = omrfile_preallocate(fileDescriptor, 0, 0);
+	OMRTEST_ASSERT_TRUE((0 > rc), "omrfile_preallocate() accepted an empty range\n");
+
+	for (advice = OMRPORT_FILE_ADVICE_NORMAL; advice <= OMRPORT_FILE_ADVICE_NOREUSE; advice++) {
+		rc = omrfile_advise(fileDescriptor, 0, 0, advice);
+		OMRTEST_ASSERT_TRUE((0 == rc), "omrfile_advise() returned " << rc << " for advice " << advice << "\n");
+	}
+	rc = omrfile_advise(fileDescriptor, 0, 0, OMRPORT_FILE_ADVICE_NOREUSE + 1);
+	OMRTEST_ASSERT_TRUE((0 > rc), "omrfile_advise() accepted an unknown advice\n");
+}
+
+/**
+ * Verify files opened with EsOpenDirect can be written and read with aligned buffers.
+ * File systems without direct I/O support (e.g. tmpfs) reject the open, and the test is skipped.
+ */
+TEST_F(PortFileTest, DirectIO)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+
+	const uintptr_t blockSize = OMRPORT_FILE_DIRECT_IO_ALIGNMENT;
+	uint8_t *memory = NULL;
+	uint8_t *block = NULL;
+	intptr_t rc = 0;
+	uintptr_t i = 0;
+
+	fileDescriptor = omrfile_open(fileName, EsOpenRead | EsOpenWrite | EsOpenCreate | EsOpenTruncate | EsOpenDirect, 0666);
+	if (-1 == fileDescriptor) {
+		portTestEnv->log("omrfile_open() with EsOpenDirect failed (%d), skipping\n", omrerror_last_error_number());
+		return;
+	}
+
+	memory = (uint8_t *)omrmem_allocate_memory(blockSize * 3, OMRMEM_CATEGORY_PORT_LIBRARY);
+	OMRTEST_ASSERT_TRUE((NULL != memory), "omrmem_allocate_memory() failed\n");
+	block = (uint8_t *)(((uintptr_t)memory + blockSize - 1) & ~(blockSize - 1));
+	for (i = 0; i < blockSize; i++) {
+		block[i] = (uint8_t)i;
+	}
+
+	rc = omrfile_pwrite(fileDescriptor, block, blockSize, blockSize);
+	EXPECT_EQ((intptr_t)blockSize, rc) << "omrfile_pwrite() of an aligned block failed";
+
+	memset(block, 0, blockSize);
+	rc = omrfile_pread(fileDescriptor, block, blockSize, blockSize);
+	EXPECT_EQ((intptr_t)blockSize, rc) << "omrfile_pread() of an aligned block failed";
+	for (i = 0; i < blockSize; i++) {
+		if (block[i] != (uint8_t)i) {
+			ADD_FAILURE() << "mismatch at byte " << i;
+			break;
+		}
+	}
+
+	omrmem_free_memory(memory);
+}
+
+#define ASYNC_BLOCKS 8
+#define ASYNC_BLOCK_SIZE 512
+#define ASYNC_QUEUE_DEPTH 4
+
+/**
+ * @internal
+ * Completion callback for the async tests, counts the requests it has seen.
+ */
+static void
+countCompletion(struct OMRPortLibrary *portLibrary, struct OMRFileAIORequest *request)
+{
+	*(uintptr_t *)request->userData += 1;
+}
+
+/**
+ * @internal
+ * Write blocks of a file as a batch, sync it and read the blocks back as a second batch.
+ * @param[in] portLibrary The port library under test
+ * @param[in] fd File descriptor opened for reading and writing
+ * @param[in] flags Flags for omrfile_aio_context_create
+ */
+static void
+asyncReadWrite(struct OMRPortLibrary *portLibrary, intptr_t fd, uint32_t flags)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	struct OMRFileAIOContext *context = NULL;
+	OMRFileAIORequest requests[ASYNC_BLOCKS];
+	OMRFileAIORequest *batch[ASYNC_BLOCKS];
+	OMRFileAIORequest syncRequest;
+	OMRFileAIORequest *syncBatch = &syncRequest;
+	uint8_t buffers[ASYNC_BLOCKS][ASYNC_BLOCK_SIZE];
+	uintptr_t completions = 0;
+	intptr_t rc = 0;
+	uintptr_t i = 0;
+	uintptr_t j = 0;
+
+	rc = omrfile_aio_context_create(ASYNC_QUEUE_DEPTH * 2, flags, &context);
+	ASSERT_EQ(0, rc) << "omrfile_aio_context_create() failed";
+
+	/* write the blocks back to front so that the requests are not sequential */
+	memset(requests, 0, sizeof(requests));
+	for (i = 0; i < ASYNC_BLOCKS; i++) {
+		memset(buffers[i], (int)('A' + i), ASYNC_BLOCK_SIZE);
+		requests[i].fd = fd;
+		requests[i].opcode = OMRPORT_FILE_AIO_WRITE;
+		requests[i].buffer = buffers[i];
+		requests[i].length = ASYNC_BLOCK_SIZE;
+		requests[i].offset = (int64_t)((ASYNC_BLOCKS - 1 - i) * ASYNC_BLOCK_SIZE);
+		requests[i].callback = countCompletion;
+		requests[i].userData = &completions;
+		batch[i] = &requests[i];
+	}
+	rc = omrfile_aio_submit(context, batch, ASYNC_BLOCKS);
+	EXPECT_EQ(ASYNC_BLOCKS, rc) << "omrfile_aio_submit() did not queue the whole batch";
+	rc = omrfile_aio_complete(context, ASYNC_BLOCKS, -1);
+	EXPECT_EQ(ASYNC_BLOCKS, rc) << "omrfile_aio_complete() did not return the whole batch";
+	EXPECT_EQ((uintptr_t)ASYNC_BLOCKS, completions) << "callbacks were not run";
+	for (i = 0; i < ASYNC_BLOCKS; i++) {
+		EXPECT_EQ(ASYNC_BLOCK_SIZE, requests[i].result) << "write " << i << " failed";
+	}
+
+	memset(&syncRequest, 0, sizeof(syncRequest));
+	syncRequest.fd = fd;
+	syncRequest.opcode = OMRPORT_FILE_AIO_SYNC;
+	rc = omrfile_aio_submit(context, &syncBatch, 1);
+	EXPECT_EQ(1, rc) << "omrfile_aio_submit() of a sync failed";
+	rc = omrfile_aio_complete(context, 1, -1);
+	EXPECT_EQ(1, rc) << "omrfile_aio_complete() of a sync failed";
+	EXPECT_EQ(0, syncRequest.result) << "sync failed";
+
+	/* nothing is in flight, so polling finds nothing */
+	rc = omrfile_aio_complete(context, 1, 0);
+	EXPECT_EQ(0, rc) << "omrfile_aio_complete() returned requests that were never queued";
+
+	completions = 0;
+	memset(buffers, 0, sizeof(buffers));
+	for (i = 0; i < ASYNC_BLOCKS; i++) {
+		requests[i].opcode = OMRPORT_FILE_AIO_READ;
+	}
+	rc = omrfile_aio_submit(context, batch, ASYNC_BLOCKS);
+	EXPECT_EQ(ASYNC_BLOCKS, rc) << "omrfile_aio_submit() did not queue the whole batch";
+	/* collect the batch in pieces; destroy must wait for whatever is left */
+	rc = omrfile_aio_complete(context, 1, 10000);
+	EXPECT_LE(1, rc) << "omrfile_aio_complete() timed out";
+	omrfile_aio_context_destroy(context);
+	EXPECT_EQ((uintptr_t)ASYNC_BLOCKS, completions) << "omrfile_aio_context_destroy() dropped requests in flight";
+
+	for (i = 0; i < ASYNC_BLOCKS; i++) {
+		EXPECT_EQ(ASYNC_BLOCK_SIZE, requests[i].result) << "read " << i << " failed";
+		for (j = 0; j < ASYNC_BLOCK_SIZE; j++) {
+			if (buffers[i][j] != (uint8_t)('A' + i)) {
+				ADD_FAILURE() << "read " << i << " mismatch at byte " << j;
+				break;
+			}
+		}
+	}
+}
+
+/**
+ * Verify batches of asynchronous writes, syncs and reads, using io_uring where the kernel provides it.
+ */
+TEST_F(PortFileTest, AsyncReadWrite)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+
+	fileDescriptor = omrfile_open(fileName, EsOpenRead | EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+	OMRTEST_ASSERT_TRUE((-1 != fileDescriptor), "omrfile_open \"" << fileName << "\" failed\n");
+
+	asyncReadWrite(OMRPORTLIB, fileDescriptor, 0);
+}
+
+/**
+ * Verify batches of asynchronous writes, syncs and reads performed by worker threads.
+ */
+TEST_F(PortFileTest, AsyncReadWriteThreads)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+
+	fileDescriptor = omrfile_open(fileName, EsOpenRead | EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+	OMRTEST_ASSERT_TRUE((-1 != fileDescriptor), "omrfile_open \"" << fileName << "\" failed\n");
+
+	asyncReadWrite(OMRPORTLIB, fileDescriptor, OMRPORT_FILE_AIO_USE_THREADS);
+}
+
+/**
+ * @internal
+ * Read past the end of a file of one block: a read that starts at the end returns 0
+ * bytes and a read that crosses the end returns the bytes up to it.
+ * @param[in] portLibrary The port library under test
+ * @param[in] fd File descriptor opened for reading and writing
+ * @param[in] flags Flags for omrfile_aio_context_create
+ */
+static void
+asyncReadEOF(struct OMRPortLibrary *portLibrary, intptr_t fd, uint32_t flags)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	struct OMRFileAIOContext *context = NULL;
+	OMRFileAIORequest requests[2];
+	OMRFileAIORequest *batch[2];
+	uint8_t block[ASYNC_BLOCK_SIZE];
+	uint8_t buffers[2][ASYNC_BLOCK_SIZE];
+	uintptr_t completions = 0;
+	intptr_t rc = 0;
+	uintptr_t i = 0;
+
+	memset(block, 'A', ASYNC_BLOCK_SIZE);
+	rc = omrfile_pwrite(fd, block, ASYNC_BLOCK_SIZE, 0);
+	ASSERT_EQ((intptr_t)ASYNC_BLOCK_SIZE, rc) << "omrfile_pwrite() failed";
+
+	rc = omrfile_aio_context_create(ASYNC_QUEUE_DEPTH, flags, &context);
+	ASSERT_EQ(0, rc) << "omrfile_aio_context_create() failed";
+
+	memset(requests, 0, sizeof(requests));
+	for (i = 0; i < 2; i++) {
+		requests[i].fd = fd;
+		requests[i].opcode = OMRPORT_FILE_AIO_READ;
+		requests[i].buffer = buffers[i];
+		requests[i].length = ASYNC_BLOCK_SIZE;
+		requests[i].callback = countCompletion;
+		requests[i].userData = &completions;
+		batch[i] = &requests[i];
+	}
+	requests[0].offset = ASYNC_BLOCK_SIZE;
+	requests[1].offset = ASYNC_BLOCK_SIZE / 2;
+
+	rc = omrfile_aio_submit(context, batch, 2);
+	EXPECT_EQ(2, rc) << "omrfile_aio_submit() did not queue the whole batch";
+	rc = omrfile_aio_complete(context, 2, -1);
+	EXPECT_EQ(2, rc) << "omrfile_aio_complete() did not return the whole batch";
+	omrfile_aio_context_destroy(context);
+
+	EXPECT_EQ(0, requests[0].result) << "read at end of file did not return 0";
+	EXPECT_EQ(ASYNC_BLOCK_SIZE / 2, requests[1].result) << "read across end of file did not stop at the end";
+}
+
+/**
+ * Verify that asynchronous reads at end of file return 0, using io_uring where the kernel provides it.
+ */
+TEST_F(PortFileTest, AsyncReadEOF)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+
+	fileDescriptor = omrfile_open(fileName, EsOpenRead | EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+	OMRTEST_ASSERT_TRUE((-1 != fileDescriptor), "omrfile_open \"" << fileName << "\" failed\n");
+
+	asyncReadEOF(OMRPORTLIB, fileDescriptor, 0);
+}
+
+/**
+ * Verify that asynchronous reads at end of file return 0 when performed by worker threads.
+ */
+TEST_F(PortFileTest, AsyncReadEOFThreads)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+
+	fileDescriptor = omrfile_open(fileName, EsOpenRead | EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+	OMRTEST_ASSERT_TRUE((-1 != fileDescriptor), "omrfile_open \"" << fileName << "\" failed\n");
+
+	asyncReadEOF(OMRPORTLIB, fileDescriptor, OMRPORT_FILE_AIO_USE_THREADS);
+}
+
+/**
+ * Verify omrfile_aio_submit stops at the queue depth and rejects malformed requests,
+ * and that failed requests report a portable error.
+ */
+TEST_F(PortFileTest, AsyncQueueLimits)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+
+	struct OMRFileAIOContext *context = NULL;
+	OMRFileAIORequest requests[ASYNC_QUEUE_DEPTH + 1];
+	OMRFileAIORequest *batch[ASYNC_QUEUE_DEPTH + 1];
+	uint8_t buffer[ASYNC_BLOCK_SIZE];
+	uintptr_t completions = 0;
+	intptr_t rc = 0;
+	uintptr_t i = 0;
+
+	fileDescriptor = omrfile_open(fileName, EsOpenRead | EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+	OMRTEST_ASSERT_TRUE((-1 != fileDescriptor), "omrfile_open \"" << fileName << "\" failed\n");
+
+	rc = omrfile_aio_context_create(0, 0, &context);
+	EXPECT_GT(0, rc) << "omrfile_aio_context_create() accepted a queue depth of 0";
+	rc = omrfile_aio_context_create(ASYNC_QUEUE_DEPTH, 0, &context);
+	ASSERT_EQ(0, rc) << "omrfile_aio_context_create() failed";
+
+	memset(requests, 0, sizeof(requests));
+	memset(buffer, 'x', sizeof(buffer));
+	for (i = 0; i <= ASYNC_QUEUE_DEPTH; i++) {
+		requests[i].fd = fileDescriptor;
+		requests[i].opcode = OMRPORT_FILE_AIO_WRITE;
+		requests[i].buffer = buffer;
+		requests[i].length = sizeof(buffer);
+		requests[i].offset = (int64_t)(i * sizeof(buffer));
+		requests[i].callback = countCompletion;
+		requests[i].userData = &completions;
+		batch[i] = &requests[i];
+	}
+
+	rc = omrfile_aio_submit(context, batch, ASYNC_QUEUE_DEPTH + 1);
+	EXPECT_EQ(ASYNC_QUEUE_DEPTH, rc) << "omrfile_aio_submit() overran the queue depth";
+	rc = omrfile_aio_submit(context, &batch[ASYNC_QUEUE_DEPTH], 1);
+	EXPECT_EQ(0, rc) << "omrfile_aio_submit() queued into a full context";
+	rc = omrfile_aio_complete(context, ASYNC_QUEUE_DEPTH + 1, -1);
+	EXPECT_EQ(ASYNC_QUEUE_DEPTH, rc) << "omrfile_aio_complete() did not return every request in flight";
+	EXPECT_EQ((uintptr_t)ASYNC_QUEUE_DEPTH, completions);
+
+	requests[0].opcode = OMRPORT_FILE_AIO_SYNC + 1;
+	rc = omrfile_aio_submit(context, batch, 1);
+	EXPECT_EQ(OMRPORT_ERROR_FILE_INVAL, rc) << "omrfile_aio_submit() accepted an unknown operation";
+
+	/* a read from a descriptor that is not open fails through the result, not the submit */
+	requests[0].opcode = OMRPORT_FILE_AIO_READ;
+	requests[0].fd = -1;
+	rc = omrfile_aio_submit(context, batch, 1);
+	EXPECT_EQ(1, rc) << "omrfile_aio_submit() rejected a well formed request";
+	rc = omrfile_aio_complete(context, 1, -1);
+	EXPECT_EQ(1, rc);
+	EXPECT_GT(0, requests[0].result) << "read from a bad descriptor succeeded";
+
+	omrfile_aio_context_destroy(context);
+}
@@ -42,6 +42,7 @@
 
 #include "testHelpers.hpp"
 #include "omrport.h"
+#include "omrthread.h"
 
 extern PortTestEnvironment *portTestEnv;
 
@@ -1517,6 +1518,249 @@ TEST(PortMemTest, mem_test9_category_walk)
 	reportTestExit(OMRPORTLIB, testName);
 }
 
+#define THREAD_CACHE_BLOCKS 100
+
+/*
+ * Tests the per thread allocation cache: freed small blocks are reused and
+ * batched category counters are exact once the cache is flushed.
+ */
+TEST(PortMemTest, mem_test10_thread_cache)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	const char *testName = "omrmem_test10_thread_cache";
+	struct CategoriesState categoriesState;
+	void *blocks[THREAD_CACHE_BLOCKS];
+	uintptr_t initialBlocks = 0;
+	uintptr_t initialBytes = 0;
+	void *first = NULL;
+	void *second = NULL;
+	uintptr_t i = 0;
+
+	reportTestEntry(OMRPORTLIB, testName);
+
+	/* Make sure this thread's per thread buffer exists before counting */
+	omrport_control(OMRPORT_CTLDATA_MEM_THREAD_CACHE, 1);
+	omrmem_free_memory(omrmem_allocate_memory(1, OMRMEM_CATEGORY_PORT_LIBRARY));
+	omrport_control(OMRPORT_CTLDATA_MEM_THREAD_CACHE, 0);
+
+	getCategoriesState(OMRPORTLIB, &categoriesState);
+	initialBlocks = categoriesState.portLibraryBlocks;
+	initialBytes = categoriesState.portLibraryBytes;
+
+	omrport_control(OMRPORT_CTLDATA_MEM_THREAD_CACHE, 1);
+
+	/* Requests that round to the same block size reuse the freed block */
+	first = omrmem_allocate_memory(48, OMRMEM_CATEGORY_PORT_LIBRARY);
+	verifyMemory(OMRPORTLIB, testName, (char *)first, 48, "omrmem_allocate_memory");
+	omrmem_free_memory(first);
+	second = omrmem_allocate_memory(41, OMRMEM_CATEGORY_PORT_LIBRARY);
+	verifyMemory(OMRPORTLIB, testName, (char *)second, 41, "omrmem_allocate_memory");
+	if (first != second) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "Freed block %p not reused, got %p\n", first, second);
+	}
+	second = omrmem_reallocate_memory(second, 1000, OMRMEM_CATEGORY_PORT_LIBRARY);
+	verifyMemory(OMRPORTLIB, testName, (char *)second, 1000, "omrmem_reallocate_memory");
+	omrmem_free_memory(second);
+
+	for (i = 0; i < THREAD_CACHE_BLOCKS; i++) {
+		blocks[i] = omrmem_allocate_memory(i, OMRMEM_CATEGORY_PORT_LIBRARY);
+		verifyMemory(OMRPORTLIB, testName, (char *)blocks[i], i, "omrmem_allocate_memory");
+	}
+
+	/* Disabling the cache flushes the calling thread's batched counters */
+	omrport_control(OMRPORT_CTLDATA_MEM_THREAD_CACHE, 0);
+	getCategoriesState(OMRPORTLIB, &categoriesState);
+	if (categoriesState.portLibraryBlocks != (initialBlocks + THREAD_CACHE_BLOCKS)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "Unexpected number of blocks after allocate. Expected %zd, got %zd.\n",
+				initialBlocks + THREAD_CACHE_BLOCKS, categoriesState.portLibraryBlocks);
+	}
+
+	omrport_control(OMRPORT_CTLDATA_MEM_THREAD_CACHE, 1);
+	for (i = 0; i < THREAD_CACHE_BLOCKS; i++) {
+		omrmem_free_memory(blocks[i]);
+	}
+	omrport_control(OMRPORT_CTLDATA_MEM_THREAD_CACHE, 0);
+
+	getCategoriesState(OMRPORTLIB, &categoriesState);
+	if (categoriesState.portLibraryBlocks != initialBlocks) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "Unexpected number of blocks after free. Expected %zd, got %zd.\n",
+				initialBlocks, categoriesState.portLibraryBlocks);
+	}
+	if (categoriesState.portLibraryBytes != initialBytes) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "Unexpected number of bytes after free. Expected %zd, got %zd.\n",
+				initialBytes, categoriesState.portLibraryBytes);
+	}
+
+	reportTestExit(OMRPORTLIB, testName);
+}
+
+static int J9THREAD_PROC
+disableThreadCache(void *arg)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT((OMRPortLibrary *)arg);
+
+	omrport_control(OMRPORT_CTLDATA_MEM_THREAD_CACHE, 0);
+	return 0;
+}
+
+/*
+ * Tests that disabling the per thread allocation cache from another thread makes
+ * this thread's later frees bypass its cache, and that the stale cache, batched
+ * counters included, is flushed once the cache is enabled again.
+ */
+TEST(PortMemTest, mem_test11_thread_cache_disabled_elsewhere)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	const char *testName = "omrmem_test11_thread_cache_disabled_elsewhere";
+	struct CategoriesState categoriesState;
+	void *blocks[THREAD_CACHE_BLOCKS];
+	omrthread_t disabler = NULL;
+	omrthread_attr_t attr = NULL;
+	uintptr_t initialBlocks = 0;
+	uintptr_t initialBytes = 0;
+	uintptr_t i = 0;
+
+	reportTestEntry(OMRPORTLIB, testName);
+
+	/* Make sure this thread's per thread buffer exists before counting */
+	omrport_control(OMRPORT_CTLDATA_MEM_THREAD_CACHE, 1);
+	omrmem_free_memory(omrmem_allocate_memory(1, OMRMEM_CATEGORY_PORT_LIBRARY));
+	omrport_control(OMRPORT_CTLDATA_MEM_THREAD_CACHE, 0);
+
+	getCategoriesState(OMRPORTLIB, &categoriesState);
+	initialBlocks = categoriesState.portLibraryBlocks;
+	initialBytes = categoriesState.portLibraryBytes;
+
+	/* Leave freed blocks and batched counter updates in this thread's cache */
+	omrport_control(OMRPORT_CTLDATA_MEM_THREAD_CACHE, 1);
+	for (i = 0; i < THREAD_CACHE_BLOCKS; i++) {
+		blocks[i] = omrmem_allocate_memory(i, OMRMEM_CATEGORY_PORT_LIBRARY);
+	}
+	for (i = 0; i < (THREAD_CACHE_BLOCKS / 2); i++) {
+		omrmem_free_memory(blocks[i]);
+	}
+
+	if ((J9THREAD_SUCCESS != omrthread_attr_init(&attr))
+		|| (J9THREAD_SUCCESS != omrthread_attr_set_detachstate(&attr, J9THREAD_CREATE_JOINABLE))
+		|| (J9THREAD_SUCCESS != omrthread_create_ex(&disabler, &attr, 0, disableThreadCache, OMRPORTLIB))
+	) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "Could not start the thread disabling the cache\n");
+	} else {
+		omrthread_join(disabler);
+	}
+	omrthread_attr_destroy(&attr);
+
+	/* The cache is off, so these frees go straight to the system allocator */
+	for (i = (THREAD_CACHE_BLOCKS / 2); i < THREAD_CACHE_BLOCKS; i++) {
+		omrmem_free_memory(blocks[i]);
+	}
+
+	/* The first allocation with the cache on again finds this thread's cache stale and flushes it */
+	omrport_control(OMRPORT_CTLDATA_MEM_THREAD_CACHE, 1);
+	omrmem_free_memory(omrmem_allocate_memory(1, OMRMEM_CATEGORY_PORT_LIBRARY));
+	omrport_control(OMRPORT_CTLDATA_MEM_THREAD_CACHE, 0);
+
+	getCategoriesState(OMRPORTLIB, &categoriesState);
+	if (categoriesState.portLibraryBlocks != initialBlocks) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "Unexpected number of blocks after free. Expected %zd, got %zd.\n",
+				initialBlocks, categoriesState.portLibraryBlocks);
+	}
+	if (categoriesState.portLibraryBytes != initialBytes) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "Unexpected number of bytes after free. Expected %zd, got %zd.\n",
+				initialBytes, categoriesState.portLibraryBytes);
+	}
+
+	reportTestExit(OMRPORTLIB, testName);
+}
+
+/*
+ * Tests that freeing a block twice while it is in the per thread allocation cache
+ * leaves it in the cache only, so it is handed out once rather than twice.
+ */
+TEST(PortMemTest, mem_test12_thread_cache_double_free)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	const char *testName = "omrmem_test12_thread_cache_double_free";
+	void *block = NULL;
+	void *first = NULL;
+	void *second = NULL;
+
+	reportTestEntry(OMRPORTLIB, testName);
+
+	omrport_control(OMRPORT_CTLDATA_MEM_THREAD_CACHE, 1);
+	block = omrmem_allocate_memory(24, OMRMEM_CATEGORY_PORT_LIBRARY);
+	omrmem_free_memory(block);
+	/* Reported as memory corruption; the block must not also be freed to the system */
+	omrmem_free_memory(block);
+
+	first = omrmem_allocate_memory(24, OMRMEM_CATEGORY_PORT_LIBRARY);
+	second = omrmem_allocate_memory(24, OMRMEM_CATEGORY_PORT_LIBRARY);
+	if (first != block) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "Cached block %p not reused, got %p\n", block, first);
+	}
+	if (first == second) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "Block %p handed out twice after a double free\n", first);
+	}
+	omrmem_free_memory(first);
+	omrmem_free_memory(second);
+	omrport_control(OMRPORT_CTLDATA_MEM_THREAD_CACHE, 0);
+
+	reportTestExit(OMRPORTLIB, testName);
+}
+
+/*
+ * Tests that blocks freed through the per thread allocation cache with sampled
+ * tag checks are still reused and counted exactly.
+ */
+TEST(PortMemTest, mem_test13_thread_cache_tag_check_interval)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	const char *testName = "omrmem_test13_thread_cache_tag_check_interval";
+	struct CategoriesState categoriesState;
+	void *blocks[THREAD_CACHE_BLOCKS];
+	uintptr_t initialBlocks = 0;
+	uintptr_t initialBytes = 0;
+	uintptr_t round = 0;
+	uintptr_t i = 0;
+
+	reportTestEntry(OMRPORTLIB, testName);
+
+	/* Make sure this thread's per thread buffer exists before counting */
+	omrport_control(OMRPORT_CTLDATA_MEM_THREAD_CACHE, 1);
+	omrmem_free_memory(omrmem_allocate_memory(1, OMRMEM_CATEGORY_PORT_LIBRARY));
+	omrport_control(OMRPORT_CTLDATA_MEM_THREAD_CACHE, 0);
+
+	getCategoriesState(OMRPORTLIB, &categoriesState);
+	initialBlocks = categoriesState.portLibraryBlocks;
+	initialBytes = categoriesState.portLibraryBytes;
+
+	omrport_control(OMRPORT_CTLDATA_MEM_TAG_CHECK_INTERVAL, 16);
+	omrport_control(OMRPORT_CTLDATA_MEM_THREAD_CACHE, 1);
+	for (round = 0; round < 4; round++) {
+		for (i = 0; i < THREAD_CACHE_BLOCKS; i++) {
+			blocks[i] = omrmem_allocate_memory(i % 64, OMRMEM_CATEGORY_PORT_LIBRARY);
+			verifyMemory(OMRPORTLIB, testName, (char *)blocks[i], i % 64, "omrmem_allocate_memory");
+		}
+		for (i = 0; i < THREAD_CACHE_BLOCKS; i++) {
+			omrmem_free_memory(blocks[i]);
+		}
+	}
+	omrport_control(OMRPORT_CTLDATA_MEM_THREAD_CACHE, 0);
+	omrport_control(OMRPORT_CTLDATA_MEM_TAG_CHECK_INTERVAL, 0);
+
+	getCategoriesState(OMRPORTLIB, &categoriesState);
+	if (categoriesState.portLibraryBlocks != initialBlocks) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "Unexpected number of blocks after free. Expected %zd, got %zd.\n",
+				initialBlocks, categoriesState.portLibraryBlocks);
+	}
+	if (categoriesState.portLibraryBytes != initialBytes) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "Unexpected number of bytes after free. Expected %zd, got %zd.\n",
+				initialBytes, categoriesState.portLibraryBytes);
+	}
+
+	reportTestExit(OMRPORTLIB, testName);
+}
+
 /* attempt to free all mem pointers stored in memPtrs array with length */
 static void
 freeMemPointers(struct OMRPortLibrary *portLibrary, void **memPtrs, uintptr_t length)
@@ -20,6 +20,9 @@
  *******************************************************************************/
 
 #include "omrcfg.h"
+#if !defined(OMR_OS_WINDOWS)
+#include <signal.h>
+#endif /* !defined(OMR_OS_WINDOWS) */
 #include "omrport.h"
 #include "omrporterror.h"
 #include "omrportsock.h"
@@ -157,6 +160,15 @@ TEST(PortSockTest, library_function_pointers_not_null)
 	EXPECT_NE(OMRPORTLIB->sock_getsockopt_int, (void *)NULL);
 	EXPECT_NE(OMRPORTLIB->sock_getsockopt_linger, (void *)NULL);
 	EXPECT_NE(OMRPORTLIB->sock_getsockopt_timeval, (void *)NULL);
+	EXPECT_NE(OMRPORTLIB->sock_eventset_create, (void *)NULL);
+	EXPECT_NE(OMRPORTLIB->sock_eventset_add, (void *)NULL);
+	EXPECT_NE(OMRPORTLIB->sock_eventset_modify, (void *)NULL);
+	EXPECT_NE(OMRPORTLIB->sock_eventset_remove, (void *)NULL);
+	EXPECT_NE(OMRPORTLIB->sock_eventset_wait, (void *)NULL);
+	EXPECT_NE(OMRPORTLIB->sock_get_event_info, (void *)NULL);
+	EXPECT_NE(OMRPORTLIB->sock_eventset_destroy, (void *)NULL);
+	EXPECT_NE(OMRPORTLIB->sock_sendfile, (void *)NULL);
+	EXPECT_NE(OMRPORTLIB->sock_splice, (void *)NULL);
 }
 
 /**
@@ -1324,3 +1336,324 @@ TEST(PortSockTest, poll_functionality_many_sockets)
 		EXPECT_EQ(OMRPORTLIB->sock_close(OMRPORTLIB, &sockets[i]), 0);
 	}
 }
+
+/**
+ * Start a loopback stream server on the given port and accept one connection from a new client.
+ *
+ * @param[in] portLibrary
+ * @param[in] port The server port.
+ * @param[out] serverSocket The listening socket, if it is NULL on entry; otherwise it is reused.
+ * @param[in] serverSockAddr The socket address of the server.
+ * @param[out] clientSocket The connected client socket.
+ * @param[out] connectedServerSocket The accepted server side of the connection.
+ *
+ * @return on success, report an error otherwise.
+ */
+void
+connect_loopback_pair(struct OMRPortLibrary *portLibrary, uint16_t port, omrsock_socket_t *serverSocket, omrsock_sockaddr_t serverSockAddr, omrsock_socket_t *clientSocket, omrsock_socket_t *connectedServerSocket)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	OMRSockAddrStorage clientSockAddr;
+	OMRSockAddrStorage connectedServerSockAddr;
+
+	if (NULL == *serverSocket) {
+		uint32_t inaddrAny = OMRPORTLIB->sock_htonl(OMRPORTLIB, OMRSOCK_INADDR_ANY);
+		uint8_t serverAddr[4];
+		memcpy(serverAddr, &inaddrAny, 4);
+		ASSERT_EQ(OMRPORTLIB->sock_sockaddr_init(OMRPORTLIB, serverSockAddr, OMRSOCK_AF_INET, serverAddr, OMRPORTLIB->sock_htons(OMRPORTLIB, port)), 0);
+		start_server(OMRPORTLIB, OMRSOCK_AF_INET, OMRSOCK_STREAM, serverSocket, serverSockAddr);
+	}
+	connect_client_to_server(OMRPORTLIB, (char *)"localhost", NULL, OMRSOCK_AF_INET, OMRSOCK_STREAM, clientSocket, &clientSockAddr, serverSockAddr);
+	ASSERT_EQ(OMRPORTLIB->sock_accept(OMRPORTLIB, *serverSocket, &connectedServerSockAddr, connectedServerSocket), 0);
+}
+
+/**
+ * Test registration, modification, removal and waiting in an event set.
+ *
+ * A connection is established over loopback and both ends are added to an event set with
+ * their own user data. Data sent from the server must be reported once for the client with
+ * that user data; after it is drained an edge-triggered registration must stay quiet. A
+ * one-shot registration must report only once until it is re-armed.
+ */
+TEST(PortSockTest, eventset_functionality_basic)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	OMRSockAddrStorage serverSockAddr;
+	omrsock_socket_t serverSocket = NULL;
+	omrsock_socket_t clientSocket = NULL;
+	omrsock_socket_t connectedServerSocket = NULL;
+	omrsock_eventset_t eventSet = NULL;
+	OMRSockEvent events[4];
+	omrsock_socket_t eventSocket = NULL;
+	void *eventUserData = NULL;
+	int16_t revents = 0;
+	int clientTag = 0;
+	int serverTag = 0;
+	const char *msg = "eventset";
+	char buf[100] = {0};
+
+	connect_loopback_pair(OMRPORTLIB, 4930, &serverSocket, &serverSockAddr, &clientSocket, &connectedServerSocket);
+	ASSERT_EQ(OMRPORTLIB->sock_fcntl(OMRPORTLIB, clientSocket, OMRSOCK_O_NONBLOCK), 0);
+	ASSERT_EQ(OMRPORTLIB->sock_fcntl(OMRPORTLIB, connectedServerSocket, OMRSOCK_O_NONBLOCK), 0);
+
+	ASSERT_EQ(OMRPORTLIB->sock_eventset_create(OMRPORTLIB, &eventSet), 0);
+	ASSERT_EQ(OMRPORTLIB->sock_eventset_add(OMRPORTLIB, eventSet, clientSocket, OMRSOCK_POLLIN | OMRSOCK_EVENT_EDGE_TRIGGERED, &clientTag), 0);
+	ASSERT_EQ(OMRPORTLIB->sock_eventset_add(OMRPORTLIB, eventSet, connectedServerSocket, OMRSOCK_POLLIN, &serverTag), 0);
+	EXPECT_NE(OMRPORTLIB->sock_eventset_add(OMRPORTLIB, eventSet, clientSocket, OMRSOCK_POLLIN, &clientTag), 0);
+
+	/* Nothing has been sent, so nothing is readable. */
+	EXPECT_EQ(OMRPORTLIB->sock_eventset_wait(OMRPORTLIB, eventSet, events, 4, 0), 0);
+
+	ASSERT_EQ(OMRPORTLIB->sock_send(OMRPORTLIB, connectedServerSocket, (uint8_t *)msg, strlen(msg) + 1, 0), (int32_t)strlen(msg) + 1);
+	ASSERT_EQ(OMRPORTLIB->sock_eventset_wait(OMRPORTLIB, eventSet, events, 4, 5000), 1);
+	EXPECT_EQ(OMRPORTLIB->sock_get_event_info(OMRPORTLIB, &events[0], &eventSocket, &eventUserData, &revents), 0);
+	EXPECT_EQ(clientSocket, eventSocket);
+	EXPECT_EQ((void *)&clientTag, eventUserData);
+	EXPECT_NE(revents & OMRSOCK_POLLIN, 0);
+
+	EXPECT_EQ(OMRPORTLIB->sock_recv(OMRPORTLIB, clientSocket, (uint8_t *)buf, sizeof(buf), 0), (int32_t)strlen(msg) + 1);
+	EXPECT_STREQ(msg, buf);
+#if defined(LINUX)
+	/* Drained and edge-triggered: no further event until more data arrives. */
+	EXPECT_EQ(OMRPORTLIB->sock_eventset_wait(OMRPORTLIB, eventSet, events, 4, 0), 0);
+#endif /* defined(LINUX) */
+
+	/* Watch the server side for writability instead; it is writable straight away. */
+	ASSERT_EQ(OMRPORTLIB->sock_eventset_modify(OMRPORTLIB, eventSet, connectedServerSocket, OMRSOCK_POLLOUT, &serverTag), 0);
+	ASSERT_EQ(OMRPORTLIB->sock_eventset_wait(OMRPORTLIB, eventSet, events, 4, 5000), 1);
+	EXPECT_EQ(connectedServerSocket, events[0].socket);
+	EXPECT_EQ((void *)&serverTag, events[0].userData);
+	EXPECT_NE(events[0].events & OMRSOCK_POLLOUT, 0);
+	ASSERT_EQ(OMRPORTLIB->sock_eventset_remove(OMRPORTLIB, eventSet, connectedServerSocket), 0);
+	EXPECT_NE(OMRPORTLIB->sock_eventset_remove(OMRPORTLIB, eventSet, connectedServerSocket), 0);
+
+	/* A one-shot registration reports once, even though the data is left unread. */
+	ASSERT_EQ(OMRPORTLIB->sock_eventset_modify(OMRPORTLIB, eventSet, clientSocket, OMRSOCK_POLLIN | OMRSOCK_EVENT_ONESHOT, &clientTag), 0);
+	ASSERT_EQ(OMRPORTLIB->sock_send(OMRPORTLIB, connectedServerSocket, (uint8_t *)msg, strlen(msg) + 1, 0), (int32_t)strlen(msg) + 1);
+	ASSERT_EQ(OMRPORTLIB->sock_eventset_wait(OMRPORTLIB, eventSet, events, 4, 5000), 1);
+	EXPECT_EQ(clientSocket, events[0].socket);
+	EXPECT_EQ(OMRPORTLIB->sock_eventset_wait(OMRPORTLIB, eventSet, events, 4, 0), 0);
+	ASSERT_EQ(OMRPORTLIB->sock_eventset_modify(OMRPORTLIB, eventSet, clientSocket, OMRSOCK_POLLIN | OMRSOCK_EVENT_ONESHOT, &clientTag), 0);
+	EXPECT_EQ(OMRPORTLIB->sock_eventset_wait(OMRPORTLIB, eventSet, events, 4, 5000), 1);
+
+	EXPECT_EQ(OMRPORTLIB->sock_eventset_remove(OMRPORTLIB, eventSet, clientSocket), 0);
+	EXPECT_EQ(OMRPORTLIB->sock_eventset_destroy(OMRPORTLIB, &eventSet), 0);
+	EXPECT_EQ(eventSet, (void *)NULL);
+
+	EXPECT_EQ(OMRPORTLIB->sock_close(OMRPORTLIB, &serverSocket), 0);
+	EXPECT_EQ(OMRPORTLIB->sock_close(OMRPORTLIB, &clientSocket), 0);
+	EXPECT_EQ(OMRPORTLIB->sock_close(OMRPORTLIB, &connectedServerSocket), 0);
+}
+
+/**
+ * Test an event set watching many connections, with fewer event slots than ready sockets.
+ *
+ * Every client sends one byte. The ready server sides must all be reported, each with the
+ * user data it was registered with, over as many waits as the event array requires.
+ */
+TEST(PortSockTest, eventset_functionality_many_sockets)
+{
+#define NUM_CONNECTIONS 32
+#define NUM_EVENT_SLOTS 8
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	OMRSockAddrStorage serverSockAddr;
+	omrsock_socket_t serverSocket = NULL;
+	omrsock_socket_t clientSockets[NUM_CONNECTIONS];
+	omrsock_socket_t connectedSockets[NUM_CONNECTIONS];
+	uintptr_t seen[NUM_CONNECTIONS];
+	omrsock_eventset_t eventSet = NULL;
+	OMRSockEvent events[NUM_EVENT_SLOTS];
+	uint8_t byte = 'x';
+	int32_t reported = 0;
+
+	ASSERT_EQ(OMRPORTLIB->sock_eventset_create(OMRPORTLIB, &eventSet), 0);
+	for (uintptr_t i = 0; i < NUM_CONNECTIONS; i++) {
+		clientSockets[i] = NULL;
+		connectedSockets[i] = NULL;
+		seen[i] = 0;
+		connect_loopback_pair(OMRPORTLIB, 4930, &serverSocket, &serverSockAddr, &clientSockets[i], &connectedSockets[i]);
+		ASSERT_EQ(OMRPORTLIB->sock_eventset_add(OMRPORTLIB, eventSet, connectedSockets[i], OMRSOCK_POLLIN | OMRSOCK_EVENT_ONESHOT, (void *)i), 0);
+		ASSERT_EQ(OMRPORTLIB->sock_send(OMRPORTLIB, clientSockets[i], &byte, 1, 0), 1);
+	}
+
+	for (int32_t attempt = 0; (attempt < 100) && (reported < NUM_CONNECTIONS); attempt++) {
+		int32_t rc = OMRPORTLIB->sock_eventset_wait(OMRPORTLIB, eventSet, events, NUM_EVENT_SLOTS, 1000);
+		ASSERT_GE(rc, 0);
+		ASSERT_LE(rc, NUM_EVENT_SLOTS);
+		for (int32_t j = 0; j < rc; j++) {
+			uintptr_t index = (uintptr_t)events[j].userData;
+			ASSERT_LT(index, (uintptr_t)NUM_CONNECTIONS);
+			EXPECT_EQ(connectedSockets[index], events[j].socket);
+			EXPECT_NE(events[j].events & OMRSOCK_POLLIN, 0);
+			seen[index] += 1;
+			reported += 1;
+		}
+	}
+	EXPECT_EQ(reported, NUM_CONNECTIONS);
+	for (uintptr_t i = 0; i < NUM_CONNECTIONS; i++) {
+		EXPECT_EQ(seen[i], (uintptr_t)1) << "connection " << i;
+	}
+
+	for (uintptr_t i = 0; i < NUM_CONNECTIONS; i++) {
+		EXPECT_EQ(OMRPORTLIB->sock_eventset_remove(OMRPORTLIB, eventSet, connectedSockets[i]), 0);
+		EXPECT_EQ(OMRPORTLIB->sock_close(OMRPORTLIB, &connectedSockets[i]), 0);
+		EXPECT_EQ(OMRPORTLIB->sock_close(OMRPORTLIB, &clientSockets[i]), 0);
+	}
+	EXPECT_EQ(OMRPORTLIB->sock_eventset_destroy(OMRPORTLIB, &eventSet), 0);
+	EXPECT_EQ(OMRPORTLIB->sock_close(OMRPORTLIB, &serverSocket), 0);
+#undef NUM_EVENT_SLOTS
+#undef NUM_CONNECTIONS
+}
+
+/**
+ * Test @ref omrsock_sendfile with an explicit offset and with the file position.
+ */
+TEST(PortSockTest, sendfile_functionality)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	OMRSockAddrStorage serverSockAddr;
+	omrsock_socket_t serverSocket = NULL;
+	omrsock_socket_t clientSocket = NULL;
+	omrsock_socket_t connectedServerSocket = NULL;
+	const char *fileName = "omrsockSendfileTest.txt";
+	const char *contents = "0123456789abcdefghijklmnopqrstuvwxyz";
+	intptr_t length = (intptr_t)strlen(contents);
+	char buf[100] = {0};
+	int64_t offset = 10;
+	intptr_t fd = -1;
+
+	connect_loopback_pair(OMRPORTLIB, 4930, &serverSocket, &serverSockAddr, &clientSocket, &connectedServerSocket);
+
+	fd = OMRPORTLIB->file_open(OMRPORTLIB, fileName, EsOpenCreate | EsOpenRead | EsOpenWrite | EsOpenTruncate, 0666);
+	ASSERT_NE(fd, -1);
+	ASSERT_EQ(OMRPORTLIB->file_write(OMRPORTLIB, fd, contents, length), length);
+	ASSERT_EQ(OMRPORTLIB->file_seek(OMRPORTLIB, fd, 0, EsSeekSet), 0);
+
+	/* From an offset: the file position stays where it is. */
+	EXPECT_EQ(OMRPORTLIB->sock_sendfile(OMRPORTLIB, connectedServerSocket, fd, &offset, 10), 10);
+	EXPECT_EQ(offset, 20);
+	EXPECT_EQ(OMRPORTLIB->sock_recv(OMRPORTLIB, clientSocket, (uint8_t *)buf, 10, 0), 10);
+	EXPECT_EQ(memcmp(buf, contents + 10, 10), 0);
+
+	/* From the file position, asking for more than is left. */
+	EXPECT_EQ(OMRPORTLIB->sock_sendfile(OMRPORTLIB, connectedServerSocket, fd, NULL, sizeof(buf)), length);
+	EXPECT_EQ(OMRPORTLIB->file_seek(OMRPORTLIB, fd, 0, EsSeekCur), length);
+	intptr_t received = 0;
+	while (received < length) {
+		int32_t rc = OMRPORTLIB->sock_recv(OMRPORTLIB, clientSocket, (uint8_t *)buf + received, (int32_t)(length - received), 0);
+		ASSERT_GT(rc, 0);
+		received += rc;
+	}
+	EXPECT_EQ(memcmp(buf, contents, length), 0);
+
+	EXPECT_EQ(OMRPORTLIB->file_close(OMRPORTLIB, fd), 0);
+	OMRPORTLIB->file_unlink(OMRPORTLIB, fileName);
+	EXPECT_EQ(OMRPORTLIB->sock_close(OMRPORTLIB, &serverSocket), 0);
+	EXPECT_EQ(OMRPORTLIB->sock_close(OMRPORTLIB, &clientSocket), 0);
+	EXPECT_EQ(OMRPORTLIB->sock_close(OMRPORTLIB, &connectedServerSocket), 0);
+}
+
+/**
+ * Test @ref omrsock_splice by relaying a message between two loopback connections.
+ */
+TEST(PortSockTest, splice_functionality)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	OMRSockAddrStorage serverSockAddr;
+	omrsock_socket_t serverSocket = NULL;
+	omrsock_socket_t inClient = NULL;
+	omrsock_socket_t inServer = NULL;
+	omrsock_socket_t outClient = NULL;
+	omrsock_socket_t outServer = NULL;
+	const char *msg = "This message is relayed by omrsock_splice.";
+	int32_t length = (int32_t)strlen(msg) + 1;
+	char buf[100] = {0};
+	int32_t moved = 0;
+
+	connect_loopback_pair(OMRPORTLIB, 4930, &serverSocket, &serverSockAddr, &inClient, &inServer);
+	connect_loopback_pair(OMRPORTLIB, 4930, &serverSocket, &serverSockAddr, &outClient, &outServer);
+
+	ASSERT_EQ(OMRPORTLIB->sock_send(OMRPORTLIB, inClient, (uint8_t *)msg, length, 0), length);
+	while (moved < length) {
+		int32_t rc = OMRPORTLIB->sock_splice(OMRPORTLIB, inServer, outServer, length - moved);
+		ASSERT_GT(rc, 0);
+		moved += rc;
+	}
+	int32_t received = 0;
+	while (received < length) {
+		int32_t rc = OMRPORTLIB->sock_recv(OMRPORTLIB, outClient, (uint8_t *)buf + received, length - received, 0);
+		ASSERT_GT(rc, 0);
+		received += rc;
+	}
+	EXPECT_STREQ(msg, buf);
+
+	/* The sending side closing shows up as a zero length splice. */
+	EXPECT_EQ(OMRPORTLIB->sock_close(OMRPORTLIB, &inClient), 0);
+	EXPECT_EQ(OMRPORTLIB->sock_splice(OMRPORTLIB, inServer, outServer, length), 0);
+
+	EXPECT_EQ(OMRPORTLIB->sock_close(OMRPORTLIB, &serverSocket), 0);
+	EXPECT_EQ(OMRPORTLIB->sock_close(OMRPORTLIB, &inServer), 0);
+	EXPECT_EQ(OMRPORTLIB->sock_close(OMRPORTLIB, &outClient), 0);
+	EXPECT_EQ(OMRPORTLIB->sock_close(OMRPORTLIB, &outServer), 0);
+}
+
+/**
+ * Test that an @ref omrsock_splice that fails after receiving data drops that data.
+ *
+ * The data is received from a connected socket but cannot be sent to a socket that was never
+ * connected. A later splice to a connected socket must deliver only the data sent after the
+ * failure.
+ */
+TEST(PortSockTest, splice_error_drops_undelivered_data)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	OMRSockAddrStorage serverSockAddr;
+	omrsock_socket_t serverSocket = NULL;
+	omrsock_socket_t inClient = NULL;
+	omrsock_socket_t inServer = NULL;
+	omrsock_socket_t outClient = NULL;
+	omrsock_socket_t outServer = NULL;
+	omrsock_socket_t unconnected = NULL;
+	const char *undelivered = "undelivered";
+	const char *msg = "delivered";
+	int32_t length = (int32_t)strlen(msg) + 1;
+	char buf[100] = {0};
+	int32_t moved = 0;
+
+	connect_loopback_pair(OMRPORTLIB, 4930, &serverSocket, &serverSockAddr, &inClient, &inServer);
+	connect_loopback_pair(OMRPORTLIB, 4930, &serverSocket, &serverSockAddr, &outClient, &outServer);
+	ASSERT_EQ(OMRPORTLIB->sock_socket(OMRPORTLIB, &unconnected, OMRSOCK_AF_INET, OMRSOCK_STREAM, OMRSOCK_IPPROTO_DEFAULT), 0);
+
+#if !defined(OMR_OS_WINDOWS)
+	/* Sending to the unconnected socket would otherwise raise SIGPIPE. */
+	void (*oldHandler)(int) = signal(SIGPIPE, SIG_IGN);
+#endif /* !defined(OMR_OS_WINDOWS) */
+
+	ASSERT_EQ(OMRPORTLIB->sock_send(OMRPORTLIB, inClient, (uint8_t *)undelivered, (int32_t)strlen(undelivered), 0), (int32_t)strlen(undelivered));
+	EXPECT_LT(OMRPORTLIB->sock_splice(OMRPORTLIB, inServer, unconnected, (int32_t)strlen(undelivered)), 0);
+
+#if !defined(OMR_OS_WINDOWS)
+	signal(SIGPIPE, oldHandler);
+#endif /* !defined(OMR_OS_WINDOWS) */
+
+	ASSERT_EQ(OMRPORTLIB->sock_send(OMRPORTLIB, inClient, (uint8_t *)msg, length, 0), length);
+	while (moved < length) {
+		int32_t rc = OMRPORTLIB->sock_splice(OMRPORTLIB, inServer, outServer, length - moved);
+		ASSERT_GT(rc, 0);
+		moved += rc;
+	}
+	int32_t received = 0;
+	while (received < length) {
+		int32_t rc = OMRPORTLIB->sock_recv(OMRPORTLIB, outClient, (uint8_t *)buf + received, length - received, 0);
+		ASSERT_GT(rc, 0);
+		received += rc;
+	}
+	EXPECT_STREQ(msg, buf);
+
+	EXPECT_EQ(OMRPORTLIB->sock_close(OMRPORTLIB, &unconnected), 0);
+	EXPECT_EQ(OMRPORTLIB->sock_close(OMRPORTLIB, &serverSocket), 0);
+	EXPECT_EQ(OMRPORTLIB->sock_close(OMRPORTLIB, &inClient), 0);
+	EXPECT_EQ(OMRPORTLIB->sock_close(OMRPORTLIB, &inServer), 0);
+	EXPECT_EQ(OMRPORTLIB->sock_close(OMRPORTLIB, &outClient), 0);
+	EXPECT_EQ(OMRPORTLIB->sock_close(OMRPORTLIB, &outServer), 0);
+}
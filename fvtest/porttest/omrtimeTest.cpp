@@ -126,6 +126,20 @@ TEST(PortTimeTest, time_test0)
 		outputErrorMessage(PORTTEST_ERROR_ARGS, "portLibrary->time_hires_delta is NULL\n");
 	}
 
+	/* omrtime_test_tick_clock, omrtime_test_tick_clock_tsc */
+	if (NULL == OMRPORTLIB->time_tick_clock) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "portLibrary->time_tick_clock is NULL\n");
+	}
+	if (NULL == OMRPORTLIB->time_tick_frequency) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "portLibrary->time_tick_frequency is NULL\n");
+	}
+	if (NULL == OMRPORTLIB->time_tick_delta) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "portLibrary->time_tick_delta is NULL\n");
+	}
+	if (NULL == OMRPORTLIB->time_tick_source) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "portLibrary->time_tick_source is NULL\n");
+	}
+
 	reportTestExit(OMRPORTLIB, testName);
 }
 
@@ -760,3 +774,161 @@ TEST(PortTimeTest, time_test_hires_delta_rounding)
 exit:
 	reportTestExit(OMRPORTLIB, testName);
 }
+
+/**
+ * Time an interval of at least intervalMicros with both the tick clock and the
+ * high-resolution clock and check that they agree to within 2%.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] testName
+ * @param[in] intervalMicros
+ */
+static void
+omrtime_test_compare_tick_clock(struct OMRPortLibrary *portLibrary, const char *testName, uint64_t intervalMicros)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	uint64_t hiresStart = omrtime_hires_clock();
+	uint64_t tickStart = omrtime_tick_clock();
+	uint64_t hiresMicros = 0;
+	uint64_t tickMicros = 0;
+	uint64_t oneSecond = 0;
+	double error = 0.0;
+
+	do {
+		hiresMicros = omrtime_hires_delta(hiresStart, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+	} while (hiresMicros < intervalMicros);
+	tickMicros = omrtime_tick_delta(tickStart, omrtime_tick_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+	hiresMicros = omrtime_hires_delta(hiresStart, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+
+	error = omrtime_test_compute_error_pct((double)hiresMicros, (double)tickMicros);
+	portTestEnv->log("hires: %llu us    ticks: %llu us    error: %lf\n", hiresMicros, tickMicros, error);
+	if (error > 0.02) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "tick clock and hires clock disagree\n");
+	}
+	/* Conversions truncate, so allow for one unit of rounding */
+	oneSecond = omrtime_tick_delta(0, omrtime_tick_frequency(), OMRPORT_TIME_DELTA_IN_MILLISECONDS);
+	if ((oneSecond < 999) || (oneSecond > 1000)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrtime_tick_delta of one second of ticks is %llums\n", oneSecond);
+	}
+}
+
+/**
+ * Verify the tick clock using its default source, the high-resolution clock.
+ *
+ * Functions verified by this test:
+ * @arg @ref omrtimeticks.c::omrtime_tick_clock "omrtime_tick_clock()"
+ * @arg @ref omrtimeticks.c::omrtime_tick_frequency "omrtime_tick_frequency()"
+ * @arg @ref omrtimeticks.c::omrtime_tick_delta "omrtime_tick_delta()"
+ * @arg @ref omrtimeticks.c::omrtime_tick_source "omrtime_tick_source()"
+ */
+TEST(PortTimeTest, time_test_tick_clock)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	const char *testName = "omrtime_test_tick_clock";
+
+	reportTestEntry(OMRPORTLIB, testName);
+
+	if (OMRPORT_TIME_TICK_SOURCE_HIRES != omrtime_tick_source()) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "tick clock does not default to the hires clock\n");
+	}
+	if (omrtime_tick_frequency() != omrtime_hires_frequency()) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "tick frequency differs from the hires frequency\n");
+	}
+	omrtime_test_compare_tick_clock(OMRPORTLIB, testName, 20000);
+
+	reportTestExit(OMRPORTLIB, testName);
+}
+
+/**
+ * Verify the tick clock with the TSC selected. Platforms without a usable
+ * TSC must fall back to the high-resolution clock.
+ *
+ * Functions verified by this test:
+ * @arg @ref omrtimeticks.c::omrtime_tick_clock "omrtime_tick_clock()"
+ * @arg @ref omrtimeticks.c::omrtime_tick_frequency "omrtime_tick_frequency()"
+ * @arg @ref omrtimeticks.c::omrtime_tick_delta "omrtime_tick_delta()"
+ * @arg @ref omrtimeticks.c::omrtime_tick_source "omrtime_tick_source()"
+ */
+TEST(PortTimeTest, time_test_tick_clock_tsc)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	const char *testName = "omrtime_test_tick_clock_tsc";
+	int32_t rc = 0;
+
+	reportTestEntry(OMRPORTLIB, testName);
+
+	rc = omrport_control(OMRPORT_CTLDATA_TIME_TICK_SOURCE, OMRPORT_TIME_TICK_SOURCE_TSC);
+	if (0 == rc) {
+		if (OMRPORT_TIME_TICK_SOURCE_TSC != omrtime_tick_source()) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "TSC selected but not reported as the tick source\n");
+		}
+		portTestEnv->log("TSC frequency: %llu\n", omrtime_tick_frequency());
+	} else {
+		if (OMRPORT_TIME_TICK_SOURCE_HIRES != omrtime_tick_source()) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "tick clock did not fall back to the hires clock\n");
+		}
+		portTestEnv->log("TSC not available, using the hires clock\n");
+	}
+	omrtime_test_compare_tick_clock(OMRPORTLIB, testName, 50000);
+
+	if (0 != omrport_control(OMRPORT_CTLDATA_TIME_TICK_SOURCE, OMRPORT_TIME_TICK_SOURCE_HIRES)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "could not restore the hires tick source\n");
+	}
+
+	reportTestExit(OMRPORTLIB, testName);
+}
+
+#define OMRTIME_BENCHMARK_CALLS 1000000
+
+/**
+ * Report the cost of one call of each clock. Only the measurements are logged.
+ */
+TEST(PortTimeTest, time_test_clock_cost)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	const char *testName = "omrtime_test_clock_cost";
+	const char *clockNames[] = {"usec_clock", "nano_time", "hires_clock", "tick_clock (hires)", "tick_clock (TSC)"};
+	uintptr_t clock = 0;
+
+	reportTestEntry(OMRPORTLIB, testName);
+
+	for (clock = 0; clock < sizeof(clockNames) / sizeof(clockNames[0]); clock++) {
+		uint64_t sum = 0;
+		uint64_t start = 0;
+		uint64_t elapsed = 0;
+		uintptr_t i = 0;
+
+		if (4 == clock) {
+			if (0 != omrport_control(OMRPORT_CTLDATA_TIME_TICK_SOURCE, OMRPORT_TIME_TICK_SOURCE_TSC)) {
+				portTestEnv->log("%s: not available\n", clockNames[clock]);
+				break;
+			}
+		}
+
+		start = omrtime_hires_clock();
+		for (i = 0; i < OMRTIME_BENCHMARK_CALLS; i++) {
+			switch (clock) {
+			case 0:
+				sum += omrtime_usec_clock();
+				break;
+			case 1:
+				sum += (uint64_t)omrtime_nano_time();
+				break;
+			case 2:
+				sum += omrtime_hires_clock();
+				break;
+			default:
+				sum += omrtime_tick_clock();
+				break;
+			}
+		}
+		elapsed = omrtime_hires_delta(start, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_NANOSECONDS);
+		if (0 == sum) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "%s returned 0\n", clockNames[clock]);
+		}
+		portTestEnv->log("%s: %.1f ns per call\n", clockNames[clock], (double)elapsed / OMRTIME_BENCHMARK_CALLS);
+	}
+	omrport_control(OMRPORT_CTLDATA_TIME_TICK_SOURCE, OMRPORT_TIME_TICK_SOURCE_HIRES);
+
+	reportTestExit(OMRPORTLIB, testName);
+}
@@ -0,0 +1,338 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "omrport.h"
+#include "omrTest.h"
+#include "testHelper.hpp"
+#include "thread_api.h"
+#include "thrtypes.h"
+
+#define MAX_BENCHMARK_THREADS 8
+#define NUM_ENTER_ITERATIONS 100000
+#define NUM_NOTIFY_ITERATIONS 20000
+
+extern ThreadTestEnvironment *omrTestEnv;
+
+typedef struct MonitorTestData {
+	omrthread_monitor_t monitor;
+	uintptr_t iterations;
+	/* only updated while the monitor is owned */
+	volatile uintptr_t counter;
+	volatile uintptr_t turn;
+	volatile uintptr_t nextId;
+} MonitorTestData;
+
+static int J9THREAD_PROC
+enterExitLoop(void *arg)
+{
+	MonitorTestData *data = (MonitorTestData *)arg;
+
+	for (uintptr_t i = 0; i < data->iterations; i++) {
+		omrthread_monitor_enter(data->monitor);
+		data->counter += 1;
+		omrthread_monitor_exit(data->monitor);
+	}
+	return 0;
+}
+
+/**
+ * Wait until the turn is 1, then count once.
+ */
+static int J9THREAD_PROC
+waitForTurnOnce(void *arg)
+{
+	MonitorTestData *data = (MonitorTestData *)arg;
+
+	omrthread_monitor_enter(data->monitor);
+	while (1 != data->turn) {
+		omrthread_monitor_wait(data->monitor);
+	}
+	data->counter += 1;
+	omrthread_monitor_exit(data->monitor);
+	return 0;
+}
+
+/**
+ * Two threads take turns: each waits until it is its turn, hands the turn
+ * over and notifies the other.
+ */
+static int J9THREAD_PROC
+pingPongLoop(void *arg)
+{
+	MonitorTestData *data = (MonitorTestData *)arg;
+	uintptr_t id = 0;
+
+	omrthread_monitor_enter(data->monitor);
+	id = data->nextId;
+	data->nextId += 1;
+	for (uintptr_t i = 0; i < data->iterations; i++) {
+		while (data->turn != id) {
+			omrthread_monitor_wait(data->monitor);
+		}
+		data->turn = 1 - id;
+		data->counter += 1;
+		omrthread_monitor_notify(data->monitor);
+	}
+	omrthread_monitor_exit(data->monitor);
+	return 0;
+}
+
+static omrthread_t
+startThread(omrthread_entrypoint_t entrypoint, MonitorTestData *data)
+{
+	omrthread_t thread = NULL;
+	omrthread_attr_t attr = NULL;
+	EXPECT_EQ(J9THREAD_SUCCESS, omrthread_attr_init(&attr));
+	EXPECT_EQ(J9THREAD_SUCCESS, omrthread_attr_set_detachstate(&attr, J9THREAD_CREATE_JOINABLE));
+	EXPECT_EQ(J9THREAD_SUCCESS, omrthread_create_ex(&thread, &attr, 0, entrypoint, data));
+	omrthread_attr_destroy(&attr);
+	return thread;
+}
+
+/**
+ * Run numThreads threads executing entrypoint on data and return the elapsed time in microseconds.
+ */
+static uint64_t
+runThreads(uintptr_t numThreads, omrthread_entrypoint_t entrypoint, MonitorTestData *data)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(omrTestEnv->getPortLibrary());
+	omrthread_t threads[MAX_BENCHMARK_THREADS];
+	uint64_t start = omrtime_hires_clock();
+
+	for (uintptr_t i = 0; i < numThreads; i++) {
+		threads[i] = startThread(entrypoint, data);
+	}
+	for (uintptr_t i = 0; i < numThreads; i++) {
+		EXPECT_EQ(J9THREAD_SUCCESS, omrthread_join(threads[i]));
+	}
+
+	return omrtime_hires_delta(start, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+}
+
+static uint64_t
+runEnterExit(uintptr_t flags, uintptr_t numThreads, uintptr_t iterations)
+{
+	MonitorTestData data;
+	memset(&data, 0, sizeof(data));
+	data.iterations = iterations;
+	EXPECT_EQ(0, omrthread_monitor_init_with_name(&data.monitor, flags, "enter_exit_monitor"));
+
+	uint64_t elapsed = runThreads(numThreads, enterExitLoop, &data);
+
+	EXPECT_EQ(numThreads * iterations, data.counter);
+	EXPECT_EQ(0, omrthread_monitor_destroy(data.monitor));
+	return elapsed;
+}
+
+static uint64_t
+runPingPong(uintptr_t flags, uintptr_t iterations)
+{
+	MonitorTestData data;
+	memset(&data, 0, sizeof(data));
+	data.iterations = iterations;
+	EXPECT_EQ(0, omrthread_monitor_init_with_name(&data.monitor, flags, "ping_pong_monitor"));
+
+	uint64_t elapsed = runThreads(2, pingPongLoop, &data);
+
+	EXPECT_EQ(2 * iterations, data.counter);
+	EXPECT_EQ(0, omrthread_monitor_destroy(data.monitor));
+	return elapsed;
+}
+
+static const char *
+monitorKind(uintptr_t flags)
+{
+	return (0 == flags) ? "default" : "futex";
+}
+
+/**
+ * Validate mutual exclusion of contended enters. J9THREAD_MONITOR_FUTEX is
+ * ignored on builds where futex monitors are unavailable.
+ */
+TEST(MonitorFutex, EnterExitStress)
+{
+	runEnterExit(J9THREAD_MONITOR_FUTEX, 4, NUM_ENTER_ITERATIONS / 4);
+}
+
+/**
+ * Validate that notify hands the turn back and forth, with both the fast and the original notify.
+ */
+TEST(MonitorFutex, WaitNotify)
+{
+	uintptr_t fastNotify = omrthread_lib_get_flags() & J9THREAD_LIB_FLAG_FAST_NOTIFY;
+
+	omrthread_lib_set_flags(J9THREAD_LIB_FLAG_FAST_NOTIFY);
+	runPingPong(J9THREAD_MONITOR_FUTEX, NUM_NOTIFY_ITERATIONS / 4);
+	omrthread_lib_clear_flags(J9THREAD_LIB_FLAG_FAST_NOTIFY);
+	runPingPong(J9THREAD_MONITOR_FUTEX, NUM_NOTIFY_ITERATIONS / 4);
+
+	if (0 != fastNotify) {
+		omrthread_lib_set_flags(J9THREAD_LIB_FLAG_FAST_NOTIFY);
+	}
+}
+
+/**
+ * Validate that a contended exit of a futex monitor wakes both a thread parked
+ * on the futex and a waiter that a fast notify moved onto the blocking queue.
+ */
+TEST(MonitorFutex, ExitWakesParkedAndNotifiedThreads)
+{
+	uintptr_t fastNotify = omrthread_lib_get_flags() & J9THREAD_LIB_FLAG_FAST_NOTIFY;
+	MonitorTestData data;
+	omrthread_monitor_t blocker = NULL;
+	omrthread_t waiter = NULL;
+	omrthread_t enterer = NULL;
+	uintptr_t numWaiting = 0;
+
+	memset(&data, 0, sizeof(data));
+	data.iterations = 1;
+	ASSERT_EQ(0, omrthread_monitor_init_with_name(&data.monitor, J9THREAD_MONITOR_FUTEX, "futex_exit_monitor"));
+	if (OMR_ARE_NO_BITS_SET(((J9ThreadMonitor *)data.monitor)->flags, J9THREAD_MONITOR_FUTEX)) {
+		omrTestEnv->log(LEVEL_INFO, "futex monitors are not available in this build\n");
+		omrthread_monitor_destroy(data.monitor);
+		return;
+	}
+	omrthread_lib_set_flags(J9THREAD_LIB_FLAG_FAST_NOTIFY);
+
+	waiter = startThread(waitForTurnOnce, &data);
+	while (1 != numWaiting) {
+		omrthread_sleep(1);
+		omrthread_monitor_enter(data.monitor);
+		numWaiting = omrthread_monitor_num_waiting(data.monitor);
+		omrthread_monitor_exit(data.monitor);
+	}
+
+	omrthread_monitor_enter(data.monitor);
+	enterer = startThread(enterExitLoop, &data);
+	while (OMR_ARE_NO_BITS_SET(omrthread_get_flags(enterer, &blocker), J9THREAD_FLAG_BLOCKED) || (blocker != data.monitor)) {
+		omrthread_sleep(1);
+	}
+
+	/* the waiter is now on the blocking queue and the enterer is parked on the futex */
+	data.turn = 1;
+	omrthread_monitor_notify(data.monitor);
+	omrthread_monitor_exit(data.monitor);
+
+	EXPECT_EQ(J9THREAD_SUCCESS, omrthread_join(enterer));
+	EXPECT_EQ(J9THREAD_SUCCESS, omrthread_join(waiter));
+	EXPECT_EQ(2u, data.counter);
+	EXPECT_EQ(0, omrthread_monitor_destroy(data.monitor));
+
+	if (0 == fastNotify) {
+		omrthread_lib_clear_flags(J9THREAD_LIB_FLAG_FAST_NOTIFY);
+	}
+}
+
+/**
+ * Validate that futex monitors are compiled in wherever they are supported,
+ * including builds with OMR_THR_SPIN_WAKE_CONTROL, the default on Linux.
+ */
+TEST(MonitorFutex, AvailableOnThreeTierLinuxBuilds)
+{
+	omrthread_monitor_t monitor = NULL;
+
+	ASSERT_EQ(0, omrthread_monitor_init_with_name(&monitor, J9THREAD_MONITOR_FUTEX, "futex_flag_monitor"));
+#if defined(LINUX) && !defined(OMRZTPF) && defined(OMR_THR_THREE_TIER_LOCKING) && !defined(OMR_THR_MCS_LOCKS)
+	EXPECT_TRUE(OMR_ARE_ALL_BITS_SET(((J9ThreadMonitor *)monitor)->flags, J9THREAD_MONITOR_FUTEX));
+#else /* defined(LINUX) && !defined(OMRZTPF) && defined(OMR_THR_THREE_TIER_LOCKING) && !defined(OMR_THR_MCS_LOCKS) */
+	EXPECT_TRUE(OMR_ARE_NO_BITS_SET(((J9ThreadMonitor *)monitor)->flags, J9THREAD_MONITOR_FUTEX));
+#endif /* defined(LINUX) && !defined(OMRZTPF) && defined(OMR_THR_THREE_TIER_LOCKING) && !defined(OMR_THR_MCS_LOCKS) */
+	EXPECT_EQ(0, omrthread_monitor_destroy(monitor));
+}
+
+/**
+ * Validate that a fast notifyAll releases every waiter of a futex monitor.
+ * With spin wake control each exit only releases a few notified threads from
+ * the blocking queue, so the rest depend on later exits.
+ */
+TEST(MonitorFutex, NotifyAllReleasesEveryWaiter)
+{
+	uintptr_t fastNotify = omrthread_lib_get_flags() & J9THREAD_LIB_FLAG_FAST_NOTIFY;
+	MonitorTestData data;
+	omrthread_t waiters[MAX_BENCHMARK_THREADS];
+	uintptr_t numWaiting = 0;
+
+	memset(&data, 0, sizeof(data));
+	ASSERT_EQ(0, omrthread_monitor_init_with_name(&data.monitor, J9THREAD_MONITOR_FUTEX, "futex_notify_all_monitor"));
+	omrthread_lib_set_flags(J9THREAD_LIB_FLAG_FAST_NOTIFY);
+
+	for (uintptr_t i = 0; i < MAX_BENCHMARK_THREADS; i++) {
+		waiters[i] = startThread(waitForTurnOnce, &data);
+	}
+	while (MAX_BENCHMARK_THREADS != numWaiting) {
+		omrthread_sleep(1);
+		omrthread_monitor_enter(data.monitor);
+		numWaiting = omrthread_monitor_num_waiting(data.monitor);
+		omrthread_monitor_exit(data.monitor);
+	}
+
+	omrthread_monitor_enter(data.monitor);
+	data.turn = 1;
+	omrthread_monitor_notify_all(data.monitor);
+	omrthread_monitor_exit(data.monitor);
+
+	for (uintptr_t i = 0; i < MAX_BENCHMARK_THREADS; i++) {
+		EXPECT_EQ(J9THREAD_SUCCESS, omrthread_join(waiters[i]));
+	}
+	EXPECT_EQ((uintptr_t)MAX_BENCHMARK_THREADS, data.counter);
+	EXPECT_EQ(0, omrthread_monitor_destroy(data.monitor));
+
+	if (0 == fastNotify) {
+		omrthread_lib_clear_flags(J9THREAD_LIB_FLAG_FAST_NOTIFY);
+	}
+}
+
+/**
+ * Measure enter/exit throughput of default and futex monitors as the number of
+ * contending threads grows. Results are logged at info level.
+ */
+TEST(MonitorFutex, EnterExitBenchmark)
+{
+	const uintptr_t flagsToTest[] = { 0, J9THREAD_MONITOR_FUTEX };
+
+	for (uintptr_t f = 0; f < sizeof(flagsToTest) / sizeof(flagsToTest[0]); f++) {
+		for (uintptr_t numThreads = 1; numThreads <= MAX_BENCHMARK_THREADS; numThreads *= 2) {
+			uint64_t elapsed = runEnterExit(flagsToTest[f], numThreads, NUM_ENTER_ITERATIONS);
+			uint64_t enters = (uint64_t)numThreads * NUM_ENTER_ITERATIONS;
+			omrTestEnv->log(LEVEL_INFO, "monitor %s: %2d threads, %llu enters in %llu us (%llu enters/ms)\n",
+					monitorKind(flagsToTest[f]), (int)numThreads,
+					(unsigned long long)enters, (unsigned long long)elapsed,
+					(unsigned long long)((0 == elapsed) ? 0 : (enters * 1000 / elapsed)));
+		}
+	}
+}
+
+/**
+ * Measure wait/notify round trips of default and futex monitors.
+ * Results are logged at info level.
+ */
+TEST(MonitorFutex, NotifyBenchmark)
+{
+	const uintptr_t flagsToTest[] = { 0, J9THREAD_MONITOR_FUTEX };
+
+	for (uintptr_t f = 0; f < sizeof(flagsToTest) / sizeof(flagsToTest[0]); f++) {
+		uint64_t elapsed = runPingPong(flagsToTest[f], NUM_NOTIFY_ITERATIONS);
+		omrTestEnv->log(LEVEL_INFO, "monitor %s: %llu notifies in %llu us (%llu notifies/ms)\n",
+				monitorKind(flagsToTest[f]),
+				(unsigned long long)(2 * NUM_NOTIFY_ITERATIONS), (unsigned long long)elapsed,
+				(unsigned long long)((0 == elapsed) ? 0 : ((uint64_t)2 * NUM_NOTIFY_ITERATIONS * 1000 / elapsed)));
+	}
+}
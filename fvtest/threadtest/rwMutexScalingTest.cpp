@@ -0,0 +1,196 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "omrport.h"
+#include "omrTest.h"
+#include "testHelper.hpp"
+#include "thread_api.h"
+
+#define NUM_STRESS_THREADS 4
+#define NUM_STRESS_ITERATIONS 20000
+#define STRESS_WRITE_INTERVAL 64
+
+#define MAX_BENCHMARK_THREADS 8
+#define NUM_BENCHMARK_ITERATIONS 200000
+
+extern ThreadTestEnvironment *omrTestEnv;
+
+typedef struct RWMutexTestData {
+	omrthread_rwmutex_t handle;
+	uintptr_t iterations;
+	/* both are only written under the write lock, so readers must always see them equal */
+	volatile uintptr_t first;
+	volatile uintptr_t second;
+	volatile uintptr_t mismatches;
+} RWMutexTestData;
+
+static int J9THREAD_PROC
+readWriteStress(void *arg)
+{
+	RWMutexTestData *data = (RWMutexTestData *)arg;
+	uintptr_t mismatches = 0;
+
+	for (uintptr_t i = 0; i < data->iterations; i++) {
+		if (0 == (i % STRESS_WRITE_INTERVAL)) {
+			omrthread_rwmutex_enter_write(data->handle);
+			data->first += 1;
+			omrthread_yield();
+			data->second += 1;
+			omrthread_rwmutex_exit_write(data->handle);
+		} else {
+			omrthread_rwmutex_enter_read(data->handle);
+			if (data->first != data->second) {
+				mismatches += 1;
+			}
+			omrthread_rwmutex_exit_read(data->handle);
+		}
+	}
+
+	omrthread_rwmutex_enter_write(data->handle);
+	data->mismatches += mismatches;
+	omrthread_rwmutex_exit_write(data->handle);
+	return 0;
+}
+
+static int J9THREAD_PROC
+readOnly(void *arg)
+{
+	RWMutexTestData *data = (RWMutexTestData *)arg;
+
+	for (uintptr_t i = 0; i < data->iterations; i++) {
+		omrthread_rwmutex_enter_read(data->handle);
+		omrthread_rwmutex_exit_read(data->handle);
+	}
+	return 0;
+}
+
+/**
+ * Run numThreads threads executing entrypoint on data and return the elapsed time in microseconds.
+ */
+static uint64_t
+runThreads(uintptr_t numThreads, omrthread_entrypoint_t entrypoint, RWMutexTestData *data)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(omrTestEnv->getPortLibrary());
+	omrthread_t threads[MAX_BENCHMARK_THREADS];
+	uint64_t start = omrtime_hires_clock();
+
+	for (uintptr_t i = 0; i < numThreads; i++) {
+		omrthread_attr_t attr = NULL;
+		EXPECT_EQ(J9THREAD_SUCCESS, omrthread_attr_init(&attr));
+		EXPECT_EQ(J9THREAD_SUCCESS, omrthread_attr_set_detachstate(&attr, J9THREAD_CREATE_JOINABLE));
+		EXPECT_EQ(J9THREAD_SUCCESS, omrthread_create_ex(&threads[i], &attr, 0, entrypoint, data));
+		omrthread_attr_destroy(&attr);
+	}
+	for (uintptr_t i = 0; i < numThreads; i++) {
+		EXPECT_EQ(J9THREAD_SUCCESS, omrthread_join(threads[i]));
+	}
+
+	return omrtime_hires_delta(start, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+}
+
+static void
+stressTest(uintptr_t flags)
+{
+	RWMutexTestData data;
+	memset(&data, 0, sizeof(data));
+	data.iterations = NUM_STRESS_ITERATIONS;
+	ASSERT_EQ(J9THREAD_RWMUTEX_OK, omrthread_rwmutex_init(&data.handle, flags, "stress_mutex"));
+
+	runThreads(NUM_STRESS_THREADS, readWriteStress, &data);
+
+	EXPECT_EQ((uintptr_t)0, data.mismatches);
+	EXPECT_EQ(data.first, data.second);
+	EXPECT_EQ((uintptr_t)(NUM_STRESS_THREADS * ((NUM_STRESS_ITERATIONS + STRESS_WRITE_INTERVAL - 1) / STRESS_WRITE_INTERVAL)), data.first);
+	ASSERT_EQ(J9THREAD_RWMUTEX_OK, omrthread_rwmutex_destroy(data.handle));
+}
+
+/**
+ * Validate the single threaded semantics of a reader-biased mutex:
+ * reentrant writers, readers nested in writers and try-enter against a reader
+ */
+TEST(RWMutexReaderBiased, NestingTest)
+{
+	omrthread_rwmutex_t handle;
+
+	ASSERT_EQ(J9THREAD_RWMUTEX_OK, omrthread_rwmutex_init(&handle, J9THREAD_RWMUTEX_READER_BIASED, "biased_mutex"));
+
+	ASSERT_EQ(J9THREAD_RWMUTEX_OK, omrthread_rwmutex_enter_read(handle));
+	ASSERT_EQ(J9THREAD_RWMUTEX_OK, omrthread_rwmutex_enter_read(handle));
+	ASSERT_FALSE(omrthread_rwmutex_is_writelocked(handle));
+	ASSERT_EQ(J9THREAD_RWMUTEX_WOULDBLOCK, omrthread_rwmutex_try_enter_write(handle));
+	ASSERT_EQ(J9THREAD_RWMUTEX_OK, omrthread_rwmutex_exit_read(handle));
+	ASSERT_EQ(J9THREAD_RWMUTEX_OK, omrthread_rwmutex_exit_read(handle));
+
+	ASSERT_EQ(J9THREAD_RWMUTEX_OK, omrthread_rwmutex_enter_write(handle));
+	ASSERT_TRUE(omrthread_rwmutex_is_writelocked(handle));
+	ASSERT_EQ(J9THREAD_RWMUTEX_OK, omrthread_rwmutex_try_enter_write(handle));
+	ASSERT_EQ(J9THREAD_RWMUTEX_OK, omrthread_rwmutex_enter_read(handle));
+	ASSERT_EQ(J9THREAD_RWMUTEX_OK, omrthread_rwmutex_exit_read(handle));
+	ASSERT_EQ(J9THREAD_RWMUTEX_OK, omrthread_rwmutex_exit_write(handle));
+	ASSERT_TRUE(omrthread_rwmutex_is_writelocked(handle));
+	ASSERT_EQ(J9THREAD_RWMUTEX_OK, omrthread_rwmutex_exit_write(handle));
+	ASSERT_FALSE(omrthread_rwmutex_is_writelocked(handle));
+
+	ASSERT_EQ(J9THREAD_RWMUTEX_OK, omrthread_rwmutex_try_enter_write(handle));
+	ASSERT_EQ(J9THREAD_RWMUTEX_OK, omrthread_rwmutex_exit_write(handle));
+
+	ASSERT_EQ(J9THREAD_RWMUTEX_OK, omrthread_rwmutex_destroy(handle));
+}
+
+/**
+ * Validate that writers exclude readers when both contend for a mutex
+ */
+TEST(RWMutexReaderBiased, StressTest)
+{
+	stressTest(J9THREAD_RWMUTEX_READER_BIASED);
+}
+
+TEST(RWMutexReaderBiased, StressTestNonBiased)
+{
+	stressTest(0);
+}
+
+/**
+ * Measure read acquisition throughput of biased and non-biased mutexes
+ * as the number of reading threads grows. Results are logged at info level.
+ */
+TEST(RWMutexReaderBiased, ReadScalingBenchmark)
+{
+	const uintptr_t flagsToTest[] = { 0, J9THREAD_RWMUTEX_READER_BIASED };
+
+	for (uintptr_t f = 0; f < sizeof(flagsToTest) / sizeof(flagsToTest[0]); f++) {
+		for (uintptr_t numThreads = 1; numThreads <= MAX_BENCHMARK_THREADS; numThreads *= 2) {
+			RWMutexTestData data;
+			memset(&data, 0, sizeof(data));
+			data.iterations = NUM_BENCHMARK_ITERATIONS;
+			ASSERT_EQ(J9THREAD_RWMUTEX_OK, omrthread_rwmutex_init(&data.handle, flagsToTest[f], "benchmark_mutex"));
+
+			uint64_t elapsed = runThreads(numThreads, readOnly, &data);
+			uint64_t reads = (uint64_t)numThreads * NUM_BENCHMARK_ITERATIONS;
+			omrTestEnv->log(LEVEL_INFO, "rwmutex %s: %2d threads, %llu reads in %llu us (%llu reads/ms)\n",
+					(0 == flagsToTest[f]) ? "non-biased" : "reader-biased", (int)numThreads,
+					(unsigned long long)reads, (unsigned long long)elapsed,
+					(unsigned long long)((0 == elapsed) ? 0 : (reads * 1000 / elapsed)));
+
+			ASSERT_EQ(J9THREAD_RWMUTEX_OK, omrthread_rwmutex_destroy(data.handle));
+		}
+	}
+}
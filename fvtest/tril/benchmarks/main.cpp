@@ -0,0 +1,524 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/*
+ * trilperf compiles a corpus of Tril kernels, times their execution and
+ * compares the results against a stored baseline.
+ *
+ * For every kernel it reports the compile time, the size of the compiled
+ * body's code and the execution time statistics over a number of timed
+ * runs that follow some untimed warmup runs. Every run is checked against a
+ * C++ implementation of the kernel.
+ *
+ * --write-baseline stores the median execution time, code size and compile
+ * time of every kernel. --baseline compares against such a file and flags a
+ * kernel whose median execution time or compile time grew by more than the
+ * given tolerance, or whose code grew at all. Baselines only make sense on the
+ * machine and build configuration they were written with.
+ *
+ * The exit code is non-zero if a kernel failed to compile or produced a wrong
+ * result, or if a regression was flagged. Kernels that need support that is
+ * missing on some platforms (vectors, calls) are skipped if they fail to
+ * compile.
+ */
+
+#include "default_compiler.hpp"
+#include "control/CompilationStatistics.hpp"
+#include "control/SimpleJit.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+#if !defined(TRILPERF_KERNEL_DIR)
+#define TRILPERF_KERNEL_DIR "."
+#endif
+
+namespace {
+
+typedef int64_t (Int64Function)(int64_t);
+typedef int64_t (Int32Function)(int32_t);
+typedef int64_t (ArraySumFunction)(int32_t *, int32_t);
+typedef void (VectorAddFunction)(int32_t *, int32_t *, int32_t *, int32_t);
+
+class Kernel {
+public:
+    Kernel(const char *name, bool optional) : _name(name), _optional(optional) {}
+    virtual ~Kernel() {}
+
+    const char *name() const { return _name; }
+
+    /* true if the kernel may fail to compile on platforms missing support for it */
+    bool optional() const { return _optional; }
+
+    /* gives the kernel a chance to edit its Tril source before it is parsed */
+    virtual std::string prepare(const std::string &source) { return source; }
+
+    /* runs the compiled kernel once and returns a checksum of what it computed */
+    virtual int64_t run(void *entry) = 0;
+
+    /* the checksum a correct run returns */
+    virtual int64_t expected() = 0;
+
+private:
+    const char *_name;
+    bool _optional;
+};
+
+class ArithKernel : public Kernel {
+public:
+    ArithKernel() : Kernel("arith", false) {}
+
+    virtual int64_t run(void *entry) { return ((Int64Function *)entry)(TRIP_COUNT); }
+
+    virtual int64_t expected() {
+        uint64_t x = 1;
+        for (uint64_t i = 0; i < TRIP_COUNT; i++)
+            x = (x * 31 + i) ^ (x >> 7);
+        return (int64_t)x;
+    }
+
+private:
+    static const int64_t TRIP_COUNT = 2000000;
+};
+
+class ArraySumKernel : public Kernel {
+public:
+    ArraySumKernel() : Kernel("arraysum", false), _array(LENGTH) {
+        for (int32_t i = 0; i < LENGTH; i++)
+            _array[i] = (i * 7919) % 1000 - 500;
+    }
+
+    virtual int64_t run(void *entry) { return ((ArraySumFunction *)entry)(&_array[0], LENGTH); }
+
+    virtual int64_t expected() {
+        int64_t sum = 0;
+        for (int32_t i = 0; i < LENGTH; i++)
+            sum += _array[i];
+        return sum;
+    }
+
+private:
+    static const int32_t LENGTH = 1000000;
+    std::vector<int32_t> _array;
+};
+
+class VectorAddKernel : public Kernel {
+public:
+    VectorAddKernel() : Kernel("vectoradd", true), _out(LENGTH), _a(LENGTH), _b(LENGTH) {
+        for (int32_t i = 0; i < LENGTH; i++) {
+            _a[i] = i;
+            _b[i] = 3 * i + 1;
+        }
+    }
+
+    virtual int64_t run(void *entry) {
+        std::fill(_out.begin(), _out.end(), 0);
+        ((VectorAddFunction *)entry)(&_out[0], &_a[0], &_b[0], LENGTH);
+        return checksum(_out);
+    }
+
+    virtual int64_t expected() {
+        std::vector<int32_t> out(LENGTH);
+        for (int32_t i = 0; i < LENGTH; i++)
+            out[i] = _a[i] + _b[i];
+        return checksum(out);
+    }
+
+private:
+    static int64_t checksum(const std::vector<int32_t> &values) {
+        int64_t sum = 0;
+        for (size_t i = 0; i < values.size(); i++)
+            sum = sum * 31 + values[i];
+        return sum;
+    }
+
+    static const int32_t LENGTH = 1000000;
+    std::vector<int32_t> _out;
+    std::vector<int32_t> _a;
+    std::vector<int32_t> _b;
+};
+
+extern "C" int32_t trilperfCallee(int32_t x) { return (x ^ (x >> 3)) + 1; }
+
+class CallsKernel : public Kernel {
+public:
+    CallsKernel() : Kernel("calls", true) {}
+
+    virtual std::string prepare(const std::string &source) {
+        char address[32];
+        snprintf(address, sizeof(address), "0x%jX", reinterpret_cast<uintmax_t>(&trilperfCallee));
+        std::string prepared(source);
+        const std::string placeholder("CALLEE_ADDRESS");
+        for (size_t pos = prepared.find(placeholder); pos != std::string::npos; pos = prepared.find(placeholder))
+            prepared.replace(pos, placeholder.size(), address);
+        return prepared;
+    }
+
+    virtual int64_t run(void *entry) { return ((Int32Function *)entry)(TRIP_COUNT); }
+
+    virtual int64_t expected() {
+        int64_t sum = 0;
+        for (int32_t i = 0; i < TRIP_COUNT; i++)
+            sum += trilperfCallee(i);
+        return sum;
+    }
+
+private:
+    static const int32_t TRIP_COUNT = 1000000;
+};
+
+class SwitchKernel : public Kernel {
+public:
+    SwitchKernel() : Kernel("switch", false) {}
+
+    virtual int64_t run(void *entry) { return ((Int32Function *)entry)(TRIP_COUNT); }
+
+    virtual int64_t expected() {
+        uint64_t acc = 0;
+        for (int32_t i = 0; i < TRIP_COUNT; i++) {
+            switch (i & 7) {
+                case 0: acc += (int64_t)i; break;
+                case 1: acc ^= (int64_t)i; break;
+                case 2: acc -= 3; break;
+                case 3: acc *= 3; break;
+                case 4: acc >>= 1; break;
+                case 5: acc += 1000; break;
+                case 6: acc |= 1; break;
+                default: acc += 8; break;
+            }
+        }
+        return (int64_t)acc;
+    }
+
+private:
+    static const int32_t TRIP_COUNT = 1000000;
+};
+
+struct Statistics {
+    double min;
+    double median;
+    double mean;
+    double stddev;
+};
+
+Statistics computeStatistics(std::vector<double> samples) {
+    Statistics stats = { 0, 0, 0, 0 };
+    if (samples.empty())
+        return stats;
+
+    std::sort(samples.begin(), samples.end());
+    size_t n = samples.size();
+    stats.min = samples[0];
+    stats.median = (n % 2 == 1) ? samples[n / 2] : (samples[n / 2 - 1] + samples[n / 2]) / 2;
+    double sum = 0;
+    for (size_t i = 0; i < n; i++)
+        sum += samples[i];
+    stats.mean = sum / n;
+    double squares = 0;
+    for (size_t i = 0; i < n; i++)
+        squares += (samples[i] - stats.mean) * (samples[i] - stats.mean);
+    stats.stddev = n > 1 ? std::sqrt(squares / (n - 1)) : 0;
+    return stats;
+}
+
+struct Measurement {
+    double compileUs;
+    int64_t codeBytes;
+    Statistics runUs;
+};
+
+struct Options {
+    Options()
+        : kernelDir(TRILPERF_KERNEL_DIR), jitOptions(NULL), baseline(NULL), writeBaseline(NULL), filter(NULL),
+          warmup(5), iterations(20), tolerance(0.10), compileTolerance(0.50) {}
+
+    const char *kernelDir;
+    const char *jitOptions;
+    const char *baseline;
+    const char *writeBaseline;
+    const char *filter;
+    int32_t warmup;
+    int32_t iterations;
+    double tolerance;
+    double compileTolerance;
+};
+
+typedef std::map<std::string, Measurement> Baseline;
+
+bool readFile(const std::string &path, std::string &contents) {
+    FILE *file = fopen(path.c_str(), "r");
+    if (file == NULL)
+        return false;
+
+    char buffer[4096];
+    size_t n;
+    while ((n = fread(buffer, 1, sizeof(buffer), file)) > 0)
+        contents.append(buffer, n);
+    fclose(file);
+    return true;
+}
+
+bool readBaseline(const char *path, Baseline &baseline) {
+    FILE *file = fopen(path, "r");
+    if (file == NULL)
+        return false;
+
+    char line[256];
+    while (fgets(line, sizeof(line), file) != NULL) {
+        char name[128];
+        Measurement m;
+        long long codeBytes;
+        if (line[0] == '#' || sscanf(line, "%127s %lf %lld %lf", name, &m.runUs.median, &codeBytes, &m.compileUs) != 4)
+            continue;
+        m.codeBytes = codeBytes;
+        baseline[name] = m;
+    }
+    fclose(file);
+    return true;
+}
+
+bool writeBaseline(const char *path, const std::vector<std::pair<std::string, Measurement> > &results) {
+    FILE *file = fopen(path, "w");
+    if (file == NULL)
+        return false;
+
+    fprintf(file, "# trilperf baseline\n");
+    fprintf(file, "# kernel median_run_us code_bytes compile_us\n");
+    for (size_t i = 0; i < results.size(); i++) {
+        const Measurement &m = results[i].second;
+        fprintf(file, "%s %.3f %lld %.3f\n", results[i].first.c_str(), m.runUs.median, (long long)m.codeBytes,
+            m.compileUs);
+    }
+    fclose(file);
+    return true;
+}
+
+double elapsedUs(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+}
+
+enum KernelStatus { KernelPassed, KernelSkipped, KernelFailed };
+
+KernelStatus measureKernel(Kernel *kernel, const Options &options, Measurement &m) {
+    std::string source;
+    std::string path = std::string(options.kernelDir) + "/" + kernel->name() + ".tril";
+    if (!readFile(path, source)) {
+        fprintf(stderr, "%s: cannot read %s\n", kernel->name(), path.c_str());
+        return KernelFailed;
+    }
+
+    source = kernel->prepare(source);
+    ASTNode *trees = parseString(source.c_str());
+    if (trees == NULL) {
+        fprintf(stderr, "%s: cannot parse %s\n", kernel->name(), path.c_str());
+        return KernelFailed;
+    }
+
+    Tril::DefaultCompiler compiler(trees);
+    TR::CompilationStatistics statistics;
+    auto compileStart = std::chrono::steady_clock::now();
+    int32_t rc = compiler.compileWithStatistics(&statistics);
+    m.compileUs = elapsedUs(compileStart);
+    m.codeBytes = statistics.codeEnd - statistics.codeStart;
+
+    if (rc != 0) {
+        fprintf(stderr, "%s: compilation failed with %d%s\n", kernel->name(), rc,
+            kernel->optional() ? ", skipped" : "");
+        return kernel->optional() ? KernelSkipped : KernelFailed;
+    }
+
+    void *entry = reinterpret_cast<void *>(compiler.getEntryPoint<void (*)()>());
+    int64_t expected = kernel->expected();
+    std::vector<double> samples;
+    for (int32_t i = 0; i < options.warmup + options.iterations; i++) {
+        auto runStart = std::chrono::steady_clock::now();
+        int64_t result = kernel->run(entry);
+        double us = elapsedUs(runStart);
+
+        if (result != expected) {
+            fprintf(stderr, "%s: run %d returned %lld, expected %lld\n", kernel->name(), i, (long long)result,
+                (long long)expected);
+            return KernelFailed;
+        }
+        if (i >= options.warmup)
+            samples.push_back(us);
+    }
+
+    m.runUs = computeStatistics(samples);
+    return KernelPassed;
+}
+
+/* relative change from base to current, or 0 if there is no meaningful base */
+double change(double current, double base) { return base > 0 ? (current - base) / base : 0; }
+
+bool parseOptions(int argc, char **argv, Options &options) {
+    for (int i = 1; i < argc; i++) {
+        const char *arg = argv[i];
+        const char *value = i + 1 < argc ? argv[i + 1] : NULL;
+        if (strcmp(arg, "--help") == 0)
+            return false;
+        if (value == NULL) {
+            fprintf(stderr, "missing value for %s\n", arg);
+            return false;
+        }
+
+        if (strcmp(arg, "--kernels") == 0)
+            options.kernelDir = value;
+        else if (strcmp(arg, "--jit-options") == 0)
+            options.jitOptions = value;
+        else if (strcmp(arg, "--baseline") == 0)
+            options.baseline = value;
+        else if (strcmp(arg, "--write-baseline") == 0)
+            options.writeBaseline = value;
+        else if (strcmp(arg, "--filter") == 0)
+            options.filter = value;
+        else if (strcmp(arg, "--warmup") == 0)
+            options.warmup = atoi(value);
+        else if (strcmp(arg, "--iterations") == 0)
+            options.iterations = atoi(value);
+        else if (strcmp(arg, "--tolerance") == 0)
+            options.tolerance = atof(value);
+        else if (strcmp(arg, "--compile-tolerance") == 0)
+            options.compileTolerance = atof(value);
+        else {
+            fprintf(stderr, "unknown option %s\n", arg);
+            return false;
+        }
+        i++;
+    }
+    return options.warmup >= 0 && options.iterations > 0;
+}
+
+void printUsage(const char *program) {
+    fprintf(stderr,
+        "usage: %s [options]\n"
+        "  --kernels <dir>             directory containing the .tril kernels (default %s)\n"
+        "  --jit-options <options>     options used to initialize the JIT, e.g. -Xjit:optLevel=hot\n"
+        "  --filter <name>             only run kernels whose name contains <name>\n"
+        "  --warmup <n>                untimed runs before timing starts (default 5)\n"
+        "  --iterations <n>            timed runs (default 20)\n"
+        "  --baseline <file>           compare against a baseline and flag regressions\n"
+        "  --write-baseline <file>     store the results as a baseline\n"
+        "  --tolerance <fraction>      allowed growth of the median run time (default 0.10)\n"
+        "  --compile-tolerance <fraction>  allowed growth of the compile time (default 0.50)\n",
+        program, TRILPERF_KERNEL_DIR);
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        printUsage(argv[0]);
+        return 2;
+    }
+
+    Baseline baseline;
+    if (options.baseline != NULL && !readBaseline(options.baseline, baseline)) {
+        fprintf(stderr, "FAIL: cannot read baseline %s; write one with --write-baseline\n", options.baseline);
+        return 2;
+    }
+
+    bool initialized = options.jitOptions != NULL ? initializeSimpleJitWithOptions(const_cast<char *>(options.jitOptions))
+                                                  : initializeSimpleJit();
+    if (!initialized) {
+        fprintf(stderr, "FAIL: could not initialize JIT\n");
+        return 2;
+    }
+
+    ArithKernel arith;
+    ArraySumKernel arraySum;
+    VectorAddKernel vectorAdd;
+    CallsKernel calls;
+    SwitchKernel switchKernel;
+    Kernel *kernels[] = { &arith, &arraySum, &vectorAdd, &calls, &switchKernel };
+
+    printf("%-12s %12s %10s %12s %12s %12s %12s %10s\n", "kernel", "compile(us)", "code(B)", "min(us)", "median(us)",
+        "mean(us)", "stddev(us)", "vs base");
+
+    std::vector<std::pair<std::string, Measurement> > results;
+    int32_t failures = 0;
+    int32_t regressions = 0;
+    for (size_t k = 0; k < sizeof(kernels) / sizeof(kernels[0]); k++) {
+        Kernel *kernel = kernels[k];
+        if (options.filter != NULL && strstr(kernel->name(), options.filter) == NULL)
+            continue;
+
+        Measurement m;
+        KernelStatus status = measureKernel(kernel, options, m);
+        if (status == KernelFailed) {
+            printf("%-12s FAILED\n", kernel->name());
+            failures++;
+            continue;
+        }
+        if (status == KernelSkipped) {
+            printf("%-12s skipped\n", kernel->name());
+            continue;
+        }
+        results.push_back(std::make_pair(std::string(kernel->name()), m));
+
+        char versus[32] = "";
+        std::string flags;
+        Baseline::iterator base = baseline.find(kernel->name());
+        if (base != baseline.end()) {
+            double runChange = change(m.runUs.median, base->second.runUs.median);
+            snprintf(versus, sizeof(versus), "%+.1f%%", runChange * 100);
+            if (runChange > options.tolerance)
+                flags += " run-time";
+            if (m.codeBytes > base->second.codeBytes)
+                flags += " code-size";
+            if (change(m.compileUs, base->second.compileUs) > options.compileTolerance)
+                flags += " compile-time";
+        } else if (options.baseline != NULL) {
+            snprintf(versus, sizeof(versus), "new");
+        }
+
+        printf("%-12s %12.1f %10lld %12.1f %12.1f %12.1f %12.1f %10s%s%s\n", kernel->name(), m.compileUs,
+            (long long)m.codeBytes, m.runUs.min, m.runUs.median, m.runUs.mean, m.runUs.stddev, versus,
+            flags.empty() ? "" : "  REGRESSION:", flags.c_str());
+        if (!flags.empty())
+            regressions++;
+    }
+
+    if (options.writeBaseline != NULL) {
+        if (!writeBaseline(options.writeBaseline, results)) {
+            fprintf(stderr, "FAIL: cannot write baseline %s\n", options.writeBaseline);
+            failures++;
+        } else {
+            printf("baseline written to %s\n", options.writeBaseline);
+        }
+    }
+
+    shutdownSimpleJit();
+
+    if (failures > 0 || regressions > 0) {
+        printf("FAIL: %d kernel(s) failed, %d regression(s)\n", failures, regressions);
+        return 1;
+    }
+    return 0;
+}
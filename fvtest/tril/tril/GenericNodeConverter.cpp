@@ -168,6 +168,18 @@ TR::Node *GenericNodeConverter::impl(const ASTNode *tree, IlGenState *state)
         TraceIL("  is branch to target block %d (%s, entry = %p", targetId, targetName, targetEntry);
         node = TR::Node::create(opcode.getOpCodeValue(), childCount);
         node->setBranchDestination(targetEntry);
+    } else if (opcode.getOpCodeValue() == TR::New) {
+        TraceIL("  is object allocation\n", "");
+
+        // OMR has no allocation helper, so methods using `new` only compile
+        // when escape analysis removes every allocation
+        auto symref = state->symRefTab()->findOrCreateNewObjectSymbolRef(state->methodSymbol());
+        node = TR::Node::createWithSymRef(opcode.getOpCodeValue(), childCount, symref);
+        state->methodSymbol()->setHasNews(true);
+    } else if (opcode.isNullCheck()) {
+        TraceIL("  is null check\n", "");
+        auto symref = state->symRefTab()->findOrCreateNullCheckSymbolRef(state->methodSymbol());
+        node = TR::Node::createWithSymRef(opcode.getOpCodeValue(), childCount, symref);
     } else {
         TraceIL("  unrecognized opcode; using default creation mechanism\n", "");
         node = TR::Node::create(opcode.getOpCodeValue(), childCount);
@@ -46,6 +46,14 @@ int32_t Tril::SimpleCompiler::compile() {
 }
 
 int32_t Tril::SimpleCompiler::compileWithVerifier(TR::IlVerifier* verifier) {
+   return compileWith(verifier, NULL);
+}
+
+int32_t Tril::SimpleCompiler::compileWithStatistics(TR::CompilationStatistics* statistics) {
+   return compileWith(NULL, statistics);
+}
+
+int32_t Tril::SimpleCompiler::compileWith(TR::IlVerifier* verifier, TR::CompilationStatistics* statistics) {
     // construct an IL generator for the method
     auto methodInfo = getMethodInfo();
     TR::TypeDictionary types;
@@ -80,6 +88,7 @@ int32_t Tril::SimpleCompiler::compileWithVerifier(TR::IlVerifier* verifier) {
        {
        methodDetails.setIlVerifier(verifier);
        }
+    methodDetails.setCompilationStatistics(statistics);
 
     int32_t rc = 0;
     auto entry_point = compileMethodFromDetails(NULL, methodDetails, warm, rc);
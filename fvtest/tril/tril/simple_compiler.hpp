@@ -24,7 +24,7 @@
 
 #include "method_compiler.hpp"
 
-namespace TR { class IlVerifier; } 
+namespace TR { class IlVerifier; class CompilationStatistics; } 
 
 namespace Tril {
 
@@ -48,6 +48,16 @@ class SimpleCompiler : public Tril::MethodCompiler {
          * @return 0 on complilation success, an error code or exception otherwise. 
          */
         int32_t compileWithVerifier(TR::IlVerifier* verifier);
+
+        /**
+         * @brief Compiles the Tril method and records measurements of the compilation
+         * @param statistics receives the measurements, including the start and end of the compiled code
+         * @return 0 on compilation success, an error code otherwise
+         */
+        int32_t compileWithStatistics(TR::CompilationStatistics* statistics);
+
+    private:
+        int32_t compileWith(TR::IlVerifier* verifier, TR::CompilationStatistics* statistics);
 };
 
 } // namespace Tril
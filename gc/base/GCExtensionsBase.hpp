@@ -400,6 +400,8 @@ public:
 
 	uintptr_t heapExpansionStabilizationCount; /**< GC count required before the heap is allowed to expand due to excessvie time after last heap expansion */
 	uintptr_t heapContractionStabilizationCount; /**< GC count required before the heap is allowed to contract due to excessvie time after last heap expansion */
+	uintptr_t heapSizingGCCPUTarget; /**< percentage of CPU time the heap is sized to spend in GC, or 0 to size the heap by free ratio (see MM_HeapSizingController) */
+	uintptr_t heapSizingContainerMemoryPercentage; /**< percentage of the container memory limit the heap may grow to when heapSizingGCCPUTarget is set */
 
 	float heapSizeStartupHintConservativeFactor; /**< Use only a fraction of hints stored in SC */
 	float heapSizeStartupHintWeightNewValue;		/**< Learn slowly by historic averaging of stored hints */
@@ -1613,6 +1615,8 @@ public:
 		, heapContractionGCRatioThreshold()
 		, heapExpansionStabilizationCount(0)
 		, heapContractionStabilizationCount(3)
+		, heapSizingGCCPUTarget(0)
+		, heapSizingContainerMemoryPercentage(75)
 		, heapSizeStartupHintConservativeFactor((float)0.7)
 		, heapSizeStartupHintWeightNewValue((float)0.8)
 		, useGCStartupHints(true)
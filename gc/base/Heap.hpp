@@ -30,6 +30,7 @@
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
 #include "HeapResizeStats.hpp"
+#include "HeapSizingController.hpp"
 #include "PercolateStats.hpp"
 
 class MM_HeapRegionDescriptor;
@@ -55,6 +56,7 @@ protected:
 	uintptr_t _maximumMemorySize;
 
 	MM_HeapResizeStats _heapResizeStats;
+	MM_HeapSizingController _heapSizingController;
 	MM_PercolateStats _percolateStats;
 
 	MM_HeapRegionManager *_heapRegionManager;
@@ -75,6 +77,8 @@ public:
 
 	MMINLINE MM_HeapResizeStats *getResizeStats() { return &_heapResizeStats; }
 
+	MMINLINE MM_HeapSizingController *getHeapSizingController() { return &_heapSizingController; }
+
 	MMINLINE MM_PercolateStats *getPercolateStats() { return &_percolateStats; }
 
 	MMINLINE MM_MemorySpace *getDefaultMemorySpace() { return _defaultMemorySpace; }
@@ -175,6 +179,7 @@ public:
 		,_memorySpaceList(NULL)
 		,_maximumMemorySize(maximumMemorySize)
 		,_heapResizeStats()
+		,_heapSizingController(env->getExtensions()->heapSizingGCCPUTarget, env->getExtensions()->heapSizingContainerMemoryPercentage)
 		,_percolateStats()
 		,_heapRegionManager(regionManager)
 	{
@@ -0,0 +1,98 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "HeapSizingController.hpp"
+
+#include "Math.hpp"
+
+bool
+MM_HeapSizingController::updateLimits(uint64_t memoryLimit, uintptr_t cpuCount)
+{
+	bool memoryLimitChanged = (memoryLimit != _memoryLimit);
+
+	_memoryLimit = memoryLimit;
+	_cpuCount = cpuCount;
+
+	return memoryLimitChanged;
+}
+
+uintptr_t
+MM_HeapSizingController::getHeapCeiling(uintptr_t maximumHeapSize, uintptr_t alignment) const
+{
+	uintptr_t ceiling = maximumHeapSize;
+
+	if (0 != _memoryLimit) {
+		/* split the multiplication so that it cannot overflow */
+		uint64_t memoryShare = ((_memoryLimit / 100) * _memoryLimitPercentage) + (((_memoryLimit % 100) * _memoryLimitPercentage) / 100);
+
+		if (memoryShare < (uint64_t)maximumHeapSize) {
+			/* never shrink the ceiling below a single resize granule */
+			ceiling = OMR_MAX(MM_Math::roundToFloor(alignment, (uintptr_t)memoryShare), alignment);
+		}
+	}
+
+	return ceiling;
+}
+
+double
+MM_HeapSizingController::getGCCPUPercentage(double gcPercentage, uintptr_t gcThreadCount) const
+{
+	double gcCPUPercentage = gcPercentage;
+
+	if ((0 != gcThreadCount) && (gcThreadCount < _cpuCount) && (gcPercentage < 100.0)) {
+		double gcCPUTime = gcPercentage * (double)gcThreadCount;
+		double mutatorCPUTime = (100.0 - gcPercentage) * (double)_cpuCount;
+
+		gcCPUPercentage = (100.0 * gcCPUTime) / (gcCPUTime + mutatorCPUTime);
+	}
+
+	return gcCPUPercentage;
+}
+
+uintptr_t
+MM_HeapSizingController::calculateTargetHeapSize(uintptr_t heapSize, uintptr_t freeBytes, double gcPercentage, uintptr_t gcThreadCount, uintptr_t ceiling, uintptr_t alignment) const
+{
+	uintptr_t targetHeapSize = heapSize;
+
+	/* without a GC time measurement there is nothing to correct */
+	if (isEnabled() && (gcPercentage > 0.0) && (freeBytes <= heapSize)) {
+		double ratio = getGCCPUPercentage(gcPercentage, gcThreadCount) / (double)_targetGCPercentage;
+
+		if ((ratio > (1.0 + HEAP_SIZING_CONTROLLER_TOLERANCE)) || (ratio < (1.0 / (1.0 + HEAP_SIZING_CONTROLLER_TOLERANCE)))) {
+			uintptr_t liveBytes = heapSize - freeBytes;
+			uintptr_t effectiveFreeBytes = OMR_MAX(freeBytes, heapSize / HEAP_SIZING_CONTROLLER_MINIMUM_FREE_DIVISOR);
+			double step = 1.0 + (HEAP_SIZING_CONTROLLER_GAIN * (ratio - 1.0));
+
+			step = OMR_MIN(OMR_MAX(step, HEAP_SIZING_CONTROLLER_MINIMUM_STEP), HEAP_SIZING_CONTROLLER_MAXIMUM_STEP);
+
+			double desiredHeapSize = (double)liveBytes + ((double)effectiveFreeBytes * step);
+
+			if (desiredHeapSize >= (double)ceiling) {
+				targetHeapSize = ceiling;
+			} else {
+				targetHeapSize = MM_Math::roundToCeiling(alignment, (uintptr_t)desiredHeapSize);
+			}
+		}
+	}
+
+	return OMR_MIN(targetHeapSize, ceiling);
+}
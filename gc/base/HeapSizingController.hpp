@@ -0,0 +1,139 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(HEAPSIZINGCONTROLLER_HPP_)
+#define HEAPSIZINGCONTROLLER_HPP_
+
+#include "omrcomp.h"
+#include "modronbase.h"
+
+#include "BaseNonVirtual.hpp"
+
+/* Measured GC CPU within this factor of the target leaves the heap size alone */
+#define HEAP_SIZING_CONTROLLER_TOLERANCE 0.25
+/* Fraction of the remaining error corrected on each resize */
+#define HEAP_SIZING_CONTROLLER_GAIN 0.5
+/* Bounds on how much free memory may be scaled by in one resize */
+#define HEAP_SIZING_CONTROLLER_MINIMUM_STEP 0.5
+#define HEAP_SIZING_CONTROLLER_MAXIMUM_STEP 2.0
+/* Free memory is treated as at least 1/divisor of the heap so that a full heap can still grow */
+#define HEAP_SIZING_CONTROLLER_MINIMUM_FREE_DIVISOR 16
+
+/**
+ * Sizes the heap so that a target percentage of CPU time is spent in GC, without growing
+ * the heap past a share of the container memory limit.
+ *
+ * The cost of a collection is roughly proportional to the live data, and the time between
+ * collections to the free memory the mutator allocates into, so the share of CPU spent in GC
+ * scales with live/free. The free memory that meets the target is therefore the current free
+ * memory scaled by measured/target; the controller corrects a fraction of that error at each
+ * resize and does nothing while the measurement is within a tolerance of the target.
+ *
+ * The controller only holds the limits last sampled by its caller. Heap occupancy and GC
+ * time are passed in, so it can be driven by simulated workloads.
+ * @ingroup GC_Base
+ */
+class MM_HeapSizingController : public MM_BaseNonVirtual
+{
+/*
+ * Data members
+ */
+private:
+	uintptr_t _targetGCPercentage; /**< percentage of CPU time that should be spent in GC, or 0 if the controller is disabled */
+	uintptr_t _memoryLimitPercentage; /**< percentage of the container memory limit the heap may occupy */
+	uint64_t _memoryLimit; /**< container memory limit in bytes from the last sample, or 0 if there is none */
+	uintptr_t _cpuCount; /**< number of CPUs available to the process from the last sample */
+
+protected:
+public:
+
+/*
+ * Function members
+ */
+private:
+protected:
+public:
+	MMINLINE bool isEnabled() const { return 0 != _targetGCPercentage; }
+	MMINLINE uintptr_t getTargetGCPercentage() const { return _targetGCPercentage; }
+	MMINLINE uint64_t getMemoryLimit() const { return _memoryLimit; }
+	MMINLINE uintptr_t getCPUCount() const { return _cpuCount; }
+
+	/**
+	 * Record the current container limits. Limits may change while the process runs, so callers
+	 * sample them before each resize decision.
+	 * @param[in] memoryLimit the container memory limit in bytes, or 0 if there is none
+	 * @param[in] cpuCount the number of CPUs available to the process
+	 * @return true if the memory limit differs from the previous sample
+	 */
+	bool updateLimits(uint64_t memoryLimit, uintptr_t cpuCount);
+
+	/**
+	 * @param[in] maximumHeapSize the largest the heap may ever be
+	 * @param[in] alignment the granularity the heap is resized in
+	 * @return the largest size the whole heap may have under the current memory limit
+	 */
+	uintptr_t getHeapCeiling(uintptr_t maximumHeapSize, uintptr_t alignment) const;
+
+	/**
+	 * Convert the share of wall-clock time spent in stop-the-world GC to a share of CPU time.
+	 * While the GC runs it uses at most gcThreadCount of the available CPUs, while the mutator
+	 * is assumed to use all of them.
+	 * @param[in] gcPercentage percentage of time spent in GC
+	 * @param[in] gcThreadCount number of threads that work in a collection
+	 * @return percentage of CPU time spent in GC
+	 */
+	double getGCCPUPercentage(double gcPercentage, uintptr_t gcThreadCount) const;
+
+	/**
+	 * Calculate the size the heap should have to meet the GC CPU target.
+	 * @param[in] heapSize the current heap size
+	 * @param[in] freeBytes the memory free in the heap after the last collection
+	 * @param[in] gcPercentage percentage of time recently spent in GC, or 0 if it is not known yet
+	 * @param[in] gcThreadCount number of threads that work in a collection
+	 * @param[in] ceiling the largest size the heap may have
+	 * @param[in] alignment the granularity the heap is resized in
+	 * @return the target heap size, which is never above ceiling
+	 */
+	uintptr_t calculateTargetHeapSize(uintptr_t heapSize, uintptr_t freeBytes, double gcPercentage, uintptr_t gcThreadCount, uintptr_t ceiling, uintptr_t alignment) const;
+
+	/**
+	 * Create a HeapSizingController object.
+	 * @param[in] targetGCPercentage percentage of CPU time to spend in GC, or 0 to disable the controller
+	 * @param[in] memoryLimitPercentage percentage of the container memory limit the heap may occupy
+	 */
+	MM_HeapSizingController(uintptr_t targetGCPercentage, uintptr_t memoryLimitPercentage)
+		: MM_BaseNonVirtual()
+		, _targetGCPercentage(targetGCPercentage)
+		, _memoryLimitPercentage(memoryLimitPercentage)
+		, _memoryLimit(0)
+		, _cpuCount(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* HEAPSIZINGCONTROLLER_HPP_ */
@@ -28,6 +28,8 @@
 #include "AllocateDescription.hpp"
 #include "GCExtensionsBase.hpp"
 #include "GlobalCollector.hpp"
+#include "HeapSizingController.hpp"
+#include "ParallelDispatcher.hpp"
 #include "PhysicalSubArena.hpp"
 #include "MemorySpace.hpp"
 
@@ -95,6 +97,10 @@ void
 MM_MemorySubSpaceUniSpace::checkResize(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool _systemGC)
 {
 	uintptr_t oldVMState = env->pushVMstate(OMRVMSTATE_GC_CHECK_RESIZE);
+	if (_extensions->heap->getHeapSizingController()->isEnabled()) {
+		/* container limits may have changed since the last collection */
+		updateHeapSizingLimits(env);
+	}
 	if (!timeForHeapContract(env, allocDescription, _systemGC)) {
 		timeForHeapExpand(env, allocDescription);
 	}
@@ -292,21 +298,39 @@ MM_MemorySubSpaceUniSpace::timeForHeapContract(MM_EnvironmentBase *env, MM_Alloc
 			return true;
 		}
 	}
-	
-	/* Don't shrink if -Xmaxf1.0 specfied, i.e max free is 100% */
-	if (100 == _extensions->heapFreeMaximumRatioMultiplier) {
+
+	bool heapSizingControllerEnabled = heap->getHeapSizingController()->isEnabled();
+
+	if (heapSizingControllerEnabled) {
+		uintptr_t activeMemorySize = getActiveMemorySize();
+		uintptr_t ceiling = getHeapSizingCeiling(env);
+		if (ceiling < activeMemorySize) {
+			/* the container memory limit has dropped below the heap so contract whatever the gc time is */
+			_contractionSize = activeMemorySize - ceiling;
+			_extensions->heap->getResizeStats()->setLastContractReason(CONTAINER_MEMORY_LIMIT_CONTRACT);
+			Trc_MM_MemorySubSpaceUniSpace_timeForHeapContract_Exit10(env->getLanguageVMThread(), _contractionSize, ceiling);
+			return true;
+		}
+	} else if (100 == _extensions->heapFreeMaximumRatioMultiplier) {
+		/* Don't shrink if -Xmaxf1.0 specfied, i.e max free is 100% */
 		Trc_MM_MemorySubSpaceUniSpace_timeForHeapContract_Exit2(env->getLanguageVMThread());
 		return false;
 	}
 	
 	/* No need to shrink if we will not be above -Xmaxf after satisfying the allocate */
 	uintptr_t allocSize = allocDescription ? allocDescription->getBytesRequested() : 0;
-	
-	/* Are we spending too little time in GC ? */
-	bool ratioContract = checkForRatioContract(env);
-	
-	/* How much, if any, do we need to contract by ? */
-	_contractionSize = calculateTargetContractSize(env, allocSize, ratioContract);
+	bool ratioContract = false;
+
+	if (heapSizingControllerEnabled) {
+		/* The controller replaces the -Xmaxf and gc ratio heuristics */
+		_contractionSize = calculateHeapSizingContractSize(env, allocSize);
+	} else {
+		/* Are we spending too little time in GC ? */
+		ratioContract = checkForRatioContract(env);
+
+		/* How much, if any, do we need to contract by ? */
+		_contractionSize = calculateTargetContractSize(env, allocSize, ratioContract);
+	}
 	
 	if (_contractionSize == 0 ) {
 		Trc_MM_MemorySubSpaceUniSpace_timeForHeapContract_Exit3(env->getLanguageVMThread());
@@ -347,7 +371,9 @@ MM_MemorySubSpaceUniSpace::timeForHeapContract(MM_EnvironmentBase *env, MM_Alloc
 	 }	
 	
 	/* Remember reason for contraction for later */
-	if (ratioContract) {
+	if (heapSizingControllerEnabled) {
+		_extensions->heap->getResizeStats()->setLastContractReason(GC_CPU_BELOW_TARGET);
+	} else if (ratioContract) {
 		_extensions->heap->getResizeStats()->setLastContractReason(GC_RATIO_TOO_LOW);
 	} else {
 		_extensions->heap->getResizeStats()->setLastContractReason(FREE_SPACE_GREATER_MAXF);
@@ -466,7 +492,14 @@ MM_MemorySubSpaceUniSpace::calculateExpandSize(MM_EnvironmentBase *env, uintptr_
 	/* The desired free is the sum of these 2 rounded to heapAlignment */
 	uintptr_t desiredFree = MM_Math::roundToCeiling(_extensions->heapAlignment, minimumFree + bytesRequired);
 
-	if (desiredFree <= currentFree) {
+	if (_extensions->heap->getHeapSizingController()->isEnabled()) {
+		/* The controller replaces the -Xminf and gc ratio heuristics */
+		expandSize = calculateHeapSizingExpandSize(env, bytesRequired);
+
+		if (expandSize > 0) {
+			_extensions->heap->getResizeStats()->setLastExpandReason(GC_CPU_ABOVE_TARGET);
+		}
+	} else if (desiredFree <= currentFree) {
 		/* Only expand if we didn't expand in last _extensions->heapExpansionStabilizationCount global collections */
 		if (_extensions->isStandardGC() || _extensions->isMetronomeGC()) {
 			uintptr_t gcCount = 0;
@@ -531,6 +564,9 @@ MM_MemorySubSpaceUniSpace::calculateExpandSize(MM_EnvironmentBase *env, uintptr_
 		expandSize = adjustExpansionWithinSoftMax(env, expandSize, 0, MEMORY_TYPE_OLD);
 	}
 
+	/* Never grow past the share of the container memory limit, even to satisfy the allocate */
+	expandSize = adjustExpansionWithinHeapSizingCeiling(env, expandSize);
+
 	Trc_MM_MemorySubSpaceUniSpace_calculateExpandSize_Exit1(env->getLanguageVMThread(), desiredFree, currentFree, expandSize);
 	return expandSize;
 }
@@ -570,6 +606,9 @@ MM_MemorySubSpaceUniSpace::calculateCollectorExpandSize(MM_EnvironmentBase *env,
 		
 	/* Adjust within -XsoftMx limit */
 	expandSize = adjustExpansionWithinSoftMax(env, expandSize, 0, MEMORY_TYPE_OLD);
+
+	/* and within the share of the container memory limit */
+	expandSize = adjustExpansionWithinHeapSizingCeiling(env, expandSize);
 	
 	Trc_MM_MemorySubSpaceUniSpace_calculateCollectorExpandSize_Exit1(env->getLanguageVMThread(), expandSize);
 	return expandSize; 
@@ -750,3 +789,139 @@ MM_MemorySubSpaceUniSpace::getHeapFreeMinimumHeuristicMultiplier(MM_EnvironmentB
 	return freeMinMultiplier;
 }
 
+/**
+ * Sample the container memory limit and CPU count for the heap sizing controller.
+ * The limits are read again before every resize decision so that the heap follows changes made while running.
+ */
+void
+MM_MemorySubSpaceUniSpace::updateHeapSizingLimits(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_HeapSizingController *heapSizingController = _extensions->heap->getHeapSizingController();
+	uint64_t memoryLimit = 0;
+
+	if (OMR_CGROUP_SUBSYSTEM_MEMORY == omrsysinfo_cgroup_are_subsystems_enabled(OMR_CGROUP_SUBSYSTEM_MEMORY)) {
+		if (0 != omrsysinfo_cgroup_get_memlimit(&memoryLimit)) {
+			/* no limit is set */
+			memoryLimit = 0;
+		}
+	}
+
+	if (heapSizingController->updateLimits(memoryLimit, omrsysinfo_get_number_CPUs_by_type(OMRPORT_CPU_TARGET))) {
+		Trc_MM_MemorySubSpaceUniSpace_updateHeapSizingLimits_memoryLimitChanged(env->getLanguageVMThread(), memoryLimit, getHeapSizingCeiling(env));
+	}
+}
+
+/**
+ * Determine the largest size of this subspace under the container memory limit.
+ * The rest of the heap (i.e. the nursery) is charged against the same limit.
+ * @return the largest active size of this subspace
+ */
+uintptr_t
+MM_MemorySubSpaceUniSpace::getHeapSizingCeiling(MM_EnvironmentBase *env)
+{
+	MM_Heap *heap = _extensions->heap;
+	uintptr_t heapCeiling = heap->getHeapSizingController()->getHeapCeiling(heap->getMaximumMemorySize(), _extensions->regionSize);
+	uintptr_t otherMemorySize = heap->getActiveMemorySize() - getActiveMemorySize();
+
+	return (heapCeiling > otherMemorySize) ? (heapCeiling - otherMemorySize) : 0;
+}
+
+/**
+ * Ask the heap sizing controller for the size this subspace should have to meet the gc cpu target.
+ * @param freeBytes the free memory to base the decision on
+ * @return the target size, never above the container memory limit ceiling
+ */
+uintptr_t
+MM_MemorySubSpaceUniSpace::calculateHeapSizingTarget(MM_EnvironmentBase *env, uintptr_t freeBytes)
+{
+	/* A whole percentage is too coarse for small targets, and reads 0 for an oversized heap */
+	double gcPercentage = _extensions->heap->getResizeStats()->calculatePreciseGCPercentage();
+	uintptr_t gcThreadCount = (NULL != _extensions->dispatcher) ? _extensions->dispatcher->threadCountMaximum() : 1;
+	uintptr_t activeMemorySize = getActiveMemorySize();
+	uintptr_t ceiling = getHeapSizingCeiling(env);
+	uintptr_t targetSize = _extensions->heap->getHeapSizingController()->calculateTargetHeapSize(
+			activeMemorySize, freeBytes, gcPercentage, gcThreadCount, ceiling, _extensions->regionSize);
+
+	Trc_MM_MemorySubSpaceUniSpace_calculateHeapSizingTarget(env->getLanguageVMThread(), (uintptr_t)(gcPercentage * 100.0), activeMemorySize, freeBytes, targetSize, ceiling);
+	return targetSize;
+}
+
+/**
+ * Determine how much to expand by to meet the gc cpu target, making room for the pending allocate.
+ * @return Number of bytes to expand by, or 0
+ */
+uintptr_t
+MM_MemorySubSpaceUniSpace::calculateHeapSizingExpandSize(MM_EnvironmentBase *env, uintptr_t bytesRequired)
+{
+	uintptr_t expandSize = 0;
+	uintptr_t activeMemorySize = getActiveMemorySize();
+	uintptr_t currentFree = getApproximateActiveFreeMemorySize();
+	uintptr_t targetSize = calculateHeapSizingTarget(env, currentFree);
+
+	if (bytesRequired > currentFree) {
+		targetSize = OMR_MAX(targetSize, activeMemorySize + (bytesRequired - currentFree));
+	}
+
+	if (targetSize > activeMemorySize) {
+		expandSize = MM_Math::roundToCeiling(_extensions->heapAlignment, targetSize - activeMemorySize);
+	}
+
+	return expandSize;
+}
+
+/**
+ * Determine how much to contract by to meet the gc cpu target.
+ * As with the free ratio heuristics, contraction is bounded by the global minimum and maximum contraction
+ * so that a compaction is not paid for a trivial amount, nor the heap shrunk too quickly.
+ * @return Number of bytes to contract by, or 0
+ */
+uintptr_t
+MM_MemorySubSpaceUniSpace::calculateHeapSizingContractSize(MM_EnvironmentBase *env, uintptr_t allocSize)
+{
+	uintptr_t contractionSize = 0;
+	uintptr_t currentFree = getApproximateActiveFreeMemorySize();
+
+	if (allocSize <= currentFree) {
+		uintptr_t currentHeapSize = getActiveMemorySize();
+		uintptr_t targetSize = calculateHeapSizingTarget(env, currentFree - allocSize);
+
+		if (targetSize < currentHeapSize) {
+			uintptr_t contractionGranule = _extensions->regionSize;
+			uintptr_t maxContract = (uintptr_t)(currentHeapSize * _extensions->globalMaximumContraction);
+			uintptr_t minContract = (uintptr_t)(currentHeapSize * _extensions->globalMinimumContraction);
+
+			maxContract = OMR_MAX(MM_Math::roundToCeiling(contractionGranule, maxContract), contractionGranule);
+			contractionSize = MM_Math::roundToFloor(contractionGranule, OMR_MIN(currentHeapSize - targetSize, maxContract));
+
+			if (contractionSize < minContract) {
+				contractionSize = 0;
+			}
+		}
+	}
+
+	return contractionSize;
+}
+
+/**
+ * Reduce the specified expand amount so that the heap stays within the container memory limit ceiling.
+ * @return Updated expand size
+ */
+uintptr_t
+MM_MemorySubSpaceUniSpace::adjustExpansionWithinHeapSizingCeiling(MM_EnvironmentBase *env, uintptr_t expandSize)
+{
+	uintptr_t result = expandSize;
+
+	if ((expandSize > 0) && _extensions->heap->getHeapSizingController()->isEnabled()) {
+		uintptr_t activeMemorySize = getActiveMemorySize();
+		uintptr_t ceiling = getHeapSizingCeiling(env);
+
+		if (activeMemorySize >= ceiling) {
+			result = 0;
+		} else {
+			result = OMR_MIN(expandSize, ceiling - activeMemorySize);
+		}
+	}
+
+	return result;
+}
@@ -54,6 +54,12 @@ protected:
 	uintptr_t performContract(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription);
 	uintptr_t getHeapFreeMaximumHeuristicMultiplier(MM_EnvironmentBase *env);
 	uintptr_t getHeapFreeMinimumHeuristicMultiplier(MM_EnvironmentBase *env);
+	void updateHeapSizingLimits(MM_EnvironmentBase *env);
+	uintptr_t getHeapSizingCeiling(MM_EnvironmentBase *env);
+	uintptr_t calculateHeapSizingTarget(MM_EnvironmentBase *env, uintptr_t freeBytes);
+	uintptr_t calculateHeapSizingExpandSize(MM_EnvironmentBase *env, uintptr_t bytesRequired);
+	uintptr_t calculateHeapSizingContractSize(MM_EnvironmentBase *env, uintptr_t allocSize);
+	uintptr_t adjustExpansionWithinHeapSizingCeiling(MM_EnvironmentBase *env, uintptr_t expandSize);
 
 public:
 	virtual void checkResize(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription = NULL, bool _systemGC = false);
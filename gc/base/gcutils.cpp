@@ -198,6 +198,10 @@ getContractReasonAsString(ContractReason reason)
 		return "forced nursery contract";
 	case SOFT_MX_CONTRACT:
 		return "satisfy softmx";
+	case GC_CPU_BELOW_TARGET:
+		return "gc cpu time below target";
+	case CONTAINER_MEMORY_LIMIT_CONTRACT:
+		return "satisfy container memory limit";
 	default:
 		return "unknown";
 	}
@@ -229,6 +233,8 @@ getExpandReasonAsString(ExpandReason reason)
 		return "forced nursery expand";
 	case HINT_PREVIOUS_RUNS:
 		return "hint from previous runs";
+	case GC_CPU_ABOVE_TARGET:
+		return "gc cpu time above target";
 	default:
 		return "unknown";
 	}
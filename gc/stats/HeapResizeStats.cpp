@@ -22,31 +22,44 @@
 
 #include "HeapResizeStats.hpp"
 
-uint32_t
-MM_HeapResizeStats::calculateGCPercentage() 
+bool
+MM_HeapResizeStats::sumRatioTicks(uint64_t *totalGCTicks, uint64_t *totalNonGCTicks)
 {
-	uint32_t percentage = 0;
-	uint64_t totalGCTicks = 0;
-	uint64_t totalNonGCTicks = 0;
-
 	/* Make sure histories has not been cleared in last 3 cycles. This will
 	 * be the case if the first element in the array is zero
 	 */
 	if (_ticksOutsideGC[0] == 0 ) {
-		return 0; 
+		return false;
 	}
-	
+
+	*totalGCTicks = 0;
+	*totalNonGCTicks = 0;
+
 	/* Sum up all ticks */
 	for (int i = 0; i < RATIO_RESIZE_HISTORIES; i++) {
-		totalGCTicks += _ticksInGC[i];
-		totalNonGCTicks += _ticksOutsideGC[i];
+		*totalGCTicks += _ticksInGC[i];
+		*totalNonGCTicks += _ticksOutsideGC[i];
 	}
 
 	/* Ignore oldest history for time outside of gc */
-	totalNonGCTicks -= _ticksOutsideGC[0];
+	*totalNonGCTicks -= _ticksOutsideGC[0];
 
 	/* Add latest history for time outside of gc */
-	totalNonGCTicks += _lastTimeOutsideGC;
+	*totalNonGCTicks += _lastTimeOutsideGC;
+
+	return true;
+}
+
+uint32_t
+MM_HeapResizeStats::calculateGCPercentage() 
+{
+	uint32_t percentage = 0;
+	uint64_t totalGCTicks = 0;
+	uint64_t totalNonGCTicks = 0;
+
+	if (!sumRatioTicks(&totalGCTicks, &totalNonGCTicks)) {
+		return 0; 
+	}
 
 	/* ..and calculate percentage of time being spent in GC without using floats */
 	percentage = (uint32_t)((totalGCTicks * 100) / (totalGCTicks + totalNonGCTicks));
@@ -57,6 +70,20 @@ MM_HeapResizeStats::calculateGCPercentage()
 	return percentage;
 }
 
+double
+MM_HeapResizeStats::calculatePreciseGCPercentage()
+{
+	double percentage = 0.0;
+	uint64_t totalGCTicks = 0;
+	uint64_t totalNonGCTicks = 0;
+
+	if (sumRatioTicks(&totalGCTicks, &totalNonGCTicks)) {
+		percentage = ((double)totalGCTicks * 100.0) / (double)(totalGCTicks + totalNonGCTicks);
+	}
+
+	return percentage;
+}
+
 void
 MM_HeapResizeStats::updateHeapResizeStats()
 {
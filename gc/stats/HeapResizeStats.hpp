@@ -78,11 +78,20 @@ public:
 	 * Function members
 	 */
 private:
+	bool	sumRatioTicks(uint64_t *totalGCTicks, uint64_t *totalNonGCTicks);
+
 protected:
 public:
 
 	uint32_t	calculateGCPercentage();
 
+	/**
+	 * Calculate the percentage of time spent in GC like calculateGCPercentage(), without truncating
+	 * it to a whole percentage. Unlike calculateGCPercentage(), the result is not remembered for verbose.
+	 * @return percentage of time spent in GC, or 0 if there is not enough history
+	 */
+	double	calculatePreciseGCPercentage();
+
 	void	updateHeapResizeStats();
 
 	MMINLINE void 	resetRatioTicks()
@@ -200,6 +200,111 @@ void *
 hashTableStartDo(J9HashTable *table,  J9HashTableState *handle);
 
 
+/* ---------------- concurrenthashtable.c ---------------- */
+
+/**
+* @brief Create a hash table that supports concurrent readers and writers.
+* @param portLibrary  The port library
+* @param tableName  A string giving the name of the table
+* @param tableSize  Initial number of buckets (if zero, use a suitable default)
+* @param entrySize  Size of the user-data for each entry
+* @param flags  Optional flags; J9HASH_TABLE_DO_NOT_GROW is supported
+* @param memoryCategory  Memory category for memory allocated by the table
+* @param hashFn  Mandatory hashing function ptr
+* @param hashEqualFn  Mandatory equality function ptr
+* @param functionUserData  Optional userData ptr to be passed to hashFn and hashEqualFn
+* @return  An initialized hash table, or NULL on failure
+*/
+J9ConcurrentHashTable *
+concurrentHashTableNew(
+	OMRPortLibrary *portLibrary,
+	const char *tableName,
+	uint32_t tableSize,
+	uint32_t entrySize,
+	uint32_t flags,
+	uint32_t memoryCategory,
+	J9HashTableHashFn hashFn,
+	J9HashTableEqualFn hashEqualFn,
+	void *functionUserData);
+
+
+/**
+* @brief Free the table and all its entries. No other thread may be using the table.
+* @param *table
+* @return void
+*/
+void
+concurrentHashTableFree(J9ConcurrentHashTable *table);
+
+
+/**
+* @brief Find an entry without taking any lock.
+* @param *table
+* @param *entry
+* @return NULL if no matching entry is present; otherwise a pointer to the user-data
+*/
+void *
+concurrentHashTableFind(J9ConcurrentHashTable *table, void *entry);
+
+
+/**
+* @brief Add an entry unless a matching one is already present.
+* @param *table
+* @param *entry
+* @return the matching or newly added user-data, or NULL on allocation failure
+*/
+void *
+concurrentHashTableAdd(J9ConcurrentHashTable *table, void *entry);
+
+
+/**
+* @brief Remove the entry matching the given key.
+* @param *table
+* @param *entry
+* @return 0 on success, 1 if no matching entry was found
+*/
+uint32_t
+concurrentHashTableRemove(J9ConcurrentHashTable *table, void *entry);
+
+
+/**
+* @brief Call doFn on every entry; entries for which it returns TRUE are removed.
+* @param *table
+* @param doFn
+* @param *opaque
+* @return void
+*/
+void
+concurrentHashTableForEachDo(J9ConcurrentHashTable *table, J9HashTableDoFn doFn, void *opaque);
+
+
+/**
+* @brief
+* @param *table
+* @return uint32_t
+*/
+uint32_t
+concurrentHashTableGetCount(J9ConcurrentHashTable *table);
+
+
+/**
+* @brief Begin a read section. Entries removed by other threads stay allocated until it ends.
+* @param *table
+* @return a token to pass to concurrentHashTableReadExit
+*/
+uintptr_t
+concurrentHashTableReadEnter(J9ConcurrentHashTable *table);
+
+
+/**
+* @brief End a read section begun by concurrentHashTableReadEnter.
+* @param *table
+* @param token
+* @return void
+*/
+void
+concurrentHashTableReadExit(J9ConcurrentHashTable *table, uintptr_t token);
+
 
 #ifdef __cplusplus
 }
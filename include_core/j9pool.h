@@ -79,6 +79,7 @@ typedef struct J9Pool {
 	uint16_t alignment;
 	uint16_t flags;
 	uint32_t memoryCategory;
+	volatile uintptr_t threadCacheLock;
 } J9Pool;
 
 #define POOL_NO_ZERO  8
@@ -89,6 +90,20 @@ typedef struct J9Pool {
 #define POOL_ALWAYS_KEEP_SORTED  4
 #define POOL_ALLOC_TYPE_PUDDLE_LIST  2
 #define POOL_ALLOC_TYPE_POOL  0
+#define POOL_THREAD_CACHE  64
+
+/*
+ * @ddr_namespace: map_to_type=J9PoolThreadCache
+ */
+
+#define POOL_THREAD_CACHE_SIZE  32
+
+typedef struct J9PoolThreadCache {
+	struct J9Pool *pool;
+	struct J9PoolPuddle *affinityPuddle;
+	uintptr_t count;
+	void *elements[POOL_THREAD_CACHE_SIZE];
+} J9PoolThreadCache;
 
 /*
  * @ddr_namespace: map_to_type=J9PoolState
@@ -442,6 +442,8 @@ typedef enum {
 	SATISFY_EXPAND,
 	FORCED_NURSERY_CONTRACT,
 	SOFT_MX_CONTRACT,
+	GC_CPU_BELOW_TARGET,
+	CONTAINER_MEMORY_LIMIT_CONTRACT,
 } ContractReason;
 
 typedef enum {
@@ -454,7 +456,8 @@ typedef enum {
 	SATISFY_COLLECTOR,
 	EXPAND_DESPERATE,
 	FORCED_NURSERY_EXPAND,
-	HINT_PREVIOUS_RUNS
+	HINT_PREVIOUS_RUNS,
+	GC_CPU_ABOVE_TARGET
 } ExpandReason;
 
 typedef enum {
@@ -132,6 +132,69 @@ typedef struct J9HashTableState {
 	uintptr_t flags;
 } J9HashTableState;
 
+/*
+ * @ddr_namespace: map_to_type=J9ConcurrentHashtableConstants
+ */
+
+/**
+ * Concurrent hash table constants
+ */
+#define J9CONCURRENT_HASH_TABLE_LOCK_STRIPES 16	/*!< Number of locks serializing writers; also the minimum number of buckets */
+#define J9CONCURRENT_HASH_TABLE_READER_STRIPES 16	/*!< Number of cache line sized counters tracking active readers */
+#define J9CONCURRENT_HASH_TABLE_READER_STRIPE_SIZE 128	/*!< Size of each reader counter stripe */
+
+/*
+ * @ddr_namespace: default
+ */
+
+typedef struct J9ConcurrentHashTableNode {
+	struct J9ConcurrentHashTableNode *volatile next;
+	struct J9ConcurrentHashTableNode *retiredNext;
+	uintptr_t hash;
+	void *entry;
+	uintptr_t retiredFlags;
+} J9ConcurrentHashTableNode;
+
+typedef struct J9ConcurrentHashTableBuckets {
+	uintptr_t size;
+	struct J9ConcurrentHashTableBuckets *volatile previous;
+	struct J9ConcurrentHashTableBuckets *retiredNext;
+	volatile uintptr_t migratedBuckets;
+	volatile uintptr_t migrateCursor;
+	struct J9ConcurrentHashTableNode *volatile heads[1];
+} J9ConcurrentHashTableBuckets;
+
+typedef struct J9ConcurrentHashTableReaderStripe {
+	volatile uintptr_t activeReaders[2];
+	uint8_t padding[J9CONCURRENT_HASH_TABLE_READER_STRIPE_SIZE - (2 * sizeof(uintptr_t))];
+} J9ConcurrentHashTableReaderStripe;
+
+typedef struct J9ConcurrentHashTable {
+	const char *tableName;
+	uint32_t entrySize;
+	uint32_t flags;
+	uint32_t memoryCategory;
+	uintptr_t (*hashFn)(void *key, void *userData) ;
+	uintptr_t (*hashEqualFn)(void *leftKey, void *rightKey, void *userData) ;
+	struct OMRPortLibrary *portLibrary;
+	void *functionUserData;
+	struct J9ConcurrentHashTableBuckets *volatile buckets;
+	volatile uintptr_t numberOfEntries;
+	volatile uintptr_t activeIterators;
+	struct J9ThreadMonitor *writeLocks[J9CONCURRENT_HASH_TABLE_LOCK_STRIPES];
+	struct J9ThreadMonitor *resizeMutex;
+	struct J9ThreadMonitor *reclaimMutex;
+	void *readerStripeMemory;
+	struct J9ConcurrentHashTableReaderStripe *readerStripes;
+	volatile uintptr_t epoch;
+	struct J9ConcurrentHashTableNode *volatile retiredNodes;
+	struct J9ConcurrentHashTableBuckets *volatile retiredBuckets;
+	volatile uintptr_t retiredCount;
+	struct J9ConcurrentHashTableNode *pendingNodes;
+	struct J9ConcurrentHashTableBuckets *pendingBuckets;
+	uintptr_t pendingParity;
+} J9ConcurrentHashTable;
+
 #ifdef __cplusplus
 }
 #endif
@@ -61,6 +61,9 @@ typedef struct J9HookInterface {
 	intptr_t (*J9HookIsEnabled)(struct J9HookInterface **hookInterface, uintptr_t eventNum);
 	uintptr_t (*J9HookAllocateAgentID)(struct J9HookInterface **hookInterface);
 	void (*J9HookDeallocateAgentID)(struct J9HookInterface **hookInterface, uintptr_t agentID);
+	intptr_t (*J9HookRegisterDumpConsumer)(struct J9HookInterface **hookInterface);
+	void (*J9HookUnregisterDumpConsumer)(struct J9HookInterface **hookInterface);
+	uintptr_t (*J9HookGetEventCount)(struct J9HookInterface **hookInterface, uintptr_t eventNum);
 } J9HookInterface;
 
 
@@ -96,7 +99,7 @@ typedef struct OMRHookInfo4Dump {
 typedef struct OMREventInfo4Dump {
 	struct OMRHookInfo4Dump longestHook;
 	struct OMRHookInfo4Dump lastHook;
-	volatile uintptr_t count;
+	volatile uintptr_t count;		/* listener invocations while a dump consumer is registered or the threshold tracepoint is enabled */
 	volatile uintptr_t totalTime;
 }OMREventInfo4Dump;
 
@@ -109,6 +112,7 @@ typedef struct J9CommonHookInterface {
 	struct OMRPortLibrary *portLib;		/* for accessing PortLibrary  */
 	uint64_t threshold4Trace;			/* the threshold for triggering tracepoint */
 	uintptr_t eventSize;				/* how many events supported by this hook interface */
+	volatile uintptr_t dumpConsumers;	/* dump info is only collected while this is non-zero or the threshold tracepoint is enabled */
 } J9CommonHookInterface;
 
 
@@ -108,6 +108,7 @@
 #define EsOpenCreateNoTag 	0x800	/* Used for zOS only, to disable USS file tagging on JVM-generated files */
 #define EsOpenShareDelete 	0x1000  /* used only for windows to allow a file to be renamed while it is still open */
 #define EsOpenAsynchronous 	0x2000  /* used only for windows to allow a file to be opened asynchronously */
+#define EsOpenDirect 	0x4000  /* bypass the OS page cache; buffers, offsets and lengths must be multiples of OMRPORT_FILE_DIRECT_IO_ALIGNMENT */
 
 #define EsIsDir 	0	/* Return values for EsFileAttr */
 #define EsIsFile 	1
@@ -249,6 +250,15 @@
 #define OMRPORT_TIME_DELTA_IN_NANOSECONDS ((uint64_t) 1000000000)
 /** @} */
 
+/**
+ * @name Tick Clock Sources
+ * Values returned by @ref omrtime::omrtime_tick_source
+ * @{
+ */
+#define OMRPORT_TIME_TICK_SOURCE_HIRES 0
+#define OMRPORT_TIME_TICK_SOURCE_TSC 1
+/** @} */
+
 #if defined(S390) || defined(J9ZOS390)
 /**
  * @name Constants to calculate time from high-resolution timer
@@ -461,6 +471,41 @@ typedef struct J9FileStatFilesystem {
 	uint64_t totalSizeBytes;
 } J9FileStatFilesystem;
 
+/**
+ * One buffer of a vectored read or write, see omrfile_readv and omrfile_writev.
+ */
+typedef struct OMRFileIOVec {
+	void *base;
+	uintptr_t length;
+} OMRFileIOVec;
+
+struct OMRPortLibrary;
+
+/**
+ * One operation of an asynchronous file I/O batch, see omrfile_aio_submit.
+ * The caller owns the request and its buffer until the request's callback has
+ * been run by omrfile_aio_complete.
+ */
+typedef struct OMRFileAIORequest {
+	intptr_t fd;
+	int32_t opcode;
+	void *buffer;
+	uintptr_t length;
+	int64_t offset;
+	void (*callback)(struct OMRPortLibrary *portLibrary, struct OMRFileAIORequest *request);
+	void *userData;
+	/* Number of bytes transferred (0 for a read at end of file), 0 for OMRPORT_FILE_AIO_SYNC, or a negative portable error code */
+	intptr_t result;
+	/* Private to the port library */
+	struct OMRFileAIORequest *next;
+} OMRFileAIORequest;
+
+/**
+ * A queue of asynchronous file I/O requests.
+ * Private, platform specific implementation.
+ */
+struct OMRFileAIOContext;
+
 /**
  * A handle to a filestream.
  * Private, platform specific implementation.
@@ -919,6 +964,9 @@ typedef struct J9ProcessorInfos {
 #define OMRPORT_CTLDATA_CRIU_SUPPORT_FLAGS "CRIU_SUPPORT_FLAGS"
 #define OMRPORT_CTLDATA_MEM_32BIT "MEM_32BIT_FLAGS"
 #define OMRPORT_CTLDATA_VMEM_TMPDIR_PATH "VMEM_TMPDIR_PATH"
+#define OMRPORT_CTLDATA_MEM_THREAD_CACHE "MEM_THREAD_CACHE"
+#define OMRPORT_CTLDATA_MEM_TAG_CHECK_INTERVAL "MEM_TAG_CHECK_INTERVAL"
+#define OMRPORT_CTLDATA_TIME_TICK_SOURCE "TIME_TICK_SOURCE"
 
 /* OMRPORT_CTLDATA_MEM_32BIT Flags */
 #define OMRPORT_MEM_32BIT_FLAGS_TMP_FILE_BACKED_VMEM 0x1
@@ -937,6 +985,31 @@ typedef struct J9ProcessorInfos {
 #define OMRPORT_FILE_WAIT_FOR_LOCK  4
 #define OMRPORT_FILE_NOWAIT_FOR_LOCK  8
 
+/* Offset for omrfile_readv and omrfile_writev to use and advance the file position */
+#define OMRPORT_FILE_CURRENT_POSITION  ((int64_t)-1)
+
+/* Alignment of buffers, file offsets and lengths for files opened with EsOpenDirect */
+#define OMRPORT_FILE_DIRECT_IO_ALIGNMENT  4096
+
+/* Access pattern hints for omrfile_advise */
+#define OMRPORT_FILE_ADVICE_NORMAL  0
+#define OMRPORT_FILE_ADVICE_SEQUENTIAL  1
+#define OMRPORT_FILE_ADVICE_RANDOM  2
+#define OMRPORT_FILE_ADVICE_WILLNEED  3
+#define OMRPORT_FILE_ADVICE_DONTNEED  4
+#define OMRPORT_FILE_ADVICE_NOREUSE  5
+
+/* Operations for OMRFileAIORequest */
+#define OMRPORT_FILE_AIO_READ  1
+#define OMRPORT_FILE_AIO_WRITE  2
+#define OMRPORT_FILE_AIO_SYNC  3
+
+/* Flags for omrfile_aio_context_create */
+#define OMRPORT_FILE_AIO_USE_THREADS  0x1
+
+/* Largest queue depth accepted by omrfile_aio_context_create */
+#define OMRPORT_FILE_AIO_MAX_QUEUE_DEPTH  4096
+
 #define OMRPORT_MMAP_CAPABILITY_COPYONWRITE  1
 #define OMRPORT_MMAP_CAPABILITY_READ  2
 #define OMRPORT_MMAP_CAPABILITY_WRITE  4
@@ -2105,6 +2178,14 @@ typedef struct OMRPortLibrary {
 	uint64_t (*time_hires_frequency)(struct OMRPortLibrary *portLibrary) ;
 	/** see @ref omrtime.c::omrtime_hires_delta "omrtime_hires_delta"*/
 	uint64_t (*time_hires_delta)(struct OMRPortLibrary *portLibrary, uint64_t startTime, uint64_t endTime, uint64_t requiredResolution) ;
+	/** see @ref omrtimeticks.c::omrtime_tick_clock "omrtime_tick_clock"*/
+	uint64_t (*time_tick_clock)(struct OMRPortLibrary *portLibrary) ;
+	/** see @ref omrtimeticks.c::omrtime_tick_frequency "omrtime_tick_frequency"*/
+	uint64_t (*time_tick_frequency)(struct OMRPortLibrary *portLibrary) ;
+	/** see @ref omrtimeticks.c::omrtime_tick_delta "omrtime_tick_delta"*/
+	uint64_t (*time_tick_delta)(struct OMRPortLibrary *portLibrary, uint64_t startTicks, uint64_t endTicks, uint64_t requiredResolution) ;
+	/** see @ref omrtimeticks.c::omrtime_tick_source "omrtime_tick_source"*/
+	int32_t (*time_tick_source)(struct OMRPortLibrary *portLibrary) ;
 	/** see @ref omrsysinfo.c::omrsysinfo_startup "omrsysinfo_startup"*/
 	int32_t (*sysinfo_startup)(struct OMRPortLibrary *portLibrary) ;
 	/** see @ref omrsysinfo.c::omrsysinfo_shutdown "omrsysinfo_shutdown"*/
@@ -2499,6 +2580,26 @@ typedef struct OMRPortLibrary {
 	int32_t (*file_blockingasync_unlock_bytes)(struct OMRPortLibrary *portLibrary, intptr_t fd, uint64_t offset, uint64_t length) ;
 	/** see @ref omrfile_blockingasync.c::omrfile_blockingasync_lock_bytes "omrfile_blockingasync_lock_bytes"*/
 	int32_t (*file_blockingasync_lock_bytes)(struct OMRPortLibrary *portLibrary, intptr_t fd, int32_t lockFlags, uint64_t offset, uint64_t length) ;
+	/** see @ref omrfile.c::omrfile_pread "omrfile_pread"*/
+	intptr_t (*file_pread)(struct OMRPortLibrary *portLibrary, intptr_t fd, void *buf, intptr_t nbytes, int64_t offset) ;
+	/** see @ref omrfile.c::omrfile_pwrite "omrfile_pwrite"*/
+	intptr_t (*file_pwrite)(struct OMRPortLibrary *portLibrary, intptr_t fd, const void *buf, intptr_t nbytes, int64_t offset) ;
+	/** see @ref omrfile.c::omrfile_readv "omrfile_readv"*/
+	intptr_t (*file_readv)(struct OMRPortLibrary *portLibrary, intptr_t fd, const struct OMRFileIOVec *iov, int32_t iovcnt, int64_t offset) ;
+	/** see @ref omrfile.c::omrfile_writev "omrfile_writev"*/
+	intptr_t (*file_writev)(struct OMRPortLibrary *portLibrary, intptr_t fd, const struct OMRFileIOVec *iov, int32_t iovcnt, int64_t offset) ;
+	/** see @ref omrfile.c::omrfile_preallocate "omrfile_preallocate"*/
+	int32_t (*file_preallocate)(struct OMRPortLibrary *portLibrary, intptr_t fd, int64_t offset, int64_t length) ;
+	/** see @ref omrfile.c::omrfile_advise "omrfile_advise"*/
+	int32_t (*file_advise)(struct OMRPortLibrary *portLibrary, intptr_t fd, int64_t offset, int64_t length, int32_t advice) ;
+	/** see @ref omrfile_aio.c::omrfile_aio_context_create "omrfile_aio_context_create"*/
+	int32_t (*file_aio_context_create)(struct OMRPortLibrary *portLibrary, uint32_t queueDepth, uint32_t flags, struct OMRFileAIOContext **context) ;
+	/** see @ref omrfile_aio.c::omrfile_aio_context_destroy "omrfile_aio_context_destroy"*/
+	void (*file_aio_context_destroy)(struct OMRPortLibrary *portLibrary, struct OMRFileAIOContext *context) ;
+	/** see @ref omrfile_aio.c::omrfile_aio_submit "omrfile_aio_submit"*/
+	intptr_t (*file_aio_submit)(struct OMRPortLibrary *portLibrary, struct OMRFileAIOContext *context, struct OMRFileAIORequest **requests, uintptr_t count) ;
+	/** see @ref omrfile_aio.c::omrfile_aio_complete "omrfile_aio_complete"*/
+	intptr_t (*file_aio_complete)(struct OMRPortLibrary *portLibrary, struct OMRFileAIOContext *context, uintptr_t minComplete, int64_t timeoutMillis) ;
 	/** see @ref omrstr.c::omrstr_ftime "omrstr_ftime"*/
 	uintptr_t (*str_ftime)(struct OMRPortLibrary *portLibrary, char *buf, uintptr_t bufLen, const char *format, int64_t timeMillis) ;
 	/** see @ref omrstr.c::omrstr_ftime_ex "omrstr_ftime_ex"*/
@@ -2801,6 +2902,24 @@ typedef struct OMRPortLibrary {
 	int32_t (*sock_getsockopt_linger)(struct OMRPortLibrary *portLibrary, omrsock_socket_t handle, int32_t optlevel, int32_t optname, omrsock_linger_t optval) ;
 	/** see @ref omrsock.c::omrsock_getsockopt_timeval "omrsock_getsockopt_timeval"*/
 	int32_t (*sock_getsockopt_timeval)(struct OMRPortLibrary *portLibrary, omrsock_socket_t handle, int32_t optlevel, int32_t optname, omrsock_timeval_t optval) ;
+	/** see @ref omrsock.c::omrsock_eventset_create "omrsock_eventset_create"*/
+	int32_t (*sock_eventset_create)(struct OMRPortLibrary *portLibrary, omrsock_eventset_t *eventSet) ;
+	/** see @ref omrsock.c::omrsock_eventset_add "omrsock_eventset_add"*/
+	int32_t (*sock_eventset_add)(struct OMRPortLibrary *portLibrary, omrsock_eventset_t eventSet, omrsock_socket_t sock, int16_t events, void *userData) ;
+	/** see @ref omrsock.c::omrsock_eventset_modify "omrsock_eventset_modify"*/
+	int32_t (*sock_eventset_modify)(struct OMRPortLibrary *portLibrary, omrsock_eventset_t eventSet, omrsock_socket_t sock, int16_t events, void *userData) ;
+	/** see @ref omrsock.c::omrsock_eventset_remove "omrsock_eventset_remove"*/
+	int32_t (*sock_eventset_remove)(struct OMRPortLibrary *portLibrary, omrsock_eventset_t eventSet, omrsock_socket_t sock) ;
+	/** see @ref omrsock.c::omrsock_eventset_wait "omrsock_eventset_wait"*/
+	int32_t (*sock_eventset_wait)(struct OMRPortLibrary *portLibrary, omrsock_eventset_t eventSet, omrsock_event_t events, uint32_t maxEvents, int32_t timeoutMs) ;
+	/** see @ref omrsock.c::omrsock_get_event_info "omrsock_get_event_info"*/
+	int32_t (*sock_get_event_info)(struct OMRPortLibrary *portLibrary, omrsock_event_t handle, omrsock_socket_t *sock, void **userData, int16_t *revents) ;
+	/** see @ref omrsock.c::omrsock_eventset_destroy "omrsock_eventset_destroy"*/
+	int32_t (*sock_eventset_destroy)(struct OMRPortLibrary *portLibrary, omrsock_eventset_t *eventSet) ;
+	/** see @ref omrsock.c::omrsock_sendfile "omrsock_sendfile"*/
+	intptr_t (*sock_sendfile)(struct OMRPortLibrary *portLibrary, omrsock_socket_t sock, intptr_t fd, int64_t *offset, uintptr_t count) ;
+	/** see @ref omrsock.c::omrsock_splice "omrsock_splice"*/
+	int32_t (*sock_splice)(struct OMRPortLibrary *portLibrary, omrsock_socket_t fromSock, omrsock_socket_t toSock, int32_t nbyte) ;
 #if defined(OMR_OPT_CUDA)
 	/** CUDA configuration data */
 	J9CudaConfig *cuda_configData;
@@ -3045,6 +3164,10 @@ extern J9_CFUNC int32_t omrport_getVersion(struct OMRPortLibrary *portLibrary);
 #define omrtime_hires_clock() privateOmrPortLibrary->time_hires_clock(privateOmrPortLibrary)
 #define omrtime_hires_frequency() privateOmrPortLibrary->time_hires_frequency(privateOmrPortLibrary)
 #define omrtime_hires_delta(param1,param2,param3) privateOmrPortLibrary->time_hires_delta(privateOmrPortLibrary, (param1), (param2), (param3))
+#define omrtime_tick_clock() privateOmrPortLibrary->time_tick_clock(privateOmrPortLibrary)
+#define omrtime_tick_frequency() privateOmrPortLibrary->time_tick_frequency(privateOmrPortLibrary)
+#define omrtime_tick_delta(param1,param2,param3) privateOmrPortLibrary->time_tick_delta(privateOmrPortLibrary, (param1), (param2), (param3))
+#define omrtime_tick_source() privateOmrPortLibrary->time_tick_source(privateOmrPortLibrary)
 #define omrsysinfo_startup() privateOmrPortLibrary->sysinfo_startup(privateOmrPortLibrary)
 #define omrsysinfo_shutdown() privateOmrPortLibrary->sysinfo_shutdown(privateOmrPortLibrary)
 #define omrsysinfo_process_exists(param1) privateOmrPortLibrary->sysinfo_process_exists(privateOmrPortLibrary, (param1))
@@ -3115,6 +3238,16 @@ extern J9_CFUNC int32_t omrport_getVersion(struct OMRPortLibrary *portLibrary);
 #define omrfile_blockingasync_write(param1,param2,param3) privateOmrPortLibrary->file_blockingasync_write(privateOmrPortLibrary, (param1), (param2), (param3))
 #define omrfile_blockingasync_unlock_bytes(param1,param2,param3) privateOmrPortLibrary->file_blockingasync_unlock_bytes(privateOmrPortLibrary, (param1), (param2), (param3))
 #define omrfile_blockingasync_lock_bytes(param1,param2,param3,param4) privateOmrPortLibrary->file_blockingasync_lock_bytes(privateOmrPortLibrary, (param1), (param2), (param3), (param4))
+#define omrfile_pread(param1,param2,param3,param4) privateOmrPortLibrary->file_pread(privateOmrPortLibrary, (param1), (param2), (param3), (param4))
+#define omrfile_pwrite(param1,param2,param3,param4) privateOmrPortLibrary->file_pwrite(privateOmrPortLibrary, (param1), (param2), (param3), (param4))
+#define omrfile_readv(param1,param2,param3,param4) privateOmrPortLibrary->file_readv(privateOmrPortLibrary, (param1), (param2), (param3), (param4))
+#define omrfile_writev(param1,param2,param3,param4) privateOmrPortLibrary->file_writev(privateOmrPortLibrary, (param1), (param2), (param3), (param4))
+#define omrfile_preallocate(param1,param2,param3) privateOmrPortLibrary->file_preallocate(privateOmrPortLibrary, (param1), (param2), (param3))
+#define omrfile_advise(param1,param2,param3,param4) privateOmrPortLibrary->file_advise(privateOmrPortLibrary, (param1), (param2), (param3), (param4))
+#define omrfile_aio_context_create(param1,param2,param3) privateOmrPortLibrary->file_aio_context_create(privateOmrPortLibrary, (param1), (param2), (param3))
+#define omrfile_aio_context_destroy(param1) privateOmrPortLibrary->file_aio_context_destroy(privateOmrPortLibrary, (param1))
+#define omrfile_aio_submit(param1,param2,param3) privateOmrPortLibrary->file_aio_submit(privateOmrPortLibrary, (param1), (param2), (param3))
+#define omrfile_aio_complete(param1,param2,param3) privateOmrPortLibrary->file_aio_complete(privateOmrPortLibrary, (param1), (param2), (param3))
 #define omrfile_blockingasync_set_length(param1,param2) privateOmrPortLibrary->file_blockingasync_set_length(privateOmrPortLibrary, (param1), (param2))
 #define omrfile_blockingasync_flength(param1) privateOmrPortLibrary->file_blockingasync_flength(privateOmrPortLibrary, (param1))
 #define omrfilestream_startup() privateOmrPortLibrary->filestream_startup(privatePortLibrary)
@@ -3388,6 +3521,15 @@ extern J9_CFUNC int32_t omrport_getVersion(struct OMRPortLibrary *portLibrary);
 #define omrsock_getsockopt_int(param1,param2,param3,param4) privateOmrPortLibrary->sock_getsockopt_int(privateOmrPortLibrary, (param1), (param2), (param3), (param4))
 #define omrsock_getsockopt_linger(param1,param2,param3,param4) privateOmrPortLibrary->sock_getsockopt_linger(privateOmrPortLibrary, (param1), (param2), (param3), (param4))
 #define omrsock_getsockopt_timeval(param1,param2,param3,param4) privateOmrPortLibrary->sock_getsockopt_timeval(privateOmrPortLibrary, (param1), (param2), (param3), (param4))
+#define omrsock_eventset_create(param1) privateOmrPortLibrary->sock_eventset_create(privateOmrPortLibrary, (param1))
+#define omrsock_eventset_add(param1,param2,param3,param4) privateOmrPortLibrary->sock_eventset_add(privateOmrPortLibrary, (param1), (param2), (param3), (param4))
+#define omrsock_eventset_modify(param1,param2,param3,param4) privateOmrPortLibrary->sock_eventset_modify(privateOmrPortLibrary, (param1), (param2), (param3), (param4))
+#define omrsock_eventset_remove(param1,param2) privateOmrPortLibrary->sock_eventset_remove(privateOmrPortLibrary, (param1), (param2))
+#define omrsock_eventset_wait(param1,param2,param3,param4) privateOmrPortLibrary->sock_eventset_wait(privateOmrPortLibrary, (param1), (param2), (param3), (param4))
+#define omrsock_get_event_info(param1,param2,param3,param4) privateOmrPortLibrary->sock_get_event_info(privateOmrPortLibrary, (param1), (param2), (param3), (param4))
+#define omrsock_eventset_destroy(param1) privateOmrPortLibrary->sock_eventset_destroy(privateOmrPortLibrary, (param1))
+#define omrsock_sendfile(param1,param2,param3,param4) privateOmrPortLibrary->sock_sendfile(privateOmrPortLibrary, (param1), (param2), (param3), (param4))
+#define omrsock_splice(param1,param2,param3) privateOmrPortLibrary->sock_splice(privateOmrPortLibrary, (param1), (param2), (param3))
 
 #if defined(OMR_OPT_CUDA)
 #define omrcuda_startup() \
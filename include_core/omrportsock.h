@@ -46,6 +46,12 @@ typedef struct OMRTimeval *omrsock_timeval_t;
 /* Pointer to OMRLinger, a struct that contains struct linger.*/
 typedef struct OMRLinger *omrsock_linger_t;
 
+/* Pointer to OMRSockEventSet, a set of sockets watched by @ref omrsock_eventset_wait. */
+typedef struct OMRSockEventSet *omrsock_eventset_t;
+
+/* Pointer to OMRSockEvent, a struct that contains one readiness event from @ref omrsock_eventset_wait. */
+typedef struct OMRSockEvent *omrsock_event_t;
+
 /* Bind to all available interfaces */
 #define OMRSOCK_INADDR_ANY ((uint32_t)0)
 
@@ -87,4 +93,8 @@ typedef struct OMRLinger *omrsock_linger_t;
 #define OMRSOCK_POLLHUP 0x0010
 #endif
 
+/* Event Set Flags, ORed with the poll constants passed to @ref omrsock_eventset_add */
+#define OMRSOCK_EVENT_EDGE_TRIGGERED 0x0100
+#define OMRSOCK_EVENT_ONESHOT 0x0200
+
 #endif /* !defined(OMRPORTSOCK_H_) */
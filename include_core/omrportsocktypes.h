@@ -101,6 +101,8 @@ typedef struct OMRSockAddrStorage {
  */
 typedef struct OMRSocket {
 	omr_os_socket data;
+	/* Set by @ref omrsock_eventset_add and returned with the socket's events. */
+	void *userData;
 } OMRSocket;
 
 /**
@@ -148,6 +150,15 @@ typedef struct OMRLinger {
 	struct linger data;
 } OMRLinger;
 
+/**
+ * A struct for one readiness event. Filled in by @ref omrsock_eventset_wait.
+ */
+typedef struct OMRSockEvent {
+	OMRSocket *socket;
+	void *userData;
+	int16_t events;
+} OMRSockEvent;
+
 /* Additional constants: Set maximum backlog for listen */
 #define OMRSOCK_MAXCONN SOMAXCONN
 
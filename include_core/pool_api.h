@@ -199,6 +199,45 @@ pool_ensureCapacity(J9Pool *aPool, uintptr_t newCapacity);
 uintptr_t
 pool_includesElement(J9Pool *aPool, void *anElement);
 
+/* ---------------- pool_threadcache.c ---------------- */
+
+/**
+* @brief
+* @param *aPool a pool created with POOL_THREAD_CACHE
+* @param *cache
+* @return void
+*/
+void
+pool_threadCacheInit(J9Pool *aPool, J9PoolThreadCache *cache);
+
+
+/**
+* @brief
+* @param *cache
+* @return void *
+*/
+void *
+pool_newElementCached(J9PoolThreadCache *cache);
+
+
+/**
+* @brief
+* @param *cache
+* @param *anElement
+* @return void
+*/
+void
+pool_removeElementCached(J9PoolThreadCache *cache, void *anElement);
+
+
+/**
+* @brief
+* @param *cache
+* @return void
+*/
+void
+pool_threadCacheFlush(J9PoolThreadCache *cache);
+
 #ifdef __cplusplus
 }
 #endif
@@ -53,6 +53,9 @@ typedef void (*omrthread_monitor_wait_callback)(void *userData);
 #define J9THREAD_RWMUTEX_FAIL	 	 1
 #define J9THREAD_RWMUTEX_WOULDBLOCK -1
 
+/* omrthread_rwmutex_init flags */
+#define J9THREAD_RWMUTEX_READER_BIASED 0x1 /* readers do not touch the monitor unless a writer is active */
+
 /* Define conversions for units of time used in thrprof.c */
 #define SEC_TO_NANO_CONVERSION_CONSTANT		(1000 * 1000 * 1000)
 #define MICRO_TO_NANO_CONVERSION_CONSTANT	1000
@@ -509,7 +509,7 @@ class CppGenerator:
             t = self.get_class_name(parm.type().as_class())
             writer.write("ARRAY_ARG_SETUP({t}, {s}, {n}Arg, {n});\n".format(t=t, n=parm.name(), s=parm.array_len()))
 
-    def write_arg_return(self, writer, parm):
+    def write_arg_return(self, writer, parm, namespace=""):
         """
         Writes the argument reconstruction for in-out parameters
         and array parameters.
@@ -522,14 +522,18 @@ class CppGenerator:
         assigned to the client arguments. Effectively, the
         generated code undoes what the code generated by
         `write_arg_setup()` does.
+
+        Services that are not class members are implemented outside
+        the client namespace, so `namespace` is used to qualify the
+        client class names.
         """
         if parm.is_in_out():
             assert parm.type().is_class()
-            t = self.get_class_name(parm.type().as_class())
+            t = namespace + self.get_class_name(parm.type().as_class())
             writer.write("ARG_RETURN({t}, {n}Impl, {n});\n".format(t=t, n=parm.name()))
         elif parm.is_array():
             assert parm.type().is_class()
-            t = self.get_class_name(parm.type().as_class())
+            t = namespace + self.get_class_name(parm.type().as_class())
             writer.write("ARRAY_ARG_RETURN({t}, {s}, {n}Arg, {n});\n".format(t=t, n=parm.name(), s=parm.array_len()))
 
     def write_class_service_impl(self, writer, desc, class_desc):
@@ -866,17 +870,17 @@ class CppGenerator:
         if "none" == desc.return_type().name():
             writer.write(impl_call + ";\n")
             for parm in desc.parameters():
-                self.write_arg_return(writer, parm)
+                self.write_arg_return(writer, parm, namespace)
         elif desc.return_type().is_class():
             writer.write("{rtype} implRet = {call};\n".format(rtype=self.get_impl_type(desc.return_type()), call=impl_call))
             for parm in desc.parameters():
-                self.write_arg_return(writer, parm)
+                self.write_arg_return(writer, parm, namespace)
             writer.write("GET_CLIENT_OBJECT(clientObj, {t}, implRet);\n".format(t=desc.return_type().name()))
             writer.write("return clientObj;\n")
         else:
             writer.write("auto ret = " + impl_call + ";\n")
             for parm in desc.parameters():
-                self.write_arg_return(writer, parm)
+                self.write_arg_return(writer, parm, namespace)
             writer.write("return ret;\n")
         writer.outdent()
         writer.write("}\n")
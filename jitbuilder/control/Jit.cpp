@@ -21,6 +21,9 @@
  *******************************************************************************/
 
 #include <stdio.h>
+#include <vector>
+#include "AtomicSupport.hpp"
+#include "omrthread.h"
 #include "control/SimpleJit.hpp"
 #include "ilgen/MethodBuilder.hpp"
 
@@ -46,6 +49,7 @@
 // An individual program should link statically against JitBuilder, then call:
 //     initializeJit() or initializeJitWithOptions() to initialize the Jit
 //     compileMethodBuilder() as many times as needed to create compiled code
+//        (or compileMethodBuilders() to compile a batch of them on several threads)
 //     shuwdownJit() when the test is complete
 //
 
@@ -90,6 +94,98 @@ internal_compileMethodBuilder(TR::MethodBuilder *m, void **entry)
    return rc;
    }
 
+namespace {
+
+// omrthread's default stack is far too small for the compiler, so give the
+// compiling threads as much stack as a typical main thread has
+const uintptr_t COMPILATION_THREAD_STACK_SIZE = 8 * 1024 * 1024;
+
+struct MethodBuilderBatch
+   {
+   TR::MethodBuilder **methodBuilders;
+   void **entryPoints;
+   int32_t *returnCodes;
+   uint32_t numMethodBuilders;
+   volatile uint32_t nextMethodBuilder;
+   };
+
+// Each compiling thread keeps claiming the next uncompiled MethodBuilder until none are left
+int J9THREAD_PROC
+compileMethodBuilderBatch(void *arg)
+   {
+   MethodBuilderBatch *batch = static_cast<MethodBuilderBatch *>(arg);
+   uint32_t m;
+   while ((m = VM_AtomicSupport::addU32(&batch->nextMethodBuilder, 1) - 1) < batch->numMethodBuilders)
+      batch->returnCodes[m] = internal_compileMethodBuilder(batch->methodBuilders[m], &batch->entryPoints[m]);
+   return 0;
+   }
+
+}
+
+// Compiles numMethodBuilders independent MethodBuilders using up to numThreads
+// threads, counting the calling thread.  The MethodBuilders may share a
+// TypeDictionary as long as every type they use is defined beforehand, but must
+// not share MethodBuilders (e.g. through Call()) with each other.  Returns 0 if
+// every compilation succeeded, otherwise the return code of the first failing
+// MethodBuilder in the list.
+int32_t
+internal_compileMethodBuilders(int32_t numMethodBuilders, TR::MethodBuilder **methodBuilders, void **entryPoints,
+                               int32_t numThreads)
+   {
+   if (numMethodBuilders <= 0)
+      return 0;
+
+   std::vector<int32_t> returnCodes(numMethodBuilders, 0);
+   MethodBuilderBatch batch;
+   batch.methodBuilders = methodBuilders;
+   batch.entryPoints = entryPoints;
+   batch.returnCodes = &returnCodes[0];
+   batch.numMethodBuilders = numMethodBuilders;
+   batch.nextMethodBuilder = 0;
+
+   if (numThreads > numMethodBuilders)
+      numThreads = numMethodBuilders;
+
+   omrthread_t self = NULL;
+   bool attached = numThreads > 1
+      && 0 == omrthread_init_library()
+      && J9THREAD_SUCCESS == omrthread_attach_ex(&self, J9THREAD_ATTR_DEFAULT);
+
+   std::vector<omrthread_t> threads;
+   if (attached)
+      {
+      // the calling thread is one of the compiling threads
+      for (int32_t t = 1; t < numThreads; t++)
+         {
+         omrthread_t thread = NULL;
+         omrthread_attr_t attr = NULL;
+         if (J9THREAD_SUCCESS != omrthread_attr_init(&attr))
+            break;
+         omrthread_attr_set_detachstate(&attr, J9THREAD_CREATE_JOINABLE);
+         omrthread_attr_set_stacksize(&attr, COMPILATION_THREAD_STACK_SIZE);
+         intptr_t created = omrthread_create_ex(&thread, &attr, 0, compileMethodBuilderBatch, &batch);
+         omrthread_attr_destroy(&attr);
+         if (J9THREAD_SUCCESS != created)
+            break; // whatever is left gets compiled by the threads already running
+         threads.push_back(thread);
+         }
+      }
+
+   compileMethodBuilderBatch(&batch);
+
+   for (size_t t = 0; t < threads.size(); t++)
+      omrthread_join(threads[t]);
+   if (attached)
+      omrthread_detach(self);
+
+   for (int32_t m = 0; m < numMethodBuilders; m++)
+      {
+      if (returnCodes[m] != 0)
+         return returnCodes[m];
+      }
+   return 0;
+   }
+
 void
 internal_shutdownJit()
    {
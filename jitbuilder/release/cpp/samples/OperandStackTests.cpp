@@ -21,6 +21,7 @@
  *******************************************************************************/
 
 
+#include <chrono>
 #include <iostream>
 #include <stdlib.h>
 #include <stdint.h>
@@ -95,6 +96,20 @@ static STACKVALUETYPE expectedResult12Top = -1;
 static char * result12Operator;
 static Thread thread;
 static bool useThreadSP = false;
+static int32_t benchmarkRewrites = 0;
+
+static void Fail()
+   {
+   numFailingTests++;
+   }
+
+static void Pass()
+   {
+   numPassingTests++;
+   }
+
+#define REPORT1(c,n,v)         { if (c) { Pass(); if (verbose) cout << "Pass\n"; } else { Fail(); if (verbose) cout << "Fail: " << (n) << " is " << (v) << "\n"; } }
+#define REPORT2(c,n1,v1,n2,v2) { if (c) { Pass(); if (verbose) cout << "Pass\n"; } else { Fail(); if (verbose) cout << "Fail: " << (n1) << " is " << (v1) << ", " << (n2) << " is " << (v2) << "\n"; } }
 
 static void
 setupResult12Equals()
@@ -162,7 +177,62 @@ main(int argc, char *argv[])
    setupResult12NotEquals();
    threadTest(&thread);
 
-   cout << "Step 6: shutdown JIT\n";
+   cout << "Step 6: compile and invoke operand stack tests with dirty slot tracking\n";
+   OMR::JitBuilder::TypeDictionary types6a;
+   OperandStackTestMethod trackingPointerMethod(&types6a, true);
+   void *entry6a = 0;
+   int32_t rc6a = compileMethodBuilder(&trackingPointerMethod, &entry6a);
+   OMR::JitBuilder::TypeDictionary types6b;
+   OperandStackTestUsingStructMethod trackingThreadMethod(&types6b, true);
+   void *entry6b = 0;
+   int32_t rc6b = compileMethodBuilder(&trackingThreadMethod, &entry6b);
+   if (rc6a != 0 || rc6b != 0)
+      {
+      cerr << "FAIL: compilation error " << rc6a << ", " << rc6b << "\n";
+      exit(-2);
+      }
+
+   useThreadSP = false;
+   verifySP = trackingPointerMethod.getSPPtr();
+   setupResult12Equals();
+   ((OperandStackTestMethodFunction *) entry6a)();
+
+   useThreadSP = true;
+   verifySP = &thread.sp;
+   setupResult12NotEquals();
+   ((OperandStackTestUsingStructMethodFunction *) entry6b)(&thread);
+   useThreadSP = false;
+
+   cout << "Step 7: compare Commit stores and cost with and without dirty slot tracking\n";
+   typedef void (OperandStackCommitBenchmarkFunction)(int32_t iterations);
+   const int32_t benchmarkIterations = 10000000;
+   for (int32_t tracking = 0; tracking <= 1; tracking++)
+      {
+      benchmarkRewrites = 0;
+      OMR::JitBuilder::TypeDictionary types7;
+      OperandStackCommitBenchmarkMethod benchmarkMethod(&types7, tracking != 0);
+      void *entry7 = 0;
+      int32_t rc7 = compileMethodBuilder(&benchmarkMethod, &entry7);
+      if (rc7 != 0)
+         {
+         cerr << "FAIL: compilation error " << rc7 << "\n";
+         exit(-2);
+         }
+
+      verifySP = benchmarkMethod.getSPPtr();
+      std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+      ((OperandStackCommitBenchmarkFunction *) entry7)(benchmarkIterations);
+      std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+      cout << "\t" << benchmarkIterations << " iterations " << (tracking ? "with" : "without") << " dirty slot tracking: "
+           << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms\n";
+
+      // without tracking every Commit in the loop stores the unchanged bottom slot again
+      int32_t expectedRewrites = tracking ? 0 : benchmarkIterations - 1;
+      if (verbose) cout << "\tCommit benchmark: bottom slot stored " << expectedRewrites << " times in the loop: ";
+      REPORT2(benchmarkRewrites == expectedRewrites, "benchmarkRewrites", benchmarkRewrites, "expectedRewrites", expectedRewrites);
+      }
+
+   cout << "Step 8: shutdown JIT\n";
    shutdownJit();
 
    cout << "Number passing tests: " << numPassingTests << "\n";
@@ -172,6 +242,8 @@ main(int argc, char *argv[])
       cout << "ALL PASS\n";
    else
       cout << "SOME FAILURES\n";
+
+   return numFailingTests == 0 ? 0 : 1;
    }
 
 
@@ -219,19 +291,6 @@ OperandStackTestMethod::freeStack()
    thread.sp = NULL;
    }
 
-static void Fail()
-   {
-   numFailingTests++;
-   }
-
-static void Pass()
-   {
-   numPassingTests++;
-   }
-
-#define REPORT1(c,n,v)         { if (c) { Pass(); if (verbose) cout << "Pass\n"; } else { Fail(); if (verbose) cout << "Fail: " << (n) << " is " << (v) << "\n"; } }
-#define REPORT2(c,n1,v1,n2,v2) { if (c) { Pass(); if (verbose) cout << "Pass\n"; } else { Fail(); if (verbose) cout << "Fail: " << (n1) << " is " << (v1) << ", " << (n2) << " is " << (v2) << "\n"; } }
-
 // Result 0: empty stack even though Push has happened
 void
 verifyResult0()
@@ -350,6 +409,30 @@ verifyResult12(STACKVALUETYPE top)
    OperandStackTestMethod::verifyStack("11", 3, 3, 5, 4, expectedResult12Top);
    }
 
+#define BENCHMARK_STACK_DEPTH 8
+#define BENCHMARK_MARKER      -1
+
+// Called on every iteration of the Commit benchmark loop, right after the Commit.
+// The bottom slot never changes inside the loop, so it is overwritten with a marker
+// here to find out whether the next Commit stores it again. The slot is restored on
+// the last iteration so that the stack can be verified once the loop is done.
+static void
+benchmarkCall(STACKVALUETYPE count, STACKVALUETYPE iterations)
+   {
+   STACKVALUETYPE *bottom = OperandStackTestMethod::getRealStack();
+   if (count > 1 && *bottom != BENCHMARK_MARKER)
+      benchmarkRewrites++;
+   *bottom = (count < iterations) ? BENCHMARK_MARKER : 1;
+   }
+
+void
+verifyBenchmarkStack(STACKVALUETYPE iterations)
+   {
+   if (verbose) cout << "Commit benchmark: stack holds 1.." << BENCHMARK_STACK_DEPTH << " and the iteration count\n";
+   OperandStackTestMethod::verifyStack("benchmark", BENCHMARK_STACK_DEPTH, BENCHMARK_STACK_DEPTH + 1,
+      1, 2, 3, 4, 5, 6, 7, 8, iterations);
+   }
+
 // used to compare expected values and report fail it not equal
 void
 verifyValuesEqual(STACKVALUETYPE v1, STACKVALUETYPE v2)
@@ -407,8 +490,9 @@ OperandStackTestMethod::verifyStack(const char *step, int32_t max, int32_t num,
    }
 
 
-OperandStackTestMethod::OperandStackTestMethod(OMR::JitBuilder::TypeDictionary *d)
-   : OMR::JitBuilder::MethodBuilder(d)
+OperandStackTestMethod::OperandStackTestMethod(OMR::JitBuilder::TypeDictionary *d, bool trackDirtySlots)
+   : OMR::JitBuilder::MethodBuilder(d),
+   _trackDirtySlots(trackDirtySlots)
    {
    DefineLine(LINETOSTR(__LINE__));
    DefineFile(__FILE__);
@@ -438,6 +522,8 @@ OperandStackTestMethod::OperandStackTestMethod(OMR::JitBuilder::TypeDictionary *
    DefineFunction("verifyResult12", "0", "0", (void *)&verifyResult12, NoType, 1, _valueType);
    DefineFunction("verifyValuesEqual", "0", "0", (void *)&verifyValuesEqual, NoType, 2, _valueType, _valueType);
    DefineFunction("modifyTop3Elements", "0", "0", (void *)&modifyTop3Elements, NoType, 1, _valueType);
+   DefineFunction("benchmarkCall", "0", "0", (void *)&benchmarkCall, NoType, 2, _valueType, _valueType);
+   DefineFunction("verifyBenchmarkStack", "0", "0", (void *)&verifyBenchmarkStack, NoType, 1, _valueType);
    }
 
 // convenience macros
@@ -564,6 +650,7 @@ OperandStackTestMethod::buildIL()
    OMR::JitBuilder::IlValue *realStackTopAddress = ConstAddress(&_realStackTop);
    OMR::JitBuilder::VirtualMachineRegister *stackTop = new OMR::JitBuilder::VirtualMachineRegister(this, "SP", pElementType, sizeof(STACKVALUETYPE), realStackTopAddress);
    OMR::JitBuilder::VirtualMachineOperandStack *stack = new OMR::JitBuilder::VirtualMachineOperandStack(this, 1, _valueType, stackTop);
+   stack->SetDirtySlotTracking(_trackDirtySlots);
 
    TestState *vmState = new TestState(stack, stackTop);
    setVMState(vmState);
@@ -581,8 +668,8 @@ OperandStackTestMethod::buildIL()
 
 
 
-OperandStackTestUsingStructMethod::OperandStackTestUsingStructMethod(OMR::JitBuilder::TypeDictionary *d)
-   : OperandStackTestMethod(d)
+OperandStackTestUsingStructMethod::OperandStackTestUsingStructMethod(OMR::JitBuilder::TypeDictionary *d, bool trackDirtySlots)
+   : OperandStackTestMethod(d, trackDirtySlots)
    {
    d->DefineStruct("Thread");
    d->DefineField("Thread", "sp", d->PointerTo(STACKVALUEILTYPE), offsetof(Thread, sp));
@@ -598,6 +685,7 @@ OperandStackTestUsingStructMethod::buildIL()
 
    OMR::JitBuilder::VirtualMachineRegisterInStruct *stackTop = new OMR::JitBuilder::VirtualMachineRegisterInStruct(this, "Thread", "thread", "sp", "SP");
    OMR::JitBuilder::VirtualMachineOperandStack *stack = new OMR::JitBuilder::VirtualMachineOperandStack(this, 1, _valueType, stackTop);
+   stack->SetDirtySlotTracking(_trackDirtySlots);
 
    TestState *vmState = new TestState(stack, stackTop);
    setVMState(vmState);
@@ -611,3 +699,57 @@ OperandStackTestUsingStructMethod::buildIL()
 
    return true;
    }
+
+
+
+
+OperandStackCommitBenchmarkMethod::OperandStackCommitBenchmarkMethod(OMR::JitBuilder::TypeDictionary *d, bool trackDirtySlots)
+   : OperandStackTestMethod(d, trackDirtySlots)
+   {
+   DefineName("commitBenchmark");
+   DefineParameter("iterations", _valueType);
+   }
+
+// Keeps BENCHMARK_STACK_DEPTH values on the stack below a loop counter and commits
+// the stack before a call on every iteration, as an interpreter JIT would before
+// calling a helper. Only the counter changes inside the loop.
+bool
+OperandStackCommitBenchmarkMethod::buildIL()
+   {
+   OMR::JitBuilder::TypeDictionary *dict = typeDictionary();
+   OMR::JitBuilder::IlType *pElementType = dict->PointerTo(dict->PointerTo(STACKVALUEILTYPE));
+
+   Call("createStack", 0);
+
+   OMR::JitBuilder::IlValue *realStackTopAddress = ConstAddress(&_realStackTop);
+   OMR::JitBuilder::VirtualMachineRegister *stackTop = new OMR::JitBuilder::VirtualMachineRegister(this, "SP", pElementType, sizeof(STACKVALUETYPE), realStackTopAddress);
+   OMR::JitBuilder::VirtualMachineOperandStack *stack = new OMR::JitBuilder::VirtualMachineOperandStack(this, BENCHMARK_STACK_DEPTH + 1, _valueType, stackTop);
+   stack->SetDirtySlotTracking(_trackDirtySlots);
+
+   TestState *vmState = new TestState(stack, stackTop);
+   setVMState(vmState);
+
+   OMR::JitBuilder::BytecodeBuilder *entry = OrphanBytecodeBuilder(0, (char *) "entry");
+   OMR::JitBuilder::BytecodeBuilder *loop = OrphanBytecodeBuilder(1, (char *) "loop");
+   OMR::JitBuilder::BytecodeBuilder *done = OrphanBytecodeBuilder(2, (char *) "done");
+   AppendBytecodeBuilder(entry);
+
+   for (int32_t i = 1; i <= BENCHMARK_STACK_DEPTH; i++)
+      PUSH(entry, entry->ConstInteger(_valueType, i));
+   PUSH(entry, entry->ConstInteger(_valueType, 0));
+   COMMIT(entry);
+   entry->AddFallThroughBuilder(loop);
+
+   OMR::JitBuilder::IlValue *count = loop->Add(POP(loop), loop->ConstInteger(_valueType, 1));
+   PUSH(loop, count);
+   COMMIT(loop);
+   loop->Call("benchmarkCall", 2, count, loop->Load("iterations"));
+   loop->IfCmpLessThan(loop, count, loop->Load("iterations"));
+   loop->AddFallThroughBuilder(done);
+
+   done->Call("verifyBenchmarkStack", 1, done->Load("iterations"));
+   done->Call("freeStack", 0);
+   done->Return();
+
+   return true;
+   }
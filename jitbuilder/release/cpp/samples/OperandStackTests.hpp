@@ -35,18 +35,20 @@
 class OperandStackTestMethod : public OMR::JitBuilder::MethodBuilder
    {
    public:
-   OperandStackTestMethod(OMR::JitBuilder::TypeDictionary *);
+   OperandStackTestMethod(OMR::JitBuilder::TypeDictionary *, bool trackDirtySlots = false);
    virtual bool buildIL();
 
    static void verifyStack(const char *step, int32_t max, int32_t num, ...);
    static bool verifyUntouched(int32_t maxTouched);
 
    STACKVALUETYPE **getSPPtr() { return &_realStackTop; }
+   static STACKVALUETYPE *getRealStack() { return _realStack; }
 
    protected:
    bool testStack(OMR::JitBuilder::BytecodeBuilder *b, bool useEqual);
 
    OMR::JitBuilder::IlType         * _valueType;
+   bool                              _trackDirtySlots;
 
    static STACKVALUETYPE           * _realStack;
    static STACKVALUETYPE           * _realStackTop;
@@ -60,7 +62,14 @@ class OperandStackTestMethod : public OMR::JitBuilder::MethodBuilder
 class OperandStackTestUsingStructMethod : public OperandStackTestMethod
    {
    public:
-   OperandStackTestUsingStructMethod(OMR::JitBuilder::TypeDictionary *);
+   OperandStackTestUsingStructMethod(OMR::JitBuilder::TypeDictionary *, bool trackDirtySlots = false);
+   virtual bool buildIL();
+   };
+
+class OperandStackCommitBenchmarkMethod : public OperandStackTestMethod
+   {
+   public:
+   OperandStackCommitBenchmarkMethod(OMR::JitBuilder::TypeDictionary *, bool trackDirtySlots);
    virtual bool buildIL();
    };
 
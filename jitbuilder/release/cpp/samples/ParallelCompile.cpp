@@ -0,0 +1,170 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include <chrono>
+#include <iostream>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#include "ParallelCompile.hpp"
+
+static const int32_t NUM_METHODS = 64;
+static const int32_t LOOP_COUNT = 100;
+static const int32_t threadCounts[] = { 1, 2, 4 };
+
+AccumulateMethod::AccumulateMethod(OMR::JitBuilder::TypeDictionary *types, int32_t multiplier)
+   : OMR::JitBuilder::MethodBuilder(types),
+   _multiplier(multiplier)
+   {
+   DefineLine(LINETOSTR(__LINE__));
+   DefineFile(__FILE__);
+
+   snprintf(_name, sizeof(_name), "accumulate%d", multiplier);
+   DefineName(_name);
+   DefineParameter("acc", types->PointerTo("Accumulator"));
+   DefineParameter("bits", types->PointerTo(types->LookupUnion("Bits")));
+   DefineParameter("n", Int32);
+   DefineParameter("value", Double);
+   DefineReturnType(Int64);
+   }
+
+bool
+AccumulateMethod::buildIL()
+   {
+   StoreIndirect("Bits", "asDouble",
+      Load("bits"),
+      Load("value"));
+
+   OMR::JitBuilder::IlBuilder *loop = NULL;
+   ForLoopUp("i", &loop,
+             ConstInt32(0),
+             Load("n"),
+             ConstInt32(1));
+
+   loop->StoreIndirect("Accumulator", "sum",
+   loop->   Load("acc"),
+   loop->   Add(
+   loop->      LoadIndirect("Accumulator", "sum",
+   loop->         Load("acc")),
+   loop->      Mul(
+   loop->         ConvertTo(Int64,
+   loop->            Load("i")),
+   loop->         ConstInt64(_multiplier))));
+
+   loop->StoreIndirect("Accumulator", "count",
+   loop->   Load("acc"),
+   loop->   Add(
+   loop->      LoadIndirect("Accumulator", "count",
+   loop->         Load("acc")),
+   loop->      ConstInt32(1)));
+
+   Return(
+      LoadIndirect("Accumulator", "sum",
+         Load("acc")));
+
+   return true;
+   }
+
+// Compiles NUM_METHODS methods sharing one TypeDictionary on numThreads threads,
+// checks every one of them and returns the time taken to compile them
+static int64_t
+compileAndCheck(OMR::JitBuilder::TypeDictionary *types, int32_t numThreads)
+   {
+   std::vector<AccumulateMethod *> methods;
+   std::vector<OMR::JitBuilder::MethodBuilder *> builders;
+   for (int32_t m = 0; m < NUM_METHODS; m++)
+      {
+      methods.push_back(new AccumulateMethod(types, m + 1));
+      builders.push_back(methods.back());
+      }
+   std::vector<void *> entryPoints(NUM_METHODS, (void *)NULL);
+
+   std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+   int32_t rc = compileMethodBuilders(NUM_METHODS, &builders[0], &entryPoints[0], numThreads);
+   std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+   if (rc != 0)
+      {
+      fprintf(stderr, "FAIL: compilation error %d with %d threads\n", rc, numThreads);
+      exit(-2);
+      }
+
+   const int64_t sumOfIndices = (int64_t)LOOP_COUNT * (LOOP_COUNT - 1) / 2;
+   for (int32_t m = 0; m < NUM_METHODS; m++)
+      {
+      AccumulateFunctionType *accumulate = (AccumulateFunctionType *)entryPoints[m];
+      Accumulator acc = { 0, 0 };
+      Bits bits;
+      bits.asInt64 = 0;
+      double value = 1.5 * (m + 1);
+
+      int64_t expectedBits;
+      memcpy(&expectedBits, &value, sizeof(expectedBits));
+
+      int64_t sum = accumulate(&acc, &bits, LOOP_COUNT, value);
+      if (sum != sumOfIndices * (m + 1) || acc.sum != sum || acc.count != LOOP_COUNT || bits.asInt64 != expectedBits)
+         {
+         fprintf(stderr, "FAIL: %s compiled with %d threads returned %lld (sum %lld, count %d), expected %lld\n",
+                 methods[m]->GetMethodName(), numThreads, (long long)sum, (long long)acc.sum, acc.count,
+                 (long long)(sumOfIndices * (m + 1)));
+         exit(-3);
+         }
+      }
+
+   for (int32_t m = 0; m < NUM_METHODS; m++)
+      delete methods[m];
+
+   return std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+   }
+
+int
+main(int argc, char *argv[])
+   {
+   std::cout << "Step 1: initialize JIT\n";
+   bool initialized = initializeJit();
+   if (!initialized)
+      {
+      fprintf(stderr, "FAIL: could not initialize JIT\n");
+      exit(-1);
+      }
+
+   std::cout << "Step 2: define type dictionary\n";
+   ParallelCompileTypeDictionary types;
+
+   std::cout << "Step 3: compile " << NUM_METHODS << " methods with 1, 2 and 4 compilation threads\n";
+   int64_t singleThreadTime = 0;
+   for (size_t t = 0; t < sizeof(threadCounts) / sizeof(threadCounts[0]); t++)
+      {
+      int32_t numThreads = threadCounts[t];
+      int64_t elapsed = compileAndCheck(&types, numThreads);
+      if (numThreads == 1)
+         singleThreadTime = elapsed;
+      printf("   %d thread(s): %lld us, speedup %.2f\n", numThreads, (long long)elapsed,
+             elapsed > 0 ? (double)singleThreadTime / elapsed : 0.0);
+      }
+
+   std::cout << "Step 4: shutdown JIT\n";
+   shutdownJit();
+
+   std::cout << "PASS\n";
+   }
@@ -0,0 +1,77 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#ifndef PARALLELCOMPILE_INCL
+#define PARALLELCOMPILE_INCL
+
+#include <stddef.h>
+#include "JitBuilder.hpp"
+
+struct Accumulator
+   {
+   int64_t sum;
+   int32_t count;
+   };
+
+union Bits
+   {
+   int64_t asInt64;
+   double asDouble;
+   };
+
+typedef int64_t (AccumulateFunctionType)(Accumulator *, Bits *, int32_t, double);
+
+class ParallelCompileTypeDictionary : public OMR::JitBuilder::TypeDictionary
+   {
+   public:
+   ParallelCompileTypeDictionary() :
+      OMR::JitBuilder::TypeDictionary()
+      {
+      DefineStruct("Accumulator");
+      DefineField("Accumulator", "sum", Int64, offsetof(Accumulator, sum));
+      DefineField("Accumulator", "count", Int32, offsetof(Accumulator, count));
+      CloseStruct("Accumulator", sizeof(Accumulator));
+
+      DefineUnion("Bits");
+      UnionField("Bits", "asInt64", Int64);
+      UnionField("Bits", "asDouble", Double);
+      CloseUnion("Bits");
+      }
+   };
+
+/**
+ * Adds multiplier * i to acc->sum for every i in [0, n), counting the
+ * iterations in acc->count, and stores value into bits->asDouble.  Each
+ * instance gets its own name and multiplier so every compilation is distinct.
+ */
+class AccumulateMethod : public OMR::JitBuilder::MethodBuilder
+   {
+   public:
+   AccumulateMethod(OMR::JitBuilder::TypeDictionary *, int32_t multiplier);
+   virtual bool buildIL();
+
+   protected:
+   int32_t _multiplier;
+   char _name[32];
+   };
+
+#endif // !defined(PARALLELCOMPILE_INCL)
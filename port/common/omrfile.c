@@ -817,3 +817,111 @@ omrfile_convert_omrfile_fd_to_native_fd(struct OMRPortLibrary *portLibrary, intp
 {
 	return omrfileFD;
 }
+
+/**
+ * Read bytes from a given offset of a file without using or moving the file position,
+ * so that several threads may read the same file descriptor concurrently.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] fd The file descriptor.
+ * @param[in,out] buf Buffer to read into.
+ * @param[in] nbytes Size of buffer.
+ * @param[in] offset Offset in the file of the first byte to read.
+ *
+ * @return The number of bytes read, or -1 on failure or at end of file.
+ */
+intptr_t
+omrfile_pread(struct OMRPortLibrary *portLibrary, intptr_t fd, void *buf, intptr_t nbytes, int64_t offset)
+{
+	return -1;
+}
+
+/**
+ * Write bytes at a given offset of a file without using or moving the file position,
+ * so that several threads may write the same file descriptor concurrently.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] fd The file descriptor.
+ * @param[in] buf Buffer to be written.
+ * @param[in] nbytes Size of buffer.
+ * @param[in] offset Offset in the file of the first byte to write.
+ *
+ * @return Number of bytes written on success, portable error return code (which is negative) on failure.
+ */
+intptr_t
+omrfile_pwrite(struct OMRPortLibrary *portLibrary, intptr_t fd, const void *buf, intptr_t nbytes, int64_t offset)
+{
+	return OMRPORT_ERROR_FILE_OPFAILED;
+}
+
+/**
+ * Read from a file into several buffers with a single call, filling each buffer before the next.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] fd The file descriptor.
+ * @param[in] iov The buffers to read into.
+ * @param[in] iovcnt The number of buffers.
+ * @param[in] offset Offset in the file of the first byte to read, or OMRPORT_FILE_CURRENT_POSITION
+ * to read from and advance the file position.
+ *
+ * @return The total number of bytes read, or -1 on failure or at end of file.
+ */
+intptr_t
+omrfile_readv(struct OMRPortLibrary *portLibrary, intptr_t fd, const struct OMRFileIOVec *iov, int32_t iovcnt, int64_t offset)
+{
+	return -1;
+}
+
+/**
+ * Write several buffers to a file with a single call, so that the data of one call is
+ * not interleaved with that of other threads writing the same file.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] fd The file descriptor.
+ * @param[in] iov The buffers to write.
+ * @param[in] iovcnt The number of buffers.
+ * @param[in] offset Offset in the file of the first byte to write, or OMRPORT_FILE_CURRENT_POSITION
+ * to write at and advance the file position.
+ *
+ * @return The total number of bytes written on success, portable error return code (which is negative) on failure.
+ */
+intptr_t
+omrfile_writev(struct OMRPortLibrary *portLibrary, intptr_t fd, const struct OMRFileIOVec *iov, int32_t iovcnt, int64_t offset)
+{
+	return OMRPORT_ERROR_FILE_OPFAILED;
+}
+
+/**
+ * Reserve disk space for a range of a file, extending the file if the range ends beyond it,
+ * so that later writes to the range do not fail for lack of space or fragment the file.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] fd The file descriptor.
+ * @param[in] offset Start of the range.
+ * @param[in] length Length of the range.
+ *
+ * @return 0 on success, negative portable error code on failure.
+ */
+int32_t
+omrfile_preallocate(struct OMRPortLibrary *portLibrary, intptr_t fd, int64_t offset, int64_t length)
+{
+	return OMRPORT_ERROR_FILE_OPFAILED;
+}
+
+/**
+ * Tell the operating system how a range of a file will be accessed, so that it can adjust
+ * read ahead and caching. The hint has no effect on the results of other operations.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] fd The file descriptor.
+ * @param[in] offset Start of the range.
+ * @param[in] length Length of the range, 0 for up to the end of the file.
+ * @param[in] advice One of the OMRPORT_FILE_ADVICE_* constants.
+ *
+ * @return 0 on success or where hints are not supported, negative portable error code on failure.
+ */
+int32_t
+omrfile_advise(struct OMRPortLibrary *portLibrary, intptr_t fd, int64_t offset, int64_t length, int32_t advice)
+{
+	return 0;
+}
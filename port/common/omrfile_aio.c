@@ -0,0 +1,774 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup Port
+ * @brief Asynchronous file I/O
+ *
+ * Requests are queued with omrfile_aio_submit and handed back, with their
+ * callbacks run on the calling thread, by omrfile_aio_complete. On Linux the
+ * requests go to an io_uring instance owned by the context. Where io_uring is
+ * not available, or was not asked for, a small set of worker threads performs
+ * the requests with omrfile_pread, omrfile_pwrite and omrfile_sync.
+ */
+
+#include <string.h>
+#include "omrport.h"
+#include "omrportpriv.h"
+#include "omrthread.h"
+#include "omrutil.h"
+#include "ut_omrport.h"
+
+#if defined(LINUX) && !defined(OMRZTPF) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <errno.h>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <linux/io_uring.h>
+#if defined(__NR_io_uring_setup) && defined(IORING_FEAT_RW_CUR_POS)
+#define OMRFILE_AIO_IO_URING
+#endif /* defined(__NR_io_uring_setup) && defined(IORING_FEAT_RW_CUR_POS) */
+#endif /* __has_include(<linux/io_uring.h>) */
+#endif /* defined(LINUX) && !defined(OMRZTPF) && defined(__has_include) */
+
+#define OMRFILE_AIO_WORKER_THREADS 4
+#define OMRFILE_AIO_WORKER_STACK_SIZE (64 * 1024)
+/* Largest transfer a single io_uring read or write may request */
+#define OMRFILE_AIO_MAX_TRANSFER ((uintptr_t)0x7ffff000)
+
+typedef struct OMRFileAIOContext {
+	struct OMRPortLibrary *portLibrary;
+	uint32_t queueDepth;
+	/* Requests submitted but not yet returned by omrfile_aio_complete */
+	uintptr_t inFlight;
+	BOOLEAN useThreads;
+	/* Worker thread state, protected by monitor */
+	omrthread_monitor_t monitor;
+	OMRFileAIORequest *pendingHead;
+	OMRFileAIORequest *pendingTail;
+	OMRFileAIORequest *doneHead;
+	OMRFileAIORequest *doneTail;
+	uintptr_t liveWorkers;
+	BOOLEAN shutdown;
+#if defined(OMRFILE_AIO_IO_URING)
+	int ringFd;
+	uint32_t sqEntries;
+	/* Entries written to the submission ring that the kernel has not consumed */
+	uint32_t unsubmitted;
+	void *sqRing;
+	size_t sqRingSize;
+	void *cqRing;
+	size_t cqRingSize;
+	struct io_uring_sqe *sqes;
+	size_t sqesSize;
+	uint32_t *sqHead;
+	uint32_t *sqTail;
+	uint32_t *sqMask;
+	uint32_t *sqArray;
+	uint32_t *cqHead;
+	uint32_t *cqTail;
+	uint32_t *cqMask;
+	struct io_uring_cqe *cqes;
+#endif /* defined(OMRFILE_AIO_IO_URING) */
+} OMRFileAIOContext;
+
+static void
+appendRequest(OMRFileAIORequest **head, OMRFileAIORequest **tail, OMRFileAIORequest *request)
+{
+	request->next = NULL;
+	if (NULL == *tail) {
+		*head = request;
+	} else {
+		(*tail)->next = request;
+	}
+	*tail = request;
+}
+
+/**
+ * Run the callbacks of a list of completed requests, in list order.
+ */
+static void
+runCallbacks(struct OMRPortLibrary *portLibrary, OMRFileAIORequest *request)
+{
+	while (NULL != request) {
+		/* The callback may reuse the request */
+		OMRFileAIORequest *next = request->next;
+		request->next = NULL;
+		if (NULL != request->callback) {
+			request->callback(portLibrary, request);
+		}
+		request = next;
+	}
+}
+
+static BOOLEAN
+isValidRequest(OMRFileAIORequest *request)
+{
+	if (NULL == request) {
+		return FALSE;
+	}
+	switch (request->opcode) {
+	case OMRPORT_FILE_AIO_READ:
+	case OMRPORT_FILE_AIO_WRITE:
+		return (NULL != request->buffer) && (0 <= request->offset);
+	case OMRPORT_FILE_AIO_SYNC:
+		return TRUE;
+	default:
+		return FALSE;
+	}
+}
+
+/**
+ * The portable error code of the last failed file operation on this thread.
+ */
+static intptr_t
+lastFileError(struct OMRPortLibrary *portLibrary)
+{
+	int32_t error = portLibrary->error_last_error_number(portLibrary);
+	return (error < 0) ? error : OMRPORT_ERROR_FILE_OPFAILED;
+}
+
+/**
+ * Perform a request synchronously on a worker thread.
+ *
+ * The result is reported as io_uring reports it: omrfile_pread returns -1 both at
+ * end of file and on error, so end of file is turned into a 0 byte read and other
+ * failures into the portable error code.
+ */
+static void
+performRequest(struct OMRPortLibrary *portLibrary, OMRFileAIORequest *request)
+{
+	intptr_t result = 0;
+
+	switch (request->opcode) {
+	case OMRPORT_FILE_AIO_READ:
+		result = portLibrary->file_pread(portLibrary, request->fd, request->buffer, (intptr_t)request->length, request->offset);
+		if (0 > result) {
+			result = lastFileError(portLibrary);
+			if ((OMRPORT_ERROR_FILE_EOF == result) || (OMRPORT_ERROR_FILE_READ_NO_BYTES_READ == result)) {
+				result = 0;
+			}
+		}
+		break;
+	case OMRPORT_FILE_AIO_WRITE:
+		result = portLibrary->file_pwrite(portLibrary, request->fd, request->buffer, (intptr_t)request->length, request->offset);
+		if (0 > result) {
+			result = lastFileError(portLibrary);
+		}
+		break;
+	default:
+		if (0 != portLibrary->file_sync(portLibrary, request->fd)) {
+			result = lastFileError(portLibrary);
+		}
+		break;
+	}
+	request->result = result;
+}
+
+static int J9THREAD_PROC
+aioWorkerMain(void *arg)
+{
+	OMRFileAIOContext *context = (OMRFileAIOContext *)arg;
+
+	omrthread_monitor_enter(context->monitor);
+	for (;;) {
+		OMRFileAIORequest *request = context->pendingHead;
+		if (NULL == request) {
+			if (context->shutdown) {
+				break;
+			}
+			omrthread_monitor_wait(context->monitor);
+			continue;
+		}
+		context->pendingHead = request->next;
+		if (NULL == context->pendingHead) {
+			context->pendingTail = NULL;
+		}
+		omrthread_monitor_exit(context->monitor);
+
+		performRequest(context->portLibrary, request);
+
+		omrthread_monitor_enter(context->monitor);
+		appendRequest(&context->doneHead, &context->doneTail, request);
+		omrthread_monitor_notify_all(context->monitor);
+	}
+	context->liveWorkers -= 1;
+	omrthread_monitor_notify_all(context->monitor);
+	omrthread_exit(context->monitor);
+
+	/* unreachable */
+	return 0;
+}
+
+static void
+stopWorkers(OMRFileAIOContext *context)
+{
+	omrthread_monitor_enter(context->monitor);
+	context->shutdown = TRUE;
+	omrthread_monitor_notify_all(context->monitor);
+	while (0 != context->liveWorkers) {
+		omrthread_monitor_wait(context->monitor);
+	}
+	omrthread_monitor_exit(context->monitor);
+}
+
+static int32_t
+startWorkers(OMRFileAIOContext *context)
+{
+	uintptr_t workers = OMR_MIN(context->queueDepth, OMRFILE_AIO_WORKER_THREADS);
+	uintptr_t i = 0;
+
+	for (i = 0; i < workers; i++) {
+		omrthread_t thread = NULL;
+
+		omrthread_monitor_enter(context->monitor);
+		context->liveWorkers += 1;
+		omrthread_monitor_exit(context->monitor);
+		if (J9THREAD_SUCCESS != createThreadWithCategory(
+				&thread,
+				OMRFILE_AIO_WORKER_STACK_SIZE,
+				J9THREAD_PRIORITY_NORMAL,
+				0,
+				aioWorkerMain,
+				context,
+				J9THREAD_CATEGORY_SYSTEM_THREAD)
+		) {
+			omrthread_monitor_enter(context->monitor);
+			context->liveWorkers -= 1;
+			omrthread_monitor_exit(context->monitor);
+			stopWorkers(context);
+			return OMRPORT_ERROR_STARTUP_THREAD;
+		}
+	}
+	return 0;
+}
+
+static uintptr_t
+completeWithThreads(OMRFileAIOContext *context, uintptr_t minComplete, int64_t timeoutMillis, OMRFileAIORequest **completed)
+{
+	struct OMRPortLibrary *portLibrary = context->portLibrary;
+	int64_t deadline = 0;
+	uintptr_t count = 0;
+	OMRFileAIORequest *tail = NULL;
+
+	if (0 < timeoutMillis) {
+		deadline = portLibrary->time_nano_time(portLibrary) + (timeoutMillis * 1000000);
+	}
+
+	omrthread_monitor_enter(context->monitor);
+	for (;;) {
+		OMRFileAIORequest *request = context->doneHead;
+		while (NULL != request) {
+			OMRFileAIORequest *next = request->next;
+			appendRequest(completed, &tail, request);
+			count += 1;
+			request = next;
+		}
+		context->doneHead = NULL;
+		context->doneTail = NULL;
+
+		if ((count >= minComplete) || (0 == timeoutMillis)) {
+			break;
+		}
+		if (0 > timeoutMillis) {
+			omrthread_monitor_wait(context->monitor);
+		} else {
+			int64_t remaining = deadline - portLibrary->time_nano_time(portLibrary);
+			if (0 >= remaining) {
+				break;
+			}
+			omrthread_monitor_wait_timed(context->monitor, remaining / 1000000, (intptr_t)(remaining % 1000000));
+		}
+	}
+	omrthread_monitor_exit(context->monitor);
+
+	return count;
+}
+
+#if defined(OMRFILE_AIO_IO_URING)
+
+static int32_t
+aioErrorFromErrno(int err)
+{
+	switch (err) {
+	case EBADF:
+		return OMRPORT_ERROR_FILE_BADF;
+	case EINVAL:
+		return OMRPORT_ERROR_FILE_INVAL;
+	case EFAULT:
+		return OMRPORT_ERROR_FILE_EFAULT;
+	case EINTR:
+		return OMRPORT_ERROR_FILE_EINTR;
+	case EAGAIN:
+		return OMRPORT_ERROR_FILE_EAGAIN;
+	case EIO:
+		return OMRPORT_ERROR_FILE_IO;
+	case ENOSPC:
+		return OMRPORT_ERROR_FILE_DISKFULL;
+	case EDQUOT:
+		return OMRPORT_ERROR_FILE_NOT_ENOUGH_QUOTA;
+	case EISDIR:
+		return OMRPORT_ERROR_FILE_ISDIR;
+	case EOVERFLOW:
+		return OMRPORT_ERROR_FILE_OVERFLOW;
+	case ESPIPE:
+		return OMRPORT_ERROR_FILE_SPIPE;
+	case EROFS:
+		return OMRPORT_ERROR_FILE_ROFS;
+	case EFBIG:
+		return OMRPORT_ERROR_FILE_SYSTEMFULL;
+	case ECANCELED:
+		return OMRPORT_ERROR_FILE_OPERATION_ABORTED;
+	default:
+		return OMRPORT_ERROR_FILE_OPFAILED;
+	}
+}
+
+static int
+ringEnter(OMRFileAIOContext *context, uint32_t toSubmit, uint32_t minComplete, uint32_t flags)
+{
+	return (int)syscall(__NR_io_uring_enter, context->ringFd, toSubmit, minComplete, flags, NULL, 0);
+}
+
+static void
+ringDestroy(OMRFileAIOContext *context)
+{
+	if (NULL != context->sqes) {
+		munmap(context->sqes, context->sqesSize);
+	}
+	if ((NULL != context->cqRing) && (context->cqRing != context->sqRing)) {
+		munmap(context->cqRing, context->cqRingSize);
+	}
+	if (NULL != context->sqRing) {
+		munmap(context->sqRing, context->sqRingSize);
+	}
+	close(context->ringFd);
+}
+
+/**
+ * Set up an io_uring instance for the context.
+ *
+ * @return 0 on success, otherwise the errno of the failing call
+ */
+static int
+ringCreate(OMRFileAIOContext *context)
+{
+	struct io_uring_params params;
+	int err = 0;
+	char *sq = NULL;
+	char *cq = NULL;
+
+	memset(&params, 0, sizeof(params));
+	context->ringFd = (int)syscall(__NR_io_uring_setup, context->queueDepth, &params);
+	if (0 > context->ringFd) {
+		return errno;
+	}
+	/* IORING_OP_READ and IORING_OP_WRITE arrived with this feature */
+	if (0 == (params.features & IORING_FEAT_RW_CUR_POS)) {
+		close(context->ringFd);
+		return EOPNOTSUPP;
+	}
+
+	context->sqEntries = params.sq_entries;
+	context->sqRingSize = params.sq_off.array + (params.sq_entries * sizeof(uint32_t));
+	context->cqRingSize = params.cq_off.cqes + (params.cq_entries * sizeof(struct io_uring_cqe));
+	if (0 != (params.features & IORING_FEAT_SINGLE_MMAP)) {
+		context->sqRingSize = OMR_MAX(context->sqRingSize, context->cqRingSize);
+		context->cqRingSize = context->sqRingSize;
+	}
+
+	context->sqRing = mmap(NULL, context->sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, context->ringFd, IORING_OFF_SQ_RING);
+	if (MAP_FAILED == context->sqRing) {
+		err = errno;
+		context->sqRing = NULL;
+		goto fail;
+	}
+	if (0 != (params.features & IORING_FEAT_SINGLE_MMAP)) {
+		context->cqRing = context->sqRing;
+	} else {
+		context->cqRing = mmap(NULL, context->cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, context->ringFd, IORING_OFF_CQ_RING);
+		if (MAP_FAILED == context->cqRing) {
+			err = errno;
+			context->cqRing = NULL;
+			goto fail;
+		}
+	}
+	context->sqesSize = params.sq_entries * sizeof(struct io_uring_sqe);
+	context->sqes = (struct io_uring_sqe *)mmap(NULL, context->sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, context->ringFd, IORING_OFF_SQES);
+	if (MAP_FAILED == (void *)context->sqes) {
+		err = errno;
+		context->sqes = NULL;
+		goto fail;
+	}
+
+	sq = (char *)context->sqRing;
+	cq = (char *)context->cqRing;
+	context->sqHead = (uint32_t *)(sq + params.sq_off.head);
+	context->sqTail = (uint32_t *)(sq + params.sq_off.tail);
+	context->sqMask = (uint32_t *)(sq + params.sq_off.ring_mask);
+	context->sqArray = (uint32_t *)(sq + params.sq_off.array);
+	context->cqHead = (uint32_t *)(cq + params.cq_off.head);
+	context->cqTail = (uint32_t *)(cq + params.cq_off.tail);
+	context->cqMask = (uint32_t *)(cq + params.cq_off.ring_mask);
+	context->cqes = (struct io_uring_cqe *)(cq + params.cq_off.cqes);
+	return 0;
+
+fail:
+	ringDestroy(context);
+	return err;
+}
+
+static void
+ringQueue(OMRFileAIOContext *context, OMRFileAIORequest *request)
+{
+	uint32_t tail = *context->sqTail;
+	uint32_t index = tail & *context->sqMask;
+	struct io_uring_sqe *sqe = &context->sqes[index];
+
+	memset(sqe, 0, sizeof(*sqe));
+	sqe->fd = (int32_t)context->portLibrary->file_convert_omrfile_fd_to_native_fd(context->portLibrary, request->fd);
+	sqe->user_data = (uint64_t)(uintptr_t)request;
+	switch (request->opcode) {
+	case OMRPORT_FILE_AIO_READ:
+	case OMRPORT_FILE_AIO_WRITE:
+		sqe->opcode = (OMRPORT_FILE_AIO_READ == request->opcode) ? IORING_OP_READ : IORING_OP_WRITE;
+		sqe->addr = (uint64_t)(uintptr_t)request->buffer;
+		sqe->len = (uint32_t)OMR_MIN(request->length, OMRFILE_AIO_MAX_TRANSFER);
+		sqe->off = (uint64_t)request->offset;
+		break;
+	default:
+		sqe->opcode = IORING_OP_FSYNC;
+		break;
+	}
+	context->sqArray[index] = index;
+	/* Publish the entry before the new tail */
+	__atomic_store_n(context->sqTail, tail + 1, __ATOMIC_RELEASE);
+	context->unsubmitted += 1;
+}
+
+static void
+ringSubmit(OMRFileAIOContext *context)
+{
+	while (0 != context->unsubmitted) {
+		int rc = ringEnter(context, context->unsubmitted, 0, 0);
+		if (0 < rc) {
+			context->unsubmitted -= (uint32_t)rc;
+		} else if ((0 > rc) && (EINTR == errno)) {
+			continue;
+		} else {
+			/* Entries left in the ring are retried by the next submit or complete */
+			break;
+		}
+	}
+}
+
+static uintptr_t
+ringReap(OMRFileAIOContext *context, OMRFileAIORequest **completed, OMRFileAIORequest **tail)
+{
+	uint32_t head = *context->cqHead;
+	uint32_t cqTail = __atomic_load_n(context->cqTail, __ATOMIC_ACQUIRE);
+	uintptr_t count = 0;
+
+	while (head != cqTail) {
+		struct io_uring_cqe *cqe = &context->cqes[head & *context->cqMask];
+		OMRFileAIORequest *request = (OMRFileAIORequest *)(uintptr_t)cqe->user_data;
+
+		request->result = (0 <= cqe->res) ? (intptr_t)cqe->res : (intptr_t)aioErrorFromErrno(-cqe->res);
+		appendRequest(completed, tail, request);
+		head += 1;
+		count += 1;
+	}
+	__atomic_store_n(context->cqHead, head, __ATOMIC_RELEASE);
+
+	return count;
+}
+
+static uintptr_t
+completeWithRing(OMRFileAIOContext *context, uintptr_t minComplete, int64_t timeoutMillis, OMRFileAIORequest **completed)
+{
+	struct OMRPortLibrary *portLibrary = context->portLibrary;
+	int64_t deadline = 0;
+	uintptr_t count = 0;
+	OMRFileAIORequest *tail = NULL;
+
+	if (0 < timeoutMillis) {
+		deadline = portLibrary->time_nano_time(portLibrary) + (timeoutMillis * 1000000);
+	}
+
+	ringSubmit(context);
+	for (;;) {
+		count += ringReap(context, completed, &tail);
+		if ((count >= minComplete) || (0 == timeoutMillis)) {
+			break;
+		}
+		if (0 > timeoutMillis) {
+			int rc = ringEnter(context, context->unsubmitted, (uint32_t)(minComplete - count), IORING_ENTER_GETEVENTS);
+			if (0 <= rc) {
+				context->unsubmitted -= (uint32_t)rc;
+			} else if (EINTR != errno) {
+				break;
+			}
+		} else {
+			/* The ring descriptor polls readable while completions are waiting */
+			struct pollfd pfd;
+			int64_t remaining = deadline - portLibrary->time_nano_time(portLibrary);
+			if (0 >= remaining) {
+				break;
+			}
+			ringSubmit(context);
+			pfd.fd = context->ringFd;
+			pfd.events = POLLIN;
+			pfd.revents = 0;
+			poll(&pfd, 1, (int)OMR_MAX(1, remaining / 1000000));
+		}
+	}
+
+	return count;
+}
+
+#endif /* defined(OMRFILE_AIO_IO_URING) */
+
+/**
+ * Create a context for asynchronous file I/O.
+ *
+ * On Linux the context is backed by an io_uring instance when the kernel
+ * provides one, otherwise, and on other platforms, by a few worker threads
+ * that perform the requests with the synchronous file functions.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] queueDepth Maximum number of requests in flight at once, at most OMRPORT_FILE_AIO_MAX_QUEUE_DEPTH
+ * @param[in] flags OMRPORT_FILE_AIO_USE_THREADS to use worker threads even where io_uring is available
+ * @param[out] context The new context
+ *
+ * @return 0 on success, negative portable error code on failure.
+ */
+int32_t
+omrfile_aio_context_create(struct OMRPortLibrary *portLibrary, uint32_t queueDepth, uint32_t flags, struct OMRFileAIOContext **context)
+{
+	OMRFileAIOContext *newContext = NULL;
+	int32_t rc = 0;
+
+	Trc_PRT_file_aio_context_create_Entry(queueDepth, flags);
+
+	if ((NULL == context) || (0 == queueDepth) || (OMRPORT_FILE_AIO_MAX_QUEUE_DEPTH < queueDepth)) {
+		rc = OMRPORT_ERROR_FILE_INVAL;
+		goto done;
+	}
+	*context = NULL;
+
+	newContext = (OMRFileAIOContext *)portLibrary->mem_allocate_memory(portLibrary, sizeof(OMRFileAIOContext), OMR_GET_CALLSITE(), OMRMEM_CATEGORY_PORT_LIBRARY);
+	if (NULL == newContext) {
+		rc = OMRPORT_ERROR_FILE_OPFAILED;
+		goto done;
+	}
+	memset(newContext, 0, sizeof(OMRFileAIOContext));
+	newContext->portLibrary = portLibrary;
+	newContext->queueDepth = queueDepth;
+	newContext->useThreads = TRUE;
+
+#if defined(OMRFILE_AIO_IO_URING)
+	if (0 == (flags & OMRPORT_FILE_AIO_USE_THREADS)) {
+		int err = ringCreate(newContext);
+		if (0 == err) {
+			newContext->useThreads = FALSE;
+		} else {
+			/* Typically ENOSYS on old kernels, or EPERM when blocked by seccomp */
+			Trc_PRT_file_aio_context_create_using_threads(err);
+		}
+	}
+#endif /* defined(OMRFILE_AIO_IO_URING) */
+
+	if (newContext->useThreads) {
+		if (0 != omrthread_monitor_init_with_name(&newContext->monitor, 0, "portLibrary_omrfile_aio_monitor")) {
+			portLibrary->mem_free_memory(portLibrary, newContext);
+			newContext = NULL;
+			rc = OMRPORT_ERROR_FILE_OPFAILED;
+			goto done;
+		}
+		rc = startWorkers(newContext);
+		if (0 != rc) {
+			omrthread_monitor_destroy(newContext->monitor);
+			portLibrary->mem_free_memory(portLibrary, newContext);
+			newContext = NULL;
+			goto done;
+		}
+	}
+	*context = newContext;
+
+done:
+	Trc_PRT_file_aio_context_create_Exit(rc, newContext);
+	return rc;
+}
+
+/**
+ * Destroy a context created by @ref omrfile_aio_context_create.
+ *
+ * Waits for all requests in flight and runs their callbacks before releasing
+ * the context.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] context The context, may be NULL
+ */
+void
+omrfile_aio_context_destroy(struct OMRPortLibrary *portLibrary, struct OMRFileAIOContext *context)
+{
+	Trc_PRT_file_aio_context_destroy_Entry(context);
+
+	if (NULL != context) {
+		while (0 != context->inFlight) {
+			if (0 >= portLibrary->file_aio_complete(portLibrary, context, context->inFlight, -1)) {
+				break;
+			}
+		}
+		if (context->useThreads) {
+			stopWorkers(context);
+			omrthread_monitor_destroy(context->monitor);
+		}
+#if defined(OMRFILE_AIO_IO_URING)
+		else {
+			ringDestroy(context);
+		}
+#endif /* defined(OMRFILE_AIO_IO_URING) */
+		portLibrary->mem_free_memory(portLibrary, context);
+	}
+
+	Trc_PRT_file_aio_context_destroy_Exit();
+}
+
+/**
+ * Queue a batch of requests.
+ *
+ * Requests are queued in order until one is malformed or the context already
+ * has queueDepth requests in flight. Queued requests run concurrently and may
+ * finish in any order. Reads and writes transfer at most length bytes at the
+ * request's offset and do not move the file position; like omrfile_pread
+ * they may transfer less than asked. The caller must not touch a queued
+ * request or its buffer until omrfile_aio_complete has run its callback.
+ *
+ * Calls to omrfile_aio_submit and omrfile_aio_complete on one context must not
+ * overlap.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] context The context
+ * @param[in] requests Array of requests to queue
+ * @param[in] count Number of requests in the array
+ *
+ * @return the number of requests queued, which may be less than count, or
+ * a negative portable error code if the first request is malformed.
+ */
+intptr_t
+omrfile_aio_submit(struct OMRPortLibrary *portLibrary, struct OMRFileAIOContext *context, struct OMRFileAIORequest **requests, uintptr_t count)
+{
+	intptr_t queued = 0;
+	uintptr_t i = 0;
+
+	Trc_PRT_file_aio_submit_Entry(context, count);
+
+	if ((NULL == context) || ((NULL == requests) && (0 != count))) {
+		queued = OMRPORT_ERROR_FILE_INVAL;
+		goto done;
+	}
+
+	for (i = 0; i < count; i++) {
+		if ((context->inFlight >= context->queueDepth) || !isValidRequest(requests[i])) {
+			break;
+		}
+		requests[i]->result = 0;
+		requests[i]->next = NULL;
+		context->inFlight += 1;
+		queued += 1;
+	}
+	if ((0 == queued) && (0 != count) && !isValidRequest(requests[0])) {
+		queued = OMRPORT_ERROR_FILE_INVAL;
+		goto done;
+	}
+
+	if (context->useThreads) {
+		omrthread_monitor_enter(context->monitor);
+		for (i = 0; i < (uintptr_t)queued; i++) {
+			appendRequest(&context->pendingHead, &context->pendingTail, requests[i]);
+		}
+		omrthread_monitor_notify_all(context->monitor);
+		omrthread_monitor_exit(context->monitor);
+	}
+#if defined(OMRFILE_AIO_IO_URING)
+	else {
+		for (i = 0; i < (uintptr_t)queued; i++) {
+			ringQueue(context, requests[i]);
+		}
+		/* One system call for the whole batch */
+		ringSubmit(context);
+	}
+#endif /* defined(OMRFILE_AIO_IO_URING) */
+
+done:
+	Trc_PRT_file_aio_submit_Exit(queued);
+	return queued;
+}
+
+/**
+ * Collect finished requests and run their callbacks on the calling thread, in
+ * the order the requests finished. Each request's result field holds the
+ * number of bytes transferred, 0 for OMRPORT_FILE_AIO_SYNC, or a negative
+ * portable error code.
+ *
+ * With a timeout of 0 this only polls for requests that have already finished.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] context The context
+ * @param[in] minComplete Number of requests to wait for, capped at the number in flight
+ * @param[in] timeoutMillis Maximum time to wait, 0 to poll, negative to wait without limit
+ *
+ * @return the number of requests completed, or a negative portable error code.
+ */
+intptr_t
+omrfile_aio_complete(struct OMRPortLibrary *portLibrary, struct OMRFileAIOContext *context, uintptr_t minComplete, int64_t timeoutMillis)
+{
+	OMRFileAIORequest *completed = NULL;
+	uintptr_t count = 0;
+
+	Trc_PRT_file_aio_complete_Entry(context, minComplete, timeoutMillis);
+
+	if (NULL == context) {
+		Trc_PRT_file_aio_complete_Exit((intptr_t)OMRPORT_ERROR_FILE_INVAL);
+		return OMRPORT_ERROR_FILE_INVAL;
+	}
+
+	minComplete = OMR_MIN(minComplete, context->inFlight);
+	if (context->useThreads) {
+		count = completeWithThreads(context, minComplete, timeoutMillis, &completed);
+	}
+#if defined(OMRFILE_AIO_IO_URING)
+	else {
+		count = completeWithRing(context, minComplete, timeoutMillis, &completed);
+	}
+#endif /* defined(OMRFILE_AIO_IO_URING) */
+	context->inFlight -= count;
+
+	runCallbacks(portLibrary, completed);
+
+	Trc_PRT_file_aio_complete_Exit((intptr_t)count);
+	return (intptr_t)count;
+}
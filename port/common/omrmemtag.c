@@ -47,6 +47,9 @@
 #include "omrport.h"
 #include "omrportpriv.h"
 #include "omrportpg.h"
+#include "omrportptb.h"
+#include "omrthread.h"
+#include "omrutilbase.h"
 #include "ut_omrport.h"
 
 #if defined(OMR_ENV_DATA64)
@@ -56,8 +59,15 @@
 #include "omrmemtag_checks.h"
 
 static void setTagSumCheck(J9MemTag *tag, uint32_t eyeCatcher);
-static void *wrapBlockAndSetTags(struct OMRPortLibrary *portLibrary, void *memoryPointer, uintptr_t byteAmount, const char *callSite, const uint32_t category);
-static void *unwrapBlockAndCheckTags(struct OMRPortLibrary *portLibrary, void *memoryPointer);
+static void *wrapBlockAndSetTags(struct OMRPortLibrary *portLibrary, void *memoryPointer, uintptr_t byteAmount, const char *callSite, const uint32_t category, J9MemThreadCache *cache);
+static void *unwrapBlockAndCheckTags(struct OMRPortLibrary *portLibrary, void *memoryPointer, J9MemThreadCache *cache, BOOLEAN *tagsValid);
+static J9MemThreadCache *lookupThreadCache(struct OMRPortLibrary *portLibrary);
+static void flushIfStale(struct OMRPortLibrary *portLibrary, J9MemThreadCache *cache);
+static J9MemThreadCache *getThreadCache(struct OMRPortLibrary *portLibrary, BOOLEAN create);
+static BOOLEAN isTagCheckDue(struct OMRPortLibrary *portLibrary, J9MemThreadCache *cache);
+static BOOLEAN isCachedBlock(struct OMRPortLibrary *portLibrary, J9MemTag *headerTag);
+static void foldPendingCounters(J9MemThreadCache *cache);
+static void updateCounters(J9MemThreadCache *cache, OMRMemCategory *category, intptr_t allocations, intptr_t bytes);
 
 /* Typedefs for basic allocators */
 typedef void *(*allocate_memory_func_t)(struct OMRPortLibrary *portLibrary, uintptr_t byteAmount);
@@ -76,9 +86,233 @@ setTagSumCheck(J9MemTag *tag, uint32_t eyeCatcher)
 BOOLEAN
 isLocatedInIgnoredRegion(struct OMRPortLibrary *portLibrary, void *memoryPointer);
 
+/**
+ * Get the calling thread's allocation cache without creating it or flushing it.
+ *
+ * @param[in] portLibrary The port library
+ *
+ * @return the cache, or NULL if the thread has no per thread buffer
+ */
+static J9MemThreadCache *
+lookupThreadCache(struct OMRPortLibrary *portLibrary)
+{
+	OMRPortLibraryGlobalData *portGlobals = portLibrary->portGlobals;
+	PortlibPTBuffers_t ptBuffers = NULL;
+	omrthread_t self = omrthread_self();
+
+	if (NULL != self) {
+		ptBuffers = omrthread_tls_get(self, portGlobals->tls_key);
+	}
+	return (NULL == ptBuffers) ? NULL : &ptBuffers->memThreadCache;
+}
+
+/**
+ * Flush a cache that went stale because the cache was disabled or the categories
+ * were replaced since its thread last used it.
+ */
+static void
+flushIfStale(struct OMRPortLibrary *portLibrary, J9MemThreadCache *cache)
+{
+	uintptr_t generation = portLibrary->portGlobals->memThreadCacheGeneration;
+
+	if (cache->generation != generation) {
+		omrmem_flush_thread_cache(portLibrary, cache);
+		cache->generation = generation;
+	}
+}
+
+/**
+ * Get the calling thread's allocation cache.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] create TRUE to create the per thread buffer holding the cache if the thread has none
+ *
+ * While the cache is disabled this returns without a TLS lookup. A thread's stale cache
+ * is then flushed when the cache is enabled again and the thread next allocates or frees,
+ * or when its per thread buffer is freed; until then the blocks it holds stay allocated
+ * and up to J9MEM_THREAD_CACHE_COUNTER_BATCH of its counter updates stay batched.
+ *
+ * @return the cache, or NULL if the cache is disabled or unavailable to this thread
+ */
+static J9MemThreadCache *
+getThreadCache(struct OMRPortLibrary *portLibrary, BOOLEAN create)
+{
+	OMRPortLibraryGlobalData *portGlobals = portLibrary->portGlobals;
+	J9MemThreadCache *cache = NULL;
+
+	if ((NULL == portGlobals) || (0 == portGlobals->memThreadCacheEnabled)) {
+		return NULL;
+	}
+	cache = lookupThreadCache(portLibrary);
+	/* omrport_tls_get allocates the buffer through omrmem_allocate_memory; don't recurse */
+	if ((NULL == cache) && create && (omrthread_self() != portGlobals->tls_creator)) {
+		PortlibPTBuffers_t ptBuffers = omrport_tls_get(portLibrary);
+		if (NULL != ptBuffers) {
+			cache = &ptBuffers->memThreadCache;
+		}
+	}
+	if (NULL != cache) {
+		flushIfStale(portLibrary, cache);
+	}
+	return cache;
+}
+
+/**
+ * Whether a block freed through a thread's cache has its footer and padding checked.
+ * Blocks freed without a cache are always checked, as are all blocks in debug builds;
+ * otherwise one free in every OMRPORT_CTLDATA_MEM_TAG_CHECK_INTERVAL is.
+ */
+static BOOLEAN
+isTagCheckDue(struct OMRPortLibrary *portLibrary, J9MemThreadCache *cache)
+{
+#if defined(J9MEM_THREAD_CACHE_DEBUG)
+	return TRUE;
+#else /* defined(J9MEM_THREAD_CACHE_DEBUG) */
+	uintptr_t interval = portLibrary->portGlobals->memTagCheckInterval;
+
+	if ((NULL == cache) || (interval <= 1)) {
+		return TRUE;
+	}
+	if (0 == cache->freesUntilTagCheck) {
+		cache->freesUntilTagCheck = interval - 1;
+		return TRUE;
+	}
+	cache->freesUntilTagCheck -= 1;
+	return FALSE;
+#endif /* defined(J9MEM_THREAD_CACHE_DEBUG) */
+}
+
+/**
+ * Whether a block is on one of the calling thread's cache lists, stale or not.
+ * Blocks cached by other threads are not found.
+ */
+static BOOLEAN
+isCachedBlock(struct OMRPortLibrary *portLibrary, J9MemTag *headerTag)
+{
+	J9MemThreadCache *cache = NULL;
+	uintptr_t sizeClass = 0;
+
+	if (0 == portLibrary->portGlobals->memThreadCacheUsed) {
+		return FALSE;
+	}
+	cache = lookupThreadCache(portLibrary);
+	if (NULL == cache) {
+		return FALSE;
+	}
+	/* The header may be corrupt, so search every size class rather than trusting allocSize */
+	for (sizeClass = 0; sizeClass < J9MEM_THREAD_CACHE_SIZE_CLASSES; sizeClass++) {
+		J9MemTag *block = (J9MemTag *)cache->freeBlocks[sizeClass];
+		while (NULL != block) {
+			if (block == headerTag) {
+				return TRUE;
+			}
+			block = *(J9MemTag **)(block + 1);
+		}
+	}
+	return FALSE;
+}
+
+/**
+ * Add the counter updates batched in a cache to their category.
+ */
+static void
+foldPendingCounters(J9MemThreadCache *cache)
+{
+	OMRMemCategory *category = cache->pendingCategory;
+
+	if (NULL != category) {
+		/* Negative deltas wrap around to the expected unsigned result */
+		if (0 != cache->pendingAllocations) {
+			addAtomic(&category->liveAllocations, (uintptr_t)cache->pendingAllocations);
+		}
+		if (0 != cache->pendingBytes) {
+			addAtomic(&category->liveBytes, (uintptr_t)cache->pendingBytes);
+		}
+	}
+	cache->pendingCategory = NULL;
+	cache->pendingAllocations = 0;
+	cache->pendingBytes = 0;
+	cache->pendingUpdates = 0;
+}
+
+/**
+ * Update a category's live allocation and byte counters, batching the
+ * update in the thread's cache when there is one.
+ */
+static void
+updateCounters(J9MemThreadCache *cache, OMRMemCategory *category, intptr_t allocations, intptr_t bytes)
+{
+	if (NULL == cache) {
+		if (allocations > 0) {
+			omrmem_categories_increment_counters(category, (uintptr_t)bytes);
+		} else {
+			omrmem_categories_decrement_counters(category, (uintptr_t)-bytes);
+		}
+		return;
+	}
+
+	if (category != cache->pendingCategory) {
+		foldPendingCounters(cache);
+		cache->pendingCategory = category;
+	}
+	cache->pendingAllocations += allocations;
+	cache->pendingBytes += bytes;
+	cache->pendingUpdates += 1;
+	if (cache->pendingUpdates >= J9MEM_THREAD_CACHE_COUNTER_BATCH) {
+		foldPendingCounters(cache);
+	}
+}
+
+/**
+ * Free the blocks held in a thread's allocation cache and fold its batched counters.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] cache The cache to flush
+ */
+void
+omrmem_flush_thread_cache(struct OMRPortLibrary *portLibrary, J9MemThreadCache *cache)
+{
+	uintptr_t sizeClass = 0;
+
+	for (sizeClass = 0; sizeClass < J9MEM_THREAD_CACHE_SIZE_CLASSES; sizeClass++) {
+		J9MemTag *block = (J9MemTag *)cache->freeBlocks[sizeClass];
+		while (NULL != block) {
+			J9MemTag *next = *(J9MemTag **)(block + 1);
+			omrmem_free_memory_basic(portLibrary, block);
+			block = next;
+		}
+		cache->freeBlocks[sizeClass] = NULL;
+		cache->freeBlockCounts[sizeClass] = 0;
+	}
+	foldPendingCounters(cache);
+}
+
+/**
+ * Mark the allocation caches of all threads stale and flush the calling thread's
+ * cache. Every other thread flushes its cache on its next allocation or free with
+ * the cache enabled, or when its per thread buffer is freed.
+ *
+ * @param[in] portLibrary The port library
+ */
+void
+omrmem_invalidate_thread_caches(struct OMRPortLibrary *portLibrary)
+{
+	OMRPortLibraryGlobalData *portGlobals = portLibrary->portGlobals;
+
+	if (0 != portGlobals->memThreadCacheUsed) {
+		J9MemThreadCache *cache = NULL;
+
+		addAtomic(&portGlobals->memThreadCacheGeneration, 1);
+		cache = lookupThreadCache(portLibrary);
+		if (NULL != cache) {
+			flushIfStale(portLibrary, cache);
+		}
+	}
+}
+
 /* A correctly constructed header/footer will sumcheck to zero */
 static void *
-wrapBlockAndSetTags(struct OMRPortLibrary *portLibrary, void *memoryPointer, uintptr_t byteAmount, const char *callSite, const uint32_t categoryCode)
+wrapBlockAndSetTags(struct OMRPortLibrary *portLibrary, void *memoryPointer, uintptr_t byteAmount, const char *callSite, const uint32_t categoryCode, J9MemThreadCache *cache)
 {
 	J9MemTag *headerTag, *footerTag;
 	uint8_t *padding;
@@ -90,12 +324,10 @@ wrapBlockAndSetTags(struct OMRPortLibrary *portLibrary, void *memoryPointer, uin
 	memoryPointer = (void *)((uint8_t *) memoryPointer + sizeof(J9MemTag));
 	padding = (uint8_t *)(((uintptr_t)memoryPointer) + byteAmount);
 
-	while ((uintptr_t)padding != (uintptr_t)footerTag) {
-		*padding++ = J9MEMTAG_PADDING_BYTE;
-	}
+	memset(padding, J9MEMTAG_PADDING_BYTE, (uintptr_t)footerTag - (uintptr_t)padding);
 
 	category = omrmem_get_category(portLibrary, categoryCode);
-	omrmem_categories_increment_counters(category, ROUNDED_BYTE_AMOUNT(byteAmount));
+	updateCounters(cache, category, 1, (intptr_t)ROUNDED_BYTE_AMOUNT(byteAmount));
 
 	/* Fill in the tags */
 	headerTag->allocSize = byteAmount;
@@ -117,10 +349,15 @@ wrapBlockAndSetTags(struct OMRPortLibrary *portLibrary, void *memoryPointer, uin
 	return memoryPointer;
 }
 
+/*
+ * The header tag is always checked; the footer and padding are checked as isTagCheckDue decides.
+ * If tagsValid is not NULL it is set to whether the checked tags were intact.
+ */
 static void *
-unwrapBlockAndCheckTags(struct OMRPortLibrary *portLibrary, void *memoryPointer)
+unwrapBlockAndCheckTags(struct OMRPortLibrary *portLibrary, void *memoryPointer, J9MemThreadCache *cache, BOOLEAN *tagsValid)
 {
 	J9MemTag *headerTag, *footerTag;
+	BOOLEAN valid = FALSE;
 
 	/* get the tags */
 	headerTag = omrmem_get_header_tag(memoryPointer);
@@ -128,10 +365,13 @@ unwrapBlockAndCheckTags(struct OMRPortLibrary *portLibrary, void *memoryPointer)
 
 	/* Check the tags and update only if not corrupted*/
 	if ((checkTagSumCheck(headerTag, J9MEMTAG_EYECATCHER_ALLOC_HEADER) == 0)
-		&& (checkTagSumCheck(footerTag, J9MEMTAG_EYECATCHER_ALLOC_FOOTER) == 0)
-		&& (checkPadding(headerTag) == 0)) {
+		&& (!isTagCheckDue(portLibrary, cache)
+			|| ((checkTagSumCheck(footerTag, J9MEMTAG_EYECATCHER_ALLOC_FOOTER) == 0)
+				&& (checkPadding(headerTag) == 0)))
+	) {
 
-		omrmem_categories_decrement_counters(headerTag->category, ROUNDED_BYTE_AMOUNT(headerTag->allocSize));
+		valid = TRUE;
+		updateCounters(cache, headerTag->category, -1, -(intptr_t)ROUNDED_BYTE_AMOUNT(headerTag->allocSize));
 
 		/* Optimized freed header sumCheck setting */
 		headerTag->eyeCatcher = J9MEMTAG_EYECATCHER_FREED_HEADER;
@@ -145,6 +385,9 @@ unwrapBlockAndCheckTags(struct OMRPortLibrary *portLibrary, void *memoryPointer)
 		Trc_Assert_PRT_memory_corruption_detected(memoryCorruptionDetected);
 	}
 
+	if (NULL != tagsValid) {
+		*tagsValid = valid;
+	}
 	return headerTag;
 }
 
@@ -172,6 +415,7 @@ omrmem_allocate_memory(struct OMRPortLibrary *portLibrary, uintptr_t byteAmount,
 	void *pointer = NULL;
 	uintptr_t allocationByteAmount;
 	allocate_memory_func_t allocateFunction = omrmem_allocate_memory_basic;
+	J9MemThreadCache *cache = getThreadCache(portLibrary, TRUE);
 
 	/* note that this monitor is protecting a larger area than strictly required but this will make the trace points sane */
 	Trc_PRT_mem_omrmem_allocate_memory_Entry(byteAmount, callSite);
@@ -179,12 +423,23 @@ omrmem_allocate_memory(struct OMRPortLibrary *portLibrary, uintptr_t byteAmount,
 
 	/* Guard against overflow when wrapped with ROUNDED_BYTE_AMOUNT. */
 	if (allocationByteAmount >= byteAmount) {
-		pointer = allocateFunction(portLibrary, allocationByteAmount);
+		if ((NULL != cache) && (allocationByteAmount <= J9MEM_THREAD_CACHE_MAX_BLOCK_SIZE)) {
+			uintptr_t sizeClass = J9MEM_THREAD_CACHE_SIZE_CLASS(allocationByteAmount);
+			J9MemTag *block = (J9MemTag *)cache->freeBlocks[sizeClass];
+			if (NULL != block) {
+				cache->freeBlocks[sizeClass] = *(J9MemTag **)(block + 1);
+				cache->freeBlockCounts[sizeClass] -= 1;
+				pointer = block;
+			}
+		}
+		if (NULL == pointer) {
+			pointer = allocateFunction(portLibrary, allocationByteAmount);
+		}
 	}
 	if (NULL == pointer) {
 		Trc_PRT_memory_alloc_returned_null_2(callSite, allocationByteAmount);
 	} else {
-		pointer = wrapBlockAndSetTags(portLibrary, pointer, byteAmount, callSite, category);
+		pointer = wrapBlockAndSetTags(portLibrary, pointer, byteAmount, callSite, category, cache);
 	}
 	Trc_PRT_mem_omrmem_allocate_memory_Exit(pointer);
 	return pointer;
@@ -205,8 +460,29 @@ omrmem_free_memory(struct OMRPortLibrary *portLibrary, void *memoryPointer)
 	Trc_PRT_mem_omrmem_free_memory_Entry(memoryPointer);
 
 	if (memoryPointer != NULL) {
-		memoryPointer = unwrapBlockAndCheckTags(portLibrary, memoryPointer);
-		freeFunction(portLibrary, memoryPointer);
+		J9MemThreadCache *cache = getThreadCache(portLibrary, FALSE);
+		BOOLEAN tagsValid = FALSE;
+		J9MemTag *headerTag = (J9MemTag *)unwrapBlockAndCheckTags(portLibrary, memoryPointer, cache, &tagsValid);
+		uintptr_t allocationByteAmount = ROUNDED_BYTE_AMOUNT(headerTag->allocSize);
+
+		/* Never cache a block whose tags can't be trusted, e.g. one freed twice */
+		if ((NULL != cache) && tagsValid && (allocationByteAmount <= J9MEM_THREAD_CACHE_MAX_BLOCK_SIZE)) {
+			uintptr_t sizeClass = J9MEM_THREAD_CACHE_SIZE_CLASS(allocationByteAmount);
+			if (cache->freeBlockCounts[sizeClass] < J9MEM_THREAD_CACHE_MAX_BLOCKS) {
+				/* The freed header is left intact so a second free is still caught */
+				*(J9MemTag **)(headerTag + 1) = (J9MemTag *)cache->freeBlocks[sizeClass];
+				cache->freeBlocks[sizeClass] = headerTag;
+				cache->freeBlockCounts[sizeClass] += 1;
+				headerTag = NULL;
+			}
+		}
+		/* A second free of a block in this thread's cache has been reported above; don't free it to the system as well */
+		if ((NULL != headerTag) && !tagsValid && isCachedBlock(portLibrary, headerTag)) {
+			headerTag = NULL;
+		}
+		if (NULL != headerTag) {
+			freeFunction(portLibrary, headerTag);
+		}
 	}
 	Trc_PRT_mem_omrmem_free_memory_Exit();
 }
@@ -241,7 +517,7 @@ omrmem_advise_and_free_memory(struct OMRPortLibrary *portLibrary, void *memoryPo
 			memorySize = 0;
 		}
 #endif /* (defined(LINUX) || defined (AIXPPC) || defined(J9ZOS390) || defined(OSX)) */
-		memoryPointer = unwrapBlockAndCheckTags(portLibrary, memoryPointer);
+		memoryPointer = unwrapBlockAndCheckTags(portLibrary, memoryPointer, NULL, NULL);
 		adviseAndFreeFunction(portLibrary, memoryPointer, memorySize);
 	}
 	Trc_PRT_mem_omrmem_advise_and_free_memory_Exit();
@@ -279,6 +555,7 @@ omrmem_reallocate_memory(struct OMRPortLibrary *portLibrary, void *memoryPointer
 	void *pointer = NULL;
 	uintptr_t allocationByteAmount;
 	reallocate_memory_func_t reallocateFunction = omrmem_reallocate_memory_basic;
+	J9MemThreadCache *cache = NULL;
 
 	Trc_PRT_mem_omrmem_reallocate_memory_Entry(memoryPointer, byteAmount, callSite, category);
 
@@ -287,7 +564,8 @@ omrmem_reallocate_memory(struct OMRPortLibrary *portLibrary, void *memoryPointer
 	} else if (byteAmount == 0) {
 		omrmem_free_memory(portLibrary, memoryPointer);
 	} else {
-		memoryPointer = unwrapBlockAndCheckTags(portLibrary, memoryPointer);
+		cache = getThreadCache(portLibrary, FALSE);
+		memoryPointer = unwrapBlockAndCheckTags(portLibrary, memoryPointer, cache, NULL);
 		if (NULL == callSite) {
 			/* Inherit the callsite from the original allocation */
 			callSite = ((J9MemTag *) memoryPointer)->callSite;
@@ -299,7 +577,7 @@ omrmem_reallocate_memory(struct OMRPortLibrary *portLibrary, void *memoryPointer
 			pointer = reallocateFunction(portLibrary, memoryPointer, allocationByteAmount);
 		}
 		if (NULL != pointer) {
-			pointer = wrapBlockAndSetTags(portLibrary, pointer, byteAmount, callSite, category);
+			pointer = wrapBlockAndSetTags(portLibrary, pointer, byteAmount, callSite, category, cache);
 		} else {
 			Trc_PRT_mem_omrmem_reallocate_memory_failed_2(callSite, memoryPointer, allocationByteAmount);
 
@@ -311,7 +589,8 @@ omrmem_reallocate_memory(struct OMRPortLibrary *portLibrary, void *memoryPointer
 						memoryPointer,
 						savedMemTag->allocSize,
 						savedMemTag->callSite,
-						savedMemTag->category->categoryCode);
+						savedMemTag->category->categoryCode,
+						cache);
 			}
 		}
 	}
@@ -469,7 +748,7 @@ omrmem_allocate_memory32(struct OMRPortLibrary *portLibrary, uintptr_t byteAmoun
 	if (NULL == pointer) {
 		Trc_PRT_mem_omrmem_allocate_memory32_returned_null(callSite, allocationByteAmount);
 	} else {
-		pointer = wrapBlockAndSetTags(portLibrary, pointer, byteAmount, callSite, category);
+		pointer = wrapBlockAndSetTags(portLibrary, pointer, byteAmount, callSite, category, NULL);
 	}
 #endif /* defined(OMR_ENV_DATA64) */
 
@@ -494,7 +773,7 @@ omrmem_free_memory32(struct OMRPortLibrary *portLibrary, void *memoryPointer)
 
 #if defined(OMR_ENV_DATA64)
 	if (memoryPointer != NULL) {
-		memoryPointer = unwrapBlockAndCheckTags(portLibrary, memoryPointer);
+		memoryPointer = unwrapBlockAndCheckTags(portLibrary, memoryPointer, NULL, NULL);
 		free_memory32(portLibrary, memoryPointer);
 	}
 #endif /* (OMR_ENV_DATA64) */
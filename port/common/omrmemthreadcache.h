@@ -0,0 +1,68 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#ifndef omrmemthreadcache_h
+#define omrmemthreadcache_h
+
+#include "omrcomp.h"
+
+struct OMRMemCategory;
+struct OMRPortLibrary;
+
+/* Blocks (including their tags) up to this many bytes are cached. The classes match the
+ * rounding of omrmem_allocate_memory, so blocks are never enlarged to fit a class.
+ */
+#define J9MEM_THREAD_CACHE_GRANULARITY	8
+#define J9MEM_THREAD_CACHE_SIZE_CLASSES	64
+#define J9MEM_THREAD_CACHE_MAX_BLOCK_SIZE	(J9MEM_THREAD_CACHE_GRANULARITY * J9MEM_THREAD_CACHE_SIZE_CLASSES)
+#define J9MEM_THREAD_CACHE_SIZE_CLASS(blockSize)	(((blockSize) - 1) / J9MEM_THREAD_CACHE_GRANULARITY)
+#define J9MEM_THREAD_CACHE_CLASS_SIZE(sizeClass)	(((sizeClass) + 1) * J9MEM_THREAD_CACHE_GRANULARITY)
+
+/* Most freed blocks kept per size class */
+#define J9MEM_THREAD_CACHE_MAX_BLOCKS	8
+/* Category counter updates batched before they are folded into the shared counters */
+#define J9MEM_THREAD_CACHE_COUNTER_BATCH	64
+
+/* Debug builds check the footer and padding of every freed block, whatever OMRPORT_CTLDATA_MEM_TAG_CHECK_INTERVAL says */
+#if !defined(NDEBUG) && !defined(J9MEM_THREAD_CACHE_DEBUG)
+#define J9MEM_THREAD_CACHE_DEBUG
+#endif /* !defined(NDEBUG) && !defined(J9MEM_THREAD_CACHE_DEBUG) */
+
+/**
+ * @typedef
+ * @brief Per thread allocation cache, enabled with OMRPORT_CTLDATA_MEM_THREAD_CACHE.
+ * Lives in the per thread buffer and is flushed when the buffer is freed.
+ */
+typedef struct J9MemThreadCache {
+	void *freeBlocks[J9MEM_THREAD_CACHE_SIZE_CLASSES]; /**< freed blocks of each size class, linked through the word after their header */
+	uint32_t freeBlockCounts[J9MEM_THREAD_CACHE_SIZE_CLASSES]; /**< number of blocks on each list */
+	struct OMRMemCategory *pendingCategory; /**< category the pending counter updates apply to */
+	intptr_t pendingAllocations; /**< live allocation delta not yet added to pendingCategory */
+	intptr_t pendingBytes; /**< live byte delta not yet added to pendingCategory */
+	uintptr_t pendingUpdates; /**< number of updates batched into the deltas */
+	uintptr_t generation; /**< memThreadCacheGeneration when the cache was last flushed */
+	uintptr_t freesUntilTagCheck; /**< frees left before the next one checks the footer and padding tags */
+} J9MemThreadCache;
+
+void omrmem_flush_thread_cache(struct OMRPortLibrary *portLibrary, J9MemThreadCache *cache);
+
+#endif /* omrmemthreadcache_h */
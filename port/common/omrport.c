@@ -56,6 +56,10 @@ static OMRPortLibrary MainPortLibraryTable = {
 	omrtime_hires_clock, /* time_hires_clock */
 	omrtime_hires_frequency, /* time_hires_frequency */
 	omrtime_hires_delta, /* time_hires_delta */
+	omrtime_tick_clock, /* time_tick_clock */
+	omrtime_tick_frequency, /* time_tick_frequency */
+	omrtime_tick_delta, /* time_tick_delta */
+	omrtime_tick_source, /* time_tick_source */
 	omrsysinfo_startup, /* sysinfo_startup */
 	omrsysinfo_shutdown, /* sysinfo_shutdown */
 	omrsysinfo_process_exists, /* sysinfo_process_exists */
@@ -258,6 +262,16 @@ static OMRPortLibrary MainPortLibraryTable = {
 	omrfile_convert_omrfile_fd_to_native_fd,
 	omrfile_blockingasync_unlock_bytes, /* file_blockingasync_unlock_bytes */
 	omrfile_blockingasync_lock_bytes, /* file_blockingasync_lock_bytes */
+	omrfile_pread, /* file_pread */
+	omrfile_pwrite, /* file_pwrite */
+	omrfile_readv, /* file_readv */
+	omrfile_writev, /* file_writev */
+	omrfile_preallocate, /* file_preallocate */
+	omrfile_advise, /* file_advise */
+	omrfile_aio_context_create, /* file_aio_context_create */
+	omrfile_aio_context_destroy, /* file_aio_context_destroy */
+	omrfile_aio_submit, /* file_aio_submit */
+	omrfile_aio_complete, /* file_aio_complete */
 	omrstr_ftime, /* str_ftime */
 	omrstr_ftime_ex, /* str_ftime_ex */
 	omrstr_current_time_zone, /* str_current_time_zone */
@@ -410,6 +424,15 @@ static OMRPortLibrary MainPortLibraryTable = {
 	omrsock_getsockopt_int, /* sock_getsockopt_int */
 	omrsock_getsockopt_linger, /* sock_getsockopt_linger */
 	omrsock_getsockopt_timeval, /* sock_getsockopt_timeval */
+	omrsock_eventset_create, /* sock_eventset_create */
+	omrsock_eventset_add, /* sock_eventset_add */
+	omrsock_eventset_modify, /* sock_eventset_modify */
+	omrsock_eventset_remove, /* sock_eventset_remove */
+	omrsock_eventset_wait, /* sock_eventset_wait */
+	omrsock_get_event_info, /* sock_get_event_info */
+	omrsock_eventset_destroy, /* sock_eventset_destroy */
+	omrsock_sendfile, /* sock_sendfile */
+	omrsock_splice, /* sock_splice */
 #if defined(OMR_OPT_CUDA)
 	NULL, /* cuda_configData */
 	omrcuda_startup, /* cuda_startup */
@@ -184,6 +184,10 @@ omrport_control(struct OMRPortLibrary *portLibrary, const char *key, uintptr_t v
 		return 0;
 	}
 
+	if (0 == strcmp(OMRPORT_CTLDATA_TIME_TICK_SOURCE, key)) {
+		return omrtime_set_tick_source(portLibrary, value);
+	}
+
 	if (strcmp(OMRPORT_CTLDATA_NOIPT, key) == 0) {
 #if defined(J9VM_PROVIDE_ICONV)
 		int rc = 0;
@@ -200,6 +204,8 @@ omrport_control(struct OMRPortLibrary *portLibrary, const char *key, uintptr_t v
 	if (!strcmp(OMRPORT_CTLDATA_MEM_CATEGORIES_SET, key)) {
 		J9PortControlData *portControl = &portLibrary->portGlobals->control;
 		OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+		/* Don't leave counter updates for the old categories batched in the thread caches */
+		omrmem_invalidate_thread_caches(portLibrary);
 		/* Allow categories to be reset to NULL (for testing purposes) - but not reset to anything else */
 		if (0 == value) {
 			omrmem_shutdown_categories(portLibrary);
@@ -290,6 +296,22 @@ omrport_control(struct OMRPortLibrary *portLibrary, const char *key, uintptr_t v
 	}
 #endif
 
+	if (0 == strcmp(OMRPORT_CTLDATA_MEM_THREAD_CACHE, key)) {
+		if (0 == value) {
+			portLibrary->portGlobals->memThreadCacheEnabled = 0;
+			omrmem_invalidate_thread_caches(portLibrary);
+		} else {
+			portLibrary->portGlobals->memThreadCacheUsed = 1;
+			portLibrary->portGlobals->memThreadCacheEnabled = 1;
+		}
+		return 0;
+	}
+
+	if (0 == strcmp(OMRPORT_CTLDATA_MEM_TAG_CHECK_INTERVAL, key)) {
+		portLibrary->portGlobals->memTagCheckInterval = value;
+		return 0;
+	}
+
 	if (0 == strcmp(OMRPORT_CTLDATA_VMEM_ADVISE_OS_ONFREE, key)) {
 		portLibrary->portGlobals->vmemAdviseOSonFree = value;
 		return 0;
@@ -847,3 +847,174 @@ omrsock_getsockopt_timeval(struct OMRPortLibrary *portLibrary, omrsock_socket_t
 {
 	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
 }
+
+/**
+ * Create an event set, which watches many sockets for readiness at a cost
+ * that does not grow with the number of sockets watched. On Linux the set is
+ * backed by epoll; elsewhere it falls back to @ref omrsock_poll style polling.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[out] eventSet The new event set.
+ *
+ * @return 0, if no errors occurred, otherwise return an error.
+ */
+int32_t
+omrsock_eventset_create(struct OMRPortLibrary *portLibrary, omrsock_eventset_t *eventSet)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+/**
+ * Add a socket to an event set. The user data is stored with the socket and
+ * returned with each of its events, so a socket may belong to only one event
+ * set at a time.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] eventSet The event set.
+ * @param[in] sock The socket to watch.
+ * @param[in] events Events to watch for, ORed together.
+ * \arg OMRSOCK_POLLIN
+ * \arg OMRSOCK_POLLOUT
+ * \arg OMRSOCK_EVENT_EDGE_TRIGGERED Report an event only when the socket becomes ready,
+ * rather than for as long as it is ready. Only honoured by epoll; other platforms
+ * report the socket for as long as it is ready.
+ * \arg OMRSOCK_EVENT_ONESHOT Stop watching the socket after one event, until it is
+ * re-armed with @ref omrsock_eventset_modify.
+ * @param[in] userData Data to return with the socket's events.
+ *
+ * @return 0, if no errors occurred, otherwise return an error.
+ */
+int32_t
+omrsock_eventset_add(struct OMRPortLibrary *portLibrary, omrsock_eventset_t eventSet, omrsock_socket_t sock, int16_t events, void *userData)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+/**
+ * Change the events watched for, and the user data of, a socket in an event set.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] eventSet The event set.
+ * @param[in] sock A socket previously added with @ref omrsock_eventset_add.
+ * @param[in] events Events to watch for, see @ref omrsock_eventset_add.
+ * @param[in] userData Data to return with the socket's events.
+ *
+ * @return 0, if no errors occurred, otherwise return an error.
+ */
+int32_t
+omrsock_eventset_modify(struct OMRPortLibrary *portLibrary, omrsock_eventset_t eventSet, omrsock_socket_t sock, int16_t events, void *userData)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+/**
+ * Stop watching a socket. A socket must be removed from its event set before
+ * it is closed.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] eventSet The event set.
+ * @param[in] sock A socket previously added with @ref omrsock_eventset_add.
+ *
+ * @return 0, if no errors occurred, otherwise return an error.
+ */
+int32_t
+omrsock_eventset_remove(struct OMRPortLibrary *portLibrary, omrsock_eventset_t eventSet, omrsock_socket_t sock)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+/**
+ * Wait for sockets in an event set to become ready. Each ready socket fills in
+ * one OMRSockEvent in the user allocated array. Use @ref omrsock_get_event_info
+ * to extract the socket, its user data and the events that occurred.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] eventSet The event set.
+ * @param[out] events Array to fill in with ready sockets.
+ * @param[in] maxEvents The length of the events array.
+ * @param[in] timeoutMs Time to wait in milliseconds. 0 returns immediately, negative waits without limit.
+ *
+ * @return the number of events filled in, 0 if the timeout expired, otherwise return an error.
+ */
+int32_t
+omrsock_eventset_wait(struct OMRPortLibrary *portLibrary, omrsock_eventset_t eventSet, omrsock_event_t events, uint32_t maxEvents, int32_t timeoutMs)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+/**
+ * Answer the details of an event filled in by @ref omrsock_eventset_wait.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] handle Pointer to the event.
+ * @param[out] sock The socket the event is for.
+ * @param[out] userData The user data of the socket.
+ * @param[out] revents The events that occurred.
+ * \arg OMRSOCK_POLLIN
+ * \arg OMRSOCK_POLLOUT
+ * \arg OMRSOCK_POLLERR (Not available on AIX)
+ * \arg OMRSOCK_POLLHUP (Not available on AIX)
+ *
+ * @return 0, if no errors occurred, otherwise return an error.
+ */
+int32_t
+omrsock_get_event_info(struct OMRPortLibrary *portLibrary, omrsock_event_t handle, omrsock_socket_t *sock, void **userData, int16_t *revents)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+/**
+ * Destroy an event set. Sockets still in the set are not closed.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] eventSet Pointer to the event set, set to NULL on return.
+ *
+ * @return 0, if no errors occurred, otherwise return an error.
+ */
+int32_t
+omrsock_eventset_destroy(struct OMRPortLibrary *portLibrary, omrsock_eventset_t *eventSet)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+/**
+ * Send the contents of a file on a connected stream socket. On Linux the data
+ * goes from the page cache to the socket without being copied through user
+ * space. Like @ref omrsock_send, this may send fewer bytes than asked.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] sock The socket to send on.
+ * @param[in] fd A file descriptor returned by omrfile_open.
+ * @param[in,out] offset If not NULL, the file offset to send from, advanced by the
+ * number of bytes sent; the file position is not used or changed. If NULL, send from
+ * and advance the file position.
+ * @param[in] count The number of bytes to send.
+ *
+ * @return the number of bytes sent if no error occurred, otherwise return an error.
+ */
+intptr_t
+omrsock_sendfile(struct OMRPortLibrary *portLibrary, omrsock_socket_t sock, intptr_t fd, int64_t *offset, uintptr_t count)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+/**
+ * Move data received on one socket to another socket. On Linux the data is
+ * moved through a per thread kernel pipe without being copied through user
+ * space. At most nbyte bytes are read from fromSock, with the blocking
+ * behaviour of fromSock; everything read is then written to toSock, waiting
+ * for toSock to become writable if it is non-blocking.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] fromSock The socket to receive from.
+ * @param[in] toSock The socket to send on.
+ * @param[in] nbyte The maximum number of bytes to move.
+ *
+ * @return the number of bytes moved if no error occurred. If fromSock has been
+ * gracefully closed, return 0. Otherwise, return an error.
+ */
+int32_t
+omrsock_splice(struct OMRPortLibrary *portLibrary, omrsock_socket_t fromSock, omrsock_socket_t toSock, int32_t nbyte)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
@@ -35,6 +35,10 @@
 
 #include "omrsockptb.h"
 
+#if defined(LINUX)
+#include <unistd.h>
+#endif /* defined(LINUX) */
+
 /**
  * @internal
  * @brief Omrsock Per Thread Buffer (PTB) Support
@@ -91,6 +95,12 @@ omrsock_ptb_free(void *socketPTBVoidP)
 	if (NULL != ptBuffer->addrInfoHints.addrInfo) {
 		portLibrary->mem_free_memory(portLibrary, ptBuffer->addrInfoHints.addrInfo);
 	}
+#if defined(LINUX)
+	if (ptBuffer->splicePipeOpen) {
+		close(ptBuffer->splicePipe[0]);
+		close(ptBuffer->splicePipe[1]);
+	}
+#endif /* defined(LINUX) */
 
 	portLibrary->mem_free_memory(portLibrary, ptBuffer);
 }
@@ -39,6 +39,11 @@
 typedef struct OMRSocketPTB {
 	OMRAddrInfoNode addrInfoHints;
 	struct OMRPortLibrary *portLibrary;
+#if defined(LINUX)
+	/* Pipe used by omrsock_splice, created on first use */
+	int splicePipe[2];
+	BOOLEAN splicePipeOpen;
+#endif /* defined(LINUX) */
 } OMRSocketPTB;
 
 typedef OMRSocketPTB *omrsock_ptb_t;
@@ -0,0 +1,418 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup Port
+ * @brief Tick clock for low overhead interval timing
+ *
+ * The tick clock is the high-resolution clock unless the invariant TSC has
+ * been selected with OMRPORT_CTLDATA_TIME_TICK_SOURCE. Selecting the TSC
+ * checks CPUID for an invariant TSC, calibrates its frequency against
+ * omrtime_hires_clock and, on Linux, checks that the TSC of every CPU the
+ * process may run on agrees with the calibration. If any step fails the
+ * high-resolution clock stays in use.
+ */
+
+#if defined(LINUX) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif /* defined(LINUX) && !defined(_GNU_SOURCE) */
+
+#include <string.h>
+#include "omrport.h"
+#include "omrportpriv.h"
+#include "ut_omrport.h"
+
+#if (defined(J9X86) || defined(J9HAMMER)) && (defined(LINUX) || defined(OSX) || defined(OMR_OS_WINDOWS))
+#define OMRTIME_TSC_SUPPORTED
+#include "omrsysinfo_helpers.h"
+#if defined(OMR_OS_WINDOWS)
+#include <intrin.h>
+#endif /* defined(OMR_OS_WINDOWS) */
+#if defined(LINUX)
+#include <sched.h>
+#endif /* defined(LINUX) */
+#endif /* (defined(J9X86) || defined(J9HAMMER)) && (defined(LINUX) || defined(OSX) || defined(OMR_OS_WINDOWS)) */
+
+#if defined(OMRTIME_TSC_SUPPORTED)
+#define OMRTIME_CPUID_MAX_EXTENDED_LEAF 0x80000000
+#define OMRTIME_CPUID_ADVANCED_POWER_MANAGEMENT 0x80000007
+#define OMRTIME_CPUID_INVARIANT_TSC 0x00000100
+/* Length of each of the two calibration intervals */
+#define OMRTIME_TSC_CALIBRATION_MICROS 10000
+/* Largest difference between the frequencies measured over the two intervals, in parts per million */
+#define OMRTIME_TSC_CALIBRATION_TOLERANCE_PPM 1000
+/* Largest difference between a CPU's TSC and the calibrated clock */
+#define OMRTIME_TSC_DRIFT_TOLERANCE_MICROS 50
+/* Number of tries at reading both clocks close together */
+#define OMRTIME_TSC_SAMPLE_TRIES 8
+
+static uint64_t
+readTSC(void)
+{
+#if defined(OMR_OS_WINDOWS)
+	return __rdtsc();
+#else /* defined(OMR_OS_WINDOWS) */
+	uint32_t low = 0;
+	uint32_t high = 0;
+	__asm volatile("rdtsc" : "=a" (low), "=d" (high));
+	return ((uint64_t)high << 32) | low;
+#endif /* defined(OMR_OS_WINDOWS) */
+}
+
+/**
+ * Read the TSC and the high-resolution clock at (nearly) the same moment.
+ * The pair read with the fewest TSC ticks around the clock read is kept.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[out] tsc TSC value
+ * @param[out] hires omrtime_hires_clock value
+ */
+static void
+sampleClocks(struct OMRPortLibrary *portLibrary, uint64_t *tsc, uint64_t *hires)
+{
+	uint64_t bestWindow = (uint64_t)-1;
+	uintptr_t i = 0;
+
+	for (i = 0; i < OMRTIME_TSC_SAMPLE_TRIES; i++) {
+		uint64_t before = readTSC();
+		uint64_t clock = portLibrary->time_hires_clock(portLibrary);
+		uint64_t after = readTSC();
+
+		if ((after - before) < bestWindow) {
+			bestWindow = after - before;
+			*tsc = before + (bestWindow / 2);
+			*hires = clock;
+		}
+	}
+}
+
+/**
+ * Measure the TSC frequency over two consecutive intervals of the
+ * high-resolution clock and check that they agree.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[out] frequency TSC ticks per second
+ * @param[out] tsc TSC value at the end of calibration
+ * @param[out] hires omrtime_hires_clock value at the end of calibration
+ *
+ * @return NULL on success, otherwise the reason calibration failed.
+ */
+static const char *
+calibrateTSC(struct OMRPortLibrary *portLibrary, double *frequency, uint64_t *tsc, uint64_t *hires)
+{
+	uint64_t hiresFrequency = portLibrary->time_hires_frequency(portLibrary);
+	uint64_t interval = (hiresFrequency * OMRTIME_TSC_CALIBRATION_MICROS) / OMRPORT_TIME_DELTA_IN_MICROSECONDS;
+	uint64_t tscSamples[3];
+	uint64_t hiresSamples[3];
+	double intervalFrequency[2];
+	uintptr_t i = 0;
+
+	sampleClocks(portLibrary, &tscSamples[0], &hiresSamples[0]);
+	for (i = 1; i < 3; i++) {
+		/* Spin rather than sleep; the interval is short and only paid once */
+		while ((portLibrary->time_hires_clock(portLibrary) - hiresSamples[i - 1]) < interval) {
+		}
+		sampleClocks(portLibrary, &tscSamples[i], &hiresSamples[i]);
+		if ((tscSamples[i] <= tscSamples[i - 1]) || (hiresSamples[i] <= hiresSamples[i - 1])) {
+			return "clock did not advance during calibration";
+		}
+		intervalFrequency[i - 1] = (double)(tscSamples[i] - tscSamples[i - 1]) * (double)hiresFrequency
+				/ (double)(hiresSamples[i] - hiresSamples[i - 1]);
+	}
+
+	if ((intervalFrequency[0] > intervalFrequency[1]
+			? intervalFrequency[0] - intervalFrequency[1]
+			: intervalFrequency[1] - intervalFrequency[0])
+			> (intervalFrequency[0] * OMRTIME_TSC_CALIBRATION_TOLERANCE_PPM / 1000000.0)
+	) {
+		return "TSC frequency is not stable";
+	}
+
+	*frequency = (double)(tscSamples[2] - tscSamples[0]) * (double)hiresFrequency / (double)(hiresSamples[2] - hiresSamples[0]);
+	*tsc = tscSamples[2];
+	*hires = hiresSamples[2];
+	return NULL;
+}
+
+#if defined(LINUX)
+/**
+ * Check that the TSC of every CPU in the affinity mask of the calling
+ * thread matches the calibrated clock. The thread is moved to each CPU in
+ * turn and its original affinity is restored afterwards.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] frequency calibrated TSC ticks per second
+ * @param[in] baseTSC TSC value taken together with baseHires
+ * @param[in] baseHires omrtime_hires_clock value
+ *
+ * @return NULL on success, otherwise the reason the check failed.
+ */
+static const char *
+checkTSCDrift(struct OMRPortLibrary *portLibrary, double frequency, uint64_t baseTSC, uint64_t baseHires)
+{
+	double hiresFrequency = (double)portLibrary->time_hires_frequency(portLibrary);
+	double tolerance = hiresFrequency * OMRTIME_TSC_DRIFT_TOLERANCE_MICROS / (double)OMRPORT_TIME_DELTA_IN_MICROSECONDS;
+	const char *result = NULL;
+	cpu_set_t originalSet;
+	uintptr_t cpu = 0;
+
+	if (0 != sched_getaffinity(0, sizeof(originalSet), &originalSet)) {
+		/* Nothing to compare against; the CPUID check has to be trusted */
+		return NULL;
+	}
+
+	for (cpu = 0; (cpu < CPU_SETSIZE) && (NULL == result); cpu++) {
+		if (CPU_ISSET(cpu, &originalSet)) {
+			cpu_set_t cpuSet;
+
+			CPU_ZERO(&cpuSet);
+			CPU_SET(cpu, &cpuSet);
+			if (0 == sched_setaffinity(0, sizeof(cpuSet), &cpuSet)) {
+				uint64_t tsc = 0;
+				uint64_t hires = 0;
+				double expected = 0.0;
+				double drift = 0.0;
+
+				sampleClocks(portLibrary, &tsc, &hires);
+				expected = (double)baseHires + ((double)(int64_t)(tsc - baseTSC) * hiresFrequency / frequency);
+				drift = (expected > (double)hires) ? (expected - (double)hires) : ((double)hires - expected);
+				if (drift > tolerance) {
+					result = "TSC is not synchronized between CPUs";
+				}
+			}
+		}
+	}
+
+	sched_setaffinity(0, sizeof(originalSet), &originalSet);
+	return result;
+}
+
+/**
+ * The kernel stops using the TSC as its clocksource when its watchdog finds
+ * the TSC unreliable, so don't trust it either in that case.
+ *
+ * @param[in] portLibrary The port library.
+ *
+ * @return TRUE unless the kernel clocksource is known to be something other than the TSC.
+ */
+static BOOLEAN
+kernelUsesTSC(struct OMRPortLibrary *portLibrary)
+{
+	BOOLEAN result = TRUE;
+	intptr_t fd = portLibrary->file_open(portLibrary, "/sys/devices/system/clocksource/clocksource0/current_clocksource", EsOpenRead, 0);
+
+	if (-1 != fd) {
+		char buffer[32];
+		intptr_t bytesRead = portLibrary->file_read(portLibrary, fd, buffer, sizeof(buffer) - 1);
+
+		if (bytesRead > 0) {
+			buffer[bytesRead] = '\0';
+			result = (0 == strncmp(buffer, "tsc", 3)) && (('\n' == buffer[3]) || ('\0' == buffer[3]));
+		}
+		portLibrary->file_close(portLibrary, fd);
+	}
+	return result;
+}
+#endif /* defined(LINUX) */
+
+/**
+ * Check for and calibrate the invariant TSC.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[out] frequency TSC ticks per second
+ *
+ * @return NULL on success, otherwise the reason the TSC can't be used.
+ */
+static const char *
+setupTSC(struct OMRPortLibrary *portLibrary, double *frequency)
+{
+	uint32_t cpuInfo[4] = {0};
+	uint64_t tsc = 0;
+	uint64_t hires = 0;
+	const char *result = NULL;
+
+	omrsysinfo_get_x86_cpuid(OMRTIME_CPUID_MAX_EXTENDED_LEAF, cpuInfo);
+	if (cpuInfo[0] < OMRTIME_CPUID_ADVANCED_POWER_MANAGEMENT) {
+		return "processor does not report an invariant TSC";
+	}
+	omrsysinfo_get_x86_cpuid(OMRTIME_CPUID_ADVANCED_POWER_MANAGEMENT, cpuInfo);
+	if (OMRTIME_CPUID_INVARIANT_TSC != (cpuInfo[3] & OMRTIME_CPUID_INVARIANT_TSC)) {
+		return "processor does not report an invariant TSC";
+	}
+#if defined(LINUX)
+	if (!kernelUsesTSC(portLibrary)) {
+		return "kernel clocksource is not the TSC";
+	}
+#endif /* defined(LINUX) */
+
+	result = calibrateTSC(portLibrary, frequency, &tsc, &hires);
+#if defined(LINUX)
+	if (NULL == result) {
+		result = checkTSCDrift(portLibrary, *frequency, tsc, hires);
+	}
+#endif /* defined(LINUX) */
+	return result;
+}
+#endif /* defined(OMRTIME_TSC_SUPPORTED) */
+
+/**
+ * Select the source of the tick clock. Called through omrport_control with
+ * OMRPORT_CTLDATA_TIME_TICK_SOURCE.
+ *
+ * Tick values read before the source changes must not be compared with
+ * values read afterwards, so the source should be chosen during startup.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] source OMRPORT_TIME_TICK_SOURCE_HIRES or OMRPORT_TIME_TICK_SOURCE_TSC
+ *
+ * @return 0 if the requested source is in use, 1 if the high-resolution clock
+ * is used instead.
+ */
+int32_t
+omrtime_set_tick_source(struct OMRPortLibrary *portLibrary, uintptr_t source)
+{
+	J9TimeTickData *ticks = &portLibrary->portGlobals->timeTicks;
+	int32_t rc = 1;
+
+	if (OMRPORT_TIME_TICK_SOURCE_HIRES == source) {
+		ticks->source = OMRPORT_TIME_TICK_SOURCE_HIRES;
+		rc = 0;
+	} else if (OMRPORT_TIME_TICK_SOURCE_TSC == source) {
+		if (OMRPORT_TIME_TICK_SOURCE_TSC == ticks->source) {
+			rc = 0;
+		} else {
+#if defined(OMRTIME_TSC_SUPPORTED)
+			double frequency = 0.0;
+			const char *reason = setupTSC(portLibrary, &frequency);
+
+			if (NULL == reason) {
+				double nanosPerTick = (double)OMRPORT_TIME_DELTA_IN_NANOSECONDS / frequency;
+				uint32_t shift = 32;
+
+				/* Keep the multiplier below 2^32 so the low half of a delta can be scaled in 64 bits */
+				while ((shift > 0) && ((nanosPerTick * (double)((uint64_t)1 << shift)) >= 4294967296.0)) {
+					shift -= 1;
+				}
+				ticks->tscFrequency = (uint64_t)(frequency + 0.5);
+				ticks->nanosShift = shift;
+				ticks->nanosMultiplier = (uint64_t)((nanosPerTick * (double)((uint64_t)1 << shift)) + 0.5);
+				ticks->source = OMRPORT_TIME_TICK_SOURCE_TSC;
+				Trc_PRT_time_tick_source_tsc(ticks->tscFrequency);
+				rc = 0;
+			} else {
+				Trc_PRT_time_tick_source_tsc_unavailable(reason);
+			}
+#else /* defined(OMRTIME_TSC_SUPPORTED) */
+			Trc_PRT_time_tick_source_tsc_unavailable("no TSC support on this platform");
+#endif /* defined(OMRTIME_TSC_SUPPORTED) */
+		}
+	}
+	return rc;
+}
+
+/**
+ * Read the tick clock.
+ *
+ * The tick clock is meant for timing intervals on hot paths: reading it is
+ * as cheap as the platform allows, and ticks are converted to time units only
+ * when needed, with @ref omrtime_tick_delta. Ticks are not related to any
+ * epoch and may differ between processes.
+ *
+ * @param[in] portLibrary The port library.
+ *
+ * @return the current tick count.
+ */
+uint64_t
+omrtime_tick_clock(struct OMRPortLibrary *portLibrary)
+{
+#if defined(OMRTIME_TSC_SUPPORTED)
+	if (OMRPORT_TIME_TICK_SOURCE_TSC == portLibrary->portGlobals->timeTicks.source) {
+		return readTSC();
+	}
+#endif /* defined(OMRTIME_TSC_SUPPORTED) */
+	return portLibrary->time_hires_clock(portLibrary);
+}
+
+/**
+ * Retrieve the frequency of the tick clock.
+ *
+ * @param[in] portLibrary The port library.
+ *
+ * @return number of ticks per second.
+ */
+uint64_t
+omrtime_tick_frequency(struct OMRPortLibrary *portLibrary)
+{
+#if defined(OMRTIME_TSC_SUPPORTED)
+	if (OMRPORT_TIME_TICK_SOURCE_TSC == portLibrary->portGlobals->timeTicks.source) {
+		return portLibrary->portGlobals->timeTicks.tscFrequency;
+	}
+#endif /* defined(OMRTIME_TSC_SUPPORTED) */
+	return portLibrary->time_hires_frequency(portLibrary);
+}
+
+/**
+ * Calculate the time between two tick clock values @ref omrtime_tick_clock.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] startTicks Tick value at start of timing interval
+ * @param[in] endTicks Tick value at end of timing interval
+ * @param[in] requiredResolution Returned time resolution as a fraction of a second,
+ * see @ref omrtime_hires_delta.
+ *
+ * @return time difference in the required resolution.
+ */
+uint64_t
+omrtime_tick_delta(struct OMRPortLibrary *portLibrary, uint64_t startTicks, uint64_t endTicks, uint64_t requiredResolution)
+{
+#if defined(OMRTIME_TSC_SUPPORTED)
+	J9TimeTickData *ticks = &portLibrary->portGlobals->timeTicks;
+
+	if (OMRPORT_TIME_TICK_SOURCE_TSC == ticks->source) {
+		uint64_t delta = endTicks - startTicks;
+
+		if ((0 != requiredResolution) && (0 == (OMRPORT_TIME_DELTA_IN_NANOSECONDS % requiredResolution))) {
+			/* Fixed point conversion, done in two halves to avoid overflow */
+			uint64_t nanos = (((delta >> 32) * ticks->nanosMultiplier) << (32 - ticks->nanosShift))
+					+ (((delta & 0xFFFFFFFF) * ticks->nanosMultiplier) >> ticks->nanosShift);
+
+			return nanos / (OMRPORT_TIME_DELTA_IN_NANOSECONDS / requiredResolution);
+		}
+		return (uint64_t)((double)delta * ((double)requiredResolution / (double)ticks->tscFrequency));
+	}
+#endif /* defined(OMRTIME_TSC_SUPPORTED) */
+	return portLibrary->time_hires_delta(portLibrary, startTicks, endTicks, requiredResolution);
+}
+
+/**
+ * Report which clock the tick clock reads.
+ *
+ * @param[in] portLibrary The port library.
+ *
+ * @return OMRPORT_TIME_TICK_SOURCE_HIRES or OMRPORT_TIME_TICK_SOURCE_TSC.
+ */
+int32_t
+omrtime_tick_source(struct OMRPortLibrary *portLibrary)
+{
+	return (int32_t)portLibrary->portGlobals->timeTicks.source;
+}
@@ -62,7 +62,10 @@ omrport_tls_get(struct OMRPortLibrary *portLibrary)
 	if (NULL == ptBuffers) {
 		MUTEX_ENTER(portLibrary->portGlobals->tls_mutex);
 
+		/* The allocation below must not try to create this buffer for the memory thread cache */
+		portLibrary->portGlobals->tls_creator = omrthread_self();
 		ptBuffers = portLibrary->mem_allocate_memory(portLibrary, sizeof(PortlibPTBuffers_struct), OMR_GET_CALLSITE(), OMRMEM_CATEGORY_PORT_LIBRARY);
+		portLibrary->portGlobals->tls_creator = NULL;
 		if (NULL != ptBuffers) {
 			if (0 == omrthread_tls_set(omrthread_self(), portLibrary->portGlobals->tls_key, ptBuffers)) {
 #if defined(J9VM_PROVIDE_ICONV)
@@ -165,6 +168,10 @@ omrport_tls_shutdown(struct OMRPortLibrary *portLibrary)
 	if (NULL != portLibrary->portGlobals) {
 		PortlibPTBuffers_t ptBuffers, next;
 
+		/* Stop using the thread caches in the buffers being freed */
+		portLibrary->portGlobals->memThreadCacheEnabled = 0;
+		portLibrary->portGlobals->memThreadCacheUsed = 0;
+
 		/* Free all remaining buffer sets */
 		MUTEX_ENTER(portLibrary->portGlobals->tls_mutex);
 		ptBuffers = portLibrary->portGlobals->buffer_list;
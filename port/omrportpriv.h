@@ -108,6 +108,16 @@ typedef struct J9CudaGlobalData {
 } J9CudaGlobalData;
 #endif /* OMR_OPT_CUDA */
 
+/**
+ * @brief State of the tick clock, see OMRPORT_CTLDATA_TIME_TICK_SOURCE.
+ */
+typedef struct J9TimeTickData {
+	uintptr_t source; /**< OMRPORT_TIME_TICK_SOURCE_HIRES or OMRPORT_TIME_TICK_SOURCE_TSC */
+	uint64_t tscFrequency; /**< calibrated TSC ticks per second */
+	uint64_t nanosMultiplier; /**< nanoseconds per TSC tick, scaled by 2^nanosShift */
+	uint32_t nanosShift;
+} J9TimeTickData;
+
 /* these port library globals are initialized to zero in omrmem_startup_basic */
 typedef struct OMRPortLibraryGlobalData {
 	void *corruptedMemoryBlock;
@@ -117,6 +127,7 @@ typedef struct OMRPortLibraryGlobalData {
 	omrthread_tls_key_t socketTlsKey;
 	MUTEX tls_mutex;
 	void *buffer_list;
+	omrthread_t tls_creator;						/* Thread allocating its per thread buffer in omrport_tls_get */
 	void *procSelfMap;
 	struct OMRPortPlatformGlobals platformGlobals;
 	OMRMemCategory unknownMemoryCategory;
@@ -125,6 +136,10 @@ typedef struct OMRPortLibraryGlobalData {
 #if defined(OMR_ENV_DATA64)
 	OMRMemCategory unusedAllocate32HeapRegionsMemoryCategory;
 #endif
+	uintptr_t memThreadCacheEnabled;				/* Use the per thread allocation cache, see OMRPORT_CTLDATA_MEM_THREAD_CACHE */
+	uintptr_t memThreadCacheUsed;					/* Set once the per thread allocation cache has been enabled */
+	volatile uintptr_t memThreadCacheGeneration;	/* Bumped to make every thread flush its allocation cache on next use */
+	uintptr_t memTagCheckInterval;					/* Check the footer and padding of every nth block freed through the cache, see OMRPORT_CTLDATA_MEM_TAG_CHECK_INTERVAL */
 	uintptr_t vmemAdviseOSonFree;					/** For softmx to determine whether OS should be advised of freed vmem */
 	uintptr_t vectorRegsSupportOn;				/* Turn on vector regs support */
 	uintptr_t userSpecifiedCPUs;						/* Number of user-specified CPUs */
@@ -134,6 +149,7 @@ typedef struct OMRPortLibraryGlobalData {
 	uintptr_t vmemEnableMadvise;					/* madvise to use Transparent HugePage (THP) for Virtual memory allocated by mmap */
 	J9SysinfoCPUTime oldestCPUTime;
 	J9SysinfoCPUTime latestCPUTime;
+	J9TimeTickData timeTicks;
 } OMRPortLibraryGlobalData;
 
 /* J9SourceJ9CPUControl*/
@@ -241,6 +257,28 @@ extern J9_CFUNC intptr_t
 omrfile_convert_native_fd_to_omrfile_fd(struct OMRPortLibrary *portLibrary, intptr_t nativeFD);
 extern J9_CFUNC intptr_t
 omrfile_convert_omrfile_fd_to_native_fd(struct OMRPortLibrary *portLibrary, intptr_t nativeFD);
+extern J9_CFUNC intptr_t
+omrfile_pread(struct OMRPortLibrary *portLibrary, intptr_t fd, void *buf, intptr_t nbytes, int64_t offset);
+extern J9_CFUNC intptr_t
+omrfile_pwrite(struct OMRPortLibrary *portLibrary, intptr_t fd, const void *buf, intptr_t nbytes, int64_t offset);
+extern J9_CFUNC intptr_t
+omrfile_readv(struct OMRPortLibrary *portLibrary, intptr_t fd, const struct OMRFileIOVec *iov, int32_t iovcnt, int64_t offset);
+extern J9_CFUNC intptr_t
+omrfile_writev(struct OMRPortLibrary *portLibrary, intptr_t fd, const struct OMRFileIOVec *iov, int32_t iovcnt, int64_t offset);
+extern J9_CFUNC int32_t
+omrfile_preallocate(struct OMRPortLibrary *portLibrary, intptr_t fd, int64_t offset, int64_t length);
+extern J9_CFUNC int32_t
+omrfile_advise(struct OMRPortLibrary *portLibrary, intptr_t fd, int64_t offset, int64_t length, int32_t advice);
+
+/* J9SourceJ9FileAIO*/
+extern J9_CFUNC int32_t
+omrfile_aio_context_create(struct OMRPortLibrary *portLibrary, uint32_t queueDepth, uint32_t flags, struct OMRFileAIOContext **context);
+extern J9_CFUNC void
+omrfile_aio_context_destroy(struct OMRPortLibrary *portLibrary, struct OMRFileAIOContext *context);
+extern J9_CFUNC intptr_t
+omrfile_aio_submit(struct OMRPortLibrary *portLibrary, struct OMRFileAIOContext *context, struct OMRFileAIORequest **requests, uintptr_t count);
+extern J9_CFUNC intptr_t
+omrfile_aio_complete(struct OMRPortLibrary *portLibrary, struct OMRFileAIOContext *context, uintptr_t minComplete, int64_t timeoutMillis);
 
 /* J9SourceJ9File_BlockingAsyncText*/
 extern J9_CFUNC int32_t
@@ -354,6 +392,8 @@ extern J9_CFUNC void
 omrmem_free_memory32(struct OMRPortLibrary *portLibrary, void *memoryPointer);
 extern J9_CFUNC uintptr_t
 omrmem_ensure_capacity32(struct OMRPortLibrary *portLibrary, uintptr_t byteAmount);
+extern J9_CFUNC void
+omrmem_invalidate_thread_caches(struct OMRPortLibrary *portLibrary);
 
 /* omrmemcategories.c */
 extern J9_CFUNC OMRMemCategory *
@@ -817,6 +857,24 @@ extern J9_CFUNC int32_t
 omrsock_getsockopt_linger(struct OMRPortLibrary *portLibrary, omrsock_socket_t handle, int32_t optlevel, int32_t optname, omrsock_linger_t optval);
 extern J9_CFUNC int32_t
 omrsock_getsockopt_timeval(struct OMRPortLibrary *portLibrary, omrsock_socket_t handle, int32_t optlevel, int32_t optname, omrsock_timeval_t optval);
+extern J9_CFUNC int32_t
+omrsock_eventset_create(struct OMRPortLibrary *portLibrary, omrsock_eventset_t *eventSet);
+extern J9_CFUNC int32_t
+omrsock_eventset_add(struct OMRPortLibrary *portLibrary, omrsock_eventset_t eventSet, omrsock_socket_t sock, int16_t events, void *userData);
+extern J9_CFUNC int32_t
+omrsock_eventset_modify(struct OMRPortLibrary *portLibrary, omrsock_eventset_t eventSet, omrsock_socket_t sock, int16_t events, void *userData);
+extern J9_CFUNC int32_t
+omrsock_eventset_remove(struct OMRPortLibrary *portLibrary, omrsock_eventset_t eventSet, omrsock_socket_t sock);
+extern J9_CFUNC int32_t
+omrsock_eventset_wait(struct OMRPortLibrary *portLibrary, omrsock_eventset_t eventSet, omrsock_event_t events, uint32_t maxEvents, int32_t timeoutMs);
+extern J9_CFUNC int32_t
+omrsock_get_event_info(struct OMRPortLibrary *portLibrary, omrsock_event_t handle, omrsock_socket_t *sock, void **userData, int16_t *revents);
+extern J9_CFUNC int32_t
+omrsock_eventset_destroy(struct OMRPortLibrary *portLibrary, omrsock_eventset_t *eventSet);
+extern J9_CFUNC intptr_t
+omrsock_sendfile(struct OMRPortLibrary *portLibrary, omrsock_socket_t sock, intptr_t fd, int64_t *offset, uintptr_t count);
+extern J9_CFUNC int32_t
+omrsock_splice(struct OMRPortLibrary *portLibrary, omrsock_socket_t fromSock, omrsock_socket_t toSock, int32_t nbyte);
 
 /* J9SourceJ9Str*/
 extern J9_CFUNC uintptr_t
@@ -870,6 +928,18 @@ omrtime_msec_clock(struct OMRPortLibrary *portLibrary);
 extern J9_CFUNC uint64_t
 omrtime_current_time_nanos(struct OMRPortLibrary *portLibrary, uintptr_t *success);
 
+/* J9SourceJ9TimeTicks*/
+extern J9_CFUNC uint64_t
+omrtime_tick_clock(struct OMRPortLibrary *portLibrary);
+extern J9_CFUNC uint64_t
+omrtime_tick_frequency(struct OMRPortLibrary *portLibrary);
+extern J9_CFUNC uint64_t
+omrtime_tick_delta(struct OMRPortLibrary *portLibrary, uint64_t startTicks, uint64_t endTicks, uint64_t requiredResolution);
+extern J9_CFUNC int32_t
+omrtime_tick_source(struct OMRPortLibrary *portLibrary);
+extern J9_CFUNC int32_t
+omrtime_set_tick_source(struct OMRPortLibrary *portLibrary, uintptr_t source);
+
 /* J9SourceJ9TTY*/
 extern J9_CFUNC void
 omrtty_shutdown(struct OMRPortLibrary *portLibrary);
@@ -117,6 +117,7 @@ ifneq (win,$(OMR_HOST_OS))
 endif
 
 OBJECTS += omrfile_blockingasync
+OBJECTS += omrfile_aio
 
 ifeq (win,$(OMR_HOST_OS))
   OBJECTS += omrfilehelpers
@@ -158,6 +159,7 @@ ifeq (win,$(OMR_HOST_OS))
   OBJECTS += omrsyslogmessages.res
 endif
 OBJECTS += omrtime
+OBJECTS += omrtimeticks
 OBJECTS += omrtlshelpers
 OBJECTS += omrtty
 OBJECTS += omrvmem
@@ -26,10 +26,17 @@
  * @brief file
  */
 
+#if defined(LINUX) && !defined(_GNU_SOURCE)
+/* _GNU_SOURCE exposes O_DIRECT */
+#define _GNU_SOURCE
+#endif /* defined(LINUX) && !defined(_GNU_SOURCE) */
+
+#include <limits.h>
 #include <stdlib.h>
 #include <stdio.h>
 #include <unistd.h>
 #include <sys/types.h>
+#include <sys/uio.h>
 #if defined(LINUX) && !defined(OMRZTPF)
 #include <sys/vfs.h>
 #elif defined(OSX)
@@ -99,6 +106,11 @@ EsTranslateOpenFlags(int32_t flags)
 		realFlags |= O_SYNC;
 	}
 #endif
+#if defined(O_DIRECT)
+	if (flags & EsOpenDirect) {
+		realFlags |= O_DIRECT;
+	}
+#endif /* defined(O_DIRECT) */
 	if (flags & EsOpenRead) {
 		if (flags & EsOpenWrite) {
 			return (O_RDWR | realFlags);
@@ -368,6 +380,13 @@ omrfile_open(struct OMRPortLibrary *portLibrary, const char *path, int32_t flags
 	fdflags = fcntl(fd, F_GETFD, 0);
 	fcntl(fd, F_SETFD, fdflags | FD_CLOEXEC);
 
+#if defined(OSX)
+	/* OSX has no O_DIRECT; turning off caching on the descriptor is the equivalent */
+	if (flags & EsOpenDirect) {
+		fcntl(fd, F_NOCACHE, 1);
+	}
+#endif /* defined(OSX) */
+
 	fd += FD_BIAS;
 	Trc_PRT_file_open_Exit(fd);
 	return (intptr_t) fd;
@@ -1277,3 +1296,398 @@ omrfile_convert_omrfile_fd_to_native_fd(struct OMRPortLibrary *portLibrary, intp
 
 	return omrfileFD;
 }
+
+/**
+ * Read bytes from a given offset of a file without using or moving the file position,
+ * so that several threads may read the same file descriptor concurrently.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] fd The file descriptor.
+ * @param[in,out] buf Buffer to read into.
+ * @param[in] nbytes Size of buffer.
+ * @param[in] offset Offset in the file of the first byte to read.
+ *
+ * @return The number of bytes read, or -1 on failure or at end of file.
+ */
+intptr_t
+omrfile_pread(struct OMRPortLibrary *portLibrary, intptr_t inFD, void *buf, intptr_t nbytes, int64_t offset)
+{
+	int fd = (int)inFD;
+	intptr_t result = 0;
+
+	Trc_PRT_file_pread_Entry(fd, buf, nbytes, offset);
+
+	if (0 == nbytes) {
+		Trc_PRT_file_pread_Exit(0);
+		return 0;
+	}
+
+	do {
+		result = pread(fd - FD_BIAS, buf, nbytes, (off_t)offset);
+	} while ((-1 == result) && (EINTR == errno));
+
+	if (-1 == result) {
+		portLibrary->error_set_last_error(portLibrary, errno, findError(errno));
+	} else if (0 == result) {
+		portLibrary->error_set_last_error(portLibrary, 0, findError(0));
+		result = -1;
+	}
+
+	Trc_PRT_file_pread_Exit(result);
+	return result;
+}
+
+/**
+ * Write bytes at a given offset of a file without using or moving the file position,
+ * so that several threads may write the same file descriptor concurrently.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] fd The file descriptor.
+ * @param[in] buf Buffer to be written.
+ * @param[in] nbytes Size of buffer.
+ * @param[in] offset Offset in the file of the first byte to write.
+ *
+ * @return Number of bytes written on success, portable error return code (which is negative) on failure.
+ *
+ * @note On files opened with EsOpenAppend the data may be appended instead, as it is by pwrite(2) on Linux.
+ */
+intptr_t
+omrfile_pwrite(struct OMRPortLibrary *portLibrary, intptr_t inFD, const void *buf, intptr_t nbytes, int64_t offset)
+{
+	int fd = (int)inFD;
+	intptr_t result = 0;
+
+	Trc_PRT_file_pwrite_Entry(fd, buf, nbytes, offset);
+
+	do {
+		result = pwrite(fd - FD_BIAS, buf, nbytes, (off_t)offset);
+	} while ((-1 == result) && (EINTR == errno));
+
+	if (-1 == result) {
+		result = portLibrary->error_set_last_error(portLibrary, errno, findError(errno));
+	}
+
+	Trc_PRT_file_pwrite_Exit(result);
+	return result;
+}
+
+#define OMRFILE_IOV_ON_STACK 16
+
+/**
+ * @internal
+ * Convert OMRFileIOVec entries to struct iovec, using the caller's stack array when it is large enough.
+ *
+ * @return the converted array, or NULL if it could not be allocated
+ */
+static struct iovec *
+toNativeIOVec(struct OMRPortLibrary *portLibrary, const struct OMRFileIOVec *iov, int32_t iovcnt, struct iovec *stackIOV)
+{
+	struct iovec *nativeIOV = stackIOV;
+	int32_t i = 0;
+
+	if (iovcnt > OMRFILE_IOV_ON_STACK) {
+		nativeIOV = (struct iovec *)portLibrary->mem_allocate_memory(portLibrary, iovcnt * sizeof(struct iovec), OMR_GET_CALLSITE(), OMRMEM_CATEGORY_PORT_LIBRARY);
+		if (NULL == nativeIOV) {
+			return NULL;
+		}
+	}
+	for (i = 0; i < iovcnt; i++) {
+		nativeIOV[i].iov_base = iov[i].base;
+		nativeIOV[i].iov_len = (size_t)iov[i].length;
+	}
+	return nativeIOV;
+}
+
+#if !defined(LINUX) || defined(OMRZTPF)
+/**
+ * @internal
+ * Positional vectored I/O for systems without preadv/pwritev: transfer the buffers one at a
+ * time, stopping at the first short transfer.
+ */
+static ssize_t
+positionalIOVec(int fd, struct iovec *iov, int iovcnt, off_t offset, BOOLEAN isWrite)
+{
+	ssize_t total = 0;
+	int i = 0;
+
+	for (i = 0; i < iovcnt; i++) {
+		ssize_t done = 0;
+
+		if (isWrite) {
+			done = pwrite(fd, iov[i].iov_base, iov[i].iov_len, offset + total);
+		} else {
+			done = pread(fd, iov[i].iov_base, iov[i].iov_len, offset + total);
+		}
+		if (-1 == done) {
+			return (0 == total) ? -1 : total;
+		}
+		total += done;
+		if ((size_t)done < iov[i].iov_len) {
+			break;
+		}
+	}
+	return total;
+}
+#endif /* !defined(LINUX) || defined(OMRZTPF) */
+
+/**
+ * Read from a file into several buffers with a single call, filling each buffer before the next.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] fd The file descriptor.
+ * @param[in] iov The buffers to read into.
+ * @param[in] iovcnt The number of buffers.
+ * @param[in] offset Offset in the file of the first byte to read, or OMRPORT_FILE_CURRENT_POSITION
+ * to read from and advance the file position.
+ *
+ * @return The total number of bytes read, or -1 on failure or at end of file.
+ */
+intptr_t
+omrfile_readv(struct OMRPortLibrary *portLibrary, intptr_t inFD, const struct OMRFileIOVec *iov, int32_t iovcnt, int64_t offset)
+{
+	int fd = (int)inFD - FD_BIAS;
+	struct iovec stackIOV[OMRFILE_IOV_ON_STACK];
+	struct iovec *nativeIOV = NULL;
+	intptr_t result = 0;
+
+	Trc_PRT_file_readv_Entry(inFD, iov, iovcnt, offset);
+
+	nativeIOV = toNativeIOVec(portLibrary, iov, iovcnt, stackIOV);
+	if (NULL == nativeIOV) {
+		result = portLibrary->error_set_last_error(portLibrary, ENOMEM, OMRPORT_ERROR_FILE_OPFAILED);
+		Trc_PRT_file_readv_Exit(result);
+		return -1;
+	}
+
+	do {
+		if (OMRPORT_FILE_CURRENT_POSITION == offset) {
+			result = readv(fd, nativeIOV, iovcnt);
+		} else {
+#if defined(LINUX) && !defined(OMRZTPF)
+			result = preadv(fd, nativeIOV, iovcnt, (off_t)offset);
+#else /* defined(LINUX) && !defined(OMRZTPF) */
+			result = positionalIOVec(fd, nativeIOV, iovcnt, (off_t)offset, FALSE);
+#endif /* defined(LINUX) && !defined(OMRZTPF) */
+		}
+	} while ((-1 == result) && (EINTR == errno));
+
+	if (-1 == result) {
+		portLibrary->error_set_last_error(portLibrary, errno, findError(errno));
+	} else if ((0 == result) && (iovcnt > 0)) {
+		portLibrary->error_set_last_error(portLibrary, 0, findError(0));
+		result = -1;
+	}
+
+	if (stackIOV != nativeIOV) {
+		portLibrary->mem_free_memory(portLibrary, nativeIOV);
+	}
+
+	Trc_PRT_file_readv_Exit(result);
+	return result;
+}
+
+/**
+ * Write several buffers to a file with a single call, so that the data of one call is
+ * not interleaved with that of other threads writing the same file.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] fd The file descriptor.
+ * @param[in] iov The buffers to write.
+ * @param[in] iovcnt The number of buffers.
+ * @param[in] offset Offset in the file of the first byte to write, or OMRPORT_FILE_CURRENT_POSITION
+ * to write at and advance the file position.
+ *
+ * @return The total number of bytes written on success, portable error return code (which is negative) on failure.
+ */
+intptr_t
+omrfile_writev(struct OMRPortLibrary *portLibrary, intptr_t inFD, const struct OMRFileIOVec *iov, int32_t iovcnt, int64_t offset)
+{
+	int fd = (int)inFD - FD_BIAS;
+	struct iovec stackIOV[OMRFILE_IOV_ON_STACK];
+	struct iovec *nativeIOV = NULL;
+	intptr_t result = 0;
+
+	Trc_PRT_file_writev_Entry(inFD, iov, iovcnt, offset);
+
+	nativeIOV = toNativeIOVec(portLibrary, iov, iovcnt, stackIOV);
+	if (NULL == nativeIOV) {
+		result = portLibrary->error_set_last_error(portLibrary, ENOMEM, OMRPORT_ERROR_FILE_OPFAILED);
+		Trc_PRT_file_writev_Exit(result);
+		return result;
+	}
+
+	do {
+		if (OMRPORT_FILE_CURRENT_POSITION == offset) {
+			result = writev(fd, nativeIOV, iovcnt);
+		} else {
+#if defined(LINUX) && !defined(OMRZTPF)
+			result = pwritev(fd, nativeIOV, iovcnt, (off_t)offset);
+#else /* defined(LINUX) && !defined(OMRZTPF) */
+			result = positionalIOVec(fd, nativeIOV, iovcnt, (off_t)offset, TRUE);
+#endif /* defined(LINUX) && !defined(OMRZTPF) */
+		}
+	} while ((-1 == result) && (EINTR == errno));
+
+	if (-1 == result) {
+		result = portLibrary->error_set_last_error(portLibrary, errno, findError(errno));
+	}
+
+	if (stackIOV != nativeIOV) {
+		portLibrary->mem_free_memory(portLibrary, nativeIOV);
+	}
+
+	Trc_PRT_file_writev_Exit(result);
+	return result;
+}
+
+/**
+ * Reserve disk space for a range of a file, extending the file if the range ends beyond it,
+ * so that later writes to the range do not fail for lack of space or fragment the file.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] fd The file descriptor.
+ * @param[in] offset Start of the range.
+ * @param[in] length Length of the range.
+ *
+ * @return 0 on success, negative portable error code on failure.
+ *
+ * @note Where the file system cannot reserve space the file is only extended.
+ */
+int32_t
+omrfile_preallocate(struct OMRPortLibrary *portLibrary, intptr_t inFD, int64_t offset, int64_t length)
+{
+	int fd = (int)inFD - FD_BIAS;
+	int32_t rc = 0;
+	int error = 0;
+
+	Trc_PRT_file_preallocate_Entry(inFD, offset, length);
+
+	if ((offset < 0) || (length <= 0)) {
+		rc = portLibrary->error_set_last_error(portLibrary, EINVAL, findError(EINVAL));
+		Trc_PRT_file_preallocate_Exit(rc);
+		return rc;
+	}
+
+#if (defined(LINUX) && !defined(OMRZTPF)) || defined(AIXPPC)
+	do {
+		error = posix_fallocate(fd, (off_t)offset, (off_t)length);
+	} while (EINTR == error);
+	if ((EOPNOTSUPP == error) || (ENOSYS == error)) {
+		error = 0;
+	} else if (0 != error) {
+		rc = portLibrary->error_set_last_error(portLibrary, error, findError(error));
+		Trc_PRT_file_preallocate_Exit(rc);
+		return rc;
+	}
+#elif defined(OSX) /* (defined(LINUX) && !defined(OMRZTPF)) || defined(AIXPPC) */
+	{
+		fstore_t store;
+
+		memset(&store, 0, sizeof(store));
+		store.fst_flags = F_ALLOCATECONTIG;
+		store.fst_posmode = F_PEOFPOSMODE;
+		store.fst_offset = 0;
+		store.fst_length = (off_t)(offset + length);
+		if (-1 == fcntl(fd, F_PREALLOCATE, &store)) {
+			store.fst_flags = F_ALLOCATEALL;
+			/* failure to reserve space is not an error; the file is still extended below */
+			fcntl(fd, F_PREALLOCATE, &store);
+		}
+	}
+#endif /* (defined(LINUX) && !defined(OMRZTPF)) || defined(AIXPPC) */
+
+	{
+		/* posix_fallocate extends the file itself; elsewhere make sure the range is inside the file */
+		struct stat statBuf;
+
+		if (-1 == fstat(fd, &statBuf)) {
+			error = errno;
+		} else if ((int64_t)statBuf.st_size < (offset + length)) {
+			if (-1 == ftruncate(fd, (off_t)(offset + length))) {
+				error = errno;
+			}
+		}
+	}
+	if (0 != error) {
+		rc = portLibrary->error_set_last_error(portLibrary, error, findError(error));
+	}
+
+	Trc_PRT_file_preallocate_Exit(rc);
+	return rc;
+}
+
+/**
+ * Tell the operating system how a range of a file will be accessed, so that it can adjust
+ * read ahead and caching. The hint has no effect on the results of other operations.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] fd The file descriptor.
+ * @param[in] offset Start of the range.
+ * @param[in] length Length of the range, 0 for up to the end of the file.
+ * @param[in] advice One of the OMRPORT_FILE_ADVICE_* constants.
+ *
+ * @return 0 on success or where hints are not supported, negative portable error code on failure.
+ */
+int32_t
+omrfile_advise(struct OMRPortLibrary *portLibrary, intptr_t inFD, int64_t offset, int64_t length, int32_t advice)
+{
+	int fd = (int)inFD - FD_BIAS;
+	int32_t rc = 0;
+	int error = 0;
+
+	Trc_PRT_file_advise_Entry(inFD, offset, length, advice);
+
+#if (defined(LINUX) && !defined(OMRZTPF)) || defined(AIXPPC)
+	{
+		int nativeAdvice = POSIX_FADV_NORMAL;
+
+		switch (advice) {
+		case OMRPORT_FILE_ADVICE_NORMAL:
+			nativeAdvice = POSIX_FADV_NORMAL;
+			break;
+		case OMRPORT_FILE_ADVICE_SEQUENTIAL:
+			nativeAdvice = POSIX_FADV_SEQUENTIAL;
+			break;
+		case OMRPORT_FILE_ADVICE_RANDOM:
+			nativeAdvice = POSIX_FADV_RANDOM;
+			break;
+		case OMRPORT_FILE_ADVICE_WILLNEED:
+			nativeAdvice = POSIX_FADV_WILLNEED;
+			break;
+		case OMRPORT_FILE_ADVICE_DONTNEED:
+			nativeAdvice = POSIX_FADV_DONTNEED;
+			break;
+		case OMRPORT_FILE_ADVICE_NOREUSE:
+			nativeAdvice = POSIX_FADV_NOREUSE;
+			break;
+		default:
+			error = EINVAL;
+			break;
+		}
+		if (0 == error) {
+			error = posix_fadvise(fd, (off_t)offset, (off_t)length, nativeAdvice);
+		}
+	}
+#else /* (defined(LINUX) && !defined(OMRZTPF)) || defined(AIXPPC) */
+	if ((advice < OMRPORT_FILE_ADVICE_NORMAL) || (advice > OMRPORT_FILE_ADVICE_NOREUSE)) {
+		error = EINVAL;
+	}
+#if defined(OSX)
+	else if (OMRPORT_FILE_ADVICE_WILLNEED == advice) {
+		struct radvisory readAdvice;
+
+		readAdvice.ra_offset = (off_t)offset;
+		readAdvice.ra_count = (int)((0 == length) ? INT_MAX : OMR_MIN(length, INT_MAX));
+		/* read ahead is only a hint; ignore failures */
+		fcntl(fd, F_RDADVISE, &readAdvice);
+	}
+#endif /* defined(OSX) */
+#endif /* (defined(LINUX) && !defined(OMRZTPF)) || defined(AIXPPC) */
+
+	if (0 != error) {
+		rc = portLibrary->error_set_last_error(portLibrary, error, findError(error));
+	}
+
+	Trc_PRT_file_advise_Exit(rc);
+	return rc;
+}
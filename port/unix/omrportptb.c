@@ -58,6 +58,7 @@ omrport_free_ptBuffer(struct OMRPortLibrary *portLibrary, PortlibPTBuffers_t ptB
 		}
 #endif /* J9VM_PROVIDE_ICONV */
 
+		omrmem_flush_thread_cache(portLibrary, &ptBuffer->memThreadCache);
 		portLibrary->mem_free_memory(portLibrary, ptBuffer);
 	}
 }
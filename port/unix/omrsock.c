@@ -26,6 +26,11 @@
  * @brief Sockets
  */
 
+#if defined(LINUX) && !defined(_GNU_SOURCE)
+/* _GNU_SOURCE exposes splice and pipe2 */
+#define _GNU_SOURCE
+#endif /* defined(LINUX) && !defined(_GNU_SOURCE) */
+
 #include "omrcfg.h"
 #include "omrsock.h"
 
@@ -35,6 +40,10 @@
 #include <string.h> 
 #include <unistd.h>
 #include <fcntl.h>
+#if defined(LINUX)
+#include <sys/epoll.h>
+#include <sys/sendfile.h>
+#endif /* defined(LINUX) */
 
 #include "omrport.h"
 #include "omrporterror.h"
@@ -822,6 +831,7 @@ omrsock_accept(struct OMRPortLibrary *portLibrary, omrsock_socket_t serverSock,
 	}
 
 	(*sockHandle)->data = connSocketDescriptor;
+	(*sockHandle)->userData = NULL;
 	return 0;
 }
 
@@ -1270,3 +1280,568 @@ omrsock_getsockopt_timeval(struct OMRPortLibrary *portLibrary, omrsock_socket_t
 {
 	return get_opt(portLibrary, handle->data, optlevel, optname, (void*)&optval->data, sizeof(struct timeval));
 }
+
+/* Internal: event set support. */
+
+#if defined(LINUX)
+typedef struct OMRSockEventSet {
+	int epollFd;
+} OMRSockEventSet;
+
+/**
+ * @internal Map OMRSOCK event set events to epoll events.
+ *
+ * @param omrEvents The OMRSOCK events to be converted.
+ *
+ * @return epoll events.
+ */
+static uint32_t
+get_os_epoll_events(int16_t omrEvents)
+{
+	uint32_t osEvents = 0;
+
+	if (OMR_ARE_ANY_BITS_SET(omrEvents, OMRSOCK_POLLIN)) {
+		osEvents |= EPOLLIN;
+	}
+	if (OMR_ARE_ANY_BITS_SET(omrEvents, OMRSOCK_POLLOUT)) {
+		osEvents |= EPOLLOUT;
+	}
+	if (OMR_ARE_ANY_BITS_SET(omrEvents, OMRSOCK_EVENT_EDGE_TRIGGERED)) {
+		osEvents |= EPOLLET;
+	}
+	if (OMR_ARE_ANY_BITS_SET(omrEvents, OMRSOCK_EVENT_ONESHOT)) {
+		osEvents |= EPOLLONESHOT;
+	}
+	return osEvents;
+}
+
+/**
+ * @internal Map epoll events to OMRSOCK poll constants.
+ *
+ * @param osEvents The epoll events to be converted.
+ *
+ * @return OMRSOCK poll constants.
+ */
+static int16_t
+get_omr_epoll_events(uint32_t osEvents)
+{
+	int16_t omrEvents = 0;
+
+	if (OMR_ARE_ANY_BITS_SET(osEvents, EPOLLIN)) {
+		omrEvents |= OMRSOCK_POLLIN;
+	}
+	if (OMR_ARE_ANY_BITS_SET(osEvents, EPOLLOUT)) {
+		omrEvents |= OMRSOCK_POLLOUT;
+	}
+	if (OMR_ARE_ANY_BITS_SET(osEvents, EPOLLERR)) {
+		omrEvents |= OMRSOCK_POLLERR;
+	}
+	if (OMR_ARE_ANY_BITS_SET(osEvents, EPOLLHUP)) {
+		omrEvents |= OMRSOCK_POLLHUP;
+	}
+	return omrEvents;
+}
+
+/**
+ * @internal Add, modify or remove a socket in an epoll event set.
+ */
+static int32_t
+eventset_control(struct OMRPortLibrary *portLibrary, omrsock_eventset_t eventSet, int op, omrsock_socket_t sock, int16_t events)
+{
+	struct epoll_event event;
+
+	memset(&event, 0, sizeof(event));
+	event.events = get_os_epoll_events(events);
+	event.data.ptr = sock;
+	if (0 != epoll_ctl(eventSet->epollFd, op, sock->data, &event)) {
+		return portLibrary->error_set_last_error(portLibrary, errno, get_omr_error(errno));
+	}
+	return 0;
+}
+#else /* defined(LINUX) */
+typedef struct OMRSockEventSet {
+	uint32_t count;
+	uint32_t capacity;
+	/* Parallel arrays, one entry per watched socket */
+	struct pollfd *pollFds;
+	OMRSocket **sockets;
+	int16_t *events;
+} OMRSockEventSet;
+
+/**
+ * @internal Find a socket in a polled event set.
+ *
+ * @return the index of the socket, or -1 if it is not in the set.
+ */
+static int32_t
+eventset_find(omrsock_eventset_t eventSet, omrsock_socket_t sock)
+{
+	uint32_t i = 0;
+
+	for (i = 0; i < eventSet->count; i++) {
+		if (sock == eventSet->sockets[i]) {
+			return (int32_t)i;
+		}
+	}
+	return -1;
+}
+
+/**
+ * @internal Arm an entry of a polled event set.
+ */
+static void
+eventset_arm(omrsock_eventset_t eventSet, uint32_t index, omrsock_socket_t sock, int16_t events)
+{
+	eventSet->sockets[index] = sock;
+	eventSet->events[index] = events;
+	eventSet->pollFds[index].fd = sock->data;
+	eventSet->pollFds[index].events = get_os_poll_constant(events);
+	eventSet->pollFds[index].revents = 0;
+}
+#endif /* defined(LINUX) */
+
+int32_t
+omrsock_eventset_create(struct OMRPortLibrary *portLibrary, omrsock_eventset_t *eventSet)
+{
+	omrsock_eventset_t newSet = NULL;
+
+	if (NULL == eventSet) {
+		return OMRPORT_ERROR_INVALID_ARGUMENTS;
+	}
+	*eventSet = NULL;
+
+	newSet = (omrsock_eventset_t)portLibrary->mem_allocate_memory(portLibrary, sizeof(OMRSockEventSet), OMR_GET_CALLSITE(), OMRMEM_CATEGORY_PORT_LIBRARY);
+	if (NULL == newSet) {
+		return OMRPORT_ERROR_SYSTEMFULL;
+	}
+	memset(newSet, 0, sizeof(OMRSockEventSet));
+
+#if defined(LINUX)
+	newSet->epollFd = epoll_create1(EPOLL_CLOEXEC);
+	if (0 > newSet->epollFd) {
+		int32_t rc = portLibrary->error_set_last_error(portLibrary, errno, get_omr_error(errno));
+		portLibrary->mem_free_memory(portLibrary, newSet);
+		return rc;
+	}
+#endif /* defined(LINUX) */
+
+	*eventSet = newSet;
+	return 0;
+}
+
+int32_t
+omrsock_eventset_add(struct OMRPortLibrary *portLibrary, omrsock_eventset_t eventSet, omrsock_socket_t sock, int16_t events, void *userData)
+{
+	int32_t rc = 0;
+
+	if ((NULL == eventSet) || (NULL == sock)) {
+		return OMRPORT_ERROR_INVALID_ARGUMENTS;
+	}
+
+#if defined(LINUX)
+	rc = eventset_control(portLibrary, eventSet, EPOLL_CTL_ADD, sock, events);
+#else /* defined(LINUX) */
+	if (-1 != eventset_find(eventSet, sock)) {
+		return OMRPORT_ERROR_INVALID_ARGUMENTS;
+	}
+	if (eventSet->count == eventSet->capacity) {
+		uint32_t capacity = (0 == eventSet->capacity) ? 8 : (eventSet->capacity * 2);
+		uintptr_t entrySize = sizeof(struct pollfd) + sizeof(OMRSocket *) + sizeof(int16_t);
+		uint8_t *memory = portLibrary->mem_allocate_memory(portLibrary, capacity * entrySize, OMR_GET_CALLSITE(), OMRMEM_CATEGORY_PORT_LIBRARY);
+		struct pollfd *pollFds = (struct pollfd *)memory;
+		OMRSocket **sockets = (OMRSocket **)(pollFds + capacity);
+		int16_t *watched = (int16_t *)(sockets + capacity);
+
+		if (NULL == memory) {
+			return OMRPORT_ERROR_SYSTEMFULL;
+		}
+		if (0 != eventSet->count) {
+			memcpy(pollFds, eventSet->pollFds, eventSet->count * sizeof(struct pollfd));
+			memcpy(sockets, eventSet->sockets, eventSet->count * sizeof(OMRSocket *));
+			memcpy(watched, eventSet->events, eventSet->count * sizeof(int16_t));
+		}
+		portLibrary->mem_free_memory(portLibrary, eventSet->pollFds);
+		eventSet->pollFds = pollFds;
+		eventSet->sockets = sockets;
+		eventSet->events = watched;
+		eventSet->capacity = capacity;
+	}
+	eventset_arm(eventSet, eventSet->count, sock, events);
+	eventSet->count += 1;
+#endif /* defined(LINUX) */
+
+	if (0 == rc) {
+		sock->userData = userData;
+	}
+	return rc;
+}
+
+int32_t
+omrsock_eventset_modify(struct OMRPortLibrary *portLibrary, omrsock_eventset_t eventSet, omrsock_socket_t sock, int16_t events, void *userData)
+{
+	int32_t rc = 0;
+
+	if ((NULL == eventSet) || (NULL == sock)) {
+		return OMRPORT_ERROR_INVALID_ARGUMENTS;
+	}
+
+#if defined(LINUX)
+	rc = eventset_control(portLibrary, eventSet, EPOLL_CTL_MOD, sock, events);
+#else /* defined(LINUX) */
+	{
+		int32_t index = eventset_find(eventSet, sock);
+		if (-1 == index) {
+			return OMRPORT_ERROR_INVALID_ARGUMENTS;
+		}
+		eventset_arm(eventSet, (uint32_t)index, sock, events);
+	}
+#endif /* defined(LINUX) */
+
+	if (0 == rc) {
+		sock->userData = userData;
+	}
+	return rc;
+}
+
+int32_t
+omrsock_eventset_remove(struct OMRPortLibrary *portLibrary, omrsock_eventset_t eventSet, omrsock_socket_t sock)
+{
+	if ((NULL == eventSet) || (NULL == sock)) {
+		return OMRPORT_ERROR_INVALID_ARGUMENTS;
+	}
+
+#if defined(LINUX)
+	if (0 != epoll_ctl(eventSet->epollFd, EPOLL_CTL_DEL, sock->data, NULL)) {
+		return portLibrary->error_set_last_error(portLibrary, errno, get_omr_error(errno));
+	}
+#else /* defined(LINUX) */
+	{
+		int32_t index = eventset_find(eventSet, sock);
+		uint32_t last = eventSet->count - 1;
+		if (-1 == index) {
+			return OMRPORT_ERROR_INVALID_ARGUMENTS;
+		}
+		/* Move the last entry into the hole */
+		eventSet->pollFds[index] = eventSet->pollFds[last];
+		eventSet->sockets[index] = eventSet->sockets[last];
+		eventSet->events[index] = eventSet->events[last];
+		eventSet->count = last;
+	}
+#endif /* defined(LINUX) */
+
+	sock->userData = NULL;
+	return 0;
+}
+
+int32_t
+omrsock_eventset_wait(struct OMRPortLibrary *portLibrary, omrsock_eventset_t eventSet, omrsock_event_t events, uint32_t maxEvents, int32_t timeoutMs)
+{
+	int32_t numEvents = 0;
+
+	if ((NULL == eventSet) || (NULL == events) || (0 == maxEvents)) {
+		return OMRPORT_ERROR_INVALID_ARGUMENTS;
+	}
+
+#if defined(LINUX)
+	{
+#define MAX_NUM_EPOLL_EVENTS 64
+		struct epoll_event osEventsArray[MAX_NUM_EPOLL_EVENTS];
+		struct epoll_event *osEvents = osEventsArray;
+		int32_t i = 0;
+
+		if (MAX_NUM_EPOLL_EVENTS < maxEvents) {
+			osEvents = portLibrary->mem_allocate_memory(portLibrary, maxEvents * sizeof(struct epoll_event), OMR_GET_CALLSITE(), OMRMEM_CATEGORY_PORT_LIBRARY);
+			if (NULL == osEvents) {
+				return OMRPORT_ERROR_SYSTEMFULL;
+			}
+		}
+
+		numEvents = epoll_wait(eventSet->epollFd, osEvents, (int)maxEvents, timeoutMs);
+		if (0 > numEvents) {
+			numEvents = portLibrary->error_set_last_error(portLibrary, errno, get_omr_error(errno));
+		}
+		for (i = 0; i < numEvents; i++) {
+			OMRSocket *sock = (OMRSocket *)osEvents[i].data.ptr;
+			events[i].socket = sock;
+			events[i].userData = sock->userData;
+			events[i].events = get_omr_epoll_events(osEvents[i].events);
+		}
+
+		if (osEvents != osEventsArray) {
+			portLibrary->mem_free_memory(portLibrary, osEvents);
+		}
+#undef MAX_NUM_EPOLL_EVENTS
+	}
+#else /* defined(LINUX) */
+	{
+		int32_t numReady = 0;
+		uint32_t i = 0;
+
+		if (0 == eventSet->count) {
+			numReady = poll(NULL, 0, timeoutMs);
+		} else {
+			numReady = poll(eventSet->pollFds, eventSet->count, timeoutMs);
+		}
+		if (0 > numReady) {
+			return portLibrary->error_set_last_error(portLibrary, errno, get_omr_error(errno));
+		}
+		for (i = 0; (i < eventSet->count) && ((uint32_t)numEvents < maxEvents); i++) {
+			struct pollfd *pollFd = &eventSet->pollFds[i];
+			if ((0 <= pollFd->fd) && (0 != pollFd->revents)) {
+				OMRSocket *sock = eventSet->sockets[i];
+				events[numEvents].socket = sock;
+				events[numEvents].userData = sock->userData;
+				events[numEvents].events = get_omr_poll_constant(pollFd->revents);
+				numEvents += 1;
+				if (OMR_ARE_ANY_BITS_SET(eventSet->events[i], OMRSOCK_EVENT_ONESHOT)) {
+					/* Disarmed until omrsock_eventset_modify; poll ignores negative descriptors */
+					pollFd->fd = -1;
+				}
+				pollFd->revents = 0;
+			}
+		}
+	}
+#endif /* defined(LINUX) */
+
+	return numEvents;
+}
+
+int32_t
+omrsock_get_event_info(struct OMRPortLibrary *portLibrary, omrsock_event_t handle, omrsock_socket_t *sock, void **userData, int16_t *revents)
+{
+	if ((NULL == handle) || (NULL == sock) || (NULL == userData) || (NULL == revents)) {
+		return OMRPORT_ERROR_INVALID_ARGUMENTS;
+	}
+	*sock = handle->socket;
+	*userData = handle->userData;
+	*revents = handle->events;
+	return 0;
+}
+
+int32_t
+omrsock_eventset_destroy(struct OMRPortLibrary *portLibrary, omrsock_eventset_t *eventSet)
+{
+	if ((NULL == eventSet) || (NULL == *eventSet)) {
+		return OMRPORT_ERROR_INVALID_ARGUMENTS;
+	}
+
+#if defined(LINUX)
+	close((*eventSet)->epollFd);
+#else /* defined(LINUX) */
+	portLibrary->mem_free_memory(portLibrary, (*eventSet)->pollFds);
+#endif /* defined(LINUX) */
+	portLibrary->mem_free_memory(portLibrary, *eventSet);
+	*eventSet = NULL;
+
+	return 0;
+}
+
+/* Internal: zero-copy transfer support. */
+
+/* Largest transfer the kernel performs in one call */
+#define OMRSOCK_MAX_TRANSFER ((uintptr_t)0x7ffff000)
+#if !defined(LINUX)
+#define OMRSOCK_COPY_BUFFER_SIZE 16384
+#endif /* !defined(LINUX) */
+
+/**
+ * @internal Wait for a non-blocking socket to become writable.
+ *
+ * @return 0 once writable, otherwise return an error.
+ */
+static int32_t
+wait_writable(struct OMRPortLibrary *portLibrary, omrsock_socket_t sock)
+{
+	struct pollfd pollFd;
+
+	pollFd.fd = sock->data;
+	pollFd.events = POLLOUT;
+	pollFd.revents = 0;
+	while (0 > poll(&pollFd, 1, -1)) {
+		if (EINTR != errno) {
+			return portLibrary->error_set_last_error(portLibrary, errno, get_omr_error(errno));
+		}
+	}
+	return 0;
+}
+
+#if !defined(LINUX)
+/**
+ * @internal Send a whole buffer, waiting for a non-blocking socket to become writable.
+ *
+ * @return 0 once all bytes are sent, otherwise return an error.
+ */
+static int32_t
+send_all(struct OMRPortLibrary *portLibrary, omrsock_socket_t sock, uint8_t *buf, intptr_t nbyte)
+{
+	intptr_t sent = 0;
+
+	while (sent < nbyte) {
+		intptr_t rc = send(sock->data, buf + sent, nbyte - sent, 0);
+		if (0 <= rc) {
+			sent += rc;
+		} else if ((EAGAIN == errno) || (EWOULDBLOCK == errno)) {
+			int32_t waitRc = wait_writable(portLibrary, sock);
+			if (0 != waitRc) {
+				return waitRc;
+			}
+		} else if (EINTR != errno) {
+			return portLibrary->error_set_last_error(portLibrary, errno, get_omr_error(errno));
+		}
+	}
+	return 0;
+}
+#endif /* !defined(LINUX) */
+
+intptr_t
+omrsock_sendfile(struct OMRPortLibrary *portLibrary, omrsock_socket_t sock, intptr_t fd, int64_t *offset, uintptr_t count)
+{
+	intptr_t bytesSent = 0;
+
+	if ((NULL == sock) || (0 > fd) || ((NULL != offset) && (0 > *offset))) {
+		return OMRPORT_ERROR_INVALID_ARGUMENTS;
+	}
+	count = OMR_MIN(count, OMRSOCK_MAX_TRANSFER);
+
+#if defined(LINUX)
+	{
+		int nativeFd = (int)portLibrary->file_convert_omrfile_fd_to_native_fd(portLibrary, fd);
+		off_t fileOffset = 0;
+
+		if (NULL != offset) {
+			fileOffset = (off_t)*offset;
+			bytesSent = sendfile(sock->data, nativeFd, &fileOffset, count);
+		} else {
+			bytesSent = sendfile(sock->data, nativeFd, NULL, count);
+		}
+		if (0 > bytesSent) {
+			return portLibrary->error_set_last_error(portLibrary, errno, get_omr_error(errno));
+		}
+		if (NULL != offset) {
+			*offset = (int64_t)fileOffset;
+		}
+	}
+#else /* defined(LINUX) */
+	{
+		uint8_t buffer[OMRSOCK_COPY_BUFFER_SIZE];
+
+		while ((uintptr_t)bytesSent < count) {
+			intptr_t chunk = (intptr_t)OMR_MIN(count - bytesSent, sizeof(buffer));
+			intptr_t bytesRead = 0;
+			int32_t rc = 0;
+
+			if (NULL != offset) {
+				bytesRead = portLibrary->file_pread(portLibrary, fd, buffer, chunk, *offset);
+			} else {
+				bytesRead = portLibrary->file_read(portLibrary, fd, buffer, chunk);
+			}
+			if (0 >= bytesRead) {
+				/* End of file, or a read error after some data was sent */
+				if ((0 > bytesRead) && (0 == bytesSent)) {
+					return bytesRead;
+				}
+				break;
+			}
+			rc = send_all(portLibrary, sock, buffer, bytesRead);
+			if (0 != rc) {
+				if (NULL == offset) {
+					portLibrary->file_seek(portLibrary, fd, -bytesRead, EsSeekCur);
+				}
+				return (0 == bytesSent) ? rc : bytesSent;
+			}
+			bytesSent += bytesRead;
+			if (NULL != offset) {
+				*offset += bytesRead;
+			}
+		}
+	}
+#endif /* defined(LINUX) */
+
+	return bytesSent;
+}
+
+#if defined(LINUX)
+/**
+ * @internal Close the per-thread splice pipe, dropping any data still in it.
+ *
+ * The next splice opens a new, empty pipe, so data that could not be delivered is
+ * never sent to another socket.
+ */
+static void
+close_splice_pipe(omrsock_ptb_t ptBuffer)
+{
+	close(ptBuffer->splicePipe[0]);
+	close(ptBuffer->splicePipe[1]);
+	ptBuffer->splicePipeOpen = FALSE;
+}
+#endif /* defined(LINUX) */
+
+int32_t
+omrsock_splice(struct OMRPortLibrary *portLibrary, omrsock_socket_t fromSock, omrsock_socket_t toSock, int32_t nbyte)
+{
+	intptr_t bytesRecv = 0;
+
+	if ((NULL == fromSock) || (NULL == toSock) || (0 >= nbyte)) {
+		return OMRPORT_ERROR_INVALID_ARGUMENTS;
+	}
+
+#if defined(LINUX)
+	{
+		omrsock_ptb_t ptBuffer = omrsock_ptb_get(portLibrary);
+		intptr_t moved = 0;
+
+		if (NULL == ptBuffer) {
+			return OMRPORT_ERROR_SOCK_PTB_FAILED;
+		}
+		if (!ptBuffer->splicePipeOpen) {
+			if (0 != pipe2(ptBuffer->splicePipe, O_CLOEXEC | O_NONBLOCK)) {
+				return portLibrary->error_set_last_error(portLibrary, errno, get_omr_error(errno));
+			}
+			ptBuffer->splicePipeOpen = TRUE;
+		}
+
+		bytesRecv = splice(fromSock->data, NULL, ptBuffer->splicePipe[1], NULL, (size_t)nbyte, SPLICE_F_MOVE);
+		if (0 > bytesRecv) {
+			return portLibrary->error_set_last_error(portLibrary, errno, get_omr_error(errno));
+		}
+
+		/* Whatever was received must leave the pipe before returning. On every error
+		 * the undelivered data is dropped along with the pipe.
+		 */
+		while (moved < bytesRecv) {
+			intptr_t rc = splice(ptBuffer->splicePipe[0], NULL, toSock->data, NULL, (size_t)(bytesRecv - moved), SPLICE_F_MOVE);
+			if (0 < rc) {
+				moved += rc;
+			} else if ((0 > rc) && ((EAGAIN == errno) || (EWOULDBLOCK == errno))) {
+				int32_t waitRc = wait_writable(portLibrary, toSock);
+				if (0 != waitRc) {
+					close_splice_pipe(ptBuffer);
+					return waitRc;
+				}
+			} else if ((0 > rc) && (EINTR == errno)) {
+				continue;
+			} else {
+				int32_t error = (0 > rc) ? errno : EPIPE;
+				close_splice_pipe(ptBuffer);
+				return portLibrary->error_set_last_error(portLibrary, error, get_omr_error(error));
+			}
+		}
+	}
+#else /* defined(LINUX) */
+	{
+		uint8_t buffer[OMRSOCK_COPY_BUFFER_SIZE];
+		int32_t rc = 0;
+
+		bytesRecv = recv(fromSock->data, buffer, OMR_MIN((uintptr_t)nbyte, sizeof(buffer)), 0);
+		if (0 > bytesRecv) {
+			return portLibrary->error_set_last_error(portLibrary, errno, get_omr_error(errno));
+		}
+		rc = send_all(portLibrary, toSock, buffer, bytesRecv);
+		if (0 != rc) {
+			return rc;
+		}
+	}
+#endif /* defined(LINUX) */
+
+	return (int32_t)bytesRecv;
+}
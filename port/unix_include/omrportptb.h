@@ -43,6 +43,7 @@
 #include "omrport.h"
 
 #include "omriconvhelpers.h"
+#include "omrmemthreadcache.h"
 
 #define J9ERROR_DEFAULT_BUFFER_SIZE 256 /**< default customized error message size if we need to create one */
 #define J9ERROR_MAXIMUM_BUFFER_SIZE 0xFFFFFFFF /**< maximum customized error message size if we need to create one */
@@ -65,6 +66,8 @@ typedef struct PortlibPTBuffers_struct {
 	char *reportedMessageBuffer; /**< last reported error message, either customized or from OS */
 	uintptr_t reportedMessageBufferSize; /**< reported message buffer size */
 
+	J9MemThreadCache memThreadCache; /**< freed small blocks and batched category counters */
+
 #if defined(J9VM_PROVIDE_ICONV)
 	iconv_t converterCache[UNCACHED_ICONV_DESCRIPTOR]; /**< Everything in J9IconvName before UNCACHED_ICONV_DESCRIPTOR is cached */
 #endif /* J9VM_PROVIDE_ICONV */
@@ -583,6 +583,10 @@ omrfile_open(struct OMRPortLibrary *portLibrary, const char *path, int32_t flags
 		flagsAndAttributes |= FILE_FLAG_OVERLAPPED;
 	}
 
+	if (flags & EsOpenDirect) {
+		flagsAndAttributes |= FILE_FLAG_NO_BUFFERING;
+	}
+
 	if (flags & EsOpenForInherit) {
 		ZeroMemory(&sAttrib, sizeof(sAttrib));
 		sAttrib.bInheritHandle = 1;
@@ -1104,3 +1108,194 @@ omrfile_convert_omrfile_fd_to_native_fd(struct OMRPortLibrary *portLibrary, intp
 {
 	return (intptr_t) toHandle(portLibrary, omrfileFD);
 }
+
+/**
+ * @internal
+ * Read or write one buffer at a file offset, or at the file pointer if offset is
+ * OMRPORT_FILE_CURRENT_POSITION.
+ *
+ * @return TRUE on success, FALSE with the Windows error available from GetLastError() on failure
+ */
+static BOOL
+transferAtOffset(HANDLE handle, void *buf, DWORD nbytes, int64_t offset, BOOL isWrite, DWORD *transferred)
+{
+	OVERLAPPED overlapped;
+	OVERLAPPED *overlappedPtr = NULL;
+
+	if (OMRPORT_FILE_CURRENT_POSITION != offset) {
+		memset(&overlapped, 0, sizeof(overlapped));
+		overlapped.Offset = (DWORD)(offset & 0xFFFFFFFF);
+		overlapped.OffsetHigh = (DWORD)(offset >> 32);
+		overlappedPtr = &overlapped;
+	}
+	if (isWrite) {
+		return WriteFile(handle, buf, nbytes, transferred, overlappedPtr);
+	}
+	return ReadFile(handle, buf, nbytes, transferred, overlappedPtr);
+}
+
+/* Positional transfers move the file pointer of synchronous handles on Windows;
+ * only the offset of each transfer is guaranteed.
+ */
+intptr_t
+omrfile_pread(struct OMRPortLibrary *portLibrary, intptr_t fd, void *buf, intptr_t nbytes, int64_t offset)
+{
+	DWORD bytesRead = 0;
+	int32_t errorCode = 0;
+
+	Trc_PRT_file_pread_Entry(fd, buf, nbytes, offset);
+
+	if (0 == nbytes) {
+		Trc_PRT_file_pread_Exit(0);
+		return 0;
+	}
+
+	if (FALSE == transferAtOffset((HANDLE)fd, buf, (DWORD)nbytes, offset, FALSE, &bytesRead)) {
+		int32_t error = GetLastError();
+		if (ERROR_HANDLE_EOF == error) {
+			errorCode = portLibrary->error_set_last_error(portLibrary, -1, OMRPORT_ERROR_FILE_READ_NO_BYTES_READ);
+		} else {
+			errorCode = portLibrary->error_set_last_error(portLibrary, error, findError(error));
+		}
+		Trc_PRT_file_pread_Exit(errorCode);
+		return -1;
+	}
+	if (0 == bytesRead) {
+		errorCode = portLibrary->error_set_last_error(portLibrary, -1, OMRPORT_ERROR_FILE_READ_NO_BYTES_READ);
+		Trc_PRT_file_pread_Exit(errorCode);
+		return -1;
+	}
+
+	Trc_PRT_file_pread_Exit(bytesRead);
+	return bytesRead;
+}
+
+intptr_t
+omrfile_pwrite(struct OMRPortLibrary *portLibrary, intptr_t fd, const void *buf, intptr_t nbytes, int64_t offset)
+{
+	DWORD bytesWritten = 0;
+	intptr_t result = 0;
+
+	Trc_PRT_file_pwrite_Entry(fd, buf, nbytes, offset);
+
+	if (FALSE == transferAtOffset((HANDLE)fd, (void *)buf, (DWORD)nbytes, offset, TRUE, &bytesWritten)) {
+		int32_t error = GetLastError();
+		result = portLibrary->error_set_last_error(portLibrary, error, findError(error));
+	} else {
+		result = bytesWritten;
+	}
+
+	Trc_PRT_file_pwrite_Exit(result);
+	return result;
+}
+
+/* Windows has no vectored I/O for ordinary handles; the buffers are transferred in turn. */
+intptr_t
+omrfile_readv(struct OMRPortLibrary *portLibrary, intptr_t fd, const struct OMRFileIOVec *iov, int32_t iovcnt, int64_t offset)
+{
+	intptr_t total = 0;
+	int32_t i = 0;
+
+	Trc_PRT_file_readv_Entry(fd, iov, iovcnt, offset);
+
+	for (i = 0; i < iovcnt; i++) {
+		DWORD bytesRead = 0;
+		int64_t position = (OMRPORT_FILE_CURRENT_POSITION == offset) ? offset : (offset + total);
+
+		if (FALSE == transferAtOffset((HANDLE)fd, iov[i].base, (DWORD)iov[i].length, position, FALSE, &bytesRead)) {
+			int32_t error = GetLastError();
+			if ((0 == total) && (ERROR_HANDLE_EOF != error)) {
+				portLibrary->error_set_last_error(portLibrary, error, findError(error));
+				Trc_PRT_file_readv_Exit(-1);
+				return -1;
+			}
+			break;
+		}
+		total += bytesRead;
+		if (bytesRead < iov[i].length) {
+			break;
+		}
+	}
+	if ((0 == total) && (iovcnt > 0)) {
+		portLibrary->error_set_last_error(portLibrary, -1, OMRPORT_ERROR_FILE_READ_NO_BYTES_READ);
+		total = -1;
+	}
+
+	Trc_PRT_file_readv_Exit(total);
+	return total;
+}
+
+intptr_t
+omrfile_writev(struct OMRPortLibrary *portLibrary, intptr_t fd, const struct OMRFileIOVec *iov, int32_t iovcnt, int64_t offset)
+{
+	intptr_t total = 0;
+	int32_t i = 0;
+
+	Trc_PRT_file_writev_Entry(fd, iov, iovcnt, offset);
+
+	for (i = 0; i < iovcnt; i++) {
+		DWORD bytesWritten = 0;
+		int64_t position = (OMRPORT_FILE_CURRENT_POSITION == offset) ? offset : (offset + total);
+
+		if (FALSE == transferAtOffset((HANDLE)fd, iov[i].base, (DWORD)iov[i].length, position, TRUE, &bytesWritten)) {
+			int32_t error = GetLastError();
+			if (0 == total) {
+				total = portLibrary->error_set_last_error(portLibrary, error, findError(error));
+			}
+			break;
+		}
+		total += bytesWritten;
+		if (bytesWritten < iov[i].length) {
+			break;
+		}
+	}
+
+	Trc_PRT_file_writev_Exit(total);
+	return total;
+}
+
+int32_t
+omrfile_preallocate(struct OMRPortLibrary *portLibrary, intptr_t fd, int64_t offset, int64_t length)
+{
+	FILE_ALLOCATION_INFO allocationInfo;
+	LARGE_INTEGER fileSize;
+	int32_t rc = 0;
+
+	Trc_PRT_file_preallocate_Entry(fd, offset, length);
+
+	if ((offset < 0) || (length <= 0)) {
+		rc = portLibrary->error_set_last_error(portLibrary, ERROR_INVALID_PARAMETER, OMRPORT_ERROR_FILE_INVAL);
+		Trc_PRT_file_preallocate_Exit(rc);
+		return rc;
+	}
+
+	/* reserving the space is only an optimization; the file is extended below either way */
+	allocationInfo.AllocationSize.QuadPart = offset + length;
+	SetFileInformationByHandle((HANDLE)fd, FileAllocationInfo, &allocationInfo, sizeof(allocationInfo));
+
+	if (FALSE == GetFileSizeEx((HANDLE)fd, &fileSize)) {
+		int32_t error = GetLastError();
+		rc = portLibrary->error_set_last_error(portLibrary, error, findError(error));
+	} else if (fileSize.QuadPart < (offset + length)) {
+		rc = omrfile_set_length(portLibrary, fd, offset + length);
+	}
+
+	Trc_PRT_file_preallocate_Exit(rc);
+	return rc;
+}
+
+/* Windows takes access pattern hints only when a file is opened, so valid advice is accepted and ignored. */
+int32_t
+omrfile_advise(struct OMRPortLibrary *portLibrary, intptr_t fd, int64_t offset, int64_t length, int32_t advice)
+{
+	int32_t rc = 0;
+
+	Trc_PRT_file_advise_Entry(fd, offset, length, advice);
+
+	if ((advice < OMRPORT_FILE_ADVICE_NORMAL) || (advice > OMRPORT_FILE_ADVICE_NOREUSE)) {
+		rc = portLibrary->error_set_last_error(portLibrary, ERROR_INVALID_PARAMETER, OMRPORT_ERROR_FILE_INVAL);
+	}
+
+	Trc_PRT_file_advise_Exit(rc);
+	return rc;
+}
@@ -51,6 +51,7 @@ omrport_free_ptBuffer(struct OMRPortLibrary *portLibrary, PortlibPTBuffers_t ptB
 			ptBuffer->reportedMessageBufferSize = 0;
 		}
 
+		omrmem_flush_thread_cache(portLibrary, &ptBuffer->memThreadCache);
 		portLibrary->mem_free_memory(portLibrary, ptBuffer);
 	}
 }
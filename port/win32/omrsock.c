@@ -285,3 +285,57 @@ omrsock_getsockopt_timeval(struct OMRPortLibrary *portLibrary, omrsock_socket_t
 {
 	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
 }
+
+int32_t
+omrsock_eventset_create(struct OMRPortLibrary *portLibrary, omrsock_eventset_t *eventSet)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+int32_t
+omrsock_eventset_add(struct OMRPortLibrary *portLibrary, omrsock_eventset_t eventSet, omrsock_socket_t sock, int16_t events, void *userData)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+int32_t
+omrsock_eventset_modify(struct OMRPortLibrary *portLibrary, omrsock_eventset_t eventSet, omrsock_socket_t sock, int16_t events, void *userData)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+int32_t
+omrsock_eventset_remove(struct OMRPortLibrary *portLibrary, omrsock_eventset_t eventSet, omrsock_socket_t sock)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+int32_t
+omrsock_eventset_wait(struct OMRPortLibrary *portLibrary, omrsock_eventset_t eventSet, omrsock_event_t events, uint32_t maxEvents, int32_t timeoutMs)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+int32_t
+omrsock_get_event_info(struct OMRPortLibrary *portLibrary, omrsock_event_t handle, omrsock_socket_t *sock, void **userData, int16_t *revents)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+int32_t
+omrsock_eventset_destroy(struct OMRPortLibrary *portLibrary, omrsock_eventset_t *eventSet)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+intptr_t
+omrsock_sendfile(struct OMRPortLibrary *portLibrary, omrsock_socket_t sock, intptr_t fd, int64_t *offset, uintptr_t count)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
+
+int32_t
+omrsock_splice(struct OMRPortLibrary *portLibrary, omrsock_socket_t fromSock, omrsock_socket_t toSock, int32_t nbyte)
+{
+	return OMRPORT_ERROR_NOT_SUPPORTED_ON_THIS_PLATFORM;
+}
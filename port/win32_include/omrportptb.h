@@ -42,6 +42,8 @@
 
 #include "omrport.h"
 
+#include "omrmemthreadcache.h"
+
 #define J9ERROR_DEFAULT_BUFFER_SIZE 256 /**< default customized error message size if we need to create one */
 #define J9ERROR_MAXIMUM_BUFFER_SIZE 0xFFFFFFFF /**< maximum customized error message size if we need to create one */
 
@@ -62,6 +64,8 @@ typedef struct PortlibPTBuffers_struct {
 	int32_t reportedErrorCode; /**< last reported error code */
 	char *reportedMessageBuffer; /**< last reported error message, either customized or from OS */
 	uintptr_t reportedMessageBufferSize; /**< reported message buffer size */
+
+	J9MemThreadCache memThreadCache; /**< freed small blocks and batched category counters */
 } PortlibPTBuffers_struct;
 
 /**
@@ -37,6 +37,15 @@
 #include "ut_j9thr.h"
 #include "thread_internal.h"
 
+#if defined(OMR_THR_FUTEX_MONITORS)
+#include <errno.h>
+#include <limits.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
+
 static void omrthread_shutdown(void);
 
 static omrthread_t threadAllocate(omrthread_library_t lib, int globalIsLocked);
@@ -78,6 +87,10 @@ static intptr_t init_spinCounts(omrthread_library_t lib);
 static void unblock_spinlock_threads(omrthread_t self, omrthread_monitor_t monitor);
 #endif /* !defined(OMR_THR_MCS_LOCKS) */
 #endif /* OMR_THR_THREE_TIER_LOCKING */
+#if defined(OMR_THR_FUTEX_MONITORS)
+static intptr_t monitor_futex_block(omrthread_t self, omrthread_monitor_t monitor, BOOLEAN isAbortable);
+static void monitor_futex_wake(omrthread_monitor_t monitor, int count);
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
 
 static intptr_t init_threadParam(const char *name, uintptr_t *pDefault);
 static intptr_t init_spinParameters(omrthread_library_t lib);
@@ -2932,6 +2945,14 @@ interrupt_blocked_thread(omrthread_t self, omrthread_t threadToInterrupt)
 
 	monitor = threadToInterrupt->monitor;
 
+#if defined(OMR_THR_FUTEX_MONITORS)
+	if (OMR_ARE_ALL_BITS_SET(monitor->flags, J9THREAD_MONITOR_FUTEX)) {
+		/* The aborted thread is parked on the spinlock word; the others go back to sleep. */
+		monitor_futex_wake(monitor, INT_MAX);
+		return;
+	}
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
+
 	if (MONITOR_TRY_LOCK(monitor) == 0) {
 		NOTIFY_WRAPPER(threadToInterrupt);
 	} else {
@@ -3759,6 +3780,15 @@ monitor_init(omrthread_monitor_t monitor, uintptr_t flags, omrthread_library_t l
 	ASSERT(monitor->spinCount3 != 0);
 #endif /* defined(OMR_THR_THREE_TIER_LOCKING) */
 
+	/* Builds without futex monitors ignore a J9THREAD_MONITOR_FUTEX request. */
+#if defined(OMR_THR_FUTEX_MONITORS)
+	if (OMR_ARE_ALL_BITS_SET(lib->flags, J9THREAD_LIB_FLAG_FUTEX_MONITORS_ENABLED)) {
+		monitor->flags |= J9THREAD_MONITOR_FUTEX;
+	}
+#else /* defined(OMR_THR_FUTEX_MONITORS) */
+	monitor->flags &= ~(uintptr_t)J9THREAD_MONITOR_FUTEX;
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
+
 	if (NULL != name) {
 		if (OMR_ARE_ANY_BITS_SET(monitor->flags, J9THREAD_MONITOR_NAME_COPY)) {
 			uintptr_t length = strlen(name);
@@ -4010,6 +4040,18 @@ monitor_enter_three_tier(omrthread_t self, omrthread_monitor_t monitor, BOOLEAN
 			break;
 		}
 
+#if defined(OMR_THR_FUTEX_MONITORS)
+		if (OMR_ARE_ALL_BITS_SET(monitor->flags, J9THREAD_MONITOR_FUTEX)) {
+			blockedCount++;
+			if (0 != monitor_futex_block(self, monitor, isAbortable)) {
+				return J9THREAD_INTERRUPTED_MONITOR_ENTER;
+			}
+			monitor->owner = self;
+			monitor->count = 1;
+			break;
+		}
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
+
 		MONITOR_LOCK(monitor, CALLER_MONITOR_ENTER_THREE_TIER1);
 
 #if !defined(OMR_THR_MCS_LOCKS)
@@ -4161,6 +4203,96 @@ unblock_spinlock_threads(omrthread_t self, omrthread_monitor_t monitor)
 
 #endif /* defined(OMR_THR_THREE_TIER_LOCKING) && !defined(OMR_THR_MCS_LOCKS) */
 
+#if defined(OMR_THR_FUTEX_MONITORS)
+/*
+ * Abortable enters re-check the abort flag at least this often, since an abort
+ * may be raised between the check and the futex wait.
+ */
+#define FUTEX_ABORT_POLL_NANOS 10000000
+
+/**
+ * Return the 32-bit futex word overlaying the monitor's spinlock state.
+ *
+ * The spinlock states are small enough to fit in the low-order half of the
+ * uintptr_t, so the kernel compares against that half.
+ *
+ * @param[in] monitor the monitor
+ * @return the address of the futex word
+ */
+static uint32_t *
+monitor_futex_word(omrthread_monitor_t monitor)
+{
+	uint32_t *word = (uint32_t *)&monitor->spinlockState;
+#if defined(OMR_ENV_DATA64) && !defined(OMR_ENV_LITTLE_ENDIAN)
+	word += 1;
+#endif /* defined(OMR_ENV_DATA64) && !defined(OMR_ENV_LITTLE_ENDIAN) */
+	return word;
+}
+
+/**
+ * Wake up to count threads parked on a futex monitor.
+ *
+ * @param[in] monitor the monitor
+ * @param[in] count the maximum number of threads to wake
+ */
+static void
+monitor_futex_wake(omrthread_monitor_t monitor, int count)
+{
+	syscall(SYS_futex, monitor_futex_word(monitor), FUTEX_WAKE_PRIVATE, count, NULL, NULL, 0);
+}
+
+/**
+ * Block on a futex monitor until its spinlock is acquired.
+ *
+ * Contended enterers swap the state to J9THREAD_MONITOR_SPINLOCK_EXCEEDED and
+ * sleep while it stays that way. A thread that acquires the monitor this way
+ * leaves the state EXCEEDED, so its exit wakes exactly one further waiter.
+ *
+ * @param[in] self the current thread
+ * @param[in] monitor the monitor to acquire
+ * @param[in] isAbortable whether the enter may be aborted
+ * @return 0 once the spinlock is owned, J9THREAD_INTERRUPTED_MONITOR_ENTER if aborted
+ */
+static intptr_t
+monitor_futex_block(omrthread_t self, omrthread_monitor_t monitor, BOOLEAN isAbortable)
+{
+	uint32_t *word = monitor_futex_word(monitor);
+	struct timespec poll = {0, FUTEX_ABORT_POLL_NANOS};
+	struct timespec *timeout = (SET_ABORTABLE == isAbortable) ? &poll : NULL;
+
+	THREAD_LOCK(self, CALLER_MONITOR_ENTER_THREE_TIER2);
+	if (SET_ABORTABLE == isAbortable) {
+		self->flags |= J9THREAD_FLAGM_BLOCKED_ABORTABLE;
+	} else {
+		self->flags |= J9THREAD_FLAG_BLOCKED;
+	}
+	self->monitor = monitor;
+	THREAD_UNLOCK(self);
+
+	while (J9THREAD_MONITOR_SPINLOCK_UNOWNED != omrthread_spinlock_swapState(monitor, J9THREAD_MONITOR_SPINLOCK_EXCEEDED)) {
+		if (SET_ABORTABLE == isAbortable) {
+			THREAD_LOCK(self, CALLER_MONITOR_ENTER_THREE_TIER4);
+			if (OMR_ARE_ALL_BITS_SET(self->flags, J9THREAD_FLAG_ABORTED)) {
+				self->flags &= ~J9THREAD_FLAGM_BLOCKED_ABORTABLE;
+				self->monitor = 0;
+				THREAD_UNLOCK(self);
+				/* Pass on any wake-up this thread may have consumed. */
+				monitor_futex_wake(monitor, 1);
+				return J9THREAD_INTERRUPTED_MONITOR_ENTER;
+			}
+			THREAD_UNLOCK(self);
+		}
+		if ((-1 == syscall(SYS_futex, word, FUTEX_WAIT_PRIVATE, (uint32_t)J9THREAD_MONITOR_SPINLOCK_EXCEEDED, timeout, NULL, 0))
+			&& (EAGAIN != errno) && (EINTR != errno) && (ETIMEDOUT != errno)
+		) {
+			ASSERT(0);
+		}
+	}
+
+	return 0;
+}
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
+
 
 
 /**
@@ -4363,7 +4495,15 @@ monitor_exit(omrthread_t self, omrthread_monitor_t monitor)
 		MONITOR_UNLOCK(monitor);
 #else /* defined(OMR_THR_MCS_LOCKS) */
 #if defined(OMR_THR_SPIN_WAKE_CONTROL)
+#if defined(OMR_THR_FUTEX_MONITORS)
+		if (J9THREAD_MONITOR_SPINLOCK_EXCEEDED == omrthread_spinlock_swapState(monitor, J9THREAD_MONITOR_SPINLOCK_UNOWNED)) {
+			if (OMR_ARE_ALL_BITS_SET(monitor->flags, J9THREAD_MONITOR_FUTEX)) {
+				monitor_futex_wake(monitor, 1);
+			}
+		}
+#else /* defined(OMR_THR_FUTEX_MONITORS) */
 		omrthread_spinlock_swapState(monitor, J9THREAD_MONITOR_SPINLOCK_UNOWNED);
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
  		MONITOR_LOCK(monitor, CALLER_MONITOR_EXIT1);
  		if (0 == monitor->spinThreads) {
  			unblock_spinlock_threads(self, monitor);
@@ -4371,6 +4511,16 @@ monitor_exit(omrthread_t self, omrthread_monitor_t monitor)
  		MONITOR_UNLOCK(monitor);
 #else /* defined(OMR_THR_SPIN_WAKE_CONTROL) */
 		if (J9THREAD_MONITOR_SPINLOCK_EXCEEDED == omrthread_spinlock_swapState(monitor, J9THREAD_MONITOR_SPINLOCK_UNOWNED)) {
+#if defined(OMR_THR_FUTEX_MONITORS)
+			if (OMR_ARE_ALL_BITS_SET(monitor->flags, J9THREAD_MONITOR_FUTEX)) {
+				monitor_futex_wake(monitor, 1);
+			}
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
+			/*
+			 * On futex monitors the blocking queue only holds waiters moved there by a
+			 * fast notify, but woken waiters dequeue themselves without owning the
+			 * monitor, so the queue is only read under the monitor mutex.
+			 */
 			MONITOR_LOCK(monitor, CALLER_MONITOR_EXIT1);
 			unblock_spinlock_threads(self, monitor);
 			MONITOR_UNLOCK(monitor);
@@ -4684,12 +4834,25 @@ monitor_wait_original(omrthread_t self, omrthread_monitor_t monitor,
 	}
 #else /* defined(OMR_THR_MCS_LOCKS) */
 #if defined(OMR_THR_SPIN_WAKE_CONTROL)
+#if defined(OMR_THR_FUTEX_MONITORS)
+	if (J9THREAD_MONITOR_SPINLOCK_EXCEEDED == omrthread_spinlock_swapState(monitor, J9THREAD_MONITOR_SPINLOCK_UNOWNED)) {
+		if (OMR_ARE_ALL_BITS_SET(monitor->flags, J9THREAD_MONITOR_FUTEX)) {
+			monitor_futex_wake(monitor, 1);
+		}
+	}
+#else /* defined(OMR_THR_FUTEX_MONITORS) */
 	omrthread_spinlock_swapState(monitor, J9THREAD_MONITOR_SPINLOCK_UNOWNED);
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
 	if (0 == monitor->spinThreads) {
 		unblock_spinlock_threads(self, monitor);
 	}
 #else /* defined(OMR_THR_SPIN_WAKE_CONTROL) */
 	if (J9THREAD_MONITOR_SPINLOCK_EXCEEDED == omrthread_spinlock_swapState(monitor, J9THREAD_MONITOR_SPINLOCK_UNOWNED)) {
+#if defined(OMR_THR_FUTEX_MONITORS)
+		if (OMR_ARE_ALL_BITS_SET(monitor->flags, J9THREAD_MONITOR_FUTEX)) {
+			monitor_futex_wake(monitor, 1);
+		}
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
 		unblock_spinlock_threads(self, monitor);
 	}
 #endif  /* defined(OMR_THR_SPIN_WAKE_CONTROL) */
@@ -4960,12 +5123,25 @@ monitor_wait_three_tier(omrthread_t self, omrthread_monitor_t monitor,
 	}
 #else /* defined(OMR_THR_MCS_LOCKS) */
 #if defined(OMR_THR_SPIN_WAKE_CONTROL)
+#if defined(OMR_THR_FUTEX_MONITORS)
+	if (J9THREAD_MONITOR_SPINLOCK_EXCEEDED == omrthread_spinlock_swapState(monitor, J9THREAD_MONITOR_SPINLOCK_UNOWNED)) {
+		if (OMR_ARE_ALL_BITS_SET(monitor->flags, J9THREAD_MONITOR_FUTEX)) {
+			monitor_futex_wake(monitor, 1);
+		}
+	}
+#else /* defined(OMR_THR_FUTEX_MONITORS) */
 	omrthread_spinlock_swapState(monitor, J9THREAD_MONITOR_SPINLOCK_UNOWNED);
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
 	if (0 == monitor->spinThreads) {
 		unblock_spinlock_threads(self, monitor);
 	}
 #else /* defined(OMR_THR_SPIN_WAKE_CONTROL) */
 	if (J9THREAD_MONITOR_SPINLOCK_EXCEEDED == omrthread_spinlock_swapState(monitor, J9THREAD_MONITOR_SPINLOCK_UNOWNED)) {
+#if defined(OMR_THR_FUTEX_MONITORS)
+		if (OMR_ARE_ALL_BITS_SET(monitor->flags, J9THREAD_MONITOR_FUTEX)) {
+			monitor_futex_wake(monitor, 1);
+		}
+#endif /* defined(OMR_THR_FUTEX_MONITORS) */
 		unblock_spinlock_threads(self, monitor);
 	}
 #endif /* defined(OMR_THR_SPIN_WAKE_CONTROL) */
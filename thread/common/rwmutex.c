@@ -22,16 +22,35 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include "omrutilbase.h"
 #include "threaddef.h"
 #include "thread_internal.h"
 
 #undef  ASSERT
 #define ASSERT(x) /**/
 
+/* Reader-biased mutexes count readers in several stripes, each on its own cache lines,
+ * so that readers on different threads do not write to the same line.
+ */
+#define RWMUTEX_READER_STRIPES 16
+#define RWMUTEX_STRIPE_SIZE 128
+
+typedef struct RWMutexReaderStripe {
+	volatile uintptr_t count;
+	uint8_t padding[RWMUTEX_STRIPE_SIZE - sizeof(uintptr_t)];
+} RWMutexReaderStripe;
+
 typedef struct RWMutex {
 	omrthread_monitor_t syncMon;
 	intptr_t status;
 	omrthread_t writer;
+	uintptr_t flags;
+	/* The following are only used by reader-biased mutexes */
+	volatile uintptr_t writerActive;
+	volatile uintptr_t writersWaiting;
+	void *stripeMemory;
+	RWMutexReaderStripe *stripes;
 } RWMutex;
 
 #define ASSERT_RWMUTEX(m)\
@@ -42,9 +61,23 @@ typedef struct RWMutex {
 #define RWMUTEX_STATUS_READING(m)  ((m)->status > 0)
 #define RWMUTEX_STATUS_WRITING(m)  ((m)->status < 0)
 
+#define RWMUTEX_IS_READER_BIASED(m) (J9THREAD_RWMUTEX_READER_BIASED == ((m)->flags & J9THREAD_RWMUTEX_READER_BIASED))
+
+static RWMutexReaderStripe *readerStripe(RWMutex *mutex, omrthread_t self);
+static uintptr_t activeReaders(RWMutex *mutex);
+static void enterReadBiased(RWMutex *mutex, omrthread_t self);
+static void exitReadBiased(RWMutex *mutex, omrthread_t self);
+static void enterWriteBiased(RWMutex *mutex, omrthread_t self);
+static intptr_t tryEnterWriteBiased(RWMutex *mutex, omrthread_t self);
+
 /**
  * Acquire and initialize a new read/write mutex from the threading library.
  *
+ * If flags contains J9THREAD_RWMUTEX_READER_BIASED, readers only update a
+ * per-thread stripe of the reader count and do not enter the internal monitor
+ * unless a writer holds or is acquiring the mutex. Writers must then drain
+ * every stripe, which makes write acquisition more expensive.
+ *
  * @param[out] handle pointer to a omrthread_rwmutex_t to be set to point to the new mutex
  * @param[in] flags initial flag values for the mutex
  * @return J9THREAD_RWMUTEX_OK on success
@@ -72,6 +105,29 @@ omrthread_rwmutex_init(omrthread_rwmutex_t *handle, uintptr_t flags, const char
 		omrthread_monitor_init_with_name(&mutex->syncMon, 0, (char *)name);
 		mutex->status = 0;
 		mutex->writer = 0;
+		mutex->flags = flags;
+		mutex->writerActive = 0;
+		mutex->writersWaiting = 0;
+		mutex->stripeMemory = NULL;
+		mutex->stripes = NULL;
+
+		if (RWMUTEX_IS_READER_BIASED(mutex)) {
+			uintptr_t stripesSize = sizeof(RWMutexReaderStripe) * RWMUTEX_READER_STRIPES;
+			mutex->stripeMemory = omrthread_allocate_memory(lib, stripesSize + RWMUTEX_STRIPE_SIZE, OMRMEM_CATEGORY_THREADS);
+			if (NULL == mutex->stripeMemory) {
+				omrthread_monitor_destroy(mutex->syncMon);
+#if defined(OMR_THR_FORK_SUPPORT)
+				GLOBAL_LOCK_SIMPLE(lib);
+				pool_removeElement(lib->rwmutexPool, mutex);
+				GLOBAL_UNLOCK_SIMPLE(lib);
+#else /* defined(OMR_THR_FORK_SUPPORT) */
+				omrthread_free_memory(lib, mutex);
+#endif /* defined(OMR_THR_FORK_SUPPORT) */
+				return J9THREAD_RWMUTEX_FAIL;
+			}
+			mutex->stripes = (RWMutexReaderStripe *)(((uintptr_t)mutex->stripeMemory + RWMUTEX_STRIPE_SIZE - 1) & ~(uintptr_t)(RWMUTEX_STRIPE_SIZE - 1));
+			memset(mutex->stripes, 0, stripesSize);
+		}
 
 		ASSERT(handle);
 		*handle = mutex;
@@ -103,6 +159,9 @@ omrthread_rwmutex_destroy(omrthread_rwmutex_t mutex)
 	ASSERT(0 == mutex->status);
 	ASSERT(0 == mutex->writer);
 	omrthread_monitor_destroy(mutex->syncMon);
+	if (NULL != mutex->stripeMemory) {
+		omrthread_free_memory(lib, mutex->stripeMemory);
+	}
 #if defined(OMR_THR_FORK_SUPPORT)
 	ASSERT(0 != lib->rwmutexPool);
 	GLOBAL_LOCK_SIMPLE(lib);
@@ -142,8 +201,14 @@ omrthread_rwmutex_destroy(omrthread_rwmutex_t mutex)
 intptr_t
 omrthread_rwmutex_enter_read(omrthread_rwmutex_t mutex)
 {
+	omrthread_t self = omrthread_self();
 	ASSERT_RWMUTEX(mutex);
-	if (mutex->writer == omrthread_self()) {
+	if (mutex->writer == self) {
+		return J9THREAD_RWMUTEX_OK;
+	}
+
+	if (RWMUTEX_IS_READER_BIASED(mutex)) {
+		enterReadBiased(mutex, self);
 		return J9THREAD_RWMUTEX_OK;
 	}
 
@@ -170,8 +235,14 @@ omrthread_rwmutex_enter_read(omrthread_rwmutex_t mutex)
 intptr_t
 omrthread_rwmutex_exit_read(omrthread_rwmutex_t mutex)
 {
+	omrthread_t self = omrthread_self();
 	ASSERT_RWMUTEX(mutex);
-	if (mutex->writer == omrthread_self()) {
+	if (mutex->writer == self) {
+		return J9THREAD_RWMUTEX_OK;
+	}
+
+	if (RWMUTEX_IS_READER_BIASED(mutex)) {
+		exitReadBiased(mutex, self);
 		return J9THREAD_RWMUTEX_OK;
 	}
 
@@ -224,6 +295,11 @@ omrthread_rwmutex_enter_write(omrthread_rwmutex_t mutex)
 		return J9THREAD_RWMUTEX_OK;
 	}
 
+	if (RWMUTEX_IS_READER_BIASED(mutex)) {
+		enterWriteBiased(mutex, self);
+		return J9THREAD_RWMUTEX_OK;
+	}
+
 	omrthread_monitor_enter(mutex->syncMon);
 
 	while (mutex->status != 0) {
@@ -262,6 +338,10 @@ omrthread_rwmutex_try_enter_write(omrthread_rwmutex_t mutex)
 		return J9THREAD_RWMUTEX_OK;
 	}
 
+	if (RWMUTEX_IS_READER_BIASED(mutex)) {
+		return tryEnterWriteBiased(mutex, self);
+	}
+
 	omrthread_monitor_enter(mutex->syncMon);
 	if (mutex->status != 0) {
 		/* must get out */
@@ -299,6 +379,7 @@ omrthread_rwmutex_exit_write(omrthread_rwmutex_t mutex)
 	mutex->status++;
 	if (0 == mutex->status) {
 		mutex->writer = NULL;
+		mutex->writerActive = 0;
 		omrthread_monitor_notify_all(mutex->syncMon);
 	}
 
@@ -321,6 +402,173 @@ omrthread_rwmutex_is_writelocked(omrthread_rwmutex_t mutex)
 	return (RWMUTEX_STATUS_WRITING(mutex) || (0 != mutex->writer));
 }
 
+/**
+ * Find the reader count stripe used by a thread.
+ *
+ * @param[in] mutex a reader-biased mutex
+ * @param[in] self the current thread
+ * @return the stripe counting the read acquisitions of self
+ */
+static RWMutexReaderStripe *
+readerStripe(RWMutex *mutex, omrthread_t self)
+{
+	/* Thread structures are at least a few cache lines apart, so fold the
+	 * bits above the line offset into the stripe index.
+	 */
+	uintptr_t hash = ((uintptr_t)self) >> 7;
+	hash ^= hash >> 4;
+	return &mutex->stripes[hash % RWMUTEX_READER_STRIPES];
+}
+
+/**
+ * Sum the reader counts of all stripes. The result is only stable when
+ * mutex->writerActive is set and a barrier was issued after setting it.
+ *
+ * @param[in] mutex a reader-biased mutex
+ * @return the number of read acquisitions
+ */
+static uintptr_t
+activeReaders(RWMutex *mutex)
+{
+	uintptr_t readers = 0;
+	uintptr_t i = 0;
+
+	for (i = 0; i < RWMUTEX_READER_STRIPES; i++) {
+		readers += mutex->stripes[i].count;
+	}
+	return readers;
+}
+
+/**
+ * Enter a reader-biased mutex as a reader.
+ *
+ * The reader publishes itself in its stripe and then checks for a writer.
+ * A writer sets writerActive before it sums the stripes, and there is a
+ * barrier between the store and the loads on both sides. So either the
+ * reader sees the writer and backs out, or the writer sees the reader and
+ * waits.
+ *
+ * @param[in] mutex a reader-biased mutex
+ * @param[in] self the current thread
+ */
+static void
+enterReadBiased(RWMutex *mutex, omrthread_t self)
+{
+	RWMutexReaderStripe *stripe = readerStripe(mutex, self);
+
+	for (;;) {
+		addAtomic(&stripe->count, 1);
+		issueReadWriteBarrier();
+		if (0 == mutex->writerActive) {
+			return;
+		}
+
+		/* A writer holds or is claiming the mutex. It may have counted this
+		 * reader, so wake it after backing out, then wait until it is done.
+		 */
+		subtractAtomic(&stripe->count, 1);
+		omrthread_monitor_enter(mutex->syncMon);
+		omrthread_monitor_notify_all(mutex->syncMon);
+		while (0 != mutex->writerActive) {
+			omrthread_monitor_wait(mutex->syncMon);
+		}
+		omrthread_monitor_exit(mutex->syncMon);
+	}
+}
+
+/**
+ * Exit a reader-biased mutex as a reader.
+ *
+ * @param[in] mutex a reader-biased mutex
+ * @param[in] self the current thread
+ */
+static void
+exitReadBiased(RWMutex *mutex, omrthread_t self)
+{
+	RWMutexReaderStripe *stripe = readerStripe(mutex, self);
+
+	subtractAtomic(&stripe->count, 1);
+	issueReadWriteBarrier();
+	if (0 != mutex->writersWaiting) {
+		omrthread_monitor_enter(mutex->syncMon);
+		omrthread_monitor_notify_all(mutex->syncMon);
+		omrthread_monitor_exit(mutex->syncMon);
+	}
+}
+
+/**
+ * Enter a reader-biased mutex as a writer.
+ *
+ * writersWaiting is raised before the first attempt so that readers
+ * leaving while the writer drains the stripes always wake it.
+ *
+ * If readers remain after writerActive is set, the writer clears the flag
+ * again and waits. Readers that hold the mutex and then re-enter it for
+ * read therefore cannot deadlock with a waiting writer, as with
+ * non-biased mutexes.
+ *
+ * @param[in] mutex a reader-biased mutex
+ * @param[in] self the current thread
+ */
+static void
+enterWriteBiased(RWMutex *mutex, omrthread_t self)
+{
+	omrthread_monitor_enter(mutex->syncMon);
+
+	mutex->writersWaiting += 1;
+	for (;;) {
+		if (0 == mutex->writerActive) {
+			mutex->writerActive = 1;
+			issueReadWriteBarrier();
+			if (0 == activeReaders(mutex)) {
+				break;
+			}
+			mutex->writerActive = 0;
+			omrthread_monitor_notify_all(mutex->syncMon);
+		}
+		omrthread_monitor_wait(mutex->syncMon);
+	}
+	mutex->writersWaiting -= 1;
+
+	mutex->status--;
+	mutex->writer = self;
+	ASSERT(RWMUTEX_STATUS_WRITING(mutex));
+
+	omrthread_monitor_exit(mutex->syncMon);
+}
+
+/**
+ * Try to enter a reader-biased mutex as a writer without blocking.
+ *
+ * @param[in] mutex a reader-biased mutex
+ * @param[in] self the current thread
+ * @return J9THREAD_RWMUTEX_OK if the mutex was entered, J9THREAD_RWMUTEX_WOULDBLOCK otherwise
+ */
+static intptr_t
+tryEnterWriteBiased(RWMutex *mutex, omrthread_t self)
+{
+	intptr_t result = J9THREAD_RWMUTEX_WOULDBLOCK;
+
+	omrthread_monitor_enter(mutex->syncMon);
+	if (0 == mutex->writerActive) {
+		mutex->writerActive = 1;
+		issueReadWriteBarrier();
+		if (0 == activeReaders(mutex)) {
+			mutex->status--;
+			mutex->writer = self;
+			ASSERT(RWMUTEX_STATUS_WRITING(mutex));
+			result = J9THREAD_RWMUTEX_OK;
+		} else {
+			/* readers that backed out are waiting for the flag to clear */
+			mutex->writerActive = 0;
+			omrthread_monitor_notify_all(mutex->syncMon);
+		}
+	}
+	omrthread_monitor_exit(mutex->syncMon);
+
+	return result;
+}
+
 #if defined(OMR_THR_FORK_SUPPORT)
 /**
  * @param [in] rwmutex to reset
@@ -330,10 +578,12 @@ omrthread_rwmutex_is_writelocked(omrthread_rwmutex_t mutex)
 void
 omrthread_rwmutex_reset(omrthread_rwmutex_t rwmutex, omrthread_t self)
 {
-	if (RWMUTEX_STATUS_READING(rwmutex)) {
+	if (RWMUTEX_STATUS_READING(rwmutex) || (RWMUTEX_IS_READER_BIASED(rwmutex) && (0 != activeReaders(rwmutex)))) {
 		fprintf(stderr, "ERROR: found read-locked rwmutex during post-fork reset!\n");
 		abort();
 	}
+	/* Writers waiting on other threads no longer exist in the child */
+	rwmutex->writersWaiting = 0;
 	if (rwmutex->writer != self) {
 		/* If another thread was writing or reading and the current thread is not blocked,
 		 * reset it. If current thread is writer, it stays writer. The syncMon is reset
@@ -341,6 +591,7 @@ omrthread_rwmutex_reset(omrthread_rwmutex_t rwmutex, omrthread_t self)
 		 */
 		rwmutex->writer = NULL;
 		rwmutex->status = 0;
+		rwmutex->writerActive = 0;
 	}
 }
 
@@ -40,6 +40,20 @@
 extern "C" {
 #endif
 
+/*
+ * Linux three-tier monitors created with J9THREAD_MONITOR_FUTEX park contended
+ * enterers on the monitor's spinlock word with futex(2) rather than on
+ * per-thread condition variables. Only monitor enter uses the futex: waiting
+ * and notified threads still block on their condition variables, which timed
+ * and interruptible waits depend on. With OMR_THR_SPIN_WAKE_CONTROL every exit
+ * still wakes one parked enterer; spin wake control only limits how many
+ * notified threads are released from the blocking queue. MCS locks hand the
+ * monitor to queued threads directly and have no futex path.
+ */
+#if defined(LINUX) && !defined(OMRZTPF) && defined(OMR_THR_THREE_TIER_LOCKING) && !defined(OMR_THR_MCS_LOCKS)
+#define OMR_THR_FUTEX_MONITORS
+#endif /* defined(LINUX) && !defined(OMRZTPF) && defined(OMR_THR_THREE_TIER_LOCKING) && !defined(OMR_THR_MCS_LOCKS) */
+
 /*
  * Define this to force a thread to be spawned when
  * interrupting a waiting thread (it's a debug thing)
@@ -0,0 +1,799 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/*
+ * file    : concurrenthashtable.c
+ *
+ *  Hash table supporting concurrent readers and writers
+ *
+ * Entries live in singly linked chains hanging off a power of two sized
+ * bucket array. Readers walk the chains without taking any lock. Writers
+ * take one of J9CONCURRENT_HASH_TABLE_LOCK_STRIPES monitors, chosen by hash,
+ * and publish a node only after it is fully initialized. Unlinked nodes keep
+ * their next pointer, so a reader standing on one can always finish its walk.
+ *
+ * Memory is reclaimed with two epochs: every operation registers in the
+ * reader counter of the current epoch. Retired nodes are batched; a batch is
+ * sealed by advancing the epoch and freed once the counters of the previous
+ * epoch drain. Reclamation never waits, so operations may nest in a read
+ * section.
+ *
+ * The table grows by doubling. The new bucket array is published with a
+ * pointer to the old one, and old buckets are copied over one at a time by
+ * writers touching them and by a shared cursor advanced on every write. A
+ * copied old bucket is marked migrated; readers look in the old bucket first
+ * and fall through to the new array when they find the mark.
+ */
+
+#include <stddef.h>
+#include <string.h>
+#include "omrcfg.h"
+#include "hashtable_internal.h"
+#include "ut_hashtable.h"
+#include "omrthread.h"
+#include "omrutilbase.h"
+
+#define CHT_MIGRATED ((J9ConcurrentHashTableNode *)(uintptr_t)1)
+#define CHT_SIZE_MIN ((uintptr_t)J9CONCURRENT_HASH_TABLE_LOCK_STRIPES)
+#define CHT_SIZE_MAX ((uintptr_t)1 << 26)
+#define CHT_LOAD_FACTOR 2
+#define CHT_MIGRATE_PER_WRITE 2
+#define CHT_RECLAIM_THRESHOLD 64
+#define CHT_RETIRED_FREE_ENTRY 1
+
+static uintptr_t spreadHash(uintptr_t hash);
+static J9ConcurrentHashTableBuckets *allocateBuckets(J9ConcurrentHashTable *table, uintptr_t size);
+static J9ConcurrentHashTableReaderStripe *readerStripe(J9ConcurrentHashTable *table);
+static uintptr_t activeReaders(J9ConcurrentHashTable *table, uintptr_t parity);
+static J9ConcurrentHashTableNode *findInChain(J9ConcurrentHashTable *table, J9ConcurrentHashTableNode *node, uintptr_t hash, void *entry);
+static J9ConcurrentHashTableNode *readChain(J9ConcurrentHashTable *table, uintptr_t hash);
+static J9ConcurrentHashTableNode *volatile *lockedChain(J9ConcurrentHashTable *table, uintptr_t hash);
+static BOOLEAN migrateBucket(J9ConcurrentHashTable *table, J9ConcurrentHashTableBuckets *buckets, J9ConcurrentHashTableBuckets *previous, uintptr_t index);
+static void helpMigrate(J9ConcurrentHashTable *table);
+static void growIfNeeded(J9ConcurrentHashTable *table);
+static void retireNode(J9ConcurrentHashTable *table, J9ConcurrentHashTableNode *node, uintptr_t flags);
+static void retireBuckets(J9ConcurrentHashTable *table, J9ConcurrentHashTableBuckets *buckets);
+static void reclaimRetired(J9ConcurrentHashTable *table);
+static void freeRetired(J9ConcurrentHashTable *table, J9ConcurrentHashTableNode *nodes, J9ConcurrentHashTableBuckets *buckets);
+static void freeChain(J9ConcurrentHashTable *table, J9ConcurrentHashTableNode *node);
+
+/**
+ * Mix the bits of a user hash so that bucket and lock indices, which use
+ * the low bits, are well distributed even for aligned pointer hashes.
+ */
+static uintptr_t
+spreadHash(uintptr_t hash)
+{
+#if defined(OMR_ENV_DATA64)
+	hash ^= hash >> 33;
+	hash *= (uintptr_t)J9CONST64(0xff51afd7ed558ccd);
+	hash ^= hash >> 33;
+#else /* defined(OMR_ENV_DATA64) */
+	hash ^= hash >> 16;
+	hash *= (uintptr_t)0x85ebca6b;
+	hash ^= hash >> 13;
+#endif /* defined(OMR_ENV_DATA64) */
+	return hash;
+}
+
+static J9ConcurrentHashTableBuckets *
+allocateBuckets(J9ConcurrentHashTable *table, uintptr_t size)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(table->portLibrary);
+	uintptr_t bytes = offsetof(J9ConcurrentHashTableBuckets, heads) + (size * sizeof(J9ConcurrentHashTableNode *));
+	J9ConcurrentHashTableBuckets *buckets = (J9ConcurrentHashTableBuckets *)omrmem_allocate_memory(bytes, table->memoryCategory);
+
+	if (NULL != buckets) {
+		memset(buckets, 0, bytes);
+		buckets->size = size;
+	}
+	return buckets;
+}
+
+/**
+ * \brief       Create a new concurrent hash table
+ * \ingroup     hash_table
+ *
+ * @param portLibrary       The port library
+ * @param tableName         A string giving the name of the table
+ * @param tableSize         Initial number of buckets, rounded up to a power of two
+ * @param entrySize         Size of the user-data for each entry
+ * @param flags             J9HASH_TABLE_DO_NOT_GROW to keep the initial size
+ * @param memoryCategory    Memory category for all memory allocated by the table
+ * @param hashFn            Mandatory hashing function ptr
+ * @param hashEqualFn       Mandatory equality function ptr
+ * @param functionUserData  Optional userData ptr to be passed to hashFn and hashEqualFn
+ * @return                  An initialized hash table, or NULL on failure
+ *
+ * The calling thread must be attached to the thread library.
+ */
+J9ConcurrentHashTable *
+concurrentHashTableNew(
+	OMRPortLibrary *portLibrary,
+	const char *tableName,
+	uint32_t tableSize,
+	uint32_t entrySize,
+	uint32_t flags,
+	uint32_t memoryCategory,
+	J9HashTableHashFn hashFn,
+	J9HashTableEqualFn hashEqualFn,
+	void *functionUserData)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	J9ConcurrentHashTable *table = NULL;
+	uintptr_t stripesSize = sizeof(J9ConcurrentHashTableReaderStripe) * J9CONCURRENT_HASH_TABLE_READER_STRIPES;
+	uintptr_t size = CHT_SIZE_MIN;
+	uintptr_t i = 0;
+
+	table = (J9ConcurrentHashTable *)omrmem_allocate_memory(sizeof(J9ConcurrentHashTable), memoryCategory);
+	if (NULL == table) {
+		return NULL;
+	}
+	memset(table, 0, sizeof(J9ConcurrentHashTable));
+	table->tableName = tableName;
+	table->entrySize = entrySize;
+	table->flags = flags;
+	table->memoryCategory = memoryCategory;
+	table->hashFn = hashFn;
+	table->hashEqualFn = hashEqualFn;
+	table->portLibrary = portLibrary;
+	table->functionUserData = functionUserData;
+
+	while ((size < tableSize) && (size < CHT_SIZE_MAX)) {
+		size <<= 1;
+	}
+	table->buckets = allocateBuckets(table, size);
+	if (NULL == table->buckets) {
+		goto fail;
+	}
+
+	table->readerStripeMemory = omrmem_allocate_memory(stripesSize + J9CONCURRENT_HASH_TABLE_READER_STRIPE_SIZE, memoryCategory);
+	if (NULL == table->readerStripeMemory) {
+		goto fail;
+	}
+	table->readerStripes = (J9ConcurrentHashTableReaderStripe *)(((uintptr_t)table->readerStripeMemory + J9CONCURRENT_HASH_TABLE_READER_STRIPE_SIZE - 1)
+			& ~(uintptr_t)(J9CONCURRENT_HASH_TABLE_READER_STRIPE_SIZE - 1));
+	memset(table->readerStripes, 0, stripesSize);
+
+	for (i = 0; i < J9CONCURRENT_HASH_TABLE_LOCK_STRIPES; i++) {
+		if (0 != omrthread_monitor_init_with_name(&table->writeLocks[i], 0, "&(J9ConcurrentHashTable->writeLocks)")) {
+			goto fail;
+		}
+	}
+	if (0 != omrthread_monitor_init_with_name(&table->resizeMutex, 0, "&(J9ConcurrentHashTable->resizeMutex)")) {
+		goto fail;
+	}
+	if (0 != omrthread_monitor_init_with_name(&table->reclaimMutex, 0, "&(J9ConcurrentHashTable->reclaimMutex)")) {
+		goto fail;
+	}
+	return table;
+
+fail:
+	concurrentHashTableFree(table);
+	return NULL;
+}
+
+/**
+ * \brief       Free a concurrent hash table
+ * \ingroup     hash_table
+ *
+ * @param table
+ *
+ *      Frees the table and all entries. No other thread may be using the table.
+ */
+void
+concurrentHashTableFree(J9ConcurrentHashTable *table)
+{
+	if (NULL != table) {
+		OMRPORT_ACCESS_FROM_OMRPORT(table->portLibrary);
+		J9ConcurrentHashTableBuckets *buckets = table->buckets;
+		uintptr_t i = 0;
+
+		if (NULL != buckets) {
+			J9ConcurrentHashTableBuckets *previous = buckets->previous;
+			if (NULL != previous) {
+				for (i = 0; i < previous->size; i++) {
+					if (CHT_MIGRATED != previous->heads[i]) {
+						freeChain(table, previous->heads[i]);
+					}
+				}
+				omrmem_free_memory(previous);
+			}
+			for (i = 0; i < buckets->size; i++) {
+				freeChain(table, buckets->heads[i]);
+			}
+			omrmem_free_memory(buckets);
+		}
+		freeRetired(table, table->pendingNodes, table->pendingBuckets);
+		freeRetired(table, table->retiredNodes, table->retiredBuckets);
+
+		for (i = 0; i < J9CONCURRENT_HASH_TABLE_LOCK_STRIPES; i++) {
+			if (NULL != table->writeLocks[i]) {
+				omrthread_monitor_destroy(table->writeLocks[i]);
+			}
+		}
+		if (NULL != table->resizeMutex) {
+			omrthread_monitor_destroy(table->resizeMutex);
+		}
+		if (NULL != table->reclaimMutex) {
+			omrthread_monitor_destroy(table->reclaimMutex);
+		}
+		if (NULL != table->readerStripeMemory) {
+			omrmem_free_memory(table->readerStripeMemory);
+		}
+		omrmem_free_memory(table);
+	}
+}
+
+static void
+freeChain(J9ConcurrentHashTable *table, J9ConcurrentHashTableNode *node)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(table->portLibrary);
+
+	while (NULL != node) {
+		J9ConcurrentHashTableNode *next = node->next;
+		omrmem_free_memory(node->entry);
+		omrmem_free_memory(node);
+		node = next;
+	}
+}
+
+static J9ConcurrentHashTableReaderStripe *
+readerStripe(J9ConcurrentHashTable *table)
+{
+	/* Thread structures are at least a few cache lines apart, so fold the
+	 * bits above the line offset into the stripe index.
+	 */
+	uintptr_t hash = ((uintptr_t)omrthread_self()) >> 7;
+	hash ^= hash >> 4;
+	return &table->readerStripes[hash % J9CONCURRENT_HASH_TABLE_READER_STRIPES];
+}
+
+static uintptr_t
+activeReaders(J9ConcurrentHashTable *table, uintptr_t parity)
+{
+	uintptr_t readers = 0;
+	uintptr_t i = 0;
+
+	for (i = 0; i < J9CONCURRENT_HASH_TABLE_READER_STRIPES; i++) {
+		readers += table->readerStripes[i].activeReaders[parity];
+	}
+	return readers;
+}
+
+/**
+ * \brief       Begin a read section
+ * \ingroup     hash_table
+ *
+ * @param table
+ * @return                  token to pass to concurrentHashTableReadExit()
+ *
+ *      Entries returned by concurrentHashTableFind() or concurrentHashTableAdd()
+ *      stay allocated until the end of the read section, even if another thread
+ *      removes them. Read sections may nest and may contain any table operation.
+ */
+uintptr_t
+concurrentHashTableReadEnter(J9ConcurrentHashTable *table)
+{
+	J9ConcurrentHashTableReaderStripe *stripe = readerStripe(table);
+
+	for (;;) {
+		uintptr_t epoch = table->epoch;
+		uintptr_t parity = epoch & 1;
+		addAtomic(&stripe->activeReaders[parity], 1);
+		/* The reclaimer advances the epoch before it sums the counters, so
+		 * either it sees this reader or this reader sees the new epoch.
+		 */
+		issueReadWriteBarrier();
+		if (epoch == table->epoch) {
+			return parity;
+		}
+		subtractAtomic(&stripe->activeReaders[parity], 1);
+	}
+}
+
+/**
+ * \brief       End a read section
+ * \ingroup     hash_table
+ *
+ * @param table
+ * @param token             value returned by the matching concurrentHashTableReadEnter()
+ */
+void
+concurrentHashTableReadExit(J9ConcurrentHashTable *table, uintptr_t token)
+{
+	issueReadWriteBarrier();
+	subtractAtomic(&readerStripe(table)->activeReaders[token], 1);
+}
+
+static J9ConcurrentHashTableNode *
+findInChain(J9ConcurrentHashTable *table, J9ConcurrentHashTableNode *node, uintptr_t hash, void *entry)
+{
+	while ((NULL != node)
+		&& ((node->hash != hash) || (0 == table->hashEqualFn(node->entry, entry, table->functionUserData)))
+	) {
+		node = node->next;
+	}
+	return node;
+}
+
+/**
+ * Find the chain holding the entries with the given hash without locking.
+ * Must be called in a read section.
+ */
+static J9ConcurrentHashTableNode *
+readChain(J9ConcurrentHashTable *table, uintptr_t hash)
+{
+	for (;;) {
+		J9ConcurrentHashTableBuckets *buckets = table->buckets;
+		J9ConcurrentHashTableBuckets *previous = buckets->previous;
+		J9ConcurrentHashTableNode *head = NULL;
+
+		if (NULL != previous) {
+			head = previous->heads[hash & (previous->size - 1)];
+			if (CHT_MIGRATED != head) {
+				return head;
+			}
+		}
+		head = buckets->heads[hash & (buckets->size - 1)];
+		if (CHT_MIGRATED != head) {
+			return head;
+		}
+		/* The table grew after it was read; retry with the new buckets */
+	}
+}
+
+/**
+ * Find the chain head holding the entries with the given hash, migrating the
+ * old bucket first if a resize is in progress. Must be called in a read
+ * section with the write lock for the hash held.
+ */
+static J9ConcurrentHashTableNode *volatile *
+lockedChain(J9ConcurrentHashTable *table, uintptr_t hash)
+{
+	J9ConcurrentHashTableBuckets *buckets = table->buckets;
+	J9ConcurrentHashTableBuckets *previous = buckets->previous;
+	J9ConcurrentHashTableNode *volatile *head = NULL;
+
+	if (NULL != previous) {
+		uintptr_t index = hash & (previous->size - 1);
+		if ((CHT_MIGRATED != previous->heads[index]) && !migrateBucket(table, buckets, previous, index)) {
+			/* Out of memory; the old bucket remains authoritative */
+			return &previous->heads[index];
+		}
+	}
+	head = &buckets->heads[hash & (buckets->size - 1)];
+	Assert_hashTable_true(CHT_MIGRATED != *head);
+	return head;
+}
+
+/**
+ * Copy the entries of one old bucket into the new buckets and mark it
+ * migrated. Must be called in a read section with the write lock for the
+ * bucket held. The old nodes are left intact for readers still walking them.
+ *
+ * @return TRUE on success, FALSE if memory for the copies could not be allocated
+ */
+static BOOLEAN
+migrateBucket(J9ConcurrentHashTable *table, J9ConcurrentHashTableBuckets *buckets, J9ConcurrentHashTableBuckets *previous, uintptr_t index)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(table->portLibrary);
+	J9ConcurrentHashTableNode *oldHead = previous->heads[index];
+	J9ConcurrentHashTableNode *node = NULL;
+	J9ConcurrentHashTableNode *copies = NULL;
+
+	/* Copy the whole chain before publishing anything so that a failure leaves the table unchanged */
+	for (node = oldHead; NULL != node; node = node->next) {
+		J9ConcurrentHashTableNode *copy = (J9ConcurrentHashTableNode *)omrmem_allocate_memory(sizeof(J9ConcurrentHashTableNode), table->memoryCategory);
+		if (NULL == copy) {
+			while (NULL != copies) {
+				node = copies->next;
+				omrmem_free_memory(copies);
+				copies = node;
+			}
+			return FALSE;
+		}
+		copy->hash = node->hash;
+		copy->entry = node->entry;
+		copy->retiredNext = NULL;
+		copy->retiredFlags = 0;
+		copy->next = copies;
+		copies = copy;
+	}
+
+	/* The new buckets fed by an unmigrated bucket are empty and unread until it is marked */
+	while (NULL != copies) {
+		J9ConcurrentHashTableNode *volatile *head = &buckets->heads[copies->hash & (buckets->size - 1)];
+		node = copies->next;
+		copies->next = *head;
+		*head = copies;
+		copies = node;
+	}
+	issueWriteBarrier();
+	previous->heads[index] = CHT_MIGRATED;
+
+	for (node = oldHead; NULL != node; node = node->next) {
+		retireNode(table, node, 0);
+	}
+
+	if (addAtomic(&previous->migratedBuckets, 1) == previous->size) {
+		buckets->previous = NULL;
+		retireBuckets(table, previous);
+	}
+	return TRUE;
+}
+
+/**
+ * Migrate a few old buckets chosen by a shared cursor, so that a resize
+ * finishes even if writers never touch some of the old buckets. Must be
+ * called in a read section without holding a write lock.
+ */
+static void
+helpMigrate(J9ConcurrentHashTable *table)
+{
+	J9ConcurrentHashTableBuckets *buckets = table->buckets;
+	J9ConcurrentHashTableBuckets *previous = buckets->previous;
+	uintptr_t i = 0;
+
+	for (i = 0; (NULL != previous) && (i < CHT_MIGRATE_PER_WRITE); i++) {
+		uintptr_t index = addAtomic(&previous->migrateCursor, 1) - 1;
+		omrthread_monitor_t lock = NULL;
+
+		if (index >= previous->size) {
+			break;
+		}
+		lock = table->writeLocks[index & (J9CONCURRENT_HASH_TABLE_LOCK_STRIPES - 1)];
+		omrthread_monitor_enter(lock);
+		if (CHT_MIGRATED != previous->heads[index]) {
+			migrateBucket(table, buckets, previous, index);
+		}
+		omrthread_monitor_exit(lock);
+	}
+}
+
+/**
+ * Start doubling the table if it is overloaded and no resize or iteration
+ * is in progress. Must be called without holding a write lock.
+ */
+static void
+growIfNeeded(J9ConcurrentHashTable *table)
+{
+	J9ConcurrentHashTableBuckets *buckets = table->buckets;
+
+	if (J9HASH_TABLE_DO_NOT_GROW == (table->flags & J9HASH_TABLE_DO_NOT_GROW)) {
+		return;
+	}
+	if ((NULL == buckets->previous) && (table->numberOfEntries > (buckets->size * CHT_LOAD_FACTOR)) && (buckets->size < CHT_SIZE_MAX)) {
+		omrthread_monitor_enter(table->resizeMutex);
+		buckets = table->buckets;
+		if ((0 == table->activeIterators) && (NULL == buckets->previous) && (table->numberOfEntries > (buckets->size * CHT_LOAD_FACTOR))) {
+			J9ConcurrentHashTableBuckets *newBuckets = allocateBuckets(table, buckets->size * 2);
+			if (NULL != newBuckets) {
+				newBuckets->previous = buckets;
+				issueWriteBarrier();
+				table->buckets = newBuckets;
+			}
+		}
+		omrthread_monitor_exit(table->resizeMutex);
+	}
+}
+
+static void
+retireNode(J9ConcurrentHashTable *table, J9ConcurrentHashTableNode *node, uintptr_t flags)
+{
+	J9ConcurrentHashTableNode *head = NULL;
+
+	node->retiredFlags = flags;
+	do {
+		head = table->retiredNodes;
+		node->retiredNext = head;
+	} while ((uintptr_t)head != compareAndSwapUDATA((uintptr_t *)&table->retiredNodes, (uintptr_t)head, (uintptr_t)node));
+	addAtomic(&table->retiredCount, 1);
+}
+
+static void
+retireBuckets(J9ConcurrentHashTable *table, J9ConcurrentHashTableBuckets *buckets)
+{
+	J9ConcurrentHashTableBuckets *head = NULL;
+
+	do {
+		head = table->retiredBuckets;
+		buckets->retiredNext = head;
+	} while ((uintptr_t)head != compareAndSwapUDATA((uintptr_t *)&table->retiredBuckets, (uintptr_t)head, (uintptr_t)buckets));
+	addAtomic(&table->retiredCount, 1);
+}
+
+/**
+ * Free the sealed batch of retired memory once its readers are gone, and
+ * seal a new batch if enough memory has been retired. Never waits; another
+ * thread already reclaiming makes this a no-op.
+ */
+static void
+reclaimRetired(J9ConcurrentHashTable *table)
+{
+	if ((NULL == table->pendingNodes) && (NULL == table->pendingBuckets) && (table->retiredCount < CHT_RECLAIM_THRESHOLD)) {
+		return;
+	}
+	if (0 != omrthread_monitor_try_enter(table->reclaimMutex)) {
+		return;
+	}
+
+	if (((NULL != table->pendingNodes) || (NULL != table->pendingBuckets)) && (0 == activeReaders(table, table->pendingParity))) {
+		freeRetired(table, table->pendingNodes, table->pendingBuckets);
+		table->pendingNodes = NULL;
+		table->pendingBuckets = NULL;
+	}
+
+	if ((NULL == table->pendingNodes) && (NULL == table->pendingBuckets) && (table->retiredCount >= CHT_RECLAIM_THRESHOLD)) {
+		J9ConcurrentHashTableNode *nodes = NULL;
+		J9ConcurrentHashTableBuckets *buckets = NULL;
+		J9ConcurrentHashTableNode *node = NULL;
+		J9ConcurrentHashTableBuckets *bucketsWalk = NULL;
+		uintptr_t count = 0;
+
+		do {
+			nodes = table->retiredNodes;
+		} while ((uintptr_t)nodes != compareAndSwapUDATA((uintptr_t *)&table->retiredNodes, (uintptr_t)nodes, 0));
+		do {
+			buckets = table->retiredBuckets;
+		} while ((uintptr_t)buckets != compareAndSwapUDATA((uintptr_t *)&table->retiredBuckets, (uintptr_t)buckets, 0));
+		for (node = nodes; NULL != node; node = node->retiredNext) {
+			count += 1;
+		}
+		for (bucketsWalk = buckets; NULL != bucketsWalk; bucketsWalk = bucketsWalk->retiredNext) {
+			count += 1;
+		}
+		subtractAtomic(&table->retiredCount, count);
+
+		/* Everything detached was unlinked before the epoch advances, so
+		 * only readers registered in the old epoch can still reach it.
+		 */
+		table->pendingParity = table->epoch & 1;
+		addAtomic(&table->epoch, 1);
+		issueReadWriteBarrier();
+		if (0 == activeReaders(table, table->pendingParity)) {
+			freeRetired(table, nodes, buckets);
+		} else {
+			table->pendingNodes = nodes;
+			table->pendingBuckets = buckets;
+		}
+	}
+
+	omrthread_monitor_exit(table->reclaimMutex);
+}
+
+static void
+freeRetired(J9ConcurrentHashTable *table, J9ConcurrentHashTableNode *nodes, J9ConcurrentHashTableBuckets *buckets)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(table->portLibrary);
+
+	while (NULL != nodes) {
+		J9ConcurrentHashTableNode *next = nodes->retiredNext;
+		if (CHT_RETIRED_FREE_ENTRY == (nodes->retiredFlags & CHT_RETIRED_FREE_ENTRY)) {
+			omrmem_free_memory(nodes->entry);
+		}
+		omrmem_free_memory(nodes);
+		nodes = next;
+	}
+	while (NULL != buckets) {
+		J9ConcurrentHashTableBuckets *next = buckets->retiredNext;
+		omrmem_free_memory(buckets);
+		buckets = next;
+	}
+}
+
+/**
+ * \brief       Find an entry in a concurrent hash table
+ * \ingroup     hash_table
+ *
+ * @param table
+ * @param entry
+ * @return                  NULL if entry is not present in the table; otherwise a pointer to the user-data
+ *
+ *      Takes no lock. If other threads may remove the entry, the caller must
+ *      be in a read section for as long as it uses the returned pointer.
+ */
+void *
+concurrentHashTableFind(J9ConcurrentHashTable *table, void *entry)
+{
+	uintptr_t hash = spreadHash(table->hashFn(entry, table->functionUserData));
+	uintptr_t token = concurrentHashTableReadEnter(table);
+	J9ConcurrentHashTableNode *node = findInChain(table, readChain(table, hash), hash, entry);
+	void *result = (NULL == node) ? NULL : node->entry;
+
+	concurrentHashTableReadExit(table, token);
+	return result;
+}
+
+/**
+ * \brief       Add an entry to a concurrent hash table
+ * \ingroup     hash_table
+ *
+ * @param table
+ * @param entry
+ * @return                  NULL on allocation failure; otherwise a pointer to the user-data
+ *
+ *      Copies entrySize bytes of entry into the table unless a matching entry is
+ *      already present, in which case the existing entry is returned.
+ */
+void *
+concurrentHashTableAdd(J9ConcurrentHashTable *table, void *entry)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(table->portLibrary);
+	uintptr_t hash = spreadHash(table->hashFn(entry, table->functionUserData));
+	omrthread_monitor_t lock = table->writeLocks[hash & (J9CONCURRENT_HASH_TABLE_LOCK_STRIPES - 1)];
+	uintptr_t token = concurrentHashTableReadEnter(table);
+	J9ConcurrentHashTableNode *volatile *head = NULL;
+	J9ConcurrentHashTableNode *node = NULL;
+	void *result = NULL;
+	BOOLEAN added = FALSE;
+
+	omrthread_monitor_enter(lock);
+	head = lockedChain(table, hash);
+	node = findInChain(table, *head, hash, entry);
+	if (NULL != node) {
+		result = node->entry;
+	} else {
+		node = (J9ConcurrentHashTableNode *)omrmem_allocate_memory(sizeof(J9ConcurrentHashTableNode), table->memoryCategory);
+		result = omrmem_allocate_memory(table->entrySize, table->memoryCategory);
+		if ((NULL != node) && (NULL != result)) {
+			memcpy(result, entry, table->entrySize);
+			node->hash = hash;
+			node->entry = result;
+			node->retiredNext = NULL;
+			node->retiredFlags = 0;
+			node->next = *head;
+			issueWriteBarrier();
+			*head = node;
+			addAtomic(&table->numberOfEntries, 1);
+			added = TRUE;
+		} else {
+			omrmem_free_memory(node);
+			omrmem_free_memory(result);
+			result = NULL;
+		}
+	}
+	omrthread_monitor_exit(lock);
+
+	if (added) {
+		growIfNeeded(table);
+	}
+	helpMigrate(table);
+	concurrentHashTableReadExit(table, token);
+	reclaimRetired(table);
+	return result;
+}
+
+/**
+ * \brief       Remove an entry from a concurrent hash table
+ * \ingroup     hash_table
+ *
+ * @param table
+ * @param entry
+ * @return                  0 on success, 1 if no matching entry was found
+ *
+ *      The entry is freed once no read section can still observe it.
+ */
+uint32_t
+concurrentHashTableRemove(J9ConcurrentHashTable *table, void *entry)
+{
+	uintptr_t hash = spreadHash(table->hashFn(entry, table->functionUserData));
+	omrthread_monitor_t lock = table->writeLocks[hash & (J9CONCURRENT_HASH_TABLE_LOCK_STRIPES - 1)];
+	uintptr_t token = concurrentHashTableReadEnter(table);
+	J9ConcurrentHashTableNode *volatile *link = NULL;
+	J9ConcurrentHashTableNode *node = NULL;
+	uint32_t rc = 1;
+
+	omrthread_monitor_enter(lock);
+	link = lockedChain(table, hash);
+	while (NULL != (node = *link)) {
+		if ((node->hash == hash) && (0 != table->hashEqualFn(node->entry, entry, table->functionUserData))) {
+			/* The node keeps its next pointer so readers standing on it can continue */
+			*link = node->next;
+			retireNode(table, node, CHT_RETIRED_FREE_ENTRY);
+			subtractAtomic(&table->numberOfEntries, 1);
+			rc = 0;
+			break;
+		}
+		link = &node->next;
+	}
+	omrthread_monitor_exit(lock);
+
+	helpMigrate(table);
+	concurrentHashTableReadExit(table, token);
+	reclaimRetired(table);
+	return rc;
+}
+
+static void
+forEachInChain(J9ConcurrentHashTable *table, J9ConcurrentHashTableNode *node, J9HashTableDoFn doFn, void *opaque)
+{
+	for (; NULL != node; node = node->next) {
+		if (doFn(node->entry, opaque)) {
+			concurrentHashTableRemove(table, node->entry);
+		}
+	}
+}
+
+/**
+ * \brief       Walk all entries of a concurrent hash table
+ * \ingroup     hash_table
+ *
+ * @param table
+ * @param doFn              function to be called
+ * @param opaque            user data to be passed to doFn
+ *
+ * Calls doFn on every entry present for the whole walk; entries added or
+ * removed concurrently may or may not be visited. Entries for which doFn
+ * returns TRUE are removed. The table does not grow during the walk.
+ */
+void
+concurrentHashTableForEachDo(J9ConcurrentHashTable *table, J9HashTableDoFn doFn, void *opaque)
+{
+	J9ConcurrentHashTableBuckets *buckets = NULL;
+	J9ConcurrentHashTableBuckets *previous = NULL;
+	uintptr_t token = 0;
+	uintptr_t i = 0;
+
+	omrthread_monitor_enter(table->resizeMutex);
+	table->activeIterators += 1;
+	omrthread_monitor_exit(table->resizeMutex);
+
+	token = concurrentHashTableReadEnter(table);
+	buckets = table->buckets;
+	previous = buckets->previous;
+	if (NULL == previous) {
+		for (i = 0; i < buckets->size; i++) {
+			forEachInChain(table, buckets->heads[i], doFn, opaque);
+		}
+	} else {
+		/* Each old bucket feeds the new buckets i and i + previous->size */
+		for (i = 0; i < previous->size; i++) {
+			J9ConcurrentHashTableNode *head = previous->heads[i];
+			if (CHT_MIGRATED != head) {
+				forEachInChain(table, head, doFn, opaque);
+			} else {
+				forEachInChain(table, buckets->heads[i], doFn, opaque);
+				forEachInChain(table, buckets->heads[i + previous->size], doFn, opaque);
+			}
+		}
+	}
+	concurrentHashTableReadExit(table, token);
+
+	omrthread_monitor_enter(table->resizeMutex);
+	table->activeIterators -= 1;
+	omrthread_monitor_exit(table->resizeMutex);
+	reclaimRetired(table);
+}
+
+/**
+ * \brief       Number of entries in a concurrent hash table
+ * \ingroup     hash_table
+ *
+ * @param table
+ * @return                  entry count; only exact while no writer is active
+ */
+uint32_t
+concurrentHashTableGetCount(J9ConcurrentHashTable *table)
+{
+	return (uint32_t)table->numberOfEntries;
+}
@@ -44,6 +44,9 @@ static intptr_t J9HookReserve(struct J9HookInterface **hookInterface, uintptr_t
 static void J9HookUnreserve(struct J9HookInterface **hookInterface, uintptr_t taggedEventNum);
 static uintptr_t J9HookAllocateAgentID(struct J9HookInterface **hookInterface);
 static void J9HookDeallocateAgentID(struct J9HookInterface **hookInterface, uintptr_t agentID);
+static intptr_t J9HookRegisterDumpConsumer(struct J9HookInterface **hookInterface);
+static void J9HookUnregisterDumpConsumer(struct J9HookInterface **hookInterface);
+static uintptr_t J9HookGetEventCount(struct J9HookInterface **hookInterface, uintptr_t taggedEventNum);
 
 static const J9HookInterface hookFunctionTable = {
 	J9HookDispatch,
@@ -57,6 +60,9 @@ static const J9HookInterface hookFunctionTable = {
 	J9HookIsEnabled,
 	J9HookAllocateAgentID,
 	J9HookDeallocateAgentID,
+	J9HookRegisterDumpConsumer,
+	J9HookUnregisterDumpConsumer,
+	J9HookGetEventCount,
 };
 
 /* flags are stored at the beginning of the interface just after the common interface fields in ascending order */
@@ -177,6 +183,10 @@ J9HookShutdownInterface(struct J9HookInterface **hookInterface)
  * before the listeners are informed. Any attempts to add listeners to a TAG_ONCE event
  * once it has been reported will fail.
  *
+ * Dispatch counts and listener timings are only collected while a dump consumer is
+ * registered or the threshold tracepoint is enabled. Otherwise listeners are called
+ * without touching the shared OMREventInfo4Dump of the event.
+ *
  * This function should not be called directly. It should be called through the hook interface
  *
  */
@@ -188,11 +198,17 @@ J9HookDispatch(struct J9HookInterface **hookInterface, uintptr_t taggedEventNum,
 	J9HookRecord *record = HOOK_RECORD(commonInterface, eventNum);
 	OMREventInfo4Dump *eventDump = J9HOOK_DUMPINFO(commonInterface, eventNum);
 	uintptr_t samplingInterval = (taggedEventNum & J9HOOK_TAG_SAMPLING_MASK) >> 16;
+	bool collectDumpInfo = false;
 	bool sampling = false;
 
 	if (taggedEventNum & J9HOOK_TAG_ONCE) {
 		uint8_t oldFlags;
 
+		/* the DISABLED flag is never cleared, so a repeated report can be rejected without the lock */
+		if (HOOK_FLAGS(commonInterface, eventNum) & J9HOOK_FLAG_DISABLED) {
+			return;
+		}
+
 		omrthread_monitor_enter(commonInterface->lock);
 		oldFlags = HOOK_FLAGS(commonInterface, eventNum);
 		/* clear the HOOKED and RESERVED flags and set the DISABLED flag */
@@ -205,6 +221,8 @@ J9HookDispatch(struct J9HookInterface **hookInterface, uintptr_t taggedEventNum,
 		}
 	}
 
+	collectDumpInfo = (0 != commonInterface->dumpConsumers) || TrcEnabled_Trc_Hook_Dispatch_Exceed_Threshold_Event;
+
 	while (record) {
 		J9HookFunction function;
 		void *userData;
@@ -222,21 +240,19 @@ J9HookDispatch(struct J9HookInterface **hookInterface, uintptr_t taggedEventNum,
 			VM_AtomicSupport::readBarrier();
 			if (record->id == id) {
 				uint64_t startTime = 0;
-				uintptr_t count = 0;
-				if (NULL != eventDump) {
-					count = VM_AtomicSupport::add((volatile uintptr_t *)&eventDump->count, 1);
+				if (collectDumpInfo) {
+					uintptr_t count = VM_AtomicSupport::add((volatile uintptr_t *)&eventDump->count, 1);
 					sampling = (1 >= samplingInterval) || ((100 >= samplingInterval) && (0 == (count % samplingInterval)));
-				} else {
-					sampling =  false;
 				}
-				OMRPORT_ACCESS_FROM_OMRPORT(commonInterface->portLib);
-				if (sampling) {
+
+				if (!sampling) {
+					function(hookInterface, eventNum, eventData, userData);
+				} else {
+					OMRPORT_ACCESS_FROM_OMRPORT(commonInterface->portLib);
 					startTime = omrtime_usec_clock();
-				}
 
-				function(hookInterface, eventNum, eventData, userData);
+					function(hookInterface, eventNum, eventData, userData);
 
-				if (sampling) {
 					uint64_t timeDelta = omrtime_hires_delta(startTime, omrtime_usec_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
 
 					eventDump->lastHook.startTime = startTime;
@@ -641,4 +657,58 @@ J9HookDeallocateAgentID(struct J9HookInterface **hookInterface, uintptr_t agentI
 	return;
 }
 
+/**
+ * Start collecting dispatch counts and listener timings in the OMREventInfo4Dump of every
+ * event of the interface. Each call must be balanced by a call to J9HookUnregisterDumpConsumer.
+ *
+ * This function should not be called directly. It should be called through the hook interface
+ *
+ * @return 0
+ */
+static intptr_t
+J9HookRegisterDumpConsumer(struct J9HookInterface **hookInterface)
+{
+	J9CommonHookInterface *commonInterface = (J9CommonHookInterface *)hookInterface;
+
+	omrthread_monitor_enter(commonInterface->lock);
+	commonInterface->dumpConsumers += 1;
+	omrthread_monitor_exit(commonInterface->lock);
+
+	return 0;
+}
+
+/**
+ * Stop collecting dump info on behalf of one consumer. The counts collected so far are
+ * kept, and collection resumes from them if another consumer registers.
+ *
+ * This function should not be called directly. It should be called through the hook interface
+ */
+static void
+J9HookUnregisterDumpConsumer(struct J9HookInterface **hookInterface)
+{
+	J9CommonHookInterface *commonInterface = (J9CommonHookInterface *)hookInterface;
+
+	omrthread_monitor_enter(commonInterface->lock);
+	if (0 != commonInterface->dumpConsumers) {
+		commonInterface->dumpConsumers -= 1;
+	}
+	omrthread_monitor_exit(commonInterface->lock);
+}
+
+/**
+ * Return the count kept in the OMREventInfo4Dump of an event.
+ *
+ * This function should not be called directly. It should be called through the hook interface
+ *
+ * @return the number of listener invocations counted for the event
+ */
+static uintptr_t
+J9HookGetEventCount(struct J9HookInterface **hookInterface, uintptr_t taggedEventNum)
+{
+	J9CommonHookInterface *commonInterface = (J9CommonHookInterface *)hookInterface;
+	uintptr_t eventNum = taggedEventNum & J9HOOK_EVENT_NUM_MASK;
+
+	return J9HOOK_DUMPINFO(commonInterface, eventNum)->count;
+}
+
 }
@@ -309,6 +309,11 @@ pool_new(uintptr_t structSizeArg,
 
 	poolFlags &= ~POOL_USES_HOLES;
 
+	if (poolFlags & POOL_THREAD_CACHE) {
+		/* Thread caches remember a puddle to refill from, so puddles must stay allocated */
+		poolFlags |= POOL_NEVER_FREE_PUDDLES;
+	}
+
 	switch (roundedStructSize) {
 	case 4:
 	case 8:
@@ -392,6 +397,7 @@ pool_new(uintptr_t structSizeArg,
 		pool->memFree = memFree;
 		pool->userData = userData;
 		pool->memoryCategory = memoryCategory;
+		pool->threadCacheLock = 0;
 
 		doInit = 1;
 		puddleList = memAlloc(userData, sizeof(J9PoolPuddleList), poolCreatorCallsite, memoryCategory, POOL_ALLOC_TYPE_PUDDLE_LIST, &doInit);
@@ -476,12 +482,8 @@ pool_kill(J9Pool *pool)
 void *
 pool_newElement(J9Pool *pool)
 {
-	int32_t slot;
 	void *newElement;
-	void *nextFreeElement;
-	J9SRP *puddleSRP;
 	J9PoolPuddle *puddle;
-	J9PoolPuddleList *puddleList;
 
 	Trc_pool_newElement_Entry(pool);
 
@@ -490,17 +492,38 @@ pool_newElement(J9Pool *pool)
 		return NULL;
 	}
 
+	puddle = pool_availablePuddle(pool);
+	if (NULL == puddle) {
+		Trc_pool_newElement_Exit(NULL);
+		return NULL;
+	}
+	newElement = poolPuddle_takeElement(pool, puddle);
+
+	Trc_pool_newElement_Exit(newElement);
+
+	return newElement;
+}
+
+/**
+ * Find a puddle with free slots, allocating a new puddle if all are full.
+ *
+ * @param[in] pool
+ *
+ * @return a puddle on the pool's available list, or NULL if a new puddle could not be allocated
+ */
+J9PoolPuddle *
+pool_availablePuddle(J9Pool *pool)
+{
 	/* Check if there is a puddle with free slots - if so use it. */
-	puddleList = J9POOL_PUDDLELIST(pool);
+	J9PoolPuddleList *puddleList = J9POOL_PUDDLELIST(pool);
+	J9PoolPuddle *puddle = J9POOLPUDDLELIST_NEXTAVAILABLEPUDDLE(puddleList);
 
-	puddle = J9POOLPUDDLELIST_NEXTAVAILABLEPUDDLE(puddleList);
 	if (NULL == puddle) {
 		J9PoolPuddle *head;
 
 		/* No available puddles. Allocate a new one. */
 		puddle = poolPuddle_new(pool);
 		if (NULL == puddle) {
-			Trc_pool_newElement_Exit(NULL);
 			return NULL;
 		}
 
@@ -513,6 +536,29 @@ pool_newElement(J9Pool *pool)
 		NNWSRP_SET(puddleList->nextAvailablePuddle, puddle);
 	}
 
+	return puddle;
+}
+
+/**
+ * Allocate the first free slot of a puddle.
+ *
+ * The contents of the element will be set to 0's unless the
+ * POOL_NO_ZERO flag is set on the pool.
+ *
+ * @param[in] pool
+ * @param[in] puddle A puddle of pool with at least one free slot
+ *
+ * @return pointer to the new element
+ */
+void *
+poolPuddle_takeElement(J9Pool *pool, J9PoolPuddle *puddle)
+{
+	int32_t slot;
+	void *newElement;
+	void *nextFreeElement;
+	J9SRP *puddleSRP;
+	J9PoolPuddleList *puddleList = J9POOL_PUDDLELIST(pool);
+
 	newElement = J9POOLPUDDLE_FIRSTFREESLOT(puddle);
 	nextFreeElement = NEXT_FREE_SLOT(newElement);
 
@@ -547,11 +593,25 @@ pool_newElement(J9Pool *pool)
 		WSRP_SET(puddle->prevAvailablePuddle, NULL);
 	}
 
-	Trc_pool_newElement_Exit(newElement);
-
 	return newElement;
 }
 
+/**
+ * Clear an allocated element, preserving the puddle SRP stored in it.
+ *
+ * @param[in] pool
+ * @param[in] anElement
+ */
+void
+pool_zeroElement(J9Pool *pool, void *anElement)
+{
+	if (pool->flags & POOL_USES_HOLES) {
+		memset(anElement, 0, pool->elementSize);
+	} else {
+		memset(anElement, 0, pool->elementSize - sizeof(J9SRP));
+	}
+}
+
 /**
  *	Deallocates an element from a pool.
  *
@@ -39,6 +39,33 @@
 extern "C" {
 #endif
 
+/* ---------------- pool.c ---------------- */
+
+/**
+* @brief
+* @param *aPool
+* @return J9PoolPuddle *
+*/
+J9PoolPuddle *
+pool_availablePuddle(J9Pool *aPool);
+
+/**
+* @brief
+* @param *aPool
+* @param *puddle
+* @return void *
+*/
+void *
+poolPuddle_takeElement(J9Pool *aPool, J9PoolPuddle *puddle);
+
+/**
+* @brief
+* @param *aPool
+* @param *anElement
+* @return void
+*/
+void
+pool_zeroElement(J9Pool *aPool, void *anElement);
 
 #ifdef __cplusplus
 }
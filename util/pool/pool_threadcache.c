@@ -0,0 +1,197 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup Pool
+ * @brief Per-thread element caches for pools shared between threads
+ *
+ * A pool created with POOL_THREAD_CACHE may be used by several threads
+ * without external locking, as long as every thread allocates and frees
+ * through its own J9PoolThreadCache. Each cache holds up to
+ * POOL_THREAD_CACHE_SIZE free elements. An empty cache is refilled with
+ * half that many elements, and a full cache returns its older half to the
+ * pool, both in one pass under a lock word in the pool. Refills prefer
+ * the puddle the cache last refilled from, so the elements a thread uses
+ * stay together and away from those of other threads.
+ *
+ * Cached elements count as allocated in pool_numElements() and are not
+ * visited by pool_do(). All caches must be flushed before the pool is
+ * walked, cleared or killed.
+ */
+
+#include "omrthread.h"
+#include "omrutilbase.h"
+#include "pool_internal.h"
+
+#define POOL_THREAD_CACHE_BATCH (POOL_THREAD_CACHE_SIZE / 2)
+#define POOL_THREAD_CACHE_LOCK_SPINS 64
+
+static void
+pool_lockForThreadCache(J9Pool *pool)
+{
+	uintptr_t spins = 0;
+
+	while (0 != compareAndSwapUDATA((uintptr_t *)&pool->threadCacheLock, 0, 1)) {
+		spins += 1;
+		if (spins >= POOL_THREAD_CACHE_LOCK_SPINS) {
+			/* The holder only moves a batch of elements; let it run */
+			omrthread_yield();
+			spins = 0;
+		}
+	}
+	issueReadWriteBarrier();
+}
+
+static void
+pool_unlockForThreadCache(J9Pool *pool)
+{
+	issueReadWriteBarrier();
+	pool->threadCacheLock = 0;
+}
+
+/**
+ * Return the oldest elements of a cache to their puddles.
+ *
+ * @param[in] cache
+ * @param[in] count number of elements to return
+ */
+static void
+pool_returnCachedElements(J9PoolThreadCache *cache, uintptr_t count)
+{
+	J9Pool *pool = cache->pool;
+	uintptr_t i = 0;
+
+	pool_lockForThreadCache(pool);
+	for (i = 0; i < count; i++) {
+		pool_removeElement(pool, cache->elements[i]);
+	}
+	pool_unlockForThreadCache(pool);
+
+	cache->count -= count;
+	for (i = 0; i < cache->count; i++) {
+		cache->elements[i] = cache->elements[i + count];
+	}
+}
+
+/**
+ * Initialize a thread cache for a pool created with POOL_THREAD_CACHE.
+ *
+ * @param[in] pool
+ * @param[in] cache Storage owned by the calling thread
+ *
+ * @return none
+ */
+void
+pool_threadCacheInit(J9Pool *pool, J9PoolThreadCache *cache)
+{
+	cache->pool = pool;
+	cache->affinityPuddle = NULL;
+	cache->count = 0;
+}
+
+/**
+ * Allocate an element through a thread cache. Only the thread owning the
+ * cache may call this.
+ *
+ * The contents of the element will be set to 0's unless the
+ * POOL_NO_ZERO flag is set on the pool.
+ *
+ * @param[in] cache
+ *
+ * @return NULL on error
+ * @return pointer to a new element otherwise
+ */
+void *
+pool_newElementCached(J9PoolThreadCache *cache)
+{
+	if (0 == cache->count) {
+		J9Pool *pool = cache->pool;
+		J9PoolPuddle *puddle = cache->affinityPuddle;
+
+		pool_lockForThreadCache(pool);
+		while (cache->count < POOL_THREAD_CACHE_BATCH) {
+			if ((NULL == puddle) || (NULL == J9POOLPUDDLE_FIRSTFREESLOT(puddle))) {
+				puddle = pool_availablePuddle(pool);
+				if (NULL == puddle) {
+					break;
+				}
+			}
+			cache->elements[cache->count] = poolPuddle_takeElement(pool, puddle);
+			cache->count += 1;
+		}
+		pool_unlockForThreadCache(pool);
+		cache->affinityPuddle = puddle;
+
+		if (0 == cache->count) {
+			return NULL;
+		}
+	}
+
+	cache->count -= 1;
+	return cache->elements[cache->count];
+}
+
+/**
+ * Free an element through a thread cache. The element may have been
+ * allocated through any cache of the same pool.
+ *
+ * @param[in] cache
+ * @param[in] anElement
+ *
+ * @return none
+ */
+void
+pool_removeElementCached(J9PoolThreadCache *cache, void *anElement)
+{
+	J9Pool *pool = cache->pool;
+
+	if (NULL == anElement) {
+		return;
+	}
+	/* Clear now so that cached elements can be handed out as they are */
+	if (!(pool->flags & POOL_NO_ZERO)) {
+		pool_zeroElement(pool, anElement);
+	}
+	if (POOL_THREAD_CACHE_SIZE == cache->count) {
+		pool_returnCachedElements(cache, POOL_THREAD_CACHE_BATCH);
+	}
+	cache->elements[cache->count] = anElement;
+	cache->count += 1;
+}
+
+/**
+ * Return all elements held by a thread cache to the pool. Call this before
+ * the owning thread exits and before the pool is walked, cleared or killed.
+ *
+ * @param[in] cache
+ *
+ * @return none
+ */
+void
+pool_threadCacheFlush(J9PoolThreadCache *cache)
+{
+	if (0 != cache->count) {
+		pool_returnCachedElements(cache, cache->count);
+	}
+	cache->affinityPuddle = NULL;
+}